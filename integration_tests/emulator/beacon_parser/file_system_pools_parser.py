@@ -0,0 +1,13 @@
+from emulator.beacon_parser.units import BoolType
+from parser import CategoryParser
+
+
+class FileSystemPoolsParser(CategoryParser):
+    def __init__(self, reader, store):
+        CategoryParser.__init__(self, '26: File System Pools', reader, store)
+
+    def get_bit_count(self):
+        return 1
+
+    def parse(self):
+        self.append("Pools Exhausted", 1, value_type=BoolType)
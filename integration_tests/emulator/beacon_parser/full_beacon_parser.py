@@ -22,6 +22,8 @@ from imtq_self_test_telemetry_parser import ImtqSelfTestTelemetryParser
 from imtq_state_telemetry_parser import ImtqStateTelemetryParser
 from imtq_temperature_telemetry_parser import ImtqTemperatureTelemetryParser
 from system_parser import SystemParser
+from idle_time_parser import IdleTimeParser
+from file_system_pools_parser import FileSystemPoolsParser
 
 
 class FullBeaconParser:
@@ -49,4 +51,6 @@ class FullBeaconParser:
                 ImtqCoilsTelemetryParser(reader, store),
                 ImtqTemperatureTelemetryParser(reader, store),
                 ImtqStateTelemetryParser(reader, store),
-                ImtqSelfTestTelemetryParser(reader, store)]
+                ImtqSelfTestTelemetryParser(reader, store),
+                IdleTimeParser(reader, store),
+                FileSystemPoolsParser(reader, store)]
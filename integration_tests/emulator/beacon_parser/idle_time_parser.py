@@ -0,0 +1,12 @@
+from parser import CategoryParser
+
+
+class IdleTimeParser(CategoryParser):
+    def __init__(self, reader, store):
+        CategoryParser.__init__(self, '25: Idle Time', reader, store)
+
+    def get_bit_count(self):
+        return 7
+
+    def parse(self):
+        self.append("Idle time", 7)
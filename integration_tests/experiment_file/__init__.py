@@ -10,6 +10,7 @@ from imtq import Magnetometer, Dipoles
 from camera import CameraSyncCount
 from payload import PayloadWhoAmI, PayloadObcTelemetry, PayloadHousekeeping
 from radfet import RadFET
+from delta import Delta, resolve_deltas
 
 pids = Synchronization \
        ^ Timestamp \
@@ -29,11 +30,13 @@ pids = Synchronization \
        ^ PayloadWhoAmI \
        ^ PayloadObcTelemetry \
        ^ PayloadHousekeeping \
-       ^ RadFET
+       ^ RadFET \
+       ^ Delta
 
 
 ExperimentFileParser = many(pids)
 
 __all__ = [
-    'ExperimentFileParser'
+    'ExperimentFileParser',
+    'resolve_deltas'
 ]
@@ -0,0 +1,76 @@
+from parsec import Parser, Value, count
+
+from base import label_as
+from parsing import byte
+
+DELTA_FLAG = 0x80
+
+DELTA_NAMES = {
+    0x10: 'Gyro',
+    0x19: 'Magnetometer',
+    0x20: 'Dipoles',
+}
+
+
+@Parser
+def delta_pid(text, index=0):
+    if index < len(text) and 0x10 | DELTA_FLAG <= ord(text[index]) < 0xFE:
+        return Value.success(index + 1, ord(text[index]) & ~DELTA_FLAG)
+    else:
+        return Value.failure(index, 'Delta PID')
+
+
+@Parser
+def zigzag_varint(text, index=0):
+    value = 0
+    shift = 0
+    while index < len(text) and shift < 35:
+        b = ord(text[index])
+        index += 1
+        value |= (b & 0x7F) << shift
+        shift += 7
+        if b & 0x80 == 0:
+            return Value.success(index, (value >> 1) ^ -(value & 1))
+
+    return Value.failure(index, 'Zig-zag varint')
+
+
+def delta_record(base_pid):
+    return byte.bind(lambda n: count(zigzag_varint, n)).parsecmap(lambda deltas: (base_pid, deltas))
+
+
+Delta = delta_pid.bind(delta_record)
+Delta >>= label_as('Delta')
+
+
+def to_int32(value):
+    value &= 0xFFFFFFFF
+    return value - 0x100000000 if value & 0x80000000 else value
+
+
+def resolve_deltas(items):
+    """Replaces delta records with absolute samples. References are reset at every packet start."""
+    previous = {}
+    result = []
+
+    for item in items:
+        if item == 'Synchronization':
+            previous = {}
+            result.append(item)
+            continue
+
+        if not isinstance(item, dict) or 'Delta' not in item:
+            result.append(item)
+            continue
+
+        (pid, deltas) = item['Delta']
+        reference = previous.get(pid)
+        if reference is None or len(reference) != len(deltas):
+            reference = [0] * len(deltas)
+
+        values = [to_int32(r + d) for (r, d) in zip(reference, deltas)]
+        previous[pid] = values
+
+        result.append({DELTA_NAMES.get(pid, 'PID {:02X}'.format(pid)): values})
+
+    return result
@@ -0,0 +1,96 @@
+# LZSS codec matching libs/base/Include/base/lzss.hpp
+DISTANCE_BITS = 10
+WINDOW_SIZE = 1 << DISTANCE_BITS
+MIN_MATCH = 3
+MAX_MATCH = MIN_MATCH + (1 << (16 - DISTANCE_BITS)) - 1
+MAX_CANDIDATES = 64
+
+
+def _find_match(data, position, chains):
+    key = bytes(data[position:position + MIN_MATCH])
+    best_length = 0
+    best_distance = 0
+
+    for candidate in reversed(chains.get(key, [])[-MAX_CANDIDATES:]):
+        distance = position - candidate
+        if distance > WINDOW_SIZE:
+            break
+
+        length = 0
+        limit = min(MAX_MATCH, len(data) - position)
+        while length < limit and data[candidate + length] == data[position + length]:
+            length += 1
+
+        if length > best_length:
+            best_length = length
+            best_distance = distance
+
+            if length == limit:
+                break
+
+    return best_length, best_distance
+
+
+def compress(data):
+    data = bytearray(data)
+    output = bytearray()
+    chains = {}
+
+    position = 0
+    while position < len(data):
+        flags_index = len(output)
+        output.append(0)
+
+        for bit in range(0, 8):
+            if position >= len(data):
+                break
+
+            length, distance = 0, 0
+            if position + MIN_MATCH <= len(data):
+                length, distance = _find_match(data, position, chains)
+
+            if length >= MIN_MATCH:
+                reference = (distance - 1) | ((length - MIN_MATCH) << DISTANCE_BITS)
+                output.append(reference & 0xFF)
+                output.append(reference >> 8)
+                step = length
+            else:
+                output[flags_index] |= 1 << bit
+                output.append(data[position])
+                step = 1
+
+            for i in range(position, position + step):
+                chains.setdefault(bytes(data[i:i + MIN_MATCH]), []).append(i)
+
+            position += step
+
+    return output
+
+
+def decompress(data):
+    data = bytearray(data)
+    output = bytearray()
+
+    position = 0
+    while position < len(data):
+        flags = data[position]
+        position += 1
+
+        for bit in range(0, 8):
+            if position >= len(data):
+                break
+
+            if flags & (1 << bit):
+                output.append(data[position])
+                position += 1
+            else:
+                reference = data[position] | (data[position + 1] << 8)
+                position += 2
+
+                distance = (reference & (WINDOW_SIZE - 1)) + 1
+                length = (reference >> DISTANCE_BITS) + MIN_MATCH
+
+                for _ in range(0, length):
+                    output.append(output[-distance])
+
+    return output
@@ -24,6 +24,8 @@ from memory import *
 from file_system import *
 from comm import *
 from time import *
+from task_statistics import *
+from i2c_statistics import *
 
 frame_types = []
 frame_types += map(lambda t: t[1], inspect.getmembers(pong, predicate=inspect.isclass))
@@ -45,6 +47,8 @@ frame_types += map(lambda t: t[1], inspect.getmembers(file_system, predicate=ins
 frame_types += map(lambda t: t[1], inspect.getmembers(comm, predicate=inspect.isclass))
 frame_types += map(lambda t: t[1], inspect.getmembers(time, predicate=inspect.isclass))
 frame_types += map(lambda t: t[1], inspect.getmembers(stop_antenna_deployment, predicate=inspect.isclass))
+frame_types += map(lambda t: t[1], inspect.getmembers(task_statistics, predicate=inspect.isclass))
+frame_types += map(lambda t: t[1], inspect.getmembers(i2c_statistics, predicate=inspect.isclass))
 frame_types = filter(lambda t: issubclass(t, ResponseFrame) and t != ResponseFrame, frame_types)
 frame_types = reduce(lambda t, x: t + [x] if x not in t else t, frame_types, [])
 
@@ -1,7 +1,7 @@
 import struct
 
-from response_frames import response_frame
-from response_frames.common import DownlinkApid, GenericSuccessResponseFrame
+from response_frames import response_frame, ResponseFrame
+from response_frames.common import DownlinkApid, GenericSuccessResponseFrame, GenericErrorResponseFrame
 from utils import ensure_string
 
 
@@ -29,3 +29,47 @@ class FileListSuccessFrame(GenericSuccessResponseFrame):
         return "{}, #files: {}".format(
             super(FileListSuccessFrame, self).__repr__(),
             len(self.file_list))
+
+
+@response_frame(0x26)
+class FileListPageSuccessFrame(GenericSuccessResponseFrame):
+    def decode(self):
+        super(FileListPageSuccessFrame, self).decode()
+
+        self.more = self.response[0] != 0
+        self.file_list = []
+
+        raw = ensure_string(self.response[1:])
+
+        while len(raw) > 0:
+            (name, raw) = raw.split('\0', 1)
+
+            (size, mtime) = struct.unpack('<LL', raw[0:8])
+            raw = raw[8:]
+
+            self.file_list.append((name, size, mtime))
+
+    def __repr__(self):
+        return "{}, #files: {}, more: {}".format(
+            super(FileListPageSuccessFrame, self).__repr__(),
+            len(self.file_list),
+            self.more)
+
+
+@response_frame(0x26)
+class FileListPageErrorFrame(GenericErrorResponseFrame):
+    pass
+
+
+@response_frame(0x28)
+class FileSystemMaintenanceFrame(ResponseFrame):
+    @classmethod
+    def matches(cls, payload):
+        return len(payload) == 6
+
+    def decode(self):
+        (self.erased_reserve, self.worst_write_latency) = struct.unpack('<HL', ensure_string(self.payload()))
+
+    def __str__(self):
+        return 'File system maintenance (erased reserve {}, worst write latency {}ms)'.format(
+            self.erased_reserve, self.worst_write_latency)
@@ -0,0 +1,30 @@
+import struct
+
+from response_frames import response_frame, ResponseFrame
+
+
+@response_frame(0x25)
+class I2CStatisticsFrame(ResponseFrame):
+    @classmethod
+    def matches(cls, payload):
+        return len(payload) == 32
+
+    def decode(self):
+        raw = ''.join(map(chr, self.payload()))
+
+        def bus(offset):
+            (transfers, failures, total_latency, max_latency) = struct.unpack('<LLLH', raw[offset:offset + 14])
+            return {
+                'transfers': transfers,
+                'failures': failures,
+                'total_latency': total_latency,
+                'max_latency': max_latency
+            }
+
+        self.system = bus(0)
+        self.payload_bus = bus(14)
+        (self.rerouted,) = struct.unpack('<L', raw[28:32])
+
+    def __str__(self):
+        return 'I2C statistics (system {} failures, payload {} failures, {} rerouted)'.format(
+            self.system['failures'], self.payload_bus['failures'], self.rerouted)
@@ -1,3 +1,7 @@
+import struct
+
+import lzss
+from crc import calc_crc
 from response_frames import response_frame, ResponseFrame
 
 
@@ -14,3 +18,21 @@ class MemoryContent(ResponseFrame):
     def __str__(self):
         return 'Memory content (Correlation {}, Seq: {})'.format(self.correlation_id, self.seq())
 
+
+@response_frame(0x27)
+class MemoryContentCompressed(ResponseFrame):
+    @classmethod
+    def matches(cls, payload):
+        return True
+
+    def decode(self):
+        raw = ''.join(map(chr, self.payload()))
+
+        self.correlation_id = self.payload()[0]
+        (self.offset, size, self.crc) = struct.unpack('<LHH', raw[1:9])
+        self.content = lzss.decompress(self.payload()[9:])
+        self.valid = len(self.content) == size and calc_crc(self.content) == self.crc
+
+    def __str__(self):
+        return 'Compressed memory content (Correlation {}, Seq: {}, Offset: 0x{:X}, Size: {}, Valid: {})'.format(
+            self.correlation_id, self.seq(), self.offset, len(self.content), self.valid)
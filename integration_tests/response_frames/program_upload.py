@@ -34,6 +34,36 @@ class EntryFinalizeSuccess(ResponseFrame):
         (_, _, self.entries, self.crc) = struct.unpack('<BBBH', ensure_string(self.payload()))
 
 
+@response_frame(0x04)
+class EntryCompressedPartWriteSuccess(ResponseFrame):
+    @classmethod
+    def matches(cls, payload):
+        return len(payload) == 11 and payload[0:2] == [3, 0]
+
+    def decode(self):
+        (_, _, self.entries, self.stream_offset, self.program_length) = struct.unpack('<BBBII', ensure_string(self.payload()))
+
+
+@response_frame(0x04)
+class EntryCompressedPartOutOfSequence(ResponseFrame):
+    @classmethod
+    def matches(cls, payload):
+        return len(payload) == 7 and payload[0:2] == [3, 30]
+
+    def decode(self):
+        (_, _, self.entries, self.stream_offset) = struct.unpack('<BBBI', ensure_string(self.payload()))
+
+
+@response_frame(0x04)
+class EntryPatchBeginSuccess(ResponseFrame):
+    @classmethod
+    def matches(cls, payload):
+        return len(payload) == 5 and payload[0:2] == [4, 0]
+
+    def decode(self):
+        (_, _, self.entries, self.source_crc) = struct.unpack('<BBBH', ensure_string(self.payload()))
+
+
 @response_frame(0x1D)
 class CopyBootSlots(ResponseFrame):
     @classmethod
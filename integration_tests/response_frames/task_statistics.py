@@ -0,0 +1,33 @@
+import struct
+
+from response_frames import response_frame, ResponseFrame
+
+
+@response_frame(0x24)
+class TaskStatisticsFrame(ResponseFrame):
+    @classmethod
+    def matches(cls, payload):
+        return len(payload) >= 3
+
+    def decode(self):
+        raw = ''.join(map(chr, self.payload()))
+
+        (idle, count) = struct.unpack('<HB', raw[0:3])
+        self.idle = idle / 10.0
+        self.tasks = []
+
+        position = 3
+        for i in xrange(0, count):
+            (load, stack) = struct.unpack('<HH', raw[position:position + 4])
+            end = raw.index('\0', position + 4)
+
+            self.tasks.append({
+                'name': raw[position + 4:end],
+                'load': load / 10.0,
+                'stack': stack
+            })
+
+            position = end + 1
+
+    def __str__(self):
+        return 'Task statistics (idle {}%, {} tasks)'.format(self.idle, len(self.tasks))
@@ -0,0 +1,105 @@
+# run with %run -i scripts/upload_software_compressed.py file slot_1 slot_2 slot_3 description
+import sys
+from Queue import Empty
+
+from time import time
+
+import lzss
+from crc import pad, calc_crc
+from response_frames.program_upload import EntryEraseSuccessFrame, EntryCompressedPartWriteSuccess, \
+    EntryCompressedPartOutOfSequence, EntryFinalizeSuccess
+from telecommand import WriteCompressedProgramPart, EraseBootTableEntry, FinalizeProgramEntry
+
+MAX_RETRIES = 5
+
+
+def wait_for_frame(expected_types, timeout):
+    start_time = time()
+    timeout_at = start_time + timeout
+
+    while time() < timeout_at:
+        try:
+            frame = system.comm.get_frame(1)
+
+            if type(frame) in expected_types:
+                return frame
+
+            print 'Ignoring {}'.format(frame)
+        except Empty:
+            pass
+
+    return None
+
+
+file = sys.argv[1]
+slots = [int(sys.argv[2]), int(sys.argv[3]), int(sys.argv[4])]
+description = sys.argv[5]
+
+with open(file, 'rb') as f:
+    program_data = f.read()
+
+program_data = pad(program_data, multiply_of=128, pad_with=0x1A)
+crc = calc_crc(program_data)
+length = len(program_data)
+stream = lzss.compress(program_data)
+
+print 'Will upload {} bytes of program (CRC: {:4X}) compressed to {} bytes into slots {}'.format(
+    length,
+    crc,
+    len(stream),
+    slots
+)
+
+print 'Erasing boot slots'
+system.comm.put_frame(EraseBootTableEntry(slots))
+
+response = wait_for_frame([EntryEraseSuccessFrame], 40)
+if response is None:
+    print 'Failed to erase'
+    sys.exit(1)
+print 'Boot slots erased'
+
+print 'Uploading program'
+stream_offset = 0
+retries = 0
+
+while stream_offset < len(stream):
+    part = stream[stream_offset:stream_offset + WriteCompressedProgramPart.MAX_PART_SIZE]
+    system.comm.put_frame(WriteCompressedProgramPart(entries=slots, stream_offset=stream_offset, content=part))
+
+    response = wait_for_frame([EntryCompressedPartWriteSuccess, EntryCompressedPartOutOfSequence], 120)
+
+    if response is None:
+        retries += 1
+        if retries > MAX_RETRIES:
+            print 'Failed to program'
+            sys.exit(2)
+
+        print 'No response, resending part at {}'.format(stream_offset)
+        continue
+
+    retries = 0
+
+    if type(response) is EntryCompressedPartOutOfSequence:
+        print 'Resuming from stream offset {} (was {})'.format(response.stream_offset, stream_offset)
+
+    stream_offset = response.stream_offset
+    print '{}/{} ({:.1f}%)'.format(stream_offset, len(stream), 100.0 * stream_offset / len(stream))
+
+print 'Upload finished'
+
+print 'Finalizing'
+system.comm.put_frame(FinalizeProgramEntry(slots, length, crc, description))
+
+response = wait_for_frame([EntryFinalizeSuccess], 40)
+
+if response is None:
+    print 'Failed to finalize'
+    sys.exit(3)
+
+print 'Uploaded {} bytes of program (CRC: {:4X}) compressed to {} bytes into slots {}'.format(
+    length,
+    crc,
+    len(stream),
+    slots
+)
@@ -19,6 +19,7 @@ from eps import *
 from adcs import *
 from memory import *
 from ping import *
+from task_statistics import *
 
 __all__ = [
     'DownloadFile',
@@ -31,6 +32,8 @@ __all__ = [
     'WriteProgramPart',
     'FinalizeProgramEntry',
     'ListFiles',
+    'ListFilesPage',
+    'GetFileSystemMaintenance',
     'SetBootSlots',
     'SendBeacon',
     'PowerCycleTelecommand',
@@ -42,6 +45,7 @@ __all__ = [
     'SetAntennaDeployment',
     'EraseFlash',
     'RawI2C',
+    'GetI2CStatistics',
     'GetSunSDataSets',
     'PerformSailExperiment',
     'TakePhotoTelecommand',
@@ -62,7 +66,9 @@ __all__ = [
     'PerformCameraCommissioningExperiment',
     'StopSailDeployment',
     'ReadMemory',
+    'ReadMemoryCompressed',
     'PingTelecommand',
+    'GetTaskStatistics',
     'CorrelatedTelecommand'
 ]
 
@@ -9,12 +9,14 @@ class PerformDetumblingExperiment(CorrelatedTelecommand):
         return 0x0D
 
     def payload(self):
-        return struct.pack('<BLB', self._correlation_id, self._duration.total_seconds(), self.sampling_interval.total_seconds())
+        return struct.pack('<BLBB', self._correlation_id, self._duration.total_seconds(), self.sampling_interval.total_seconds(),
+                           1 if self._delta_records else 0)
 
-    def __init__(self, correlation_id, duration, sampling_interval):
+    def __init__(self, correlation_id, duration, sampling_interval, delta_records=False):
         super(PerformDetumblingExperiment, self).__init__(correlation_id)
         self.sampling_interval = sampling_interval
         self._duration = duration
+        self._delta_records = delta_records
 
 
 class AbortExperiment(CorrelatedTelecommand):
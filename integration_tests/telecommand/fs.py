@@ -59,6 +59,31 @@ class ListFiles(CorrelatedTelecommand):
             self._path)
 
 
+class ListFilesPage(CorrelatedTelecommand):
+    def __init__(self, correlation_id, path, prefix='', start_after='', max_entries=0):
+        super(ListFilesPage, self).__init__(correlation_id)
+        self._path = path
+        self._prefix = prefix
+        self._start_after = start_after
+        self._max_entries = max_entries
+
+    def apid(self):
+        return 0x11
+
+    def payload(self):
+        return [self._correlation_id, self._max_entries] + \
+               list(self._path) + [0x0] + \
+               list(self._prefix) + [0x0] + \
+               list(self._start_after) + [0x0]
+
+    def __repr__(self):
+        return "{}, path={}, prefix={}, start_after={}".format(
+            super(ListFilesPage, self).__repr__(),
+            self._path,
+            self._prefix,
+            self._start_after)
+
+
 class EraseFlash(CorrelatedTelecommand):
     def __init__(self, correlation_id):
         super(EraseFlash, self).__init__(correlation_id)
@@ -68,3 +93,14 @@ class EraseFlash(CorrelatedTelecommand):
 
     def payload(self):
         return [self._correlation_id]
+
+
+class GetFileSystemMaintenance(Telecommand):
+    def __init__(self):
+        Telecommand.__init__(self)
+
+    def apid(self):
+        return 0x2E
+
+    def payload(self):
+        return []
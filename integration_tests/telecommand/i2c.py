@@ -1,6 +1,6 @@
 import struct
 
-from telecommand.base import CorrelatedTelecommand
+from telecommand.base import Telecommand, CorrelatedTelecommand
 from utils import ensure_byte_list
 
 
@@ -17,3 +17,14 @@ class RawI2C(CorrelatedTelecommand):
 
     def payload(self):
         return ensure_byte_list(struct.pack('<BBBH' + 'B' * len(self._data), self._correlation_id, self._busSelect, self._address, self._delay, *self._data))
+
+
+class GetI2CStatistics(Telecommand):
+    def __init__(self):
+        Telecommand.__init__(self)
+
+    def apid(self):
+        return 0x2B
+
+    def payload(self):
+        return []
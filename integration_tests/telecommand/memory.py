@@ -14,3 +14,16 @@ class ReadMemory(CorrelatedTelecommand):
 
     def payload(self):
         return struct.pack('<BII', self._correlation_id, self.offset, self.size)
+
+
+class ReadMemoryCompressed(CorrelatedTelecommand):
+    def __init__(self, correlation_id, offset, size):
+        super(ReadMemoryCompressed, self).__init__(correlation_id)
+        self.size = size
+        self.offset = offset
+
+    def apid(self):
+        return 0x2C
+
+    def payload(self):
+        return struct.pack('<BII', self._correlation_id, self.offset, self.size)
@@ -37,6 +37,43 @@ class WriteProgramPart(Telecommand):
         self._entries = entries
 
 
+class WriteCompressedProgramPart(Telecommand):
+    MAX_PART_SIZE = Telecommand.MAX_PAYLOAD_SIZE - 5
+
+    def apid(self):
+        return 0xB3
+
+    def payload(self):
+        mask = 0
+        for e in self._entries:
+            mask |= 1 << e
+
+        return list(struct.pack('<BI', mask, self._stream_offset)) + list(self._content)
+
+    def __init__(self, entries, stream_offset, content):
+        self._stream_offset = stream_offset
+        self._content = content
+        self._entries = entries
+
+
+class BeginProgramPatch(Telecommand):
+    def apid(self):
+        return 0xB4
+
+    def payload(self):
+        mask = 0
+        for e in self._entries:
+            mask |= 1 << e
+
+        return list(struct.pack('<BBIH', mask, self._source_entry, self._source_length, self._source_crc))
+
+    def __init__(self, entries, source_entry, source_length, source_crc):
+        self._entries = entries
+        self._source_entry = source_entry
+        self._source_length = source_length
+        self._source_crc = source_crc
+
+
 class FinalizeProgramEntry(Telecommand):
     def apid(self):
         return 0xB2
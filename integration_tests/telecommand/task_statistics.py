@@ -0,0 +1,12 @@
+from telecommand import Telecommand
+
+
+class GetTaskStatistics(Telecommand):
+    def __init__(self):
+        Telecommand.__init__(self)
+
+    def apid(self):
+        return 0x2A
+
+    def payload(self):
+        return []
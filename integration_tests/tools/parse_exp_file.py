@@ -5,10 +5,10 @@ from binascii import hexlify
 import pprint
 
 try:
-    from experiment_file import ExperimentFileParser
+    from experiment_file import ExperimentFileParser, resolve_deltas
 except ImportError:
     sys.path.append(os.path.join(os.path.dirname(__file__), '..'))
-    from experiment_file import ExperimentFileParser
+    from experiment_file import ExperimentFileParser, resolve_deltas
 
 
 def read_all(p):
@@ -34,7 +34,7 @@ print(result[0])
 
 with open(args.outfile, 'a') as f:
     print 'Parsed data:'
-    for p in result[0]:
+    for p in resolve_deltas(result[0]):
         pprint.pprint(p, f)
 
 if len(result[1]) > 0:
@@ -1,4 +1,5 @@
 #include "ExperimentalDetumbling.hpp"
+#include <algorithm>
 #include <chrono>
 #include "base/os.h"
 #include "logger/logger.h"
@@ -15,7 +16,14 @@ namespace adcs
     constexpr std::chrono::milliseconds ExperimentalDetumbling::ActuationTimeout;
 
     ExperimentalDetumbling::ExperimentalDetumbling(devices::imtq::IImtqDriver& imtqDriver_, services::power::IPowerControl& powerControl_)
-        : imtqDriver(imtqDriver_), powerControl(powerControl_), syncSemaphore(System::CreateBinarySemaphore()), tryToFixIsisErrors(false)
+        : imtqDriver(imtqDriver_),                         //
+          powerControl(powerControl_),                     //
+          syncSemaphore(System::CreateBinarySemaphore()),  //
+          tryToFixIsisErrors(false),                       //
+          iterationStartedAt(0),                           //
+          actuationStartedAt(0),                           //
+          actuating(false),                                //
+          statistics{}
     {
     }
 
@@ -45,7 +53,7 @@ namespace adcs
             return OSResult::IOError;
         }
 
-        DetumblingComputations::Parameters parameters;
+        DetumblingAlgorithm::Parameters parameters;
 
         for (auto& step : selfTestResult.stepResults)
         {
@@ -143,6 +151,13 @@ namespace adcs
             return OSResult::IOError;
         }
 
+        {
+            CriticalSection criticalSection;
+            this->statistics = DetumblingTimingStatistics{};
+        }
+
+        this->actuating = false;
+
         return OSResult::Success;
     }
 
@@ -153,8 +168,25 @@ namespace adcs
 
     void ExperimentalDetumbling::Process()
     {
+        const auto actuationEnd = System::GetUptime();
+
+        devices::imtq::MagnetometerMeasurementToken token;
+        if (!this->imtqDriver.BeginMagnetometerMeasurement(token))
+        {
+            LOG(LOG_LEVEL_ERROR, "Cannot start magnetometer measurement");
+            this->actuating = false;
+            return;
+        }
+
+        // Coils stay off until the new dipole is known, so only work done after integration delays actuation. Everything that
+        // could move here (bookkeeping and the decay term of the b-dot filter) takes microseconds out of the 200ms period,
+        // which is below the permille resolution of the duty cycle, so no duty cycle gain is reported.
+        CompleteIteration(actuationEnd);
+
+        this->iterationStartedAt = actuationEnd;
+
         Vector3<MagnetometerMeasurement> magnetometerMeasurement;
-        if (!this->imtqDriver.MeasureMagnetometer(magnetometerMeasurement))
+        if (!this->imtqDriver.EndMagnetometerMeasurement(token, magnetometerMeasurement))
         {
             LOG(LOG_LEVEL_ERROR, "Cannot get magnetometer measurement");
             return;
@@ -169,6 +201,42 @@ namespace adcs
             LOG(LOG_LEVEL_ERROR, "Cannot start actuation dipole");
             return;
         }
+
+        this->actuationStartedAt = System::GetUptime();
+        this->actuating = true;
+    }
+
+    void ExperimentalDetumbling::CompleteIteration(std::chrono::milliseconds actuationEnd)
+    {
+        if (!this->actuating)
+        {
+            return;
+        }
+
+        this->actuating = false;
+
+        const auto actuationTime = std::min(actuationEnd - this->actuationStartedAt, ExperimentalDetumbling::ActuationTimeout);
+        const auto idleTime = this->actuationStartedAt - this->iterationStartedAt;
+        const auto iterationTime = actuationTime + idleTime;
+
+        // statistics are modified only by this task, lock is needed only to publish consistent snapshot
+        auto current = this->statistics;
+        current.Iterations++;
+        current.ActuationTime = actuationTime;
+        current.IdleTime = idleTime;
+        if (iterationTime > std::chrono::milliseconds::zero())
+        {
+            current.DutyCycle = static_cast<std::uint16_t>(actuationTime.count() * 1000 / iterationTime.count());
+        }
+
+        CriticalSection criticalSection;
+        this->statistics = current;
+    }
+
+    DetumblingTimingStatistics ExperimentalDetumbling::GetTimingStatistics() const
+    {
+        CriticalSection criticalSection;
+        return this->statistics;
     }
 
     std::chrono::milliseconds ExperimentalDetumbling::GetWait() const
@@ -0,0 +1,90 @@
+#include <FixedPointDetumblingComputations.hpp>
+#include <em_device.h>
+#include <algorithm>
+#include <arm_math.h>
+#include <cmath>
+
+using std::int32_t;
+using std::int64_t;
+
+using namespace adcs;
+
+constexpr std::uint8_t FixedPointDetumblingComputations::DerivativeFractionalBits;
+constexpr std::int32_t FixedPointDetumblingComputations::MaxField;
+constexpr std::int32_t FixedPointDetumblingComputations::ToleranceAbsolute;
+constexpr std::int32_t FixedPointDetumblingComputations::TolerancePermille;
+constexpr std::int32_t FixedPointDetumblingComputations::ToleranceMinField;
+
+/** @brief Rounds value to nearest integer and saturates it to 32 bits */
+static q31_t RoundWithSaturation(double value)
+{
+    return clip_q63_to_q31(static_cast<q63_t>(value + (value < 0 ? -0.5 : 0.5)));
+}
+
+/** @brief Converts value in range [-1, 1) to Q31 with saturation */
+static q31_t ToQ31(float value)
+{
+    return RoundWithSaturation(static_cast<double>(value) * 2147483648.0);
+}
+
+FixedPointDetumblingComputations::State::State(const Parameters& p) : mtmDotPrev{{0, 0, 0}}, mtmMeasPrev{{0, 0, 0}}, coilsOn(p.coilsOn)
+{
+}
+
+FixedPointDetumblingComputations::FixedPointDetumblingComputations() : mtmDotExp(0), wCutOff(0), bDotGain(0)
+{
+}
+
+FixedPointDetumblingComputations::State FixedPointDetumblingComputations::initialize(const Parameters& param, const MagVec& /*mgmt_meas*/)
+{
+    mtmDotExp = ToQ31(std::exp(-param.wCutOff * param.dt));
+    wCutOff = ToQ31(param.wCutOff);
+    bDotGain = RoundWithSaturation(param.bDotGain);
+
+    // previous measurement starts zeroed exactly as in DetumblingComputations so both implementations stay in lockstep
+    return State(param);
+}
+
+DipoleVec FixedPointDetumblingComputations::step(const MagVec& mgmt_meas, State& state)
+{
+    std::array<int32_t, 3> field;
+    std::array<int32_t, 3> mtmDot;
+    int64_t normSquared = 0;
+
+    for (unsigned int i = 0; i < field.size(); i++)
+    {
+        field[i] = std::max(-MaxField, std::min(static_cast<int32_t>(mgmt_meas[i]), MaxField));
+
+        // magnetic field time derivative: Q31 * Q23.8 products accumulated in Q54.39, rounded back to Q23.8
+        const int64_t delta = static_cast<int64_t>(field[i] - state.mtmMeasPrev[i]) << DerivativeFractionalBits;
+        const int64_t accumulator = static_cast<int64_t>(mtmDotExp) * state.mtmDotPrev[i] + static_cast<int64_t>(wCutOff) * delta;
+        mtmDot[i] = clip_q63_to_q31((accumulator + (static_cast<int64_t>(1) << 30)) >> 31);
+
+        normSquared += static_cast<int64_t>(field[i]) * field[i];
+    }
+
+    DipoleVec dipole{{0, 0, 0}};
+
+    // commanded magnetic dipole to coils, division truncates towards zero as float to integer cast does
+    if (normSquared != 0)
+    {
+        const int64_t denominator = normSquared << DerivativeFractionalBits;
+
+        for (unsigned int i = 0; i < dipole.size(); i++)
+        {
+            if (!state.coilsOn[i])
+            {
+                continue;
+            }
+
+            const int64_t numerator = -static_cast<int64_t>(bDotGain) * mtmDot[i];
+            dipole[i] = static_cast<Dipole>(__SSAT(clip_q63_to_q31(numerator / denominator), 16));
+        }
+    }
+
+    // store prev values
+    state.mtmDotPrev = mtmDot;
+    state.mtmMeasPrev = field;
+
+    return dipole;
+}
@@ -1,7 +1,10 @@
 #ifndef LIBS_ADCS_EXPERIMENTAL_ADCS_EXPERIMENTAL_DETUMBLING_HPP
 #define LIBS_ADCS_EXPERIMENTAL_ADCS_EXPERIMENTAL_DETUMBLING_HPP
 
+#include <chrono>
+#include <cstdint>
 #include "DetumblingComputations.hpp"
+#include "FixedPointDetumblingComputations.hpp"
 #include "adcs/adcs.hpp"
 #include "base/hertz.hpp"
 #include "imtq/imtq.h"
@@ -9,6 +12,32 @@
 
 namespace adcs
 {
+#ifdef ADCS_FIXED_POINT_DETUMBLING
+    /** @brief Detumbling computations implementation selected at build time (ADCS_FIXED_POINT_DETUMBLING option). */
+    using DetumblingAlgorithm = FixedPointDetumblingComputations;
+#else
+    /** @brief Detumbling computations implementation selected at build time (ADCS_FIXED_POINT_DETUMBLING option). */
+    using DetumblingAlgorithm = DetumblingComputations;
+#endif
+
+    /**
+     * @brief Timing statistics of experimental detumbling control loop.
+     *
+     * Single iteration spans from cancelling actuation in order to measure magnetic field
+     * till the same point in the next iteration.
+     */
+    struct DetumblingTimingStatistics
+    {
+        /** @brief Number of completed iterations */
+        std::uint32_t Iterations;
+        /** @brief Time coils were actuated during last iteration */
+        std::chrono::milliseconds ActuationTime;
+        /** @brief Time coils were off during last iteration (field decay, integration, computations) */
+        std::chrono::milliseconds IdleTime;
+        /** @brief Actuation duty cycle of last iteration in permille */
+        std::uint16_t DutyCycle;
+    };
+
     /**
      * @brief Experimental detumbling.
      */
@@ -40,6 +69,12 @@ namespace adcs
 
         virtual std::chrono::milliseconds GetWait() const override final;
 
+        /**
+         * @brief Returns control loop timing statistics.
+         * @return Timing statistics.
+         */
+        DetumblingTimingStatistics GetTimingStatistics() const;
+
         /** @brief Algorithm refresh frequency. */
         static constexpr chrono_extensions::hertz Frequency = chrono_extensions::hertz{1.0 / DetumblingComputations::Parameters::dt};
 
@@ -49,11 +84,17 @@ namespace adcs
       private:
         OSResult PerformSelfTest();
 
+        /**
+         * @brief Closes timing statistics of previous iteration.
+         * @param[in] actuationEnd Time at which actuation started in previous iteration has been cancelled.
+         */
+        void CompleteIteration(std::chrono::milliseconds actuationEnd);
+
         /** @brief Detumbling computations algorithm. */
-        DetumblingComputations detumblingComputations;
+        DetumblingAlgorithm detumblingComputations;
 
         /** @brief Detumbling algorithm state. */
-        DetumblingComputations::State detumblingState;
+        DetumblingAlgorithm::State detumblingState;
 
         /** @brief Low level imtq module driver. */
         devices::imtq::IImtqDriver& imtqDriver;
@@ -64,6 +105,18 @@ namespace adcs
 
         /** @brief Whether to enable the alternative self-test algorithm. */
         bool tryToFixIsisErrors;
+
+        /** @brief Time at which current iteration started. */
+        std::chrono::milliseconds iterationStartedAt;
+
+        /** @brief Time at which coils actuation started in current iteration. */
+        std::chrono::milliseconds actuationStartedAt;
+
+        /** @brief true if coils are being actuated by this algorithm. */
+        bool actuating;
+
+        /** @brief Control loop timing statistics. */
+        DetumblingTimingStatistics statistics;
     };
 }
 
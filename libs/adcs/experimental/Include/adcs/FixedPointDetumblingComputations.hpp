@@ -0,0 +1,119 @@
+#ifndef ADCS_FIXED_POINT_DETUMBLING_HPP_
+#define ADCS_FIXED_POINT_DETUMBLING_HPP_
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include "DetumblingComputations.hpp"
+#include "InterfaceTypes.hpp"
+
+namespace adcs
+{
+    /**
+     * @defgroup adcs_detumbling_fixed_point Fixed-point implementation of detumbling algorithm
+     *
+     * @{
+     */
+
+    /**
+     * @brief Fixed-point implementation of detumbling algorithm
+     *
+     * Computes the same B-Dot control law with high-pass filtered field derivative as @ref DetumblingComputations
+     * using integer arithmetic only, as Cortex-M3 has no FPU and every float operation is a library call.
+     *
+     * Number formats:
+     *  - filter coefficients (exp(-wCutOff * dt) and wCutOff) are Q31 (so wCutOff has to be lower than 1 rad/s),
+     *  - magnetic field is integer [1e-9 T] saturated to +/- @ref MaxField,
+     *  - filtered field derivative is Q23.8 [1e-9 T],
+     *  - B-dot gain is rounded to integer.
+     *
+     * Floating point is used only in @ref initialize to convert parameters.
+     *
+     * Tolerance: for field magnitude not lower than @ref ToleranceMinField each commanded dipole differs from
+     * @ref DetumblingComputations result by at most max(@ref ToleranceAbsolute, |reference| * @ref TolerancePermille / 1000).
+     * Both implementations saturate to the same range and truncate towards zero.
+     */
+    class FixedPointDetumblingComputations final
+    {
+      public:
+        /** @brief Set of detumbling algorithm parameters (shared with floating point implementation) */
+        using Parameters = DetumblingComputations::Parameters;
+
+        /** @brief Number of fractional bits of filtered field derivative */
+        static constexpr std::uint8_t DerivativeFractionalBits = 8;
+
+        /** @brief Magnitude at which single field component is saturated [1e-9 T] */
+        static constexpr std::int32_t MaxField = 1 << 22;
+
+        /** @brief Absolute tolerance of commanded dipole [1e-4 Am2] */
+        static constexpr std::int32_t ToleranceAbsolute = 2;
+
+        /** @brief Relative tolerance of commanded dipole [permille] */
+        static constexpr std::int32_t TolerancePermille = 5;
+
+        /** @brief Field magnitude above which tolerance is guaranteed [1e-9 T] */
+        static constexpr std::int32_t ToleranceMinField = 10000;
+
+        /**
+         * @brief State of detumbling algorithm
+         */
+        class State final
+        {
+          public:
+            State() = default;
+
+            /**
+             * @brief ctor.
+             * @param p Reference to detumbling algorithm parameters.
+             */
+            State(const Parameters& p);
+
+            /** @brief Value of filtered magnetic field derivative preserved from previous step (Q23.8) */
+            std::array<std::int32_t, 3> mtmDotPrev;
+
+            /** @brief Value of magnetometer measurement preserved from previous step */
+            std::array<std::int32_t, 3> mtmMeasPrev;
+
+            /** @brief State of flags enabling coils */
+            std::array<bool, 3> coilsOn;
+        };
+
+        FixedPointDetumblingComputations();
+
+        /**
+         * @brief Detumbling algorithm initialization function
+         *
+         * This function should be called before first step of algorithm
+         * and every time user intend to change parameters
+         *
+         * @param[in] parameters parameters set
+         * @param[in] mgmt_meas initial mtm measurement
+         * @return state container
+         */
+        State initialize(const Parameters& parameters, const MagVec& mgmt_meas);
+
+        /**
+         * @brief Detumbling step function
+         *
+         * @param[in] magnetometer measurement \[1e-9 T\]
+         * @param[in,out] state container
+         * @return values to be comanded to dipoles [1e-4 Am2]
+         */
+        DipoleVec step(const MagVec& magnetometer, State& state);
+
+      private:
+        /** @brief exp(-wCutOff * dt) in Q31 */
+        std::int32_t mtmDotExp;
+
+        /** @brief High-pass filter cut off frequency in Q31 */
+        std::int32_t wCutOff;
+
+        /** @brief B-dot gain */
+        std::int32_t bDotGain;
+    };
+
+    /** @} */
+}
+
+#endif /* ADCS_FIXED_POINT_DETUMBLING_HPP_ */
@@ -0,0 +1,174 @@
+#ifndef LIBS_BASE_INCLUDE_BASE_BLOCK_POOL_HPP_
+#define LIBS_BASE_INCLUDE_BASE_BLOCK_POOL_HPP_
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+/**
+ * @defgroup block_pool Fixed-size block pool
+ * @ingroup utilities
+ *
+ * @{
+ */
+
+/**
+ * @brief Usage statistics of single block pool
+ */
+struct BlockPoolStatistics
+{
+    /** @brief Total number of blocks in pool */
+    std::uint16_t Capacity;
+    /** @brief Number of currently allocated blocks */
+    std::uint16_t InUse;
+    /** @brief Largest number of blocks allocated at the same time */
+    std::uint16_t HighWaterMark;
+    /** @brief Number of allocation requests that found pool empty */
+    std::uint32_t Exhaustions;
+};
+
+/**
+ * @brief Pool of fixed-size memory blocks with constant time allocation and release.
+ * @tparam BlockSize Size of single block in bytes
+ * @tparam BlockCount Number of blocks in pool
+ *
+ * Free blocks are linked into intrusive list, so pool does not need any memory besides block storage.
+ * Pool is not synchronized in any way, it is up to caller to serialize access to it.
+ */
+template <std::size_t BlockSize, std::size_t BlockCount> class BlockPool final
+{
+  public:
+    static_assert(BlockCount > 0, "Pool must contain at least one block");
+    static_assert(BlockCount <= std::numeric_limits<std::uint16_t>::max(), "Pool is too large");
+
+    /** @brief Size of single block */
+    static constexpr std::size_t Size = BlockSize;
+
+    /** @brief Number of blocks in pool */
+    static constexpr std::size_t Count = BlockCount;
+
+    /**
+     * @brief Ctor
+     */
+    BlockPool();
+
+    /**
+     * @brief Takes one block from pool
+     * @return Pointer to block or nullptr if pool is exhausted
+     */
+    void* Allocate();
+
+    /**
+     * @brief Returns block to pool
+     * @param[in] block Pointer previously returned by @ref Allocate
+     */
+    void Free(void* block);
+
+    /**
+     * @brief Checks if pointer points to block owned by this pool
+     * @param[in] pointer Pointer to check
+     * @return true if pointer belongs to this pool
+     */
+    bool Contains(const void* pointer) const;
+
+    /**
+     * @brief Returns usage statistics
+     * @return Pool statistics
+     */
+    BlockPoolStatistics Statistics() const;
+
+  private:
+    /** @brief Single block in pool */
+    union Block {
+        /** @brief Next free block (valid only when block is free) */
+        Block* Next;
+        /** @brief Block contents */
+        std::uint8_t Data[BlockSize];
+        /** @brief Member forcing 8-byte alignment of block contents */
+        std::uint64_t Alignment;
+    };
+
+    /** @brief Block storage */
+    Block _blocks[BlockCount];
+
+    /** @brief Head of free blocks list */
+    Block* _free;
+
+    /** @brief Number of currently allocated blocks */
+    std::uint16_t _inUse;
+
+    /** @brief Largest number of blocks allocated at the same time */
+    std::uint16_t _highWaterMark;
+
+    /** @brief Number of failed allocations */
+    std::uint32_t _exhaustions;
+};
+
+template <std::size_t BlockSize, std::size_t BlockCount>
+BlockPool<BlockSize, BlockCount>::BlockPool() : _free(_blocks), _inUse(0), _highWaterMark(0), _exhaustions(0)
+{
+    for (std::size_t i = 0; i < BlockCount - 1; i++)
+    {
+        this->_blocks[i].Next = &this->_blocks[i + 1];
+    }
+
+    this->_blocks[BlockCount - 1].Next = nullptr;
+}
+
+template <std::size_t BlockSize, std::size_t BlockCount> void* BlockPool<BlockSize, BlockCount>::Allocate()
+{
+    auto block = this->_free;
+    if (block == nullptr)
+    {
+        this->_exhaustions++;
+        return nullptr;
+    }
+
+    this->_free = block->Next;
+    this->_inUse++;
+
+    if (this->_inUse > this->_highWaterMark)
+    {
+        this->_highWaterMark = this->_inUse;
+    }
+
+    return block->Data;
+}
+
+template <std::size_t BlockSize, std::size_t BlockCount> void BlockPool<BlockSize, BlockCount>::Free(void* block)
+{
+    if (block == nullptr)
+    {
+        return;
+    }
+
+    auto b = static_cast<Block*>(block);
+    b->Next = this->_free;
+    this->_free = b;
+    this->_inUse--;
+}
+
+template <std::size_t BlockSize, std::size_t BlockCount> bool BlockPool<BlockSize, BlockCount>::Contains(const void* pointer) const
+{
+    auto p = static_cast<const std::uint8_t*>(pointer);
+    auto begin = reinterpret_cast<const std::uint8_t*>(this->_blocks);
+    auto end = begin + sizeof(this->_blocks);
+
+    return p >= begin && p < end;
+}
+
+template <std::size_t BlockSize, std::size_t BlockCount> BlockPoolStatistics BlockPool<BlockSize, BlockCount>::Statistics() const
+{
+    BlockPoolStatistics statistics;
+    statistics.Capacity = BlockCount;
+    statistics.InUse = this->_inUse;
+    statistics.HighWaterMark = this->_highWaterMark;
+    statistics.Exhaustions = this->_exhaustions;
+    return statistics;
+}
+
+/** @} */
+
+#endif /* LIBS_BASE_INCLUDE_BASE_BLOCK_POOL_HPP_ */
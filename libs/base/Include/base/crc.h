@@ -47,4 +47,12 @@ uint16_t CRC_calc(uint8_t* start, uint8_t* end);
  */
 uint16_t CRC_calc(gsl::span<const uint8_t> buffer);
 
+/**
+ * @brief Continues CRC calculation over next part of area
+ * @param buffer Span containing next part of area
+ * @param crc CRC of all preceding parts (0 for first part)
+ * @return CRC of all parts including this one
+ */
+uint16_t CRC_calc(gsl::span<const uint8_t> buffer, uint16_t crc);
+
 #endif
@@ -0,0 +1,153 @@
+#ifndef LIBS_BASE_INCLUDE_BASE_LZSS_HPP_
+#define LIBS_BASE_INCLUDE_BASE_LZSS_HPP_
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <gsl/span>
+
+namespace lzss
+{
+    /**
+     * @defgroup lzss LZSS compression
+     *
+     * Small footprint LZSS codec with bounded window.
+     *
+     * Compressed stream consists of groups. Each group starts with flags byte followed by up to 8 tokens.
+     * Bits of flags byte (starting from LSB) describe consecutive tokens:
+     *  - 1 - literal - single byte copied to output
+     *  - 0 - reference - two bytes (little endian):
+     *    - bits 0-9 - distance back in output minus 1 (1..@ref WindowSize)
+     *    - bits 10-15 - match length minus @ref MinMatchLength
+     *
+     * @{
+     */
+
+    /** @brief Number of bits used to encode reference distance */
+    static constexpr std::uint8_t DistanceBits = 10;
+
+    /** @brief Size of sliding window (maximal reference distance) */
+    static constexpr std::uint16_t WindowSize = 1 << DistanceBits;
+
+    /** @brief Shortest encoded match */
+    static constexpr std::uint8_t MinMatchLength = 3;
+
+    /** @brief Longest encoded match */
+    static constexpr std::uint8_t MaxMatchLength = MinMatchLength + (1 << (16 - DistanceBits)) - 1;
+
+    /**
+     * @brief Decoding status
+     */
+    enum class DecoderStatus
+    {
+        Ok,              //!< Stream decoded correctly so far
+        InvalidReference //!< Reference points before the beginning of the stream
+    };
+
+    /**
+     * @brief Streaming LZSS decoder
+     *
+     * Decoder keeps whole state (including partially received tokens and partially copied matches) between calls
+     * so compressed stream can be fed in arbitrarily sized parts and decoded into arbitrarily sized output buffers.
+     */
+    class Decoder final
+    {
+      public:
+        /**
+         * @brief Ctor
+         */
+        Decoder();
+
+        /**
+         * @brief Resets decoder to the beginning of new stream
+         */
+        void Reset();
+
+        /**
+         * @brief Decodes next part of stream
+         * @param input Compressed input
+         * @param output Buffer for decompressed data
+         * @param consumed Number of input bytes consumed
+         * @param produced Number of bytes written to output
+         * @return Decoding status
+         *
+         * Decoding stops when either whole input is consumed or output buffer is full.
+         */
+        DecoderStatus Decode(
+            gsl::span<const std::uint8_t> input, gsl::span<std::uint8_t> output, std::size_t& consumed, std::size_t& produced);
+
+        /**
+         * @brief Returns total number of bytes produced since last reset
+         * @return Number of decompressed bytes
+         */
+        inline std::uint32_t TotalProduced() const;
+
+        /**
+         * @brief Checks whether decoder is at token boundary (all received tokens are fully decoded)
+         * @return true if no token is partially processed
+         */
+        inline bool IsIdle() const;
+
+      private:
+        /** @brief Decoder state */
+        enum class State
+        {
+            Flags,          //!< Waiting for flags byte
+            Token,          //!< Waiting for literal or first byte of reference
+            ReferenceSecond //!< Waiting for second byte of reference
+        };
+
+        /**
+         * @brief Emits single byte to window and output
+         * @param value Byte value
+         * @param output Output buffer
+         * @param produced Number of bytes already written to output
+         */
+        void Emit(std::uint8_t value, gsl::span<std::uint8_t> output, std::size_t& produced);
+
+        /** @brief Current state */
+        State _state;
+        /** @brief Remaining flags (with sentinel bit marking end of group) */
+        std::uint16_t _flags;
+        /** @brief First byte of reference */
+        std::uint8_t _referenceLow;
+        /** @brief Distance of match being copied */
+        std::uint16_t _matchDistance;
+        /** @brief Number of bytes left to copy from match */
+        std::uint8_t _matchRemaining;
+        /** @brief Total number of decompressed bytes */
+        std::uint32_t _produced;
+        /** @brief Position in window to which next byte will be stored */
+        std::uint16_t _windowPosition;
+        /** @brief Sliding window */
+        std::array<std::uint8_t, WindowSize> _window;
+    };
+
+    std::uint32_t Decoder::TotalProduced() const
+    {
+        return this->_produced;
+    }
+
+    bool Decoder::IsIdle() const
+    {
+        return this->_matchRemaining == 0 && this->_state != State::ReferenceSecond;
+    }
+
+    /**
+     * @brief Compresses data into self-contained stream
+     * @param input Data to compress
+     * @param output Buffer for compressed stream
+     * @param consumed Number of input bytes represented by produced stream
+     * @return Number of bytes written to output
+     *
+     * Compression stops when whole input is consumed or when next token (with flags byte of its group) does not fit in output.
+     * References never point before the beginning of input, so produced stream can be decoded by freshly reset @ref Decoder.
+     * Encoder searches for matches directly in input, so it does not need any additional memory.
+     */
+    std::size_t Encode(gsl::span<const std::uint8_t> input, gsl::span<std::uint8_t> output, std::size_t& consumed);
+
+    /** @} */
+}
+
+#endif /* LIBS_BASE_INCLUDE_BASE_LZSS_HPP_ */
@@ -7,6 +7,7 @@
 #include <atomic>
 #include <chrono>
 #include <cstdint>
+#include <gsl/span>
 #include <type_traits>
 #include <utility>
 #include "system.h"
@@ -196,6 +197,23 @@ enum class TaskPriority
     Highest   //!< Highest
 };
 
+/**
+ * @brief Run time statistics of single task
+ */
+struct TaskRunTime
+{
+    /** @brief Task name */
+    const char* Name;
+    /** @brief Unique task number */
+    std::uint32_t Number;
+    /** @brief Time spent by task in running state (in run time counter units) */
+    std::uint32_t RunTime;
+    /** @brief Minimal amount of free stack space observed so far (in bytes) */
+    std::uint16_t StackHighWaterMark;
+    /** @brief Flag indicating that this is the idle task */
+    bool IsIdle;
+};
+
 /**
  * @brief Definition of operating system interface.
  */
@@ -226,6 +244,16 @@ class System final : public PureStatic
      */
     static void SleepTask(const std::chrono::milliseconds time);
 
+    /**
+     * @brief Suspends current task execution until system uptime reaches specified value.
+     * @param[in] time Uptime at which task should be resumed.
+     *
+     * Unlike @ref SleepTask the wake up time does not depend on time spent by the task before going to sleep,
+     * so waiting for consecutive multiples of period gives drift free periodic execution.
+     * If specified time has already passed the procedure returns immediately.
+     */
+    static void SleepUntil(const std::chrono::milliseconds time);
+
     /**
      * @brief Resumes execution of requested task.
      *
@@ -467,6 +495,16 @@ class System final : public PureStatic
      */
     static std::chrono::milliseconds GetUptime();
 
+    /**
+     * @brief Captures run time statistics of all tasks
+     * @param[out] tasks Buffer that will be filled with statistics of tasks
+     * @param[out] totalRunTime Value of run time counter at the moment of capture
+     * @return Number of captured tasks. Zero if statistics are unavailable.
+     *
+     * When there are more tasks than @p tasks can hold only part of them is captured, idle task is always among them.
+     */
+    static std::size_t GetTaskRunTimes(gsl::span<TaskRunTime> tasks, std::uint32_t& totalRunTime);
+
     /**
      * @brief Enters critical section
      */
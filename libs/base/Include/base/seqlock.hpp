@@ -0,0 +1,162 @@
+#ifndef LIBS_BASE_INCLUDE_BASE_SEQLOCK_HPP_
+#define LIBS_BASE_INCLUDE_BASE_SEQLOCK_HPP_
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <gsl/span>
+
+/**
+ * @defgroup seqlock Sequence-numbered double buffer
+ * @ingroup utilities
+ *
+ * @{
+ */
+
+/**
+ * @brief Double-buffered snapshot published by single writer and read by any number of readers without locking.
+ * @tparam Size Size of snapshot in bytes
+ *
+ * Writer always fills buffer that is not currently published and flips published buffer by bumping sequence number
+ * (odd while write is in progress, even when it is done). Reader takes sequence number, consumes published buffer
+ * in place and validates that the buffer was not reused by writer in the meantime. As buffers are alternated,
+ * reader is invalidated only if writer has started two publications during single read.
+ *
+ * Readers never block and never disable interrupts. Retry count is bounded by @ref MaxReadAttempts.
+ * Writer must not be preempted by another writer.
+ */
+template <std::size_t Size> class SeqLockBuffer final
+{
+  public:
+    /** @brief Size of snapshot */
+    static constexpr std::size_t Length = Size;
+
+    /** @brief Number of attempts taken by reader before giving up */
+    static constexpr std::uint8_t MaxReadAttempts = 3;
+
+    /**
+     * @brief Ctor
+     *
+     * Until first publication readers see snapshot filled with zeros.
+     */
+    SeqLockBuffer();
+
+    /**
+     * @brief Publishes new snapshot
+     * @param[in] data Snapshot contents. Data longer than snapshot is truncated, shorter is padded with zeros.
+     */
+    void Publish(gsl::span<const std::uint8_t> data);
+
+    /**
+     * @brief Passes consistent view of published snapshot to consumer
+     * @param[in] consumer Callable taking gsl::span<const std::uint8_t>.
+     * @return true if consumer has seen consistent snapshot, false if writer kept replacing it for @ref MaxReadAttempts reads.
+     * @remark Consumer can be invoked more than once and has to discard results of previous invocation on each call.
+     * Only results of the last invocation are valid and only if this method returns true.
+     */
+    template <typename Consumer> bool Read(Consumer&& consumer) const;
+
+    /**
+     * @brief Copies consistent snapshot into buffer
+     * @param[out] buffer Output buffer, at most @ref Length bytes are copied
+     * @return true on success, false if writer kept replacing snapshot for @ref MaxReadAttempts reads.
+     */
+    bool CopyTo(gsl::span<std::uint8_t> buffer) const;
+
+    /**
+     * @brief Returns publication sequence number
+     * @return Number incremented twice by each publication
+     * @remark Readers can compare sequence numbers to detect whether snapshot has changed since last read.
+     */
+    std::uint32_t Sequence() const;
+
+  private:
+    /**
+     * @brief Checks whether buffer used by read started at given sequence number could have been overwritten
+     * @param[in] start Sequence number taken before read
+     * @param[in] end Sequence number taken after read
+     * @return true if read is consistent
+     */
+    static constexpr bool IsConsistent(std::uint32_t start, std::uint32_t end);
+
+    /** @brief Publication sequence number */
+    std::atomic<std::uint32_t> _sequence;
+
+    /** @brief Snapshot buffers */
+    std::array<std::array<std::uint8_t, Size>, 2> _buffers;
+};
+
+template <std::size_t Size> constexpr std::size_t SeqLockBuffer<Size>::Length;
+
+template <std::size_t Size> constexpr std::uint8_t SeqLockBuffer<Size>::MaxReadAttempts;
+
+template <std::size_t Size> SeqLockBuffer<Size>::SeqLockBuffer() : _sequence(0)
+{
+    for (auto& buffer : this->_buffers)
+    {
+        buffer.fill(0);
+    }
+}
+
+template <std::size_t Size> void SeqLockBuffer<Size>::Publish(gsl::span<const std::uint8_t> data)
+{
+    const auto sequence = this->_sequence.load(std::memory_order_relaxed);
+    auto& target = this->_buffers[((sequence >> 1) + 1) & 1];
+
+    this->_sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    const auto length = std::min<std::size_t>(data.size(), Size);
+    std::memcpy(target.data(), data.data(), length);
+    std::memset(target.data() + length, 0, Size - length);
+
+    this->_sequence.store(sequence + 2, std::memory_order_release);
+}
+
+template <std::size_t Size> template <typename Consumer> bool SeqLockBuffer<Size>::Read(Consumer&& consumer) const
+{
+    for (std::uint8_t attempt = 0; attempt < MaxReadAttempts; attempt++)
+    {
+        const auto start = this->_sequence.load(std::memory_order_acquire);
+        const auto& source = this->_buffers[(start >> 1) & 1];
+
+        consumer(gsl::span<const std::uint8_t>(source));
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const auto end = this->_sequence.load(std::memory_order_relaxed);
+
+        if (IsConsistent(start, end))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template <std::size_t Size> bool SeqLockBuffer<Size>::CopyTo(gsl::span<std::uint8_t> buffer) const
+{
+    return Read([buffer](gsl::span<const std::uint8_t> snapshot) {
+        std::memcpy(buffer.data(), snapshot.data(), std::min<std::size_t>(buffer.size(), snapshot.size()));
+    });
+}
+
+template <std::size_t Size> std::uint32_t SeqLockBuffer<Size>::Sequence() const
+{
+    return this->_sequence.load(std::memory_order_acquire);
+}
+
+template <std::size_t Size> constexpr bool SeqLockBuffer<Size>::IsConsistent(std::uint32_t start, std::uint32_t end)
+{
+    // buffer read at 'start' is reused by the second write started after last completed publication
+    return end - start <= 2 - (start & 1);
+}
+
+/** @} */
+
+#endif /* LIBS_BASE_INCLUDE_BASE_SEQLOCK_HPP_ */
@@ -46,8 +46,11 @@ uint16_t CRC_calc(uint8_t* start, uint8_t* end)
 
 uint16_t CRC_calc(gsl::span<const uint8_t> buffer)
 {
-    uint16_t crc = 0;
+    return CRC_calc(buffer, 0);
+}
 
+uint16_t CRC_calc(gsl::span<const uint8_t> buffer, uint16_t crc)
+{
     for (auto data : buffer)
     {
         crc = (crc >> 8) | (crc << 8);
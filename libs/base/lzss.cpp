@@ -0,0 +1,176 @@
+#include "lzss.hpp"
+#include <algorithm>
+
+namespace lzss
+{
+    /** @brief Value of flags register when all flags of group are used */
+    static constexpr std::uint16_t FlagsExhausted = 1;
+
+    Decoder::Decoder()
+    {
+        Reset();
+    }
+
+    void Decoder::Reset()
+    {
+        this->_state = State::Flags;
+        this->_flags = FlagsExhausted;
+        this->_referenceLow = 0;
+        this->_matchDistance = 0;
+        this->_matchRemaining = 0;
+        this->_produced = 0;
+        this->_windowPosition = 0;
+    }
+
+    void Decoder::Emit(std::uint8_t value, gsl::span<std::uint8_t> output, std::size_t& produced)
+    {
+        this->_window[this->_windowPosition] = value;
+        this->_windowPosition = (this->_windowPosition + 1) % WindowSize;
+        this->_produced++;
+
+        output[produced] = value;
+        produced++;
+    }
+
+    DecoderStatus Decoder::Decode(
+        gsl::span<const std::uint8_t> input, gsl::span<std::uint8_t> output, std::size_t& consumed, std::size_t& produced)
+    {
+        consumed = 0;
+        produced = 0;
+
+        const std::size_t inputSize = input.size();
+        const std::size_t outputSize = output.size();
+
+        while (produced < outputSize)
+        {
+            if (this->_matchRemaining > 0)
+            {
+                auto from = (this->_windowPosition + WindowSize - this->_matchDistance) % WindowSize;
+                Emit(this->_window[from], output, produced);
+                this->_matchRemaining--;
+                continue;
+            }
+
+            if (consumed == inputSize)
+            {
+                break;
+            }
+
+            auto value = input[consumed];
+            consumed++;
+
+            switch (this->_state)
+            {
+                case State::Flags:
+                    this->_flags = 0x100 | value;
+                    this->_state = State::Token;
+                    break;
+
+                case State::Token:
+                    if ((this->_flags & 1) == 1)
+                    {
+                        Emit(value, output, produced);
+                        this->_flags >>= 1;
+                        this->_state = this->_flags == FlagsExhausted ? State::Flags : State::Token;
+                    }
+                    else
+                    {
+                        this->_referenceLow = value;
+                        this->_state = State::ReferenceSecond;
+                    }
+                    break;
+
+                case State::ReferenceSecond:
+                {
+                    const std::uint16_t reference = this->_referenceLow | (value << 8);
+                    const std::uint16_t distance = (reference & (WindowSize - 1)) + 1;
+
+                    if (distance > this->_produced)
+                    {
+                        return DecoderStatus::InvalidReference;
+                    }
+
+                    this->_matchDistance = distance;
+                    this->_matchRemaining = (reference >> DistanceBits) + MinMatchLength;
+                    this->_flags >>= 1;
+                    this->_state = this->_flags == FlagsExhausted ? State::Flags : State::Token;
+                    break;
+                }
+            }
+        }
+
+        return DecoderStatus::Ok;
+    }
+
+    /** @brief Number of tokens described by single flags byte */
+    static constexpr std::uint8_t TokensInGroup = 8;
+
+    std::size_t Encode(gsl::span<const std::uint8_t> input, gsl::span<std::uint8_t> output, std::size_t& consumed)
+    {
+        const std::size_t inputSize = input.size();
+        const std::size_t outputSize = output.size();
+
+        std::size_t produced = 0;
+        std::size_t flagsPosition = 0;
+        std::uint8_t tokensInGroup = TokensInGroup;
+
+        consumed = 0;
+
+        while (consumed < inputSize)
+        {
+            const std::size_t maxLength = std::min<std::size_t>(MaxMatchLength, inputSize - consumed);
+            const std::size_t maxDistance = std::min<std::size_t>(WindowSize, consumed);
+
+            std::size_t matchLength = 0;
+            std::size_t matchDistance = 0;
+
+            // nearest candidates are checked first so runs of repeated byte are found immediately
+            for (std::size_t distance = 1; distance <= maxDistance && matchLength < maxLength; distance++)
+            {
+                std::size_t length = 0;
+                while (length < maxLength && input[consumed + length - distance] == input[consumed + length])
+                {
+                    length++;
+                }
+
+                if (length > matchLength)
+                {
+                    matchLength = length;
+                    matchDistance = distance;
+                }
+            }
+
+            const bool isReference = matchLength >= MinMatchLength;
+            const std::size_t tokenSize = (isReference ? 2 : 1) + (tokensInGroup == TokensInGroup ? 1 : 0);
+
+            if (produced + tokenSize > outputSize)
+            {
+                break;
+            }
+
+            if (tokensInGroup == TokensInGroup)
+            {
+                flagsPosition = produced;
+                output[produced++] = 0;
+                tokensInGroup = 0;
+            }
+
+            if (isReference)
+            {
+                const auto reference = static_cast<std::uint16_t>((matchDistance - 1) | ((matchLength - MinMatchLength) << DistanceBits));
+                output[produced++] = static_cast<std::uint8_t>(reference & 0xFF);
+                output[produced++] = static_cast<std::uint8_t>(reference >> 8);
+                consumed += matchLength;
+            }
+            else
+            {
+                output[flagsPosition] |= 1 << tokensInGroup;
+                output[produced++] = input[consumed++];
+            }
+
+            tokensInGroup++;
+        }
+
+        return produced;
+    }
+}
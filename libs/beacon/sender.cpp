@@ -19,7 +19,7 @@ namespace beacon
     {
         LOG(LOG_LEVEL_INFO, "Send beacon!");
 
-        auto telemetry = this->_telemetry.GetState();
+        const auto& telemetry = this->_telemetry.GetState();
 
         std::chrono::seconds beaconDelay;
 
@@ -36,7 +36,7 @@ namespace beacon
 
         if (frame.size() > 0)
         {
-            if (!this->_transmitter.SendFrame(this->_frame.Frame()))
+            if (!this->_transmitter.SendFrameInPlace(this->_frame.FrameWithHeadroom()))
             {
                 LOG(LOG_LEVEL_ERROR, "Beacon send failure");
                 beaconDelay = 5s;
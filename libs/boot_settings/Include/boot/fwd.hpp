@@ -8,6 +8,9 @@ namespace boot
     /** @brief Size of boot settings */
     constexpr std::size_t BootSettingsSize = 16;
 
+    /** @brief FRAM address of N25Q recovery progress kept by safe mode (last 16 bytes of FM25W256) */
+    constexpr std::size_t SafeModeRecoveryProgressAddress = 0x7FF0;
+
     class BootSettings;
 }
 
@@ -0,0 +1,59 @@
+#include "FramePool.hpp"
+#include "base/os.h"
+
+COMM_BEGIN
+
+constexpr std::size_t FramePool::BufferSize;
+constexpr std::size_t FramePool::BufferCount;
+
+FramePool::Buffer::Buffer(FramePool& pool, std::uint8_t* data) : _pool(pool), _data(data)
+{
+}
+
+FramePool::Buffer::Buffer(Buffer&& other) : _pool(other._pool), _data(other._data)
+{
+    other._data = nullptr;
+}
+
+FramePool::Buffer::~Buffer()
+{
+    if (this->_data != nullptr)
+    {
+        this->_pool.Release(this->_data);
+    }
+}
+
+FramePool::Buffer::operator bool() const
+{
+    return this->_data != nullptr;
+}
+
+gsl::span<std::uint8_t> FramePool::Buffer::Data()
+{
+    if (this->_data == nullptr)
+    {
+        return gsl::span<std::uint8_t>();
+    }
+
+    return gsl::make_span(this->_data, BufferSize);
+}
+
+FramePool::Buffer FramePool::Acquire()
+{
+    CriticalSection critical;
+    return Buffer(*this, static_cast<std::uint8_t*>(this->_pool.Allocate()));
+}
+
+BlockPoolStatistics FramePool::Statistics()
+{
+    CriticalSection critical;
+    return this->_pool.Statistics();
+}
+
+void FramePool::Release(std::uint8_t* data)
+{
+    CriticalSection critical;
+    this->_pool.Free(data);
+}
+
+COMM_END
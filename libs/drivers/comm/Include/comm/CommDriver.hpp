@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "FramePool.hpp"
 #include "IBeaconController.hpp"
 #include "ITransmitter.hpp"
 #include "base/os.h"
@@ -127,6 +128,21 @@ class CommObject final : public ITransmitter,      //
      */
     virtual bool SendFrame(gsl::span<const std::uint8_t> frame) override final;
 
+    /**
+     * @brief Adds the frame built in place to the send queue without copying it.
+     *
+     * @param[in] buffer Buffer that starts with @ref FrameHeadroom reserved bytes followed by frame contents.
+     * @return Operation status, true in case of success, false otherwise.
+     */
+    virtual bool SendFrameInPlace(gsl::span<std::uint8_t> buffer) override final;
+
+    /**
+     * @brief Returns number of free slots in transmitter's output buffer reported when the last frame was queued.
+     *
+     * @return Number of free slots, None if no frame has been queued since the last transmitter reset.
+     */
+    virtual Option<std::uint8_t> FreeSlots() override final;
+
     /**
      * @brief Requests the contents of the oldest received frame from the queue.
      *
@@ -326,14 +342,27 @@ class CommObject final : public ITransmitter,      //
     /**
      * @brief Adds the requested frame to the send queue.
      *
+     * @param[in] buffer Buffer containing @ref FrameHeadroom reserved bytes followed by frame contents.
+     * @param[out] remainingSlots Number of free slots in transmitter's output buffer.
+     * @param[in] resultAggregator Aggregator for error counter
+     * @return Operation status, true in case of success, false otherwise.
+     */
+    bool ScheduleFrameTransmission(gsl::span<std::uint8_t> buffer, //
+        std::uint8_t& remainingSlots,                              //
+        error_counter::AggregatedErrorCounter& resultAggregator    //
+        );
+
+    /**
+     * @brief Copies frame into buffer taken from frame pool and adds it to the send queue.
+     *
      * @param[in] frame Buffer containing frame contents.
      * @param[out] remainingSlots Number of free slots in transmitter's output buffer.
      * @param[in] resultAggregator Aggregator for error counter
      * @return Operation status, true in case of success, false otherwise.
      */
-    bool ScheduleFrameTransmission(gsl::span<const std::uint8_t> frame, //
-        std::uint8_t& remainingSlots,                                   //
-        error_counter::AggregatedErrorCounter& resultAggregator         //
+    bool ScheduleFrameCopyTransmission(gsl::span<const std::uint8_t> frame, //
+        std::uint8_t& remainingSlots,                                       //
+        error_counter::AggregatedErrorCounter& resultAggregator             //
         );
 
     bool ReceiveFrameInternal(gsl::span<std::uint8_t> buffer, Frame& frame, error_counter::AggregatedErrorCounter& resultAggregator);
@@ -391,13 +420,35 @@ class CommObject final : public ITransmitter,      //
     };
 
     std::atomic<LastFrameStatus> _lastFrameStatus;
+
+    /** @brief Buffers for frames and beacons that were not built in place */
+    FramePool _framePool;
 };
 
 inline bool CommObject::SendFrame(gsl::span<const std::uint8_t> frame)
 {
     error_counter::AggregatedErrorReporter<0> errorContext(_error);
     std::uint8_t remainingBufferSize;
-    return ScheduleFrameTransmission(frame, remainingBufferSize, errorContext.Counter());
+    return ScheduleFrameCopyTransmission(frame, remainingBufferSize, errorContext.Counter());
+}
+
+inline bool CommObject::SendFrameInPlace(gsl::span<std::uint8_t> buffer)
+{
+    error_counter::AggregatedErrorReporter<0> errorContext(_error);
+    std::uint8_t remainingBufferSize;
+    return ScheduleFrameTransmission(buffer, remainingBufferSize, errorContext.Counter());
+}
+
+inline Option<std::uint8_t> CommObject::FreeSlots()
+{
+    const auto lastSend = this->_lastSend;
+    if (!lastSend.HasValue)
+    {
+        return None<std::uint8_t>();
+    }
+
+    // frame rejected by transmitter means that its buffer is full
+    return Option<std::uint8_t>::Some(lastSend.Value.FreeSlots == 0xff ? 0 : lastSend.Value.FreeSlots);
 }
 
 inline void CommObject::SetFrameHandler(IHandleFrame& handler)
@@ -0,0 +1,102 @@
+#ifndef LIBS_DRIVERS_COMM_FRAME_POOL_HPP
+#define LIBS_DRIVERS_COMM_FRAME_POOL_HPP
+
+#pragma once
+
+#include <cstdint>
+#include <gsl/span>
+#include "base/block_pool.hpp"
+#include "comm.hpp"
+
+COMM_BEGIN
+
+/**
+ * @brief Pool of buffers able to hold single downlink frame preceded by transmitter command prefix.
+ * @ingroup LowerCommDriver
+ *
+ * Buffers are taken from static storage, so tasks sending frames that were not built in place do not need
+ * frame-sized stack buffers. Pool is shared between tasks and guarded by critical section.
+ *
+ * Each task sending frame copies holds one buffer for the duration of blocking transfer to the transmitter, so pool has
+ * one buffer per such task: communication task (telecommand responses and beacon changes), experiment task (flash and program
+ * experiments) and terminal task.
+ */
+class FramePool final : private NotCopyable, private NotMoveable
+{
+  public:
+    /** @brief Size of single buffer */
+    static constexpr std::size_t BufferSize = FrameHeadroom + MaxDownlinkFrameSize;
+
+    /** @brief Number of buffers in pool - one per task that sends frame copies */
+    static constexpr std::size_t BufferCount = 3;
+
+    /**
+     * @brief Buffer taken from pool, returned to pool on destruction
+     */
+    class Buffer final : private NotCopyable
+    {
+      public:
+        /**
+         * @brief Move ctor
+         * @param other Other buffer
+         */
+        Buffer(Buffer&& other);
+
+        /** @brief Returns buffer to pool */
+        ~Buffer();
+
+        /**
+         * @brief Checks whether buffer has been taken from pool
+         * @return true if buffer is valid
+         */
+        explicit operator bool() const;
+
+        /**
+         * @brief Returns buffer memory
+         * @return Span of @ref BufferSize bytes, empty if buffer is not valid
+         */
+        gsl::span<std::uint8_t> Data();
+
+      private:
+        /**
+         * @brief Ctor
+         * @param pool Owning pool
+         * @param data Buffer memory, nullptr if pool was exhausted
+         */
+        Buffer(FramePool& pool, std::uint8_t* data);
+
+        /** @brief Owning pool */
+        FramePool& _pool;
+
+        /** @brief Buffer memory */
+        std::uint8_t* _data;
+
+        friend class FramePool;
+    };
+
+    /**
+     * @brief Takes buffer from pool
+     * @return Buffer, invalid if pool is exhausted
+     */
+    Buffer Acquire();
+
+    /**
+     * @brief Returns usage statistics
+     * @return Pool statistics
+     */
+    BlockPoolStatistics Statistics();
+
+  private:
+    /**
+     * @brief Returns buffer to pool
+     * @param data Buffer memory
+     */
+    void Release(std::uint8_t* data);
+
+    /** @brief Buffer storage */
+    BlockPool<BufferSize, BufferCount> _pool;
+};
+
+COMM_END
+
+#endif /* LIBS_DRIVERS_COMM_FRAME_POOL_HPP */
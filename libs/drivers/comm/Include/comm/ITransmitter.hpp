@@ -4,6 +4,7 @@
 #include <cstdint>
 #include "comm.hpp"
 #include "gsl/span"
+#include "utils.h"
 
 COMM_BEGIN
 
@@ -21,6 +22,32 @@ struct ITransmitter
      */
     virtual bool SendFrame(gsl::span<const std::uint8_t> frame) = 0;
 
+    /**
+     * @brief Adds the frame built in place to the send queue without copying it.
+     *
+     * @param[in] buffer Buffer that starts with @ref FrameHeadroom reserved bytes followed by frame contents.
+     * Reserved bytes are overwritten with transmitter command.
+     * @return Operation status, true in case of success, false otherwise.
+     *
+     * Default implementation skips reserved bytes and falls back to @ref SendFrame.
+     */
+    virtual bool SendFrameInPlace(gsl::span<std::uint8_t> buffer)
+    {
+        return SendFrame(buffer.subspan(FrameHeadroom));
+    }
+
+    /**
+     * @brief Returns number of free slots in transmitter's output buffer reported when the last frame was queued.
+     *
+     * @return Number of free slots, None if it is not known.
+     *
+     * Default implementation does not track transmitter's buffer.
+     */
+    virtual Option<std::uint8_t> FreeSlots()
+    {
+        return None<std::uint8_t>();
+    }
+
     /**
      * @brief Queries the comm driver for the transmitter telemetry.
      *
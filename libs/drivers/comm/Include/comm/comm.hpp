@@ -71,6 +71,13 @@ constexpr std::uint16_t MaxUplinkFrameSize = 200u;
  */
 constexpr std::uint16_t PrefferedBufferSize = MaxDownlinkFrameSize + 20;
 
+/**
+ * @brief Number of bytes reserved in front of downlink frame for transmitter command prefix.
+ *
+ * Longest prefix is used by beacon update: command byte followed by 16-bit beacon period.
+ */
+constexpr std::uint16_t FrameHeadroom = 3;
+
 /** Transmitter state enumerator. */
 enum class IdleState
 {
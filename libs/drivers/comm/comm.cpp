@@ -5,6 +5,7 @@
 */
 #include "comm.hpp"
 #include <stdnoreturn.h>
+#include <algorithm>
 #include <cstddef>
 #include <cstdlib>
 #include <cstring>
@@ -549,7 +550,7 @@ bool CommObject::ReceiveFrameInternal(gsl::span<std::uint8_t> buffer, Frame& fra
     return status;
 }
 
-bool CommObject::ScheduleFrameTransmission(
+bool CommObject::ScheduleFrameCopyTransmission(
     gsl::span<const std::uint8_t> frame, std::uint8_t& remainingBufferSize, AggregatedErrorCounter& resultAggregator)
 {
     if (frame.size() > MaxDownlinkFrameSize)
@@ -558,12 +559,38 @@ bool CommObject::ScheduleFrameTransmission(
         return false;
     }
 
-    std::uint8_t cmd[PrefferedBufferSize];
-    cmd[0] = num(TransmitterCommand::SendFrame);
-    memcpy(cmd + 1, frame.data(), frame.size());
+    // running out of buffers is a local resource shortage, not a transmitter failure
+    auto buffer = this->_framePool.Acquire();
+    if (!buffer)
+    {
+        LOG(LOG_LEVEL_ERROR, "[comm] No free frame buffer");
+        return false;
+    }
+
+    auto data = buffer.Data().subspan(0, FrameHeadroom + frame.size());
+    std::copy(frame.begin(), frame.end(), data.begin() + FrameHeadroom);
+
+    return ScheduleFrameTransmission(data, remainingBufferSize, resultAggregator);
+}
+
+bool CommObject::ScheduleFrameTransmission(
+    gsl::span<std::uint8_t> buffer, std::uint8_t& remainingBufferSize, AggregatedErrorCounter& resultAggregator)
+{
+    if (buffer.size() < FrameHeadroom || buffer.size() - FrameHeadroom > MaxDownlinkFrameSize)
+    {
+        LOGF(LOG_LEVEL_ERROR,
+            "Frame payload is too long. Allowed: %d, Requested: '%d'.",
+            MaxDownlinkFrameSize,
+            static_cast<int>(buffer.size() - FrameHeadroom));
+        return false;
+    }
+
+    // command byte is placed directly in front of frame, so frame is sent from buffer it was built in
+    auto command = buffer.subspan(FrameHeadroom - 1);
+    command[0] = num(TransmitterCommand::SendFrame);
 
     const bool status = SendBufferWithResponse(Address::Transmitter, //
-        gsl::span<const std::uint8_t>(cmd, 1 + frame.size()),        //
+        command,                                                     //
         gsl::span<std::uint8_t>(&remainingBufferSize, 1),            //
         resultAggregator                                             //
         );
@@ -608,7 +635,7 @@ Option<bool> CommObject::SetBeacon(const Beacon& beaconData)
 {
     ErrorReporter errorContext(_error);
     std::uint8_t remainingBufferSize = 0;
-    const auto result = ScheduleFrameTransmission(beaconData.Contents(), remainingBufferSize, errorContext.Counter());
+    const auto result = ScheduleFrameCopyTransmission(beaconData.Contents(), remainingBufferSize, errorContext.Counter());
     if (!result)
     {
         return Option<bool>::Some(false);
@@ -635,8 +662,14 @@ bool CommObject::UpdateBeaconInternal(const Beacon& beaconData, AggregatedErrorC
         return false;
     }
 
-    std::array<std::uint8_t, MaxDownlinkFrameSize + 2> buffer;
-    Writer writer(buffer);
+    auto buffer = this->_framePool.Acquire();
+    if (!buffer)
+    {
+        LOG(LOG_LEVEL_ERROR, "[comm] No free frame buffer");
+        return false;
+    }
+
+    Writer writer(buffer.Data());
     writer.WriteByte(num(TransmitterCommand::SetBeacon));
     writer.WriteWordLE(gsl::narrow_cast<std::uint16_t>(beaconData.Period().count()));
     writer.WriteArray(beaconData.Contents());
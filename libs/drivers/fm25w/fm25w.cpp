@@ -6,6 +6,7 @@
 #include "utils.h"
 
 using drivers::spi::SPISelectSlave;
+using drivers::spi::SPITransfer;
 using gsl::make_span;
 
 using redundancy::Vote;
@@ -39,9 +40,10 @@ namespace devices
             w.WriteByte(num(Command::Read));
             w.WriteWordBE(address);
 
+            const SPITransfer transfers[] = {SPITransfer::Write(cmd), SPITransfer::Read(buffer)};
+
             SPISelectSlave s(this->_spi);
-            this->_spi.Write(cmd);
-            this->_spi.Read(buffer);
+            this->_spi.Transaction(transfers);
         }
 
         void FM25WDriver::Write(Address address, gsl::span<const std::uint8_t> buffer)
@@ -58,9 +60,10 @@ namespace devices
             }
 
             {
+                const SPITransfer transfers[] = {SPITransfer::Write(cmd), SPITransfer::Write(buffer)};
+
                 SPISelectSlave s(this->_spi);
-                this->_spi.Write(cmd);
-                this->_spi.Write(buffer);
+                this->_spi.Transaction(transfers);
             }
         }
 
@@ -40,6 +40,16 @@ namespace drivers
 
             virtual I2CResult WriteRead(const I2CAddress address, gsl::span<const uint8_t> inData, gsl::span<uint8_t> outData) override;
 
+            /**
+             * @brief Starts transfer on hardware
+             * @param[in,out] transfer Transfer to start
+             *
+             * Bus remains locked until transfer is completed with @ref Wait.
+             */
+            virtual void Submit(I2CTransfer& transfer) override;
+
+            virtual I2CResult Wait(I2CTransfer& transfer) override;
+
             /**
              * @brief Initializes RTOS and hardware components of I2C low-level driver
              */
@@ -53,10 +63,16 @@ namespace drivers
           private:
             /**
              * @brief Executes single I2C transfer
-             * @param[in] seq Transfer sequence definition
+             * @param[in] transfer Transfer definition
+             * @return Transfer result
+             */
+            I2CResult ExecuteTransfer(I2CTransfer transfer);
+
+            /**
+             * @brief Waits for result of transfer in progress and aborts it on timeout
              * @return Transfer result
              */
-            I2CResult ExecuteTransfer(I2C_TransferSeq_TypeDef* seq);
+            I2CResult WaitForCompletion();
 
             /**
              * @brief Checks if SCL or SDA line is latched at low level
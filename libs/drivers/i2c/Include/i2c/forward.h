@@ -9,11 +9,16 @@ namespace drivers
     {
         using I2CAddress = std::uint8_t;
         enum class I2CResult;
+        enum class I2CTransferType;
+        struct I2CTransfer;
         struct II2CBus;
         class I2CLowLevelBus;
         struct I2CInterface;
         class I2CFallbackBus;
         class I2CErrorHandlingBus;
+        struct I2CBusStatistics;
+        struct I2CFallbackStatistics;
+        struct II2CFallbackStatistics;
     }
 }
 
@@ -26,7 +26,8 @@ namespace drivers
          * * Write, Read and Write-Read transfers
          * * Dual-bus (System and Payload) configuration
          * * Error-handling
-         * * Automatic fallback
+         * * Automatic fallback with per-device bus health tracking
+         * * Asynchronous transfers (submit, then wait for completion)
          *
          * @{
          */
@@ -74,6 +75,64 @@ namespace drivers
          */
         using I2CAddress = uint8_t;
 
+        /**
+         * @brief Kind of I2C transfer
+         */
+        enum class I2CTransferType
+        {
+            Write,    //!< Write transfer
+            Read,     //!< Read transfer
+            WriteRead //!< Write-read transfer
+        };
+
+        /**
+         * @brief Asynchronous I2C transfer
+         *
+         * Object (and buffers it refers to) must stay valid until transfer is completed with @ref II2CBus::Wait.
+         */
+        struct I2CTransfer
+        {
+            /**
+             * @brief Creates write transfer
+             * @param[in] address Address of device
+             * @param[in] inData Data to be sent
+             * @return Transfer description
+             */
+            static I2CTransfer Write(const I2CAddress address, gsl::span<const uint8_t> inData);
+
+            /**
+             * @brief Creates read transfer
+             * @param[in] address Address of device
+             * @param[out] outData Buffer for data read from device
+             * @return Transfer description
+             */
+            static I2CTransfer Read(const I2CAddress address, gsl::span<uint8_t> outData);
+
+            /**
+             * @brief Creates write-read transfer
+             * @param[in] address Address of device
+             * @param[in] inData Data to be sent
+             * @param[out] outData Buffer for data read from device
+             * @return Transfer description
+             */
+            static I2CTransfer WriteRead(const I2CAddress address, gsl::span<const uint8_t> inData, gsl::span<uint8_t> outData);
+
+            /** @brief Kind of transfer */
+            I2CTransferType Type;
+            /** @brief Address of device */
+            I2CAddress Address;
+            /** @brief Data to be sent */
+            gsl::span<const uint8_t> InData;
+            /** @brief Buffer for data read from device */
+            gsl::span<uint8_t> OutData;
+            /** @brief Transfer result (valid once transfer is completed) */
+            I2CResult Result;
+            /** @brief Flag indicating that transfer is in progress on hardware */
+            bool Pending;
+            /** @brief Transfer sequence used by low-level driver */
+            I2C_TransferSeq_TypeDef Sequence;
+        };
+
         /**
          * @brief I2C bus interface
          */
@@ -103,6 +162,23 @@ namespace drivers
              * @return Transfer result
              */
             virtual I2CResult WriteRead(const I2CAddress address, gsl::span<const uint8_t> inData, gsl::span<uint8_t> outData) = 0;
+
+            /**
+             * @brief Starts transfer without waiting for its completion
+             * @param[in,out] transfer Transfer to start
+             *
+             * Result of transfer (including failure to start it) is returned by @ref Wait, which must be called for every
+             * submitted transfer. Bus implementations that are not capable of asynchronous operation execute transfer
+             * synchronously.
+             */
+            virtual void Submit(I2CTransfer& transfer);
+
+            /**
+             * @brief Waits for completion of submitted transfer
+             * @param[in,out] transfer Transfer previously passed to @ref Submit
+             * @return Transfer result
+             */
+            virtual I2CResult Wait(I2CTransfer& transfer);
         };
 
         /**
@@ -1,6 +1,9 @@
 #ifndef LIBS_DRIVERS_I2C_INCLUDE_I2C_WRAPPERS_H_
 #define LIBS_DRIVERS_I2C_INCLUDE_I2C_WRAPPERS_H_
 
+#include <array>
+#include <chrono>
+#include <cstdint>
 #include "i2c.h"
 
 namespace drivers
@@ -13,25 +16,150 @@ namespace drivers
          */
 
         /**
-         * @brief I2C Fallbacking bus driver*
+         * @brief Transfer statistics of single bus
          */
-        class I2CFallbackBus final : public II2CBus
+        struct I2CBusStatistics
+        {
+            /** @brief Number of transfers */
+            std::uint32_t Transfers;
+            /** @brief Number of failed transfers */
+            std::uint32_t Failures;
+            /** @brief Total time spent in transfers (in milliseconds) */
+            std::uint32_t TotalLatency;
+            /** @brief Longest transfer (in milliseconds) */
+            std::uint16_t MaxLatency;
+        };
+
+        /**
+         * @brief Transfer statistics of fallback bus
+         */
+        struct I2CFallbackStatistics
+        {
+            /** @brief System bus statistics */
+            I2CBusStatistics System;
+            /** @brief Payload bus statistics */
+            I2CBusStatistics Payload;
+            /** @brief Number of transfers that were routed to payload bus first */
+            std::uint32_t Rerouted;
+        };
+
+        /**
+         * @brief Interface of object providing fallback bus statistics
+         */
+        struct II2CFallbackStatistics
+        {
+            /**
+             * @brief Returns transfer statistics
+             * @return Transfer statistics
+             */
+            virtual I2CFallbackStatistics Statistics() = 0;
+        };
+
+        /**
+         * @brief I2C Fallbacking bus driver
+         *
+         * Outcome of recent transfers is tracked per device address. After transfer to given device fails
+         * on one bus and succeeds on the other, the healthy bus is used first for that device.
+         * The failed bus is probed again once cool-down period elapses.
+         *
+         * Submitted transfers are executed synchronously, as fallback decision requires result of transfer.
+         */
+        class I2CFallbackBus final : public II2CBus, public II2CFallbackStatistics
         {
           public:
+            /** @brief Default time after which failed bus is probed again */
+            static constexpr std::chrono::milliseconds DefaultCoolDown = std::chrono::milliseconds(60000);
+
+            /** @brief Number of device addresses with tracked bus health */
+            static constexpr std::size_t MaxTrackedDevices = 16;
+
             /**
              * @brief Setups bus wrapper that fallbacks from system to payload bus in case of failure
              * @param[in] buses Object representing both buses used in the system
+             * @param[in] coolDown Time during which failed bus is not used as first choice
              */
-            I2CFallbackBus(I2CInterface& buses);
+            I2CFallbackBus(I2CInterface& buses, std::chrono::milliseconds coolDown = DefaultCoolDown);
 
             virtual I2CResult Write(const I2CAddress address, gsl::span<const uint8_t> inData) override;
             virtual I2CResult Read(const I2CAddress address, gsl::span<uint8_t> outData) override;
 
             virtual I2CResult WriteRead(const I2CAddress address, gsl::span<const uint8_t> inData, gsl::span<uint8_t> outData) override;
 
+            virtual I2CFallbackStatistics Statistics() override;
+
           private:
+            /** @brief Bus health of single device */
+            struct Route
+            {
+                /** @brief Device address */
+                I2CAddress Address;
+                /** @brief Flag indicating that entry is used */
+                bool Used;
+                /** @brief Flag indicating that payload bus should be used first */
+                bool PreferPayload;
+                /** @brief Time at which system bus was marked as failed */
+                std::chrono::milliseconds FailedAt;
+            };
+
+            /**
+             * @brief Executes transfer on bus selected by routing policy
+             * @param[in] address Device address
+             * @param[in] transfer Callable executing transfer on given bus
+             * @return Transfer result
+             */
+            template <typename Transfer> I2CResult Execute(const I2CAddress address, Transfer transfer);
+
+            /**
+             * @brief Executes transfer on single bus and updates its statistics
+             * @param[in] bus Bus to use
+             * @param[in] statistics Statistics of selected bus
+             * @param[in] transfer Callable executing transfer on given bus
+             * @return Transfer result
+             */
+            template <typename Transfer> I2CResult Measure(II2CBus& bus, I2CBusStatistics& statistics, Transfer transfer);
+
+            /**
+             * @brief Checks whether transfers to device should go to payload bus first
+             * @param[in] address Device address
+             * @param[in] now Current uptime
+             * @return True if system bus failed for this device within cool-down period
+             */
+            bool IsPayloadPreferred(const I2CAddress address, std::chrono::milliseconds now);
+
+            /**
+             * @brief Marks system bus as failed for device
+             * @param[in] address Device address
+             * @param[in] now Current uptime
+             */
+            void PreferPayload(const I2CAddress address, std::chrono::milliseconds now);
+
+            /**
+             * @brief Restores system bus as first choice for device
+             * @param[in] address Device address
+             * @return True if payload bus was preferred for this device
+             */
+            bool ClearPayloadPreference(const I2CAddress address);
+
+            /**
+             * @brief Finds (or allocates) route entry for device
+             * @param[in] address Device address
+             * @return Pointer to route entry or nullptr if table is full
+             *
+             * Route table is shared by all tasks using this bus, so caller must be in critical section.
+             */
+            Route* FindRoute(const I2CAddress address);
+
             /** @brief Object representing both buses used in the system */
             I2CInterface& _innerBuses;
+
+            /** @brief Time during which failed bus is not used as first choice */
+            const std::chrono::milliseconds _coolDown;
+
+            /** @brief Routes of tracked devices */
+            std::array<Route, MaxTrackedDevices> _routes;
+
+            /** @brief Transfer statistics */
+            I2CFallbackStatistics _statistics;
         };
 
         /**
@@ -63,6 +191,10 @@ namespace drivers
 
             virtual I2CResult WriteRead(const I2CAddress address, gsl::span<const uint8_t> inData, gsl::span<uint8_t> outData) override;
 
+            virtual void Submit(I2CTransfer& transfer) override;
+
+            virtual I2CResult Wait(I2CTransfer& transfer) override;
+
           private:
             /** @brief Underlying bus */
             II2CBus& _innerBus;
@@ -15,37 +15,92 @@ bool I2CLowLevelBus::IsSclOrSdaLatched()
     return GPIO_PinInGet(this->_io.Port, this->_io.SCL) == 0 || GPIO_PinInGet(this->_io.Port, this->_io.SDA) == 0;
 }
 
-I2CResult I2CLowLevelBus::ExecuteTransfer(I2C_TransferSeq_TypeDef* seq)
+void I2CLowLevelBus::Submit(I2CTransfer& transfer)
 {
-    Lock lock(this->_lock, InfiniteTimeout);
+    assert((transfer.Address & 0b10000000) == 0);
 
-    if (!lock())
+    transfer.Pending = false;
+
+    if (OS_RESULT_FAILED(System::TakeSemaphore(this->_lock, InfiniteTimeout)))
     {
-        LOGF(LOG_LEVEL_ERROR, "[I2C] Taking semaphore failed. Address: %X", seq->addr);
-        return I2CResult::Failure;
+        LOGF(LOG_LEVEL_ERROR, "[I2C] Taking semaphore failed. Address: %X", transfer.Address);
+        transfer.Result = I2CResult::Failure;
+        return;
     }
 
     if (this->IsSclOrSdaLatched())
     {
         LOG(LOG_LEVEL_FATAL, "[I2C] SCL or SDA already latched");
-        return I2CResult::LineAlreadyLatched;
+        System::GiveSemaphore(this->_lock);
+        transfer.Result = I2CResult::LineAlreadyLatched;
+        return;
+    }
+
+    auto& seq = transfer.Sequence;
+    seq.addr = (transfer.Address << 1);
+    seq.buf[0].len = transfer.InData.length();
+    seq.buf[0].data = const_cast<uint8_t*>(transfer.InData.data());
+    seq.buf[1].len = 0;
+    seq.buf[1].data = nullptr;
+
+    switch (transfer.Type)
+    {
+        case I2CTransferType::Write:
+            seq.flags = I2C_FLAG_WRITE;
+            break;
+        case I2CTransferType::Read:
+            seq.flags = I2C_FLAG_READ;
+            seq.buf[0].len = transfer.OutData.length();
+            seq.buf[0].data = transfer.OutData.data();
+            break;
+        case I2CTransferType::WriteRead:
+            seq.flags = I2C_FLAG_WRITE_READ;
+            seq.buf[1].len = transfer.OutData.length();
+            seq.buf[1].data = transfer.OutData.data();
+            break;
     }
 
     auto hw = reinterpret_cast<I2C_TypeDef*>(this->HWInterface);
 
-    auto rawResult = I2C_TransferInit(hw, seq);
+    auto rawResult = I2C_TransferInit(hw, &seq);
 
     if (rawResult != i2cTransferInProgress)
     {
-        return (I2CResult)rawResult;
+        System::GiveSemaphore(this->_lock);
+        transfer.Result = (I2CResult)rawResult;
+        return;
     }
 
+    transfer.Pending = true;
+}
+
+I2CResult I2CLowLevelBus::Wait(I2CTransfer& transfer)
+{
+    if (!transfer.Pending)
+    {
+        return transfer.Result;
+    }
+
+    transfer.Pending = false;
+    transfer.Result = WaitForCompletion();
+
+    System::GiveSemaphore(this->_lock);
+
+    return transfer.Result;
+}
+
+I2CResult I2CLowLevelBus::WaitForCompletion()
+{
+    I2C_TransferReturn_TypeDef rawResult;
+
     if (OS_RESULT_FAILED(this->_resultQueue.Pop(rawResult, std::chrono::seconds(static_cast<uint64_t>(io_map::I2C::Timeout)))))
     {
         I2CResult ret = I2CResult::Timeout;
 
         LOG(LOG_LEVEL_ERROR, "Didn't received i2c transfer result");
 
+        auto hw = reinterpret_cast<I2C_TypeDef*>(this->HWInterface);
+
         hw->CMD = I2C_CMD_STOP | I2C_CMD_ABORT;
 
         while (has_flag(hw->STATUS, I2C_STATUS_PABORT))
@@ -65,49 +120,25 @@ I2CResult I2CLowLevelBus::ExecuteTransfer(I2C_TransferSeq_TypeDef* seq)
     return (I2CResult)rawResult;
 }
 
-I2CResult I2CLowLevelBus::Write(const I2CAddress address, gsl::span<const uint8_t> inData)
+I2CResult I2CLowLevelBus::ExecuteTransfer(I2CTransfer transfer)
 {
-    assert((address & 0b10000000) == 0);
-
-    I2C_TransferSeq_TypeDef seq;
-    seq.addr = (address << 1);
-    seq.flags = I2C_FLAG_WRITE;
-    seq.buf[0].len = inData.length();
-    seq.buf[0].data = const_cast<uint8_t*>(inData.data());
-    seq.buf[1].len = 0;
-    seq.buf[1].data = nullptr;
+    Submit(transfer);
+    return Wait(transfer);
+}
 
-    return ExecuteTransfer(&seq);
+I2CResult I2CLowLevelBus::Write(const I2CAddress address, gsl::span<const uint8_t> inData)
+{
+    return ExecuteTransfer(I2CTransfer::Write(address, inData));
 }
 
 I2CResult I2CLowLevelBus::Read(const I2CAddress address, gsl::span<uint8_t> outData)
 {
-    assert((address & 0b10000000) == 0);
-
-    I2C_TransferSeq_TypeDef seq;
-    seq.addr = (address << 1);
-    seq.flags = I2C_FLAG_READ;
-    seq.buf[0].len = outData.length();
-    seq.buf[0].data = const_cast<uint8_t*>(outData.data());
-    seq.buf[1].len = 0;
-    seq.buf[1].data = nullptr;
-
-    return ExecuteTransfer(&seq);
+    return ExecuteTransfer(I2CTransfer::Read(address, outData));
 }
 
 I2CResult I2CLowLevelBus::WriteRead(const I2CAddress address, gsl::span<const uint8_t> inData, gsl::span<uint8_t> outData)
 {
-    assert((address & 0b10000000) == 0);
-
-    I2C_TransferSeq_TypeDef seq;
-    seq.addr = (address << 1);
-    seq.flags = I2C_FLAG_WRITE_READ;
-    seq.buf[0].len = inData.length();
-    seq.buf[0].data = const_cast<uint8_t*>(inData.data());
-    seq.buf[1].len = outData.length();
-    seq.buf[1].data = outData.data();
-
-    return ExecuteTransfer(&seq);
+    return ExecuteTransfer(I2CTransfer::WriteRead(address, inData, outData));
 }
 
 I2CLowLevelBus::I2CLowLevelBus(I2C_TypeDef* hw, //
@@ -61,3 +61,27 @@ I2CResult I2CErrorHandlingBus::WriteRead(const I2CAddress address, gsl::span<con
 
     return this->_errorHandler(this->_innerBus, result, address, this->_handlerContext);
 }
+
+void I2CErrorHandlingBus::Submit(I2CTransfer& transfer)
+{
+    this->_innerBus.Submit(transfer);
+}
+
+I2CResult I2CErrorHandlingBus::Wait(I2CTransfer& transfer)
+{
+    const I2CResult result = this->_innerBus.Wait(transfer);
+
+    if (result == I2CResult::OK)
+    {
+        return result;
+    }
+
+    if (this->_errorHandler == nullptr)
+    {
+        return result;
+    }
+
+    transfer.Result = this->_errorHandler(this->_innerBus, result, transfer.Address, this->_handlerContext);
+
+    return transfer.Result;
+}
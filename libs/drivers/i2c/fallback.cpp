@@ -1,57 +1,165 @@
 #include <stddef.h>
+#include <algorithm>
+#include "base/os.h"
 #include "logger/logger.h"
 #include "wrappers.h"
 
 using namespace drivers::i2c;
+using namespace std::chrono_literals;
+
+constexpr std::chrono::milliseconds I2CFallbackBus::DefaultCoolDown;
+constexpr std::size_t I2CFallbackBus::MaxTrackedDevices;
+
+I2CFallbackBus::I2CFallbackBus(I2CInterface& buses, std::chrono::milliseconds coolDown)
+    : _innerBuses(buses), _coolDown(coolDown), _routes{}, _statistics{}
+{
+}
 
 I2CResult I2CFallbackBus::Write(const I2CAddress address, gsl::span<const uint8_t> inData)
 {
-    const I2CResult systemBusResult = this->_innerBuses.Bus.Write(address, inData);
+    return Execute(address, [=](II2CBus& bus) { return bus.Write(address, inData); });
+}
+
+I2CResult I2CFallbackBus::Read(const I2CAddress address, gsl::span<uint8_t> outData)
+{
+    return Execute(address, [=](II2CBus& bus) { return bus.Read(address, outData); });
+}
 
+I2CResult I2CFallbackBus::WriteRead(const I2CAddress address, gsl::span<const uint8_t> inData, gsl::span<uint8_t> outData)
+{
+    return Execute(address, [=](II2CBus& bus) { return bus.WriteRead(address, inData, outData); });
+}
+
+I2CFallbackStatistics I2CFallbackBus::Statistics()
+{
+    CriticalSection criticalSection;
+    return this->_statistics;
+}
+
+template <typename Transfer> I2CResult I2CFallbackBus::Execute(const I2CAddress address, Transfer transfer)
+{
+    if (IsPayloadPreferred(address, System::GetUptime()))
+    {
+        {
+            CriticalSection criticalSection;
+            this->_statistics.Rerouted++;
+        }
+
+        const I2CResult payloadBusResult = Measure(this->_innerBuses.Payload, this->_statistics.Payload, transfer);
+        if (payloadBusResult == I2CResult::OK)
+        {
+            return payloadBusResult;
+        }
+
+        LOGF(LOG_LEVEL_WARNING, "Payload bus error %d. Retrying transfer to %X on system bus", num(payloadBusResult), address);
+
+        const I2CResult systemBusResult = Measure(this->_innerBuses.Bus, this->_statistics.System, transfer);
+        if (systemBusResult == I2CResult::OK)
+        {
+            ClearPayloadPreference(address);
+        }
+
+        return systemBusResult;
+    }
+
+    const I2CResult systemBusResult = Measure(this->_innerBuses.Bus, this->_statistics.System, transfer);
     if (systemBusResult == I2CResult::OK)
     {
+        if (ClearPayloadPreference(address))
+        {
+            LOGF(LOG_LEVEL_INFO, "System bus recovered. Transfer to %X", address);
+        }
+
         return systemBusResult;
     }
 
     LOGF(LOG_LEVEL_WARNING, "Fallbacking to payload bus. System bus error %d. Transfer to %X", num(systemBusResult), address);
 
-    const I2CResult payloadBusResult = this->_innerBuses.Payload.Write(address, inData);
+    const I2CResult payloadBusResult = Measure(this->_innerBuses.Payload, this->_statistics.Payload, transfer);
+    if (payloadBusResult == I2CResult::OK)
+    {
+        PreferPayload(address, System::GetUptime());
+    }
 
     return payloadBusResult;
 }
 
-I2CResult I2CFallbackBus::Read(const I2CAddress address, gsl::span<uint8_t> outData)
+template <typename Transfer> I2CResult I2CFallbackBus::Measure(II2CBus& bus, I2CBusStatistics& statistics, Transfer transfer)
 {
-    const I2CResult systemBusResult = this->_innerBuses.Bus.Read(address, outData);
+    const auto start = System::GetUptime();
 
-    if (systemBusResult == I2CResult::OK)
+    const I2CResult result = transfer(bus);
+
+    const auto latency = static_cast<std::uint32_t>((System::GetUptime() - start).count());
+
+    CriticalSection criticalSection;
+    statistics.Transfers++;
+    if (result != I2CResult::OK)
     {
-        return systemBusResult;
+        statistics.Failures++;
     }
 
-    LOGF(LOG_LEVEL_WARNING, "Fallbacking to payload bus. System bus error %d. Transfer to %X", num(systemBusResult), address);
+    statistics.TotalLatency += latency;
+    statistics.MaxLatency = static_cast<std::uint16_t>(std::min<std::uint32_t>(std::max<std::uint32_t>(statistics.MaxLatency, latency), 0xFFFF));
 
-    const I2CResult payloadBusResult = this->_innerBuses.Payload.Read(address, outData);
+    return result;
+}
 
-    return payloadBusResult;
+bool I2CFallbackBus::IsPayloadPreferred(const I2CAddress address, std::chrono::milliseconds now)
+{
+    CriticalSection criticalSection;
+
+    const auto route = FindRoute(address);
+    return route != nullptr && route->PreferPayload && (now - route->FailedAt) < this->_coolDown;
 }
 
-I2CResult I2CFallbackBus::WriteRead(const I2CAddress address, gsl::span<const uint8_t> inData, gsl::span<uint8_t> outData)
+void I2CFallbackBus::PreferPayload(const I2CAddress address, std::chrono::milliseconds now)
 {
-    const I2CResult systemBusResult = this->_innerBuses.Bus.WriteRead(address, inData, outData);
+    CriticalSection criticalSection;
 
-    if (systemBusResult == I2CResult::OK)
+    const auto route = FindRoute(address);
+    if (route != nullptr)
     {
-        return systemBusResult;
+        route->PreferPayload = true;
+        route->FailedAt = now;
     }
+}
 
-    LOGF(LOG_LEVEL_WARNING, "Fallbacking to payload bus. System bus error %d. Transfer to %X", num(systemBusResult), address);
+bool I2CFallbackBus::ClearPayloadPreference(const I2CAddress address)
+{
+    CriticalSection criticalSection;
 
-    const I2CResult payloadBusResult = this->_innerBuses.Payload.WriteRead(address, inData, outData);
+    const auto route = FindRoute(address);
+    if (route == nullptr || !route->PreferPayload)
+    {
+        return false;
+    }
 
-    return payloadBusResult;
+    route->PreferPayload = false;
+    return true;
 }
 
-I2CFallbackBus::I2CFallbackBus(I2CInterface& buses) : _innerBuses(buses)
+I2CFallbackBus::Route* I2CFallbackBus::FindRoute(const I2CAddress address)
 {
+    for (auto& route : this->_routes)
+    {
+        if (route.Used && route.Address == address)
+        {
+            return &route;
+        }
+    }
+
+    for (auto& route : this->_routes)
+    {
+        if (!route.Used)
+        {
+            route.Used = true;
+            route.Address = address;
+            route.PreferPayload = false;
+            route.FailedAt = 0ms;
+            return &route;
+        }
+    }
+
+    return nullptr;
 }
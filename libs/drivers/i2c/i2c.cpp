@@ -7,3 +7,58 @@ I2CInterface::I2CInterface(II2CBus& system, II2CBus& payload)
       Payload(payload)
 {
 }
+
+I2CTransfer I2CTransfer::Write(const I2CAddress address, gsl::span<const uint8_t> inData)
+{
+    I2CTransfer transfer;
+    transfer.Type = I2CTransferType::Write;
+    transfer.Address = address;
+    transfer.InData = inData;
+    transfer.Result = I2CResult::OK;
+    transfer.Pending = false;
+    return transfer;
+}
+
+I2CTransfer I2CTransfer::Read(const I2CAddress address, gsl::span<uint8_t> outData)
+{
+    I2CTransfer transfer;
+    transfer.Type = I2CTransferType::Read;
+    transfer.Address = address;
+    transfer.OutData = outData;
+    transfer.Result = I2CResult::OK;
+    transfer.Pending = false;
+    return transfer;
+}
+
+I2CTransfer I2CTransfer::WriteRead(const I2CAddress address, gsl::span<const uint8_t> inData, gsl::span<uint8_t> outData)
+{
+    I2CTransfer transfer;
+    transfer.Type = I2CTransferType::WriteRead;
+    transfer.Address = address;
+    transfer.InData = inData;
+    transfer.OutData = outData;
+    transfer.Result = I2CResult::OK;
+    transfer.Pending = false;
+    return transfer;
+}
+
+void II2CBus::Submit(I2CTransfer& transfer)
+{
+    switch (transfer.Type)
+    {
+        case I2CTransferType::Write:
+            transfer.Result = Write(transfer.Address, transfer.InData);
+            break;
+        case I2CTransferType::Read:
+            transfer.Result = Read(transfer.Address, transfer.OutData);
+            break;
+        case I2CTransferType::WriteRead:
+            transfer.Result = WriteRead(transfer.Address, transfer.InData, transfer.OutData);
+            break;
+    }
+}
+
+I2CResult II2CBus::Wait(I2CTransfer& transfer)
+{
+    return transfer.Result;
+}
@@ -34,6 +34,29 @@ namespace devices
             bool coilActuationDuringMeasurement;
         };
 
+        /**
+         * @brief Token identifying magnetometer measurement started by @ref IImtqDriver::BeginMagnetometerMeasurement.
+         */
+        struct MagnetometerMeasurementToken
+        {
+            /**
+             * @brief Ctor.
+             */
+            constexpr MagnetometerMeasurementToken() : ReadyAt(0), Pending(false)
+            {
+            }
+
+            /**
+             * @brief Uptime at which magnetometer integration finishes.
+             */
+            std::chrono::milliseconds ReadyAt;
+
+            /**
+             * @brief true if measurement has been started and its result has not been collected yet.
+             */
+            bool Pending;
+        };
+
         /**
          * @brief Imtq driver error, used to determine why command have failed.
          */
@@ -362,6 +385,31 @@ namespace devices
              */
             virtual bool MeasureMagnetometer(Vector3<MagnetometerMeasurement>& result) = 0;
 
+            /**
+             * Starts magnetometer measurement, having in mind possible on-going actuation, without waiting for integration.
+             * @param[out] token Token identifying started measurement
+             * @return Operation status.
+             * This method runs:
+             * 1) cancels on-going actuation (TC-OP-03)
+             * 2) waits wait magnetic field decay
+             * 3) sends magnetometer measurement request (TC-OP-04)
+             *
+             * Caller is free to perform other work during magnetometer integration and should collect
+             * result with @ref EndMagnetometerMeasurement. Coils must not be actuated in the meantime.
+             */
+            virtual bool BeginMagnetometerMeasurement(MagnetometerMeasurementToken& token) = 0;
+
+            /**
+             * Collects result of magnetometer measurement started with @ref BeginMagnetometerMeasurement.
+             * @param[in,out] token Token returned by @ref BeginMagnetometerMeasurement
+             * @param[out] result Three axis magnetometer measurement
+             * @return Operation status.
+             * This method runs:
+             * 1) waits for remaining part of integration time (if any)
+             * 2) reads magnetometer data (TC-DR-03)
+             */
+            virtual bool EndMagnetometerMeasurement(MagnetometerMeasurementToken& token, Vector3<MagnetometerMeasurement>& result) = 0;
+
             // ----- Commands -----
 
             /**
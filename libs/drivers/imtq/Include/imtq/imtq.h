@@ -71,6 +71,34 @@ namespace devices
              */
             virtual bool MeasureMagnetometer(Vector3<MagnetometerMeasurement>& result) override;
 
+            /**
+             * Starts magnetometer measurement, having in mind possible on-going actuation, without waiting for integration.
+             * @param[out] token Token identifying started measurement
+             * @return Operation status.
+             * This method runs:
+             * 1) cancels on-going actuation (TC-OP-03)
+             * 2) waits wait magnetic field decay
+             * 3) sends magnetometer measurement request (TC-OP-04)
+             */
+            virtual bool BeginMagnetometerMeasurement(MagnetometerMeasurementToken& token) override;
+
+            /**
+             * Collects result of magnetometer measurement started with @ref BeginMagnetometerMeasurement.
+             * @param[in,out] token Token returned by @ref BeginMagnetometerMeasurement
+             * @param[out] result Three axis magnetometer measurement
+             * @return Operation status.
+             * This method runs:
+             * 1) waits for remaining part of integration time (if any)
+             * 2) reads magnetometer data (TC-DR-03)
+             */
+            virtual bool EndMagnetometerMeasurement(MagnetometerMeasurementToken& token, Vector3<MagnetometerMeasurement>& result) override;
+
+            /** @brief Time needed for magnetic field to decay after actuation is cancelled */
+            static constexpr std::chrono::milliseconds MagneticFieldDecayTime = std::chrono::milliseconds(10);
+
+            /** @brief Magnetometer integration time (including margin) */
+            static constexpr std::chrono::milliseconds IntegrationTime = std::chrono::milliseconds(30);
+
             // ----- Commands -----
 
             /**
@@ -29,6 +29,9 @@ namespace devices
 {
     namespace imtq
     {
+        constexpr std::chrono::milliseconds ImtqDriver::MagneticFieldDecayTime;
+        constexpr std::chrono::milliseconds ImtqDriver::IntegrationTime;
+
         // ------------------------- status -------------------------
 
         /**
@@ -181,22 +184,56 @@ namespace devices
         }
 
         bool ImtqDriver::MeasureMagnetometer(Vector3<MagnetometerMeasurement>& result)
+        {
+            MagnetometerMeasurementToken token;
+            if (!BeginMagnetometerMeasurement(token))
+            {
+                return false;
+            }
+
+            return EndMagnetometerMeasurement(token, result);
+        }
+
+        bool ImtqDriver::BeginMagnetometerMeasurement(MagnetometerMeasurementToken& token)
         {
             ErrorReporter errorContext(_error);
 
+            token.Pending = false;
+
             if (!CancelOperationInternal(errorContext.Counter()))
             {
                 return false;
             }
 
-            System::SleepTask(10ms); // magnetic field decay
+            System::SleepTask(MagneticFieldDecayTime);
 
             if (!StartMTMMeasurementInternal(errorContext.Counter()))
             {
                 return false;
             }
 
-            System::SleepTask(30ms); // integration time + margin
+            token.ReadyAt = System::GetUptime() + IntegrationTime;
+            token.Pending = true;
+
+            return true;
+        }
+
+        bool ImtqDriver::EndMagnetometerMeasurement(MagnetometerMeasurementToken& token, Vector3<MagnetometerMeasurement>& result)
+        {
+            if (!token.Pending)
+            {
+                return false;
+            }
+
+            token.Pending = false;
+
+            const auto now = System::GetUptime();
+            if (now < token.ReadyAt)
+            {
+                System::SleepTask(token.ReadyAt - now);
+            }
+
+            ErrorReporter errorContext(_error);
 
             MagnetometerMeasurementResult value;
             if (!GetCalibratedMagnetometerDataInternal(value, errorContext.Counter()))
@@ -165,6 +165,14 @@ namespace devices
              * This method will be automatically called by @ref OperationWaiter
              */
             virtual OperationResult WaitForOperation(std::chrono::milliseconds timeout, FlagStatus status) = 0;
+
+            /**
+             * @brief Checks whether device is still performing write or erase operation
+             * @return true if operation is in progress
+             *
+             * This method does not wait, it can be used to poll several devices before waiting for any of them.
+             */
+            virtual bool IsBusy() = 0;
         };
 
         /**
@@ -257,6 +265,12 @@ namespace devices
              */
             virtual OperationResult WaitForOperation(std::chrono::milliseconds timeout, FlagStatus status) override;
 
+            /**
+             * @brief Checks whether device is still performing write or erase operation
+             * @return true if operation is in progress
+             */
+            virtual bool IsBusy() override;
+
             /**
              * @brief Read device ID
              * @return Device id
@@ -278,11 +292,20 @@ namespace devices
             /** @brief Maximum size of single data page, used when writing data to chip. */
             static constexpr std::ptrdiff_t PageSize = 256;
 
+            /**
+             * @brief Maximum number of bytes read under single slave selection.
+             *
+             * Longer reads are split so that latency sensitive devices sharing the bus wait for at most one part.
+             */
+            static constexpr std::ptrdiff_t MaxReadLength = 2048;
+
           private:
             /**
              * @brief Waits for device to finish current operation
              * @param[in] timeout Timeout
              * @return true of operation finished, false on timeout
+             *
+             * Slave is selected only for each status register read, so bus is available to other devices in between.
              */
             bool WaitBusy(std::chrono::milliseconds timeout);
 
@@ -466,7 +489,11 @@ namespace devices
              * In case of failure in one of them, subsequent writes are aborted and memory is left partially written
              *
              * Operation can take up to 5ms per page.
-             * The operation is performed in parallel on 3 chips.
+             * The operation is performed in parallel on 3 chips. Each chip proceeds to its next page as soon as it finishes
+             * previous one, so fast chips are not held back by the slowest one. Chip that fails stops writing.
+             *
+             * Operation completes once all pages have been issued to every chip and two chips have confirmed all of them.
+             * Last page of the remaining chip is verified at the beginning of next operation, its failure is counted as error.
              */
             OperationResult WriteMemory(size_t address, gsl::span<const uint8_t> buffer);
 
@@ -485,11 +512,22 @@ namespace devices
             using ErrorCounter = error_counter::ErrorCounter<7>;
 
           private:
+            /**
+             * @brief Waits for write left in progress by previous @ref WriteMemory call and checks its result
+             */
+            void VerifyLaggingWrite();
+
             std::array<IN25QDriver*, 3> _n25qDrivers;
 
             /** @brief Error counter */
             ErrorCounter _error;
 
+            /** @brief Last page write of chip that did not finish before @ref WriteMemory returned */
+            OperationWaiter _laggingWrite;
+
+            /** @brief true if @ref _laggingWrite has to be verified */
+            bool _laggingWritePending;
+
             using ErrorReporter = error_counter::AggregatedErrorReporter<ErrorCounter::DeviceId>;
         };
 
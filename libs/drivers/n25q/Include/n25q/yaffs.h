@@ -1,6 +1,7 @@
 #ifndef LIBS_DRIVERS_N25Q_INCLUDE_N25Q_YAFFS_H_
 #define LIBS_DRIVERS_N25Q_INCLUDE_N25Q_YAFFS_H_
 
+#include <bitset>
 #include "base/os.h"
 #include "fs/yaffs.h"
 #include "logger/logger.h"
@@ -30,15 +31,49 @@ namespace devices
             Sector     //!< Sector
         };
 
+        /** @brief Mapping from block size type to size in bytes */
+        template <BlockMapping blockMapping> struct BlockSize;
+        /** @brief Mapping from block size type Sector to size in bytes */
+        template <> struct BlockSize<BlockMapping::Sector>
+        {
+            /** @brief Block size */
+            static constexpr size_t value = 64_KB;
+        };
+        /** @brief Mapping from block size type SubSector to size in bytes */
+        template <> struct BlockSize<BlockMapping::SubSector>
+        {
+            /** @brief Block size */
+            static constexpr size_t value = 4_KB;
+        };
+
         /**
          * @brief Yaffs driver for N25Q flash memory
          * @tparam blockMapping Block mapping
          * @tparam ChunkSize Single chunk size
          * @tparam TotalSize Total memory size
+         *
+         * Erasure of blocks released by YAFFS while file system is mounted is deferred, so that garbage collection does not
+         * stall writes for the duration of sector erase. Such blocks stay dirty in YAFFS and are erased one by one by file system
+         * maintenance task. When YAFFS runs out of erased blocks, pending blocks are erased synchronously until YAFFS has enough
+         * of them again. All pending blocks are erased before checkpoint is written, so block states stored in checkpoint match
+         * flash content.
          */
-        template <BlockMapping blockMapping, std::size_t ChunkSize, std::size_t TotalSize> class N25QYaffsDevice
+        template <BlockMapping blockMapping, std::size_t ChunkSize, std::size_t TotalSize>
+        class N25QYaffsDevice final : public services::fs::IEraseAheadDevice
         {
           public:
+            /** @brief Number of chunks in single block */
+            static constexpr std::size_t ChunksPerBlock = BlockSize<blockMapping>::value / ChunkSize;
+
+            /** @brief First block used by file system */
+            static constexpr std::size_t StartBlock = 1;
+
+            /** @brief Number of blocks reserved for garbage collection */
+            static constexpr std::size_t ReservedBlocks = 3;
+
+            /** @brief Last block used by file system */
+            static constexpr std::size_t EndBlock = TotalSize / BlockSize<blockMapping>::value - StartBlock - ReservedBlocks;
+
             /**
              * @brief Constructs @ref N25QYaffsDevice instance
              * @param[in] mountPoint Mount point (absolute path)
@@ -56,6 +91,8 @@ namespace devices
             /** @brief Return raw yaffs device */
             inline yaffs_dev* Device();
 
+            virtual bool EraseNext() override;
+
           private:
             N25QYaffsDevice(const N25QYaffsDevice&) = delete;
             N25QYaffsDevice& operator=(const N25QYaffsDevice&) = delete;
@@ -122,6 +159,36 @@ namespace devices
             */
             static int CheckBadBlock(struct yaffs_dev* dev, int block_no);
 
+            /**
+             * @brief (Yaffs callback) Defers erasure of block released by garbage collection
+             * @param[in] dev Yaffs device
+             * @param[in] block_no Block number
+             * @return YAFFS_OK if block will be erased later, YAFFS_FAIL if it must be erased immediately
+             */
+            static int DeferErase(struct yaffs_dev* dev, int block_no);
+
+            /**
+             * @brief (Yaffs callback) Erases blocks with deferred erasure
+             * @param[in] dev Yaffs device
+             * @param[in] min_erased Number of erased blocks YAFFS needs, negative to erase all pending blocks
+             * @return YAFFS_OK if required blocks have been erased
+             */
+            static int FlushErases(struct yaffs_dev* dev, int min_erased);
+
+            /**
+             * @brief Physically erases block
+             * @param[in] block_no Block number
+             * @return true on success
+             */
+            bool Erase(int block_no);
+
+            /**
+             * @brief Erases block with deferred erasure and reports it to YAFFS
+             * @param[in] block_no Block number
+             * @return true on success
+             */
+            bool ErasePending(int block_no);
+
             /** @brief Yaffs device */
             yaffs_dev _device;
             /** @brief Low-level N25Q driver */
@@ -132,21 +199,8 @@ namespace devices
             alignas(4) std::array<std::uint8_t, ChunkSize> _redundantReadBuffer1;
             /** @brief Second buffer for redundant reads */
             alignas(4) std::array<std::uint8_t, ChunkSize> _redundantReadBuffer2;
-        };
-
-        /** @brief Mapping from block size type to size in bytes */
-        template <BlockMapping blockMapping> struct BlockSize;
-        /** @brief Mapping from block size type Sector to size in bytes */
-        template <> struct BlockSize<BlockMapping::Sector>
-        {
-            /** @brief Block size */
-            static constexpr size_t value = 64_KB;
-        };
-        /** @brief Mapping from block size type SubSector to size in bytes */
-        template <> struct BlockSize<BlockMapping::SubSector>
-        {
-            /** @brief Block size */
-            static constexpr size_t value = 4_KB;
+            /** @brief Blocks released by YAFFS that wait for erasure */
+            std::bitset<EndBlock + 1> _pendingErase;
         };
 
         template <BlockMapping blockMapping, std::size_t ChunkSize, std::size_t TotalSize>
@@ -161,10 +215,10 @@ namespace devices
             this->_device.param.inband_tags = true;
             this->_device.param.is_yaffs2 = true;
             this->_device.param.total_bytes_per_chunk = ChunkSize;
-            this->_device.param.chunks_per_block = BlockSize<blockMapping>::value / this->_device.param.total_bytes_per_chunk;
+            this->_device.param.chunks_per_block = ChunksPerBlock;
             this->_device.param.spare_bytes_per_chunk = 0;
-            this->_device.param.start_block = 1;
-            this->_device.param.n_reserved_blocks = 3;
+            this->_device.param.start_block = StartBlock;
+            this->_device.param.n_reserved_blocks = ReservedBlocks;
             this->_device.param.no_tags_ecc = true;
             this->_device.param.always_check_erased = true;
             this->_device.param.disable_bad_block_marking = true;
@@ -175,12 +229,10 @@ namespace devices
             this->_device.drv.drv_erase_fn = N25QYaffsDevice<blockMapping, ChunkSize, TotalSize>::EraseBlock;
             this->_device.drv.drv_mark_bad_fn = N25QYaffsDevice<blockMapping, ChunkSize, TotalSize>::MarkBadBlock;
             this->_device.drv.drv_check_bad_fn = N25QYaffsDevice<blockMapping, ChunkSize, TotalSize>::CheckBadBlock;
+            this->_device.drv.drv_defer_erase_fn = N25QYaffsDevice<blockMapping, ChunkSize, TotalSize>::DeferErase;
+            this->_device.drv.drv_flush_erases_fn = N25QYaffsDevice<blockMapping, ChunkSize, TotalSize>::FlushErases;
 
-            auto blockSize = this->_device.param.chunks_per_block * this->_device.param.total_bytes_per_chunk;
-
-            this->_device.param.end_block = TotalSize / blockSize //
-                - this->_device.param.start_block                 //
-                - this->_device.param.n_reserved_blocks;
+            this->_device.param.end_block = EndBlock;
         }
 
         template <BlockMapping blockMapping, std::size_t ChunkSize, std::size_t TotalSize>
@@ -281,30 +333,102 @@ namespace devices
         {
             auto This = reinterpret_cast<N25QYaffsDevice*>(dev->driver_context);
 
+            return This->Erase(block_no) ? YAFFS_OK : YAFFS_FAIL;
+        }
+
+        template <BlockMapping blockMapping, std::size_t ChunkSize, std::size_t TotalSize>
+        int N25QYaffsDevice<blockMapping, ChunkSize, TotalSize>::DeferErase(struct yaffs_dev* dev, int block_no)
+        {
+            auto This = reinterpret_cast<N25QYaffsDevice*>(dev->driver_context);
+
+            if (!dev->is_mounted)
+            {
+                return YAFFS_FAIL;
+            }
+
+            This->_pendingErase.set(block_no);
+            return YAFFS_OK;
+        }
+
+        template <BlockMapping blockMapping, std::size_t ChunkSize, std::size_t TotalSize>
+        int N25QYaffsDevice<blockMapping, ChunkSize, TotalSize>::FlushErases(struct yaffs_dev* dev, int min_erased)
+        {
+            auto This = reinterpret_cast<N25QYaffsDevice*>(dev->driver_context);
+
+            for (std::size_t block = StartBlock; block <= EndBlock; block++)
+            {
+                // each erase stalls the caller, so only as many blocks as YAFFS asked for are erased
+                if (min_erased >= 0 && dev->n_erased_blocks >= min_erased)
+                {
+                    break;
+                }
+
+                if (This->_pendingErase.test(block) && !This->ErasePending(block))
+                {
+                    return YAFFS_FAIL;
+                }
+            }
+
+            return YAFFS_OK;
+        }
+
+        template <BlockMapping blockMapping, std::size_t ChunkSize, std::size_t TotalSize>
+        bool N25QYaffsDevice<blockMapping, ChunkSize, TotalSize>::Erase(int block_no)
+        {
+            auto dev = &this->_device;
+
             LOGF(LOG_LEVEL_INFO, "[Device %s] Erasing block %d", dev->param.name, block_no);
 
             auto baseAddress = block_no * dev->param.chunks_per_block * dev->param.total_bytes_per_chunk;
 
             auto result = OperationResult::Failure;
 
-            switch (This->_blockMapping)
+            switch (this->_blockMapping)
             {
                 case devices::n25q::BlockMapping::Sector:
-                    result = This->_driver.EraseSector(baseAddress);
+                    result = this->_driver.EraseSector(baseAddress);
                     break;
 
                 case devices::n25q::BlockMapping::SubSector:
-                    result = This->_driver.EraseSubSector(baseAddress);
+                    result = this->_driver.EraseSubSector(baseAddress);
                     break;
             }
 
             if (result != OperationResult::Success)
             {
                 LOGF(LOG_LEVEL_ERROR, "[Device %s] Erase block failed: %d Error %d", dev->param.name, block_no, num(result));
-                return YAFFS_FAIL;
+                return false;
             }
 
-            return YAFFS_OK;
+            return true;
+        }
+
+        template <BlockMapping blockMapping, std::size_t ChunkSize, std::size_t TotalSize>
+        bool N25QYaffsDevice<blockMapping, ChunkSize, TotalSize>::ErasePending(int block_no)
+        {
+            if (!this->Erase(block_no))
+            {
+                return false;
+            }
+
+            this->_pendingErase.reset(block_no);
+            yaffs_block_erased(&this->_device, block_no);
+
+            return true;
+        }
+
+        template <BlockMapping blockMapping, std::size_t ChunkSize, std::size_t TotalSize>
+        bool N25QYaffsDevice<blockMapping, ChunkSize, TotalSize>::EraseNext()
+        {
+            for (std::size_t block = StartBlock; block <= EndBlock; block++)
+            {
+                if (this->_pendingErase.test(block))
+                {
+                    return this->ErasePending(block);
+                }
+            }
+
+            return false;
         }
 
         template <BlockMapping blockMapping, std::size_t ChunkSize, std::size_t TotalSize>
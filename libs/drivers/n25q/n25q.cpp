@@ -18,6 +18,7 @@ using gsl::span;
 using namespace devices::n25q;
 using drivers::spi::ISPIInterface;
 using drivers::spi::SPISelectSlave;
+using drivers::spi::SPITransfer;
 
 enum N25QCommand
 {
@@ -38,6 +39,7 @@ enum N25QCommand
 };
 
 constexpr std::ptrdiff_t N25QDriver::PageSize;
+constexpr std::ptrdiff_t N25QDriver::MaxReadLength;
 constexpr std::chrono::milliseconds N25QDriver::ProgramPageTimeout;
 constexpr std::chrono::milliseconds N25QDriver::EraseSubSectorTimeout;
 constexpr std::chrono::seconds N25QDriver::EraseSectorTimeout;
@@ -148,23 +150,26 @@ FlagStatus N25QDriver::ReadFlagStatus()
 
 OSResult N25QDriver::ReadMemory(std::size_t address, gsl::span<uint8_t> buffer)
 {
-    auto r = Retry(RetryCount, [this, address, &buffer]() {
-        array<uint8_t, 4> command;
-        Writer writer(command);
+    auto r = OSResult::Success;
 
-        writer.WriteByte(N25QCommand::ReadMemory);
-        WriterWriteAddress(writer, address);
+    for (ptrdiff_t offset = 0; offset < buffer.size() && r == OSResult::Success; offset += MaxReadLength)
+    {
+        auto part = buffer.subspan(offset, min(MaxReadLength, buffer.size() - offset));
+        const auto partAddress = address + offset;
 
-        SPISelectSlave slave(this->_spi);
-        auto r = this->_spi.Write(command);
+        r = Retry(RetryCount, [this, partAddress, &part]() {
+            array<uint8_t, 4> command;
+            Writer writer(command);
 
-        if (r != OSResult::Success)
-        {
-            return r;
-        }
+            writer.WriteByte(N25QCommand::ReadMemory);
+            WriterWriteAddress(writer, partAddress);
 
-        return this->_spi.Read(buffer);
-    });
+            const SPITransfer transfers[] = {SPITransfer::Write(command), SPITransfer::Read(part)};
+
+            SPISelectSlave slave(this->_spi);
+            return this->_spi.Transaction(transfers);
+        });
+    }
 
     if (r == OSResult::Success)
     {
@@ -248,10 +253,10 @@ OperationWaiter N25QDriver::BeginWritePage(size_t address, ptrdiff_t offset, spa
         writer.WriteByte(N25QCommand::ProgramMemory);
         WriterWriteAddress(writer, address + offset);
 
-        SPISelectSlave slave(this->_spi);
+        const SPITransfer transfers[] = {SPITransfer::Write(command), SPITransfer::Write(page)};
 
-        this->_spi.Write(command);
-        this->_spi.Write(page);
+        SPISelectSlave slave(this->_spi);
+        this->_spi.Transaction(transfers);
     }
 
     return OperationWaiter(this, ProgramPageTimeout, FlagStatus::ProgramError);
@@ -284,7 +289,10 @@ bool N25QDriver::WaitBusy(std::chrono::milliseconds timeout)
     {
         uint8_t status = 0;
 
-        this->Command(N25QCommand::ReadStatusRegister, span<uint8_t>(&status, 1));
+        {
+            SPISelectSlave slave(this->_spi);
+            this->Command(N25QCommand::ReadStatusRegister, span<uint8_t>(&status, 1));
+        }
 
         if (!has_flag(static_cast<Status>(status), Status::WriteInProgress))
         {
@@ -304,14 +312,10 @@ bool N25QDriver::WaitBusy(std::chrono::milliseconds timeout)
 
 OperationResult N25QDriver::WaitForOperation(std::chrono::milliseconds timeout, FlagStatus errorStatus)
 {
+    if (!WaitBusy(timeout))
     {
-        SPISelectSlave slave(_spi);
-
-        if (!WaitBusy(timeout))
-        {
-            _errors.Failure(_deviceId);
-            return OperationResult::Timeout;
-        }
+        _errors.Failure(_deviceId);
+        return OperationResult::Timeout;
     }
 
     auto flags = ReadFlagStatus();
@@ -325,6 +329,11 @@ OperationResult N25QDriver::WaitForOperation(std::chrono::milliseconds timeout,
     return OperationResult::Success;
 }
 
+bool N25QDriver::IsBusy()
+{
+    return has_flag(this->ReadStatus(), Status::WriteInProgress);
+}
+
 OperationWaiter N25QDriver::BeginEraseSector(size_t address)
 {
     this->ClearFlags();
@@ -421,14 +430,10 @@ OperationResult N25QDriver::Reset()
         this->_spi.Write(gsl::make_span(&value, 1));
     }
 
+    if (!this->WaitBusy(WriteStatusRegisterTimeout))
     {
-        SPISelectSlave select(this->_spi);
-
-        if (!this->WaitBusy(WriteStatusRegisterTimeout))
-        {
-            _errors.Failure(_deviceId);
-            return OperationResult::Timeout;
-        }
+        _errors.Failure(_deviceId);
+        return OperationResult::Timeout;
     }
 
     _errors.Success(_deviceId);
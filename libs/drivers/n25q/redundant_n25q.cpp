@@ -15,19 +15,89 @@ using namespace devices::n25q;
 using redundancy::Vote;
 using redundancy::CorrectBuffer;
 
+namespace
+{
+    /** @brief Progress of pipelined write on single chip */
+    struct WriteLane
+    {
+        WriteLane()
+            : Waiter(nullptr, std::chrono::milliseconds(0), FlagStatus::Clear), //
+              Issued(0),                                                        //
+              Confirmed(0),                                                     //
+              InFlight(false),                                                  //
+              IssueOrder(0),                                                    //
+              Result(OperationResult::Success)
+        {
+        }
+
+        /** @brief Waiter of page currently being written */
+        OperationWaiter Waiter;
+        /** @brief Number of pages issued to chip */
+        ptrdiff_t Issued;
+        /** @brief Number of pages chip has confirmed */
+        ptrdiff_t Confirmed;
+        /** @brief true if page write is in progress */
+        bool InFlight;
+        /** @brief Sequence number of page write in progress, used to wait for the oldest one first */
+        std::uint32_t IssueOrder;
+        /** @brief Result of first failed page write, chip is not used after failure */
+        OperationResult Result;
+
+        bool Failed() const
+        {
+            return Result != OperationResult::Success;
+        }
+
+        void Complete()
+        {
+            InFlight = false;
+
+            auto r = Waiter.Wait();
+            if (r == OperationResult::Success)
+            {
+                Confirmed++;
+            }
+            else
+            {
+                Result = r;
+            }
+        }
+    };
+}
+
 RedundantN25QDriver::RedundantN25QDriver(         //
     error_counter::IErrorCounting& errorCounting, //
     std::array<IN25QDriver*, 3> n25qDrivers)
-    : _n25qDrivers(n25qDrivers), _error(errorCounting)
+    : _n25qDrivers(n25qDrivers),                                              //
+      _error(errorCounting),                                                  //
+      _laggingWrite(nullptr, std::chrono::milliseconds(0), FlagStatus::Clear), //
+      _laggingWritePending(false)
 {
 }
 
+void RedundantN25QDriver::VerifyLaggingWrite()
+{
+    if (!_laggingWritePending)
+    {
+        return;
+    }
+
+    _laggingWritePending = false;
+
+    if (_laggingWrite.Wait() != OperationResult::Success)
+    {
+        _error.Failure();
+    }
+}
+
 OSResult RedundantN25QDriver::ReadMemory( //
     std::size_t address,                  //
     gsl::span<uint8_t> outputBuffer,      //
     gsl::span<uint8_t> redundantBuffer1,  //
     gsl::span<uint8_t> redundantBuffer2)
 {
+    VerifyLaggingWrite();
+
     auto bufferLength = std::min(outputBuffer.length(), std::min(redundantBuffer1.length(), redundantBuffer2.length()));
 
     auto normalizedOutputBuffer = outputBuffer.subspan(0, bufferLength);
@@ -73,6 +143,8 @@ OSResult RedundantN25QDriver::ReadMemory( //
 
 OperationResult RedundantN25QDriver::EraseChip()
 {
+    VerifyLaggingWrite();
+
     auto d1Wait = _n25qDrivers[0]->BeginEraseChip();
     auto d2Wait = _n25qDrivers[1]->BeginEraseChip();
     auto d3Wait = _n25qDrivers[2]->BeginEraseChip();
@@ -95,6 +167,8 @@ OperationResult RedundantN25QDriver::EraseChip()
 
 OperationResult RedundantN25QDriver::EraseSubSector(size_t address)
 {
+    VerifyLaggingWrite();
+
     auto d1Wait = _n25qDrivers[0]->BeginEraseSubSector(address);
     auto d2Wait = _n25qDrivers[1]->BeginEraseSubSector(address);
     auto d3Wait = _n25qDrivers[2]->BeginEraseSubSector(address);
@@ -117,6 +191,8 @@ OperationResult RedundantN25QDriver::EraseSubSector(size_t address)
 
 OperationResult RedundantN25QDriver::EraseSector(size_t address)
 {
+    VerifyLaggingWrite();
+
     auto d1Wait = _n25qDrivers[0]->BeginEraseSector(address);
     auto d2Wait = _n25qDrivers[1]->BeginEraseSector(address);
     auto d3Wait = _n25qDrivers[2]->BeginEraseSector(address);
@@ -139,29 +215,95 @@ OperationResult RedundantN25QDriver::EraseSector(size_t address)
 
 OperationResult RedundantN25QDriver::WriteMemory(size_t address, gsl::span<const uint8_t> buffer)
 {
-    for (ptrdiff_t offset = 0; offset < buffer.size(); offset += N25QDriver::PageSize)
+    VerifyLaggingWrite();
+
+    const ptrdiff_t pagesCount = (buffer.size() + N25QDriver::PageSize - 1) / N25QDriver::PageSize;
+
+    std::array<WriteLane, 3> lanes;
+    std::uint32_t issueOrder = 0;
+
+    while (true)
     {
-        auto page = buffer.subspan(offset, min(N25QDriver::PageSize, buffer.size() - offset));
+        bool progress = false;
 
-        auto d1Waiter = _n25qDrivers[0]->BeginWritePage(address, offset, page);
-        auto d2Waiter = _n25qDrivers[1]->BeginWritePage(address, offset, page);
-        auto d3Waiter = _n25qDrivers[2]->BeginWritePage(address, offset, page);
+        for (std::uint8_t chip = 0; chip < lanes.size(); chip++)
+        {
+            auto& lane = lanes[chip];
+
+            if (lane.Failed())
+            {
+                continue;
+            }
+
+            if (lane.InFlight)
+            {
+                if (_n25qDrivers[chip]->IsBusy())
+                {
+                    continue;
+                }
+
+                lane.Complete();
+                progress = true;
+
+                if (lane.Failed())
+                {
+                    continue;
+                }
+            }
+
+            if (lane.Issued < pagesCount)
+            {
+                const auto offset = lane.Issued * N25QDriver::PageSize;
+                const auto page = buffer.subspan(offset, min(N25QDriver::PageSize, buffer.size() - offset));
+
+                lane.Waiter = _n25qDrivers[chip]->BeginWritePage(address, offset, page);
+                lane.Issued++;
+                lane.InFlight = true;
+                lane.IssueOrder = issueOrder++;
+                progress = true;
+            }
+        }
 
-        auto d1Result = d1Waiter.Wait();
-        auto d2Result = d2Waiter.Wait();
-        auto d3Result = d3Waiter.Wait();
+        const auto failed = std::count_if(lanes.begin(), lanes.end(), [](const WriteLane& lane) { return lane.Failed(); });
 
-        auto votedResult = Vote(d1Result, d2Result, d3Result);
-        if (!votedResult.HasValue)
+        if (failed >= 2)
         {
             _error.Failure();
-            return OperationResult::Failure;
+
+            auto votedResult = Vote(lanes[0].Result, lanes[1].Result, lanes[2].Result);
+            return votedResult.HasValue ? votedResult.Value : OperationResult::Failure;
+        }
+
+        const auto confirmed = std::count_if(lanes.begin(), lanes.end(), [pagesCount](const WriteLane& lane) {
+            return !lane.Failed() && lane.Confirmed == pagesCount;
+        });
+
+        const auto allIssued = std::all_of(lanes.begin(), lanes.end(), [pagesCount](const WriteLane& lane) {
+            return lane.Failed() || lane.Issued == pagesCount;
+        });
+
+        if (confirmed >= 2 && allIssued)
+        {
+            break;
         }
 
-        if (votedResult.Value != OperationResult::Success)
+        if (!progress)
         {
-            _error.Failure();
-            return votedResult.Value;
+            // all chips are busy, block on the one that started its page first
+            auto oldest = std::min_element(lanes.begin(), lanes.end(), [](const WriteLane& a, const WriteLane& b) {
+                return a.InFlight && (!b.InFlight || a.IssueOrder < b.IssueOrder);
+            });
+
+            oldest->Complete();
+        }
+    }
+
+    for (auto& lane : lanes)
+    {
+        if (lane.InFlight)
+        {
+            _laggingWrite = std::move(lane.Waiter);
+            _laggingWritePending = true;
         }
     }
 
@@ -171,6 +313,8 @@ OperationResult RedundantN25QDriver::WriteMemory(size_t address, gsl::span<const
 
 OperationResult RedundantN25QDriver::Reset()
 {
+    VerifyLaggingWrite();
+
     auto d1Result = _n25qDrivers[0]->Reset();
     auto d2Result = _n25qDrivers[1]->Reset();
     auto d3Result = _n25qDrivers[2]->Reset();
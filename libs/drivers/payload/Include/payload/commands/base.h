@@ -34,6 +34,20 @@ namespace devices
                  */
                 virtual OSResult Execute(TOutputDataType& output);
 
+                /**
+                 * @brief Sends command to payload without waiting for its completion.
+                 * @returns Result status.
+                 * @remark Measurement has to be collected with @ref Complete before any other command is sent to payload.
+                 */
+                OSResult Start();
+
+                /**
+                 * @brief Waits for completion of command sent with @ref Start and retrieves its data.
+                 * @param output Command output
+                 * @returns Result status.
+                 */
+                OSResult Complete(TOutputDataType& output);
+
               protected:
                 /**
                   * @brief The method saving retrieved data.
@@ -14,6 +14,17 @@ PayloadCommand<TCommandCode, TOutputDataType>::PayloadCommand(IPayloadDriver& dr
 
 template <std::uint8_t TCommandCode, class TOutputDataType>
 OSResult PayloadCommand<TCommandCode, TOutputDataType>::Execute(TOutputDataType& output)
+{
+    OSResult result = Start();
+    if (result != OSResult::Success)
+    {
+        return result;
+    }
+
+    return Complete(output);
+}
+
+template <std::uint8_t TCommandCode, class TOutputDataType> OSResult PayloadCommand<TCommandCode, TOutputDataType>::Start()
 {
     if (_driver.IsBusy())
     {
@@ -21,13 +32,13 @@ OSResult PayloadCommand<TCommandCode, TOutputDataType>::Execute(TOutputDataType&
         return OSResult::Busy;
     }
 
-    OSResult result = ExecuteCommand();
-    if (result != OSResult::Success)
-    {
-        return result;
-    }
+    return ExecuteCommand();
+}
 
-    result = _driver.WaitForData();
+template <std::uint8_t TCommandCode, class TOutputDataType>
+OSResult PayloadCommand<TCommandCode, TOutputDataType>::Complete(TOutputDataType& output)
+{
+    auto result = _driver.WaitForData();
     if (result != OSResult::Success)
     {
         return result;
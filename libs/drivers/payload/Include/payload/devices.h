@@ -53,6 +53,19 @@ namespace devices
               */
             virtual OSResult MeasureSunSRef(PayloadTelemetry::SunsRef& output) override;
 
+            /**
+              * @brief Starts measuring SunS reference voltages without waiting for the result.
+              * @return Result status.
+              */
+            virtual OSResult BeginSunSRefMeasurement() override;
+
+            /**
+              * @brief Waits for SunS reference voltages measurement and retrieves its result.
+              * @param output Retrieved data.
+              * @return Result status.
+              */
+            virtual OSResult EndSunSRefMeasurement(PayloadTelemetry::SunsRef& output) override;
+
             /**
               * @brief Starts measuring Temperature data.
               * @param output Retrieved data.
@@ -97,6 +110,9 @@ namespace devices
 
           private:
             IPayloadDriver& _driver;
+
+            /** @brief true if SunS reference voltages measurement has been started and not yet collected */
+            bool _sunsRefPending;
         };
 
         /* @} */
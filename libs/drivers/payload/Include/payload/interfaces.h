@@ -77,6 +77,22 @@ namespace devices
              */
             virtual OSResult MeasureSunSRef(PayloadTelemetry::SunsRef& output) = 0;
 
+            /**
+             * @brief Starts measuring SunS reference voltages without waiting for the result.
+             * @return Result status.
+             *
+             * Caller is free to use other devices while payload is measuring and has to collect result
+             * with @ref EndSunSRefMeasurement before sending any other command to payload.
+             */
+            virtual OSResult BeginSunSRefMeasurement() = 0;
+
+            /**
+             * @brief Waits for measurement started with @ref BeginSunSRefMeasurement and retrieves its result.
+             * @param output Retrieved data.
+             * @return Result status.
+             */
+            virtual OSResult EndSunSRefMeasurement(PayloadTelemetry::SunsRef& output) = 0;
+
             /**
               * @brief Starts measuring Temperature data.
               * @param output Retrieved data.
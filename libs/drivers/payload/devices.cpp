@@ -11,7 +11,7 @@
 
 using namespace devices::payload;
 
-PayloadDeviceDriver::PayloadDeviceDriver(IPayloadDriver& driver) : _driver(driver)
+PayloadDeviceDriver::PayloadDeviceDriver(IPayloadDriver& driver) : _driver(driver), _sunsRefPending(false)
 {
 }
 
@@ -32,6 +32,27 @@ OSResult PayloadDeviceDriver::MeasureSunSRef(PayloadTelemetry::SunsRef& output)
     return command.Execute(output);
 }
 
+OSResult PayloadDeviceDriver::BeginSunSRefMeasurement()
+{
+    commands::SunSCommand command(_driver);
+    const auto result = command.Start();
+    _sunsRefPending = result == OSResult::Success;
+    return result;
+}
+
+OSResult PayloadDeviceDriver::EndSunSRefMeasurement(PayloadTelemetry::SunsRef& output)
+{
+    if (!_sunsRefPending)
+    {
+        return OSResult::InvalidOperation;
+    }
+
+    _sunsRefPending = false;
+
+    commands::SunSCommand command(_driver);
+    return command.Complete(output);
+}
+
 OSResult PayloadDeviceDriver::MeasureTemperatures(PayloadTelemetry::Temperatures& output)
 {
     commands::TemperaturesCommand command(_driver);
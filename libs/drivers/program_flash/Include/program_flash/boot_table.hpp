@@ -1,6 +1,7 @@
 #ifndef LIBS_DRIVERS_PROGRAM_FLASH_INCLUDE_PROGRAM_FLASH_BOOT_TABLE_HPP_
 #define LIBS_DRIVERS_PROGRAM_FLASH_INCLUDE_PROGRAM_FLASH_BOOT_TABLE_HPP_
 
+#include <array>
 #include <cstdint>
 #include <gsl/span>
 #include <tuple>
@@ -17,6 +18,64 @@ namespace program_flash
      * @{
      */
 
+    /**
+     * @brief Running CRC of program entry content
+     *
+     * Tracks content written sequentially since entry was erased so its CRC is known without reading whole entry back.
+     * CRC is updated with each part read back from flash right after it has been programmed.
+     * Any write that does not extend already written content (including rewrite of already written area) makes CRC unknown
+     * until entry is erased again.
+     */
+    class ContentTracker
+    {
+      public:
+        /**
+         * @brief Ctor
+         */
+        ContentTracker();
+
+        /**
+         * @brief Marks entry as erased
+         */
+        void Erased();
+
+        /**
+         * @brief Marks entry content as unknown
+         */
+        void Invalidate();
+
+        /**
+         * @brief Updates tracker with successfully programmed content
+         * @param offset Offset from content start
+         * @param content Programmed content read back from flash
+         */
+        void Programmed(std::size_t offset, gsl::span<const std::uint8_t> content);
+
+        /**
+         * @brief Checks whether given area has already been written since last erase
+         * @param offset Offset from content start
+         * @param size Area size
+         * @return true if whole area was written
+         */
+        bool Covers(std::size_t offset, std::size_t size) const;
+
+        /**
+         * @brief Returns CRC of written content
+         * @param length Expected content length
+         * @return CRC if exactly length bytes were written sequentially since last erase
+         */
+        Option<std::uint16_t> Crc(std::uint32_t length) const;
+
+      private:
+        /** @brief Value of written length marking unknown content */
+        static constexpr std::uint32_t Unknown = 0xFFFFFFFF;
+
+        /** @brief Number of bytes written since erase */
+        std::uint32_t _length;
+        /** @brief CRC of written bytes */
+        std::uint16_t _crc;
+    };
+
     /**
      * @brief Class representing single entry in boot table
      */
@@ -27,8 +86,9 @@ namespace program_flash
          * @brief Ctor
          * @param flash Flash driver
          * @param index Entry index
+         * @param tracker Tracker of entry content
          */
-        ProgramEntry(IFlashDriver& flash, std::uint8_t index);
+        ProgramEntry(IFlashDriver& flash, std::uint8_t index, ContentTracker& tracker);
 
         /**
          * @brief Returns entry description
@@ -114,15 +174,35 @@ namespace program_flash
          * @param offset Offset from content start
          * @param content Content to write
          * @return Operation status
+         *
+         * @remark Parts already written with the same content since last erase are not programmed again
          */
         FlashStatus WriteContent(std::size_t offset, gsl::span<const std::uint8_t> content);
 
+        /**
+         * @brief Checks whether given content has already been written at offset since last erase
+         * @param offset Offset from content start
+         * @param content Content to check
+         * @return true if programming content would not change entry
+         */
+        bool IsWritten(std::size_t offset, gsl::span<const std::uint8_t> content) const;
+
         /**
          * @brief Calculates CRC of stored content
          * @return CRC
          */
         std::uint16_t CalculateCrc() const;
 
+        /**
+         * @brief Returns CRC of content calculated while it was written
+         * @param length Program length
+         * @return CRC if whole program was written sequentially since last erase, None otherwise
+         */
+        inline Option<std::uint16_t> WrittenContentCrc(std::uint32_t length) const
+        {
+            return this->_tracker.Crc(length);
+        }
+
         /**
          * @brief Returns span containing whole program entry
          * @return Span over whole program entry
@@ -141,10 +221,21 @@ namespace program_flash
             return this->_entrySpan.BaseOffset();
         }
 
+        /**
+         * @brief Returns offset to this program entry content from flash begin
+         * @return Offset from flash begin
+         */
+        inline std::size_t ContentInFlashOffset() const
+        {
+            return this->_program.BaseOffset();
+        }
+
         /** @brief Size of single entry */
         static constexpr std::size_t Size = 512_KB;
 
       private:
+        /** @brief Tracker of entry content */
+        ContentTracker& _tracker;
         /** @brief Span for whole entry */
         FlashSpan _entrySpan;
         /** @brief Span for entry length */
@@ -338,9 +429,22 @@ namespace program_flash
          */
         inline ProgramEntry Entry(std::uint8_t index)
         {
-            return ProgramEntry(this->_flash, index);
+            return ProgramEntry(this->_flash, index, this->_trackers[index]);
         }
 
+        /**
+         * @brief Writes the same part of content to several entries
+         * @param entries Bit mask of entries to write
+         * @param offset Offset from content start
+         * @param content Content to write
+         * @return Operation result (Flash status and index of entry at which fail occured)
+         *
+         * Program operations of all entries are overlapped, so entries placed in different flash banks are programmed
+         * simultaneously. Entries that already contain given content are not programmed again.
+         */
+        Result<FlashStatus, std::tuple<FlashStatus, std::uint8_t>> WriteContent(
+            std::uint8_t entries, std::size_t offset, gsl::span<const std::uint8_t> content);
+
         /**
          * @brief Returns bootloader copy from boot table
          * @param index Bootloader copy index
@@ -389,6 +493,8 @@ namespace program_flash
         std::uint32_t _deviceId;
         /** @brief Flash device boot config */
         std::uint8_t _bootConfig;
+        /** @brief Content trackers of all entries */
+        std::array<ContentTracker, EntriesCount> _trackers;
     };
 
     /** @} */
@@ -0,0 +1,198 @@
+#ifndef LIBS_DRIVERS_PROGRAM_FLASH_INCLUDE_PROGRAM_FLASH_COMPRESSED_WRITER_HPP_
+#define LIBS_DRIVERS_PROGRAM_FLASH_INCLUDE_PROGRAM_FLASH_COMPRESSED_WRITER_HPP_
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <gsl/span>
+#include "base/lzss.hpp"
+#include "boot_table.hpp"
+#include "patch.hpp"
+#include "utils.h"
+
+namespace program_flash
+{
+    /**
+     * @ingroup boot_table
+     * @{
+     */
+
+    /**
+     * @brief Status of compressed program part write
+     */
+    enum class CompressedWriteStatus
+    {
+        Success,         //!< Part has been decompressed and programmed (or was already programmed before)
+        OutOfSequence,   //!< Part does not continue the stream, expected offset is reported by upload session
+        CorruptedStream, //!< Compressed stream is invalid or too long, upload session has been aborted
+        FlashError       //!< Programming failed, upload session has been aborted
+    };
+
+    /**
+     * @brief Result of compressed program part write
+     */
+    struct CompressedWriteResult
+    {
+        /** @brief Operation status */
+        CompressedWriteStatus Status;
+        /** @brief Flash status (valid only for @ref CompressedWriteStatus::FlashError) */
+        FlashStatus Flash;
+        /** @brief Index of entry that failed (valid only for @ref CompressedWriteStatus::FlashError) */
+        std::uint8_t Entry;
+    };
+
+    /**
+     * @brief Compressed program upload session
+     *
+     * LZSS compressed program stream is uploaded in parts. Each part is decompressed directly into selected boot table
+     * entries. Entries track CRC of programmed content (see @ref ContentTracker), so program does not have to be scanned again
+     * on finalization.
+     *
+     * Session started with @ref StartPatch expects LZSS compressed patch (see @ref PatchOperation) instead of program.
+     * Decompressed patch is applied to source entry and result is programmed into selected entries.
+     *
+     * Parts are identified by their offset in compressed stream:
+     *  - part starting at offset 0 always starts new session (patch session keeps its source). Stream is decoded again and
+     *    data already present in entries is not programmed again
+     *  - part continuing stream is decompressed
+     *  - part that was already processed (e.g. retransmission after lost response) is accepted without programming anything
+     *  - part partially overlapping already processed data is processed from first new byte
+     *  - part beyond current stream offset is rejected, upload should be resumed from @ref StreamOffset
+     *
+     * Session is kept only in RAM. After restart (or any error) upload has to be restarted from offset 0. Programming the same
+     * data again over not erased entries is harmless as flash programming can only clear bits.
+     */
+    class CompressedProgramWriter final : private NotCopyable, private NotMoveable
+    {
+      public:
+        /**
+         * @brief Ctor
+         * @param bootTable Boot table
+         */
+        CompressedProgramWriter(BootTable& bootTable);
+
+        /**
+         * @brief Writes next part of compressed stream
+         * @param entries Entries bitmask (bit 0 - entry 0, etc.)
+         * @param streamOffset Offset of part in compressed stream
+         * @param content Compressed part
+         * @return Operation result
+         *
+         * @remark Boot table must be locked by caller
+         */
+        CompressedWriteResult Write(std::uint8_t entries, std::uint32_t streamOffset, gsl::span<const std::uint8_t> content);
+
+        /**
+         * @brief Starts session applying patch to source program
+         * @param entries Target entries bitmask
+         * @param sourceEntry Index of source entry
+         * @param source Source program
+         *
+         * @remark Caller is responsible for verifying source program
+         */
+        void StartPatch(std::uint8_t entries, std::uint8_t sourceEntry, gsl::span<const std::uint8_t> source);
+
+        /**
+         * @brief Aborts session if it targets (or reads from) any of specified entries
+         * @param entries Entries bitmask
+         *
+         * Must be used whenever entries are modified outside of session (erase, raw write).
+         */
+        void Invalidate(std::uint8_t entries);
+
+        /**
+         * @brief Returns offset in compressed stream from which upload to given entries should be continued
+         * @param entries Entries bitmask
+         * @return Expected stream offset
+         */
+        std::uint32_t StreamOffset(std::uint8_t entries) const;
+
+        /**
+         * @brief Returns number of program bytes written in current session
+         * @return Number of decompressed bytes
+         */
+        inline std::uint32_t ProgramLength() const;
+
+        /** @brief Size of buffer for decompressed data */
+        static constexpr std::size_t ChunkSize = 256;
+
+        /** @brief Maximal length of program that fits in boot table entry */
+        static constexpr std::uint32_t MaxProgramLength = ProgramEntry::Size - 1_KB;
+
+        /** @brief Size of buffer for decompressed patch */
+        static constexpr std::size_t PatchChunkSize = 128;
+
+      private:
+        /**
+         * @brief Starts new session
+         * @param entries Entries bitmask
+         */
+        void Start(std::uint8_t entries);
+
+        /**
+         * @brief Rewinds current session to the beginning of stream
+         */
+        void Rewind();
+
+        /**
+         * @brief Decodes next part of input into chunk buffer
+         * @param input Compressed input
+         * @param consumed Number of input bytes consumed
+         * @param produced Number of program bytes placed in chunk buffer
+         * @return true on success, false if stream is corrupted
+         */
+        bool Decode(gsl::span<const std::uint8_t> input, std::size_t& consumed, std::size_t& produced);
+
+        /**
+         * @brief Checks whether all decoders are at token boundary
+         * @return true if no token is partially processed
+         */
+        bool IsIdle() const;
+
+        /**
+         * @brief Returns total number of program bytes produced in current session
+         * @return Number of program bytes
+         */
+        std::uint32_t TotalProduced() const;
+
+        /**
+         * @brief Programs decompressed chunk to all entries
+         * @param chunk Decompressed data
+         * @return Operation result
+         */
+        CompressedWriteResult Program(gsl::span<const std::uint8_t> chunk);
+
+        /** @brief Boot table */
+        BootTable& _bootTable;
+        /** @brief Entries in current session (0 - no session) */
+        std::uint8_t _entries;
+        /** @brief Source entry of patch session (0 - session is not a patch) */
+        std::uint8_t _sourceEntries;
+        /** @brief Offset in compressed stream up to which data has been processed */
+        std::uint32_t _streamOffset;
+        /** @brief Decoder */
+        lzss::Decoder _decoder;
+        /** @brief Buffer for decompressed data */
+        std::array<std::uint8_t, ChunkSize> _chunk;
+        /** @brief Source program of patch session */
+        gsl::span<const std::uint8_t> _patchSource;
+        /** @brief Patch decoder */
+        PatchDecoder _patch;
+        /** @brief Buffer for decompressed patch */
+        std::array<std::uint8_t, PatchChunkSize> _patchChunk;
+        /** @brief Number of valid bytes in patch buffer */
+        std::uint8_t _patchChunkSize;
+        /** @brief Number of bytes in patch buffer already applied */
+        std::uint8_t _patchChunkPosition;
+    };
+
+    std::uint32_t CompressedProgramWriter::ProgramLength() const
+    {
+        return this->_entries == 0 ? 0 : TotalProduced();
+    }
+
+    /** @} */
+}
+
+#endif /* LIBS_DRIVERS_PROGRAM_FLASH_INCLUDE_PROGRAM_FLASH_COMPRESSED_WRITER_HPP_ */
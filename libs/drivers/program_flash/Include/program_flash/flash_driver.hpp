@@ -158,6 +158,19 @@ namespace program_flash
          */
         virtual FlashStatus Program(std::size_t offset, gsl::span<const std::uint8_t> value) = 0;
 
+        /**
+         * @brief Programs the same bytes at multiple offsets
+         * @param offsets Offsets at which bytes should be programmed
+         * @param value Values to write
+         * @param failedOffset Index of offset at which programming failed
+         * @return Operation result
+         *
+         * Default implementation programs offsets one after another. Drivers can override it to avoid per-call overhead
+         * (e.g. entering faster programming mode once for all offsets).
+         */
+        virtual FlashStatus ProgramMultiple(
+            gsl::span<const std::size_t> offsets, gsl::span<const std::uint8_t> value, std::size_t& failedOffset);
+
         /**
          * @brief Erases single sector (64KB) inside span
          * @param sectorOffset Sector offset
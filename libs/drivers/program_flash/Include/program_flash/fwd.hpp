@@ -7,6 +7,7 @@ namespace program_flash
 {
     class ProgramEntry;
     class BootTable;
+    class CompressedProgramWriter;
 }
 
 #endif /* LIBS_DRIVERS_PROGRAM_FLASH_INCLUDE_PROGRAM_FLASH_FWD_HPP_ */
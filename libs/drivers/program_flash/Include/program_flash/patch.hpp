@@ -0,0 +1,138 @@
+#ifndef LIBS_DRIVERS_PROGRAM_FLASH_INCLUDE_PROGRAM_FLASH_PATCH_HPP_
+#define LIBS_DRIVERS_PROGRAM_FLASH_INCLUDE_PROGRAM_FLASH_PATCH_HPP_
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <gsl/span>
+
+namespace program_flash
+{
+    /**
+     * @ingroup boot_table
+     * @{
+     */
+
+    /**
+     * @brief Patch operation codes
+     *
+     * Patch is a sequence of operations producing new program from source program:
+     *  - Copy - 32-bit source offset, 32-bit length - copies bytes from source
+     *  - Add - 32-bit source offset, 32-bit length, followed by length bytes - each output byte is a sum (modulo 256) of source byte
+     *  and patch byte
+     *  - Insert - 32-bit length, followed by length bytes - bytes are copied from patch
+     *
+     * All fields are little-endian.
+     */
+    enum class PatchOperation : std::uint8_t
+    {
+        Copy = 0,   //!< Copy bytes from source
+        Add = 1,    //!< Add patch bytes to source bytes
+        Insert = 2, //!< Insert bytes from patch
+    };
+
+    /**
+     * @brief Patch decoding status
+     */
+    enum class PatchStatus
+    {
+        Ok,                //!< Patch applied correctly so far
+        InvalidOperation,  //!< Unknown operation code
+        SourceOutOfRange   //!< Operation refers to bytes outside of source program
+    };
+
+    /**
+     * @brief Streaming patch decoder
+     *
+     * Decoder keeps whole state between calls so patch can be fed in arbitrarily sized parts and decoded into arbitrarily
+     * sized output buffers.
+     */
+    class PatchDecoder final
+    {
+      public:
+        /**
+         * @brief Ctor
+         */
+        PatchDecoder();
+
+        /**
+         * @brief Resets decoder to the beginning of new patch
+         * @param source Source program
+         */
+        void Reset(gsl::span<const std::uint8_t> source);
+
+        /**
+         * @brief Decodes next part of patch
+         * @param input Patch part
+         * @param output Buffer for new program
+         * @param consumed Number of input bytes consumed
+         * @param produced Number of bytes written to output
+         * @return Decoding status
+         *
+         * Decoding stops when either whole input is consumed or output buffer is full.
+         */
+        PatchStatus Decode(
+            gsl::span<const std::uint8_t> input, gsl::span<std::uint8_t> output, std::size_t& consumed, std::size_t& produced);
+
+        /**
+         * @brief Returns total number of bytes produced since last reset
+         * @return Number of bytes of new program
+         */
+        inline std::uint32_t TotalProduced() const;
+
+        /**
+         * @brief Checks whether decoder is at operation boundary
+         * @return true if no operation is partially processed
+         */
+        inline bool IsIdle() const;
+
+      private:
+        /** @brief Decoder state */
+        enum class State
+        {
+            Operation, //!< Waiting for operation code
+            Header,    //!< Receiving operation fields
+            Body       //!< Producing operation output
+        };
+
+        /**
+         * @brief Starts operation body after all fields are received
+         * @return Decoding status
+         */
+        PatchStatus BeginBody();
+
+        /** @brief Source program */
+        gsl::span<const std::uint8_t> _source;
+        /** @brief Current state */
+        State _state;
+        /** @brief Current operation */
+        PatchOperation _operation;
+        /** @brief Operation fields */
+        std::array<std::uint8_t, 8> _header;
+        /** @brief Number of received field bytes */
+        std::uint8_t _headerReceived;
+        /** @brief Number of field bytes of current operation */
+        std::uint8_t _headerLength;
+        /** @brief Position in source */
+        std::uint32_t _sourcePosition;
+        /** @brief Number of bytes left to produce in current operation */
+        std::uint32_t _remaining;
+        /** @brief Total number of produced bytes */
+        std::uint32_t _produced;
+    };
+
+    std::uint32_t PatchDecoder::TotalProduced() const
+    {
+        return this->_produced;
+    }
+
+    bool PatchDecoder::IsIdle() const
+    {
+        return this->_state == State::Operation;
+    }
+
+    /** @} */
+}
+
+#endif /* LIBS_DRIVERS_PROGRAM_FLASH_INCLUDE_PROGRAM_FLASH_PATCH_HPP_ */
@@ -1,4 +1,5 @@
 #include "boot_table.hpp"
+#include <algorithm>
 #include <array>
 #include "base/crc.h"
 #include "lld.h"
@@ -9,6 +10,56 @@ namespace program_flash
     static constexpr std::uint32_t ExpectedDeviceId = 0x00530000;
     static constexpr std::uint32_t ExpectedDeviceBootConfig = 0x00000002;
 
+    constexpr std::uint32_t ContentTracker::Unknown;
+
+    ContentTracker::ContentTracker() : _length(Unknown), _crc(0)
+    {
+    }
+
+    void ContentTracker::Erased()
+    {
+        this->_length = 0;
+        this->_crc = 0;
+    }
+
+    void ContentTracker::Invalidate()
+    {
+        this->_length = Unknown;
+    }
+
+    void ContentTracker::Programmed(std::size_t offset, gsl::span<const std::uint8_t> content)
+    {
+        if (this->_length == Unknown)
+        {
+            return;
+        }
+
+        // rewrite of already written area changes content covered by running CRC
+        if (offset != this->_length)
+        {
+            Invalidate();
+            return;
+        }
+
+        this->_crc = CRC_calc(content, this->_crc);
+        this->_length += content.size();
+    }
+
+    bool ContentTracker::Covers(std::size_t offset, std::size_t size) const
+    {
+        return this->_length != Unknown && offset + size <= this->_length;
+    }
+
+    Option<std::uint16_t> ContentTracker::Crc(std::uint32_t length) const
+    {
+        if (this->_length != length)
+        {
+            return None<std::uint16_t>();
+        }
+
+        return Option<std::uint16_t>::Some(this->_crc);
+    }
+
     BootTable::BootTable(IFlashDriver& flash) : _flash(flash)
     {
     }
@@ -24,14 +75,16 @@ namespace program_flash
         return OSResult::Success;
     }
 
-    ProgramEntry::ProgramEntry(IFlashDriver& flash, std::uint8_t index)
-        : _entrySpan(flash.Span(index * Size)), _length(_entrySpan), _crc(_entrySpan), _isValid(_entrySpan), _description(_entrySpan),
+    ProgramEntry::ProgramEntry(IFlashDriver& flash, std::uint8_t index, ContentTracker& tracker)
+        : _tracker(tracker), _entrySpan(flash.Span(index * Size)), _length(_entrySpan), _crc(_entrySpan), _isValid(_entrySpan), _description(_entrySpan),
           _program(_entrySpan)
     {
     }
 
     Result<FlashStatus, std::tuple<FlashStatus, std::size_t>> ProgramEntry::Erase()
     {
+        this->_tracker.Invalidate();
+
         for (std::size_t sectorOffset = 0; sectorOffset < Size; sectorOffset += IFlashDriver::LargeSectorSize)
         {
             auto status = this->_entrySpan.Erase(sectorOffset);
@@ -41,6 +94,8 @@ namespace program_flash
             }
         }
 
+        this->_tracker.Erased();
+
         return {FlashStatus::NotBusy};
     }
 
@@ -93,7 +148,28 @@ namespace program_flash
 
     FlashStatus ProgramEntry::WriteContent(std::size_t offset, gsl::span<const std::uint8_t> content)
     {
-        return this->_program.Program(offset, content);
+        if (IsWritten(offset, content))
+        {
+            return FlashStatus::NotBusy;
+        }
+
+        auto status = this->_program.Program(offset, content);
+
+        if (status == FlashStatus::NotBusy)
+        {
+            this->_tracker.Programmed(offset, gsl::make_span(this->Content() + offset, content.size()));
+        }
+        else
+        {
+            this->_tracker.Invalidate();
+        }
+
+        return status;
+    }
+
+    bool ProgramEntry::IsWritten(std::size_t offset, gsl::span<const std::uint8_t> content) const
+    {
+        return this->_tracker.Covers(offset, content.size()) && std::equal(content.begin(), content.end(), this->Content() + offset);
     }
 
     std::uint16_t ProgramEntry::CalculateCrc() const
@@ -103,6 +179,59 @@ namespace program_flash
         return CRC_calc(programArea);
     }
 
+    Result<FlashStatus, std::tuple<FlashStatus, std::uint8_t>> BootTable::WriteContent(
+        std::uint8_t entries, std::size_t offset, gsl::span<const std::uint8_t> content)
+    {
+        std::array<std::size_t, EntriesCount> offsets;
+        std::array<std::uint8_t, EntriesCount> indexes;
+        std::size_t count = 0;
+
+        for (std::uint8_t i = 0; i < EntriesCount; i++)
+        {
+            if (!has_flag(entries, 1 << i))
+            {
+                continue;
+            }
+
+            auto entry = Entry(i);
+            if (entry.IsWritten(offset, content))
+            {
+                continue;
+            }
+
+            offsets[count] = entry.ContentInFlashOffset() + offset;
+            indexes[count] = i;
+            count++;
+        }
+
+        if (count == 0)
+        {
+            return {FlashStatus::NotBusy};
+        }
+
+        std::size_t failed = 0;
+        auto status = this->_flash.ProgramMultiple(gsl::make_span(offsets.data(), count), content, failed);
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            if (status == FlashStatus::NotBusy)
+            {
+                this->_trackers[indexes[i]].Programmed(offset, gsl::make_span(this->_flash.At(offsets[i]), content.size()));
+            }
+            else
+            {
+                this->_trackers[indexes[i]].Invalidate();
+            }
+        }
+
+        if (status != FlashStatus::NotBusy)
+        {
+            return {std::make_tuple(status, indexes[failed])};
+        }
+
+        return {FlashStatus::NotBusy};
+    }
+
     bool BootTable::Lock(std::chrono::milliseconds timeout)
     {
         return this->_flash.Lock(timeout);
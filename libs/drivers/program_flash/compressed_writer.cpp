@@ -0,0 +1,214 @@
+#include "compressed_writer.hpp"
+#include "logger/logger.h"
+
+namespace program_flash
+{
+    constexpr std::size_t CompressedProgramWriter::ChunkSize;
+    constexpr std::uint32_t CompressedProgramWriter::MaxProgramLength;
+    constexpr std::size_t CompressedProgramWriter::PatchChunkSize;
+
+    static constexpr CompressedWriteResult MakeResult(CompressedWriteStatus status)
+    {
+        return CompressedWriteResult{status, FlashStatus::NotBusy, 0};
+    }
+
+    CompressedProgramWriter::CompressedProgramWriter(BootTable& bootTable)
+        : _bootTable(bootTable), _entries(0), _sourceEntries(0), _streamOffset(0), _patchChunkSize(0), _patchChunkPosition(0)
+    {
+    }
+
+    void CompressedProgramWriter::Start(std::uint8_t entries)
+    {
+        this->_entries = entries;
+        this->_sourceEntries = 0;
+        this->_patchSource = gsl::span<const std::uint8_t>();
+        Rewind();
+    }
+
+    void CompressedProgramWriter::StartPatch(std::uint8_t entries, std::uint8_t sourceEntry, gsl::span<const std::uint8_t> source)
+    {
+        this->_entries = entries;
+        this->_sourceEntries = 1 << sourceEntry;
+        this->_patchSource = source;
+        Rewind();
+    }
+
+    void CompressedProgramWriter::Rewind()
+    {
+        this->_streamOffset = 0;
+        this->_decoder.Reset();
+        this->_patch.Reset(this->_patchSource);
+        this->_patchChunkSize = 0;
+        this->_patchChunkPosition = 0;
+    }
+
+    void CompressedProgramWriter::Invalidate(std::uint8_t entries)
+    {
+        if (((this->_entries | this->_sourceEntries) & entries) != 0)
+        {
+            LOG(LOG_LEVEL_WARNING, "[upload] Compressed upload session invalidated");
+            this->_entries = 0;
+        }
+    }
+
+    std::uint32_t CompressedProgramWriter::StreamOffset(std::uint8_t entries) const
+    {
+        if (entries != this->_entries)
+        {
+            return 0;
+        }
+
+        return this->_streamOffset;
+    }
+
+    bool CompressedProgramWriter::IsIdle() const
+    {
+        if (this->_sourceEntries == 0)
+        {
+            return this->_decoder.IsIdle();
+        }
+
+        return this->_decoder.IsIdle() && this->_patch.IsIdle() && this->_patchChunkPosition == this->_patchChunkSize;
+    }
+
+    std::uint32_t CompressedProgramWriter::TotalProduced() const
+    {
+        return this->_sourceEntries == 0 ? this->_decoder.TotalProduced() : this->_patch.TotalProduced();
+    }
+
+    bool CompressedProgramWriter::Decode(gsl::span<const std::uint8_t> input, std::size_t& consumed, std::size_t& produced)
+    {
+        consumed = 0;
+        produced = 0;
+
+        if (this->_sourceEntries == 0)
+        {
+            return this->_decoder.Decode(input, this->_chunk, consumed, produced) == lzss::DecoderStatus::Ok;
+        }
+
+        while (true)
+        {
+            auto pending = gsl::make_span(this->_patchChunk).subspan(this->_patchChunkPosition, this->_patchChunkSize - this->_patchChunkPosition);
+
+            std::size_t patchConsumed = 0;
+            auto status = this->_patch.Decode(pending, this->_chunk, patchConsumed, produced);
+            if (status != PatchStatus::Ok)
+            {
+                LOGF(LOG_LEVEL_ERROR, "[upload] Unable to apply patch (%d)", num(status));
+                return false;
+            }
+
+            this->_patchChunkPosition += patchConsumed;
+
+            if (produced > 0)
+            {
+                return true;
+            }
+
+            std::size_t lzssConsumed = 0;
+            std::size_t lzssProduced = 0;
+            if (this->_decoder.Decode(input.subspan(consumed), this->_patchChunk, lzssConsumed, lzssProduced) != lzss::DecoderStatus::Ok)
+            {
+                return false;
+            }
+
+            consumed += lzssConsumed;
+            this->_patchChunkSize = lzssProduced;
+            this->_patchChunkPosition = 0;
+
+            if (lzssProduced == 0)
+            {
+                return true;
+            }
+        }
+    }
+
+    CompressedWriteResult CompressedProgramWriter::Write(
+        std::uint8_t entries, std::uint32_t streamOffset, gsl::span<const std::uint8_t> content)
+    {
+        if (entries == 0)
+        {
+            return MakeResult(CompressedWriteStatus::OutOfSequence);
+        }
+
+        if (streamOffset == 0)
+        {
+            if (entries == this->_entries)
+            {
+                Rewind();
+            }
+            else
+            {
+                Start(entries);
+            }
+        }
+
+        if (entries != this->_entries || streamOffset > this->_streamOffset)
+        {
+            return MakeResult(CompressedWriteStatus::OutOfSequence);
+        }
+
+        const std::uint32_t alreadyProcessed = this->_streamOffset - streamOffset;
+        if (alreadyProcessed >= static_cast<std::uint32_t>(content.size()))
+        {
+            return MakeResult(CompressedWriteStatus::Success);
+        }
+
+        auto input = content.subspan(alreadyProcessed);
+
+        while (input.size() > 0 || !IsIdle())
+        {
+            std::size_t consumed = 0;
+            std::size_t produced = 0;
+
+            if (!Decode(input, consumed, produced))
+            {
+                LOGF(LOG_LEVEL_ERROR,
+                    "[upload] Corrupted compressed stream at 0x%lX",
+                    static_cast<std::uint32_t>(this->_streamOffset + consumed));
+                this->_entries = 0;
+                return MakeResult(CompressedWriteStatus::CorruptedStream);
+            }
+
+            if (TotalProduced() > MaxProgramLength)
+            {
+                LOG(LOG_LEVEL_ERROR, "[upload] Decompressed program does not fit in entry");
+                this->_entries = 0;
+                return MakeResult(CompressedWriteStatus::CorruptedStream);
+            }
+
+            if (produced > 0)
+            {
+                auto result = Program(gsl::make_span(this->_chunk).subspan(0, produced));
+                if (result.Status != CompressedWriteStatus::Success)
+                {
+                    this->_entries = 0;
+                    return result;
+                }
+            }
+
+            this->_streamOffset += consumed;
+            input = input.subspan(consumed);
+
+            if (consumed == 0 && produced == 0)
+            {
+                break;
+            }
+        }
+
+        return MakeResult(CompressedWriteStatus::Success);
+    }
+
+    CompressedWriteResult CompressedProgramWriter::Program(gsl::span<const std::uint8_t> chunk)
+    {
+        const std::size_t offset = TotalProduced() - chunk.size();
+
+        auto result = this->_bootTable.WriteContent(this->_entries, offset, chunk);
+        if (!result)
+        {
+            return CompressedWriteResult{CompressedWriteStatus::FlashError, std::get<0>(result.Error()), std::get<1>(result.Error())};
+        }
+
+        return MakeResult(CompressedWriteStatus::Success);
+    }
+}
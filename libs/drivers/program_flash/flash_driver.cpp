@@ -11,4 +11,21 @@ namespace program_flash
     FlashSpan::FlashSpan(IFlashDriver& flash, std::size_t offset) : _flash(flash), _offset(offset)
     {
     }
+
+    FlashStatus IFlashDriver::ProgramMultiple(
+        gsl::span<const std::size_t> offsets, gsl::span<const std::uint8_t> value, std::size_t& failedOffset)
+    {
+        for (decltype(offsets.size()) i = 0; i < offsets.size(); i++)
+        {
+            auto status = Program(offsets[i], value);
+
+            if (status != FlashStatus::NotBusy)
+            {
+                failedOffset = i;
+                return status;
+            }
+        }
+
+        return FlashStatus::NotBusy;
+    }
 }
@@ -0,0 +1,134 @@
+#include "patch.hpp"
+#include "base/reader.h"
+#include "system.h"
+
+namespace program_flash
+{
+    PatchDecoder::PatchDecoder()
+    {
+        Reset(gsl::span<const std::uint8_t>());
+    }
+
+    void PatchDecoder::Reset(gsl::span<const std::uint8_t> source)
+    {
+        this->_source = source;
+        this->_state = State::Operation;
+        this->_operation = PatchOperation::Copy;
+        this->_headerReceived = 0;
+        this->_headerLength = 0;
+        this->_sourcePosition = 0;
+        this->_remaining = 0;
+        this->_produced = 0;
+    }
+
+    PatchStatus PatchDecoder::BeginBody()
+    {
+        Reader r(gsl::make_span(this->_header).subspan(0, this->_headerLength));
+
+        if (this->_operation == PatchOperation::Insert)
+        {
+            this->_remaining = r.ReadDoubleWordLE();
+        }
+        else
+        {
+            this->_sourcePosition = r.ReadDoubleWordLE();
+            this->_remaining = r.ReadDoubleWordLE();
+
+            const std::uint32_t sourceSize = this->_source.size();
+            if (this->_sourcePosition > sourceSize || this->_remaining > sourceSize - this->_sourcePosition)
+            {
+                return PatchStatus::SourceOutOfRange;
+            }
+        }
+
+        this->_state = this->_remaining == 0 ? State::Operation : State::Body;
+
+        return PatchStatus::Ok;
+    }
+
+    PatchStatus PatchDecoder::Decode(
+        gsl::span<const std::uint8_t> input, gsl::span<std::uint8_t> output, std::size_t& consumed, std::size_t& produced)
+    {
+        consumed = 0;
+        produced = 0;
+
+        const std::size_t inputSize = input.size();
+        const std::size_t outputSize = output.size();
+
+        while (produced < outputSize)
+        {
+            if (this->_state == State::Body && this->_operation == PatchOperation::Copy)
+            {
+                output[produced] = this->_source[this->_sourcePosition];
+                produced++;
+                this->_produced++;
+                this->_sourcePosition++;
+                this->_remaining--;
+
+                if (this->_remaining == 0)
+                {
+                    this->_state = State::Operation;
+                }
+
+                continue;
+            }
+
+            if (consumed == inputSize)
+            {
+                break;
+            }
+
+            auto value = input[consumed];
+            consumed++;
+
+            switch (this->_state)
+            {
+                case State::Operation:
+                    if (value > num(PatchOperation::Insert))
+                    {
+                        return PatchStatus::InvalidOperation;
+                    }
+
+                    this->_operation = static_cast<PatchOperation>(value);
+                    this->_headerReceived = 0;
+                    this->_headerLength = this->_operation == PatchOperation::Insert ? 4 : 8;
+                    this->_state = State::Header;
+                    break;
+
+                case State::Header:
+                    this->_header[this->_headerReceived] = value;
+                    this->_headerReceived++;
+
+                    if (this->_headerReceived == this->_headerLength)
+                    {
+                        auto status = BeginBody();
+                        if (status != PatchStatus::Ok)
+                        {
+                            return status;
+                        }
+                    }
+                    break;
+
+                case State::Body:
+                    if (this->_operation == PatchOperation::Add)
+                    {
+                        value += this->_source[this->_sourcePosition];
+                        this->_sourcePosition++;
+                    }
+
+                    output[produced] = value;
+                    produced++;
+                    this->_produced++;
+                    this->_remaining--;
+
+                    if (this->_remaining == 0)
+                    {
+                        this->_state = State::Operation;
+                    }
+                    break;
+            }
+        }
+
+        return PatchStatus::Ok;
+    }
+}
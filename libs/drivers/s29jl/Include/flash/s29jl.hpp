@@ -43,8 +43,31 @@ namespace devices
             virtual program_flash::FlashStatus EraseSector(std::size_t sectorOfffset) override;
 
             virtual program_flash::FlashStatus Program(std::size_t offset, std::uint8_t value) override;
+
+            /**
+             * @brief Programs multiple bytes into flash
+             * @param offset Offset
+             * @param value Value to write
+             * @return Operation result
+             *
+             * Device is switched into unlock bypass mode for the whole operation, so each byte requires only two bus cycles
+             * to start programming. Each byte is verified after programming.
+             */
             virtual program_flash::FlashStatus Program(std::size_t offset, gsl::span<const std::uint8_t> value) override;
 
+            /**
+             * @brief Programs the same bytes at multiple offsets
+             * @param offsets Offsets at which bytes should be programmed
+             * @param value Values to write
+             * @param failedOffset Index of offset at which programming failed
+             * @return Operation result
+             *
+             * Device stays in unlock bypass mode for the whole operation. Program commands are issued one at a time as device
+             * performs only one embedded program operation at a time (regardless of bank). Content is verified after programming.
+             */
+            virtual program_flash::FlashStatus ProgramMultiple(
+                gsl::span<const std::size_t> offsets, gsl::span<const std::uint8_t> value, std::size_t& failedOffset) override;
+
             virtual bool Lock(std::chrono::milliseconds timeout) override;
             virtual void Unlock() override;
 
@@ -56,6 +79,13 @@ namespace devices
              */
             bool WaitForIdle(std::size_t offset);
 
+            /**
+             * @brief Waits for program operation to finish
+             * @param offset Offset of programmed byte
+             * @return Final status of program operation
+             */
+            program_flash::FlashStatus WaitForProgram(std::size_t offset);
+
             /** @brief Synchronization */
             OSSemaphoreHandle _sync;
             /** @brief Pointer for memory area mapped to flash device */
@@ -1,4 +1,5 @@
 #include "s29jl.hpp"
+#include <algorithm>
 #include <chrono>
 #include "lld.h"
 #include "logger/logger.h"
@@ -67,13 +68,63 @@ namespace devices
                 return FlashStatus::Busy;
             }
 
+            lld_UnlockBypassEntryCmd(this->_flashBase);
+
             for (decltype(value.size()) i = 0; i < value.size(); i++)
             {
-                auto d = static_cast<FlashStatus>(lld_ProgramOp(this->_flashBase, offset + i, value[i]));
+                FLASHDATA data = value[i];
+                lld_UnlockBypassProgramCmd(this->_flashBase, offset + i, &data);
+
+                auto status = WaitForProgram(offset + i);
+
+                if (status == FlashStatus::NotBusy && *At(offset + i) != value[i])
+                {
+                    status = FlashStatus::VerifyError;
+                }
 
-                if (d != FlashStatus::NotBusy)
+                if (status != FlashStatus::NotBusy)
                 {
-                    return d;
+                    lld_UnlockBypassResetCmd(this->_flashBase);
+                    return status;
+                }
+            }
+
+            lld_UnlockBypassResetCmd(this->_flashBase);
+
+            return FlashStatus::NotBusy;
+        }
+
+        FlashStatus FlashDriver::ProgramMultiple(
+            gsl::span<const std::size_t> offsets, gsl::span<const std::uint8_t> value, std::size_t& failedOffset)
+        {
+            lld_UnlockBypassEntryCmd(this->_flashBase);
+
+            for (decltype(value.size()) i = 0; i < value.size(); i++)
+            {
+                for (decltype(offsets.size()) j = 0; j < offsets.size(); j++)
+                {
+                    FLASHDATA data = value[i];
+                    lld_UnlockBypassProgramCmd(this->_flashBase, offsets[j] + i, &data);
+
+                    // device runs single embedded operation at a time regardless of bank, next command has to wait for this one
+                    const auto status = WaitForProgram(offsets[j] + i);
+                    if (status != FlashStatus::NotBusy)
+                    {
+                        lld_UnlockBypassResetCmd(this->_flashBase);
+                        failedOffset = j;
+                        return status;
+                    }
+                }
+            }
+
+            lld_UnlockBypassResetCmd(this->_flashBase);
+
+            for (decltype(offsets.size()) j = 0; j < offsets.size(); j++)
+            {
+                if (!std::equal(value.begin(), value.end(), At(offsets[j])))
+                {
+                    failedOffset = j;
+                    return FlashStatus::VerifyError;
                 }
             }
 
@@ -104,6 +155,26 @@ namespace devices
             return dev_status == DEV_NOT_BUSY;
         }
 
+        FlashStatus FlashDriver::WaitForProgram(std::size_t offset)
+        {
+            DEVSTATUS dev_status;
+
+            Timeout t(10s);
+
+            do
+            {
+                dev_status = lld_StatusGet(this->_flashBase, offset);
+            } while (dev_status == DEV_BUSY && !t.Expired());
+
+            if (dev_status != DEV_NOT_BUSY && dev_status != DEV_BUSY)
+            {
+                // failed program operation leaves device in status mode
+                lld_ResetCmd(this->_flashBase);
+            }
+
+            return static_cast<FlashStatus>(dev_status);
+        }
+
         bool FlashDriver::Lock(std::chrono::milliseconds timeout)
         {
             return OS_RESULT_SUCCEEDED(System::TakeSemaphore(this->_sync, timeout));
@@ -1,7 +1,10 @@
 #ifndef LIBS_DRIVERS_SPI_INCLUDE_SPI_EFM_H_
 #define LIBS_DRIVERS_SPI_INCLUDE_SPI_EFM_H_
 
+#include <array>
+#include <chrono>
 #include <cstdint>
+#include <dmadrv.h>
 #include <gsl/span>
 
 #include "base/os.h"
@@ -19,6 +22,28 @@ namespace drivers
          * @{
          */
 
+        /**
+         * @brief SPI bus access priority class
+         */
+        enum class SPIPriority
+        {
+            Bulk,    //!< Throughput oriented traffic (e.g. external flash)
+            Critical //!< Latency sensitive traffic (e.g. FRAM holding persistent state and boot settings)
+        };
+
+        /**
+         * @brief Bus utilisation counters of single slave
+         */
+        struct SPIUtilisation
+        {
+            /** @brief Number of times slave has been selected */
+            std::uint32_t Transactions;
+            /** @brief Number of bytes transferred */
+            std::uint32_t Bytes;
+            /** @brief Longest time spent waiting for access to bus */
+            std::chrono::milliseconds MaxWait;
+        };
+
         /**
          * @brief SPI interface using EFM SPI peripheral
          *
@@ -46,10 +71,26 @@ namespace drivers
              */
             OSResult Read(gsl::span<std::uint8_t> buffer);
 
+            /**
+             * @brief Performs list of transfers as single chain of DMA transfers
+             * @param[in] transfers Transfers to perform in order
+             * @return Operation result
+             *
+             * Transfers are split into parts of at most @ref MaxDMATransfer bytes which are executed as DMA scatter-gather
+             * cycles of up to @ref ChainLength parts on both channels, so command, address and data are clocked out
+             * back to back. Two descriptor chains are used alternately - next chain is prepared while previous one is
+             * being transferred, so longer transactions stream with only chain activation between them.
+             */
+            OSResult Transaction(gsl::span<const SPITransfer> transfers);
+
             /**
              * @brief Locks SPI peripheral
+             * @param[in] priority Priority class of transaction
+             *
+             * Bulk transactions are not granted the bus while any critical transaction is waiting for it, so critical
+             * transaction waits at most for single bulk transaction that is already in progress.
              */
-            void Lock();
+            void Lock(SPIPriority priority = SPIPriority::Bulk);
 
             /**
             * @brief Unlocks SPI peripheral
@@ -57,6 +98,59 @@ namespace drivers
             void Unlock();
 
           private:
+            /** @brief Maximal number of bytes transferred by single DMA descriptor */
+            static constexpr std::ptrdiff_t MaxDMATransfer = 1024;
+            /** @brief Number of scatter-gather descriptors in single chain */
+            static constexpr std::uint8_t ChainLength = 8;
+
+            /** @brief Scatter-gather descriptors for both channels */
+            struct Chain
+            {
+                /** @brief Output channel descriptors */
+                std::array<DMA_DESCRIPTOR_TypeDef, ChainLength> TX;
+                /** @brief Input channel descriptors */
+                std::array<DMA_DESCRIPTOR_TypeDef, ChainLength> RX;
+            };
+
+            /** @brief Position in transaction being transferred */
+            struct ChainPosition
+            {
+                /** @brief Index of current transfer */
+                std::ptrdiff_t Transfer;
+                /** @brief Offset in current transfer */
+                std::ptrdiff_t Offset;
+            };
+
+            /**
+             * @brief Fills chain with descriptors of next transaction parts
+             * @param[out] chain Chain to fill
+             * @param[in] transfers Transaction transfers
+             * @param[in,out] position Position of first part to put in chain, updated to first part not put in chain
+             * @return Number of descriptors in chain (0 if transaction is complete)
+             */
+            static std::uint8_t PrepareChain(Chain& chain, gsl::span<const SPITransfer> transfers, ChainPosition& position);
+
+            /**
+             * @brief Starts scatter-gather cycles on both channels
+             * @param[in] chain Chain to transfer
+             * @param[in] count Number of descriptors in chain
+             */
+            void StartChain(Chain& chain, std::uint8_t count);
+
+            /**
+             * @brief Updates number of critical transactions waiting for bus and gates bulk transactions accordingly
+             * @param[in] change Change of number of waiting critical transactions
+             */
+            void UpdateCriticalPending(std::int8_t change);
+
+            /**
+             * @brief DMA callback called when scatter-gather cycle is finished. Always executes in ISR mode
+             * @param[in] channel Channel number
+             * @param[in] primary Ignored
+             * @param[in] param User-specified param. In this case this pointer
+             */
+            static void OnChainFinished(unsigned int channel, bool primary, void* param);
+
             /**
              * @brief DMA callback called when transfer is finished. Always executes in ISR mode
              * @param[in] channel Channel number
@@ -72,6 +166,8 @@ namespace drivers
             static constexpr OSEventBits TransferRXFinished = 1 << 0;
             /** @brief Input and output transfer finished flag */
             static constexpr OSEventBits TransferFinished = TransferRXFinished | TransferTXFinished;
+            /** @brief Set when no critical transaction is waiting for bus */
+            static constexpr OSEventBits BulkAllowed = 1 << 2;
 
             /** @brief Output data channel */
             unsigned int _txChannel;
@@ -81,6 +177,16 @@ namespace drivers
             EventGroup _transferGroup;
             /** @brief Lock used to synchronize periperhal access */
             OSSemaphoreHandle _lock;
+            /** @brief Lock protecting number of waiting critical transactions */
+            OSSemaphoreHandle _arbitrationLock;
+            /** @brief Number of critical transactions waiting for bus */
+            std::uint8_t _criticalPending;
+            /** @brief Output channel callback used by scatter-gather cycles */
+            DMA_CB_TypeDef _txChainCallback;
+            /** @brief Input channel callback used by scatter-gather cycles */
+            DMA_CB_TypeDef _rxChainCallback;
+            /** @brief Descriptor chains used alternately by @ref Transaction */
+            std::array<Chain, 2> _chains;
         };
 
         /**
@@ -93,19 +199,31 @@ namespace drivers
              * @brief Initializes @ref EFMSPISlaveInterface instance
              * @param[in] spi SPI peripheral to use
              * @param[in] pin Pin used as slave select
+             * @param[in] priority Priority class of all transactions with this slave
              */
-            EFMSPISlaveInterface(EFMSPIInterface& spi, const drivers::gpio::Pin& pin);
+            EFMSPISlaveInterface(EFMSPIInterface& spi, const drivers::gpio::Pin& pin, SPIPriority priority = SPIPriority::Bulk);
 
             virtual void Select() override;
             virtual void Deselect() override;
             virtual OSResult Write(gsl::span<const std::uint8_t> buffer) override;
             virtual OSResult Read(gsl::span<std::uint8_t> buffer) override;
+            virtual OSResult Transaction(gsl::span<const SPITransfer> transfers) override;
+
+            /**
+             * @brief Returns bus utilisation counters of this slave
+             * @return Utilisation counters
+             */
+            SPIUtilisation Utilisation() const;
 
           private:
             /** @brief SPI peripheral to use */
             EFMSPIInterface& _spi;
             /** @brief Pin used as slave select */
             const drivers::gpio::Pin& _pin;
+            /** @brief Priority class of transactions */
+            const SPIPriority _priority;
+            /** @brief Utilisation counters */
+            SPIUtilisation _utilisation;
         };
 
         /** @} */
@@ -21,6 +21,33 @@ namespace drivers
          * @{
          */
 
+        /**
+         * @brief Single part of SPI transaction
+         *
+         * Transfer either writes buffer to device or reads from device into buffer, never both.
+         */
+        struct SPITransfer
+        {
+            /**
+             * @brief Creates transfer writing buffer to device
+             * @param[in] buffer Buffer to write
+             * @return Transfer
+             */
+            static SPITransfer Write(gsl::span<const std::uint8_t> buffer);
+
+            /**
+             * @brief Creates transfer reading from device
+             * @param[in] buffer Buffer to fill
+             * @return Transfer
+             */
+            static SPITransfer Read(gsl::span<std::uint8_t> buffer);
+
+            /** @brief Buffer written to device (empty for read transfer) */
+            gsl::span<const std::uint8_t> Output;
+            /** @brief Buffer filled with data read from device (empty for write transfer) */
+            gsl::span<std::uint8_t> Input;
+        };
+
         /**
          * @brief SPI interface
          */
@@ -42,6 +69,15 @@ namespace drivers
              * @return Operation result
              */
             virtual OSResult Read(gsl::span<std::uint8_t> buffer) = 0;
+            /**
+             * @brief Performs list of transfers (e.g. command, address and data) as single transaction
+             * @param[in] transfers Transfers to perform in order
+             * @return Operation result
+             *
+             * Slave is not selected by this method. Default implementation performs transfers one by one using
+             * @ref Write and @ref Read and stops on first failure.
+             */
+            virtual OSResult Transaction(gsl::span<const SPITransfer> transfers);
         };
 
         /**
@@ -18,6 +18,14 @@ using namespace drivers::spi;
 static void* RXPort = const_cast<uint32_t*>(&io_map::SPI::Peripheral->RXDATA);
 static void* TXPort = const_cast<uint32_t*>(&io_map::SPI::Peripheral->TXDATA);
 
+/** @brief Byte clocked out while reading in transaction */
+static uint8_t TXFiller = 0xFF;
+/** @brief Bytes received while writing in transaction are discarded here */
+static uint8_t RXSink;
+
+constexpr std::ptrdiff_t EFMSPIInterface::MaxDMATransfer;
+constexpr std::uint8_t EFMSPIInterface::ChainLength;
+
 void EFMSPIInterface::Initialize()
 {
     efm::cmu::ClockEnable(efm::Clock(io_map::SPI::Peripheral), true);
@@ -41,9 +49,17 @@ void EFMSPIInterface::Initialize()
 
     efm::usart::Enable(io_map::SPI::Peripheral, usartEnable);
 
+    this->_txChainCallback = DMA_CB_TypeDef{OnChainFinished, this, 0};
+    this->_rxChainCallback = DMA_CB_TypeDef{OnChainFinished, this, 0};
+
     this->_transferGroup.Initialize();
     this->_lock = System::CreateBinarySemaphore();
     System::GiveSemaphore(this->_lock);
+
+    this->_arbitrationLock = System::CreateBinarySemaphore();
+    System::GiveSemaphore(this->_arbitrationLock);
+    this->_criticalPending = 0;
+    this->_transferGroup.Set(BulkAllowed);
 }
 
 OSResult EFMSPIInterface::Write(gsl::span<const std::uint8_t> buffer)
@@ -131,6 +147,117 @@ OSResult EFMSPIInterface::Read(gsl::span<std::uint8_t> buffer)
     return OSResult::Success;
 }
 
+OSResult EFMSPIInterface::Transaction(gsl::span<const SPITransfer> transfers)
+{
+    ChainPosition position{0, 0};
+    std::uint8_t current = 0;
+
+    auto count = PrepareChain(this->_chains[current], transfers, position);
+
+    if (count == 0)
+    {
+        return OSResult::Success;
+    }
+
+    efm::usart::Command(io_map::SPI::Peripheral, USART_CMD_CLEARRX);
+    efm::usart::Command(io_map::SPI::Peripheral, USART_CMD_CLEARTX);
+
+    efm::usart::IntClear(io_map::SPI::Peripheral, efm::usart::IntGet(io_map::SPI::Peripheral));
+
+    while (count > 0)
+    {
+        this->_transferGroup.Clear(TransferFinished);
+
+        this->StartChain(this->_chains[current], count);
+
+        current ^= 1;
+        count = PrepareChain(this->_chains[current], transfers, position);
+
+        auto result = this->_transferGroup.WaitAll(TransferFinished, true, io_map::SPI::DMATransferTimeout);
+
+        if (!has_flag(result, TransferFinished))
+        {
+            return OSResult::Timeout;
+        }
+    }
+
+    return OSResult::Success;
+}
+
+std::uint8_t EFMSPIInterface::PrepareChain(Chain& chain, gsl::span<const SPITransfer> transfers, ChainPosition& position)
+{
+    std::uint8_t count = 0;
+
+    while (count < ChainLength && position.Transfer < transfers.size())
+    {
+        auto& transfer = transfers[position.Transfer];
+        const bool isRead = !transfer.Input.empty();
+        const auto length = isRead ? transfer.Input.size() : transfer.Output.size();
+
+        if (position.Offset >= length)
+        {
+            position.Transfer++;
+            position.Offset = 0;
+            continue;
+        }
+
+        const auto part = std::min(MaxDMATransfer, length - position.Offset);
+
+        DMA_CfgDescrSGAlt_TypeDef tx;
+        tx.src = isRead ? &TXFiller : const_cast<uint8_t*>(transfer.Output.data() + position.Offset);
+        tx.dst = TXPort;
+        tx.srcInc = isRead ? dmaDataIncNone : dmaDataInc1;
+        tx.dstInc = dmaDataIncNone;
+        tx.size = dmaDataSize1;
+        tx.arbRate = dmaArbitrate1;
+        tx.nMinus1 = static_cast<uint16_t>(part - 1);
+        tx.hprot = 0;
+        tx.peripheral = true;
+
+        DMA_CfgDescrSGAlt_TypeDef rx = tx;
+        rx.src = RXPort;
+        rx.dst = isRead ? transfer.Input.data() + position.Offset : &RXSink;
+        rx.srcInc = dmaDataIncNone;
+        rx.dstInc = isRead ? dmaDataInc1 : dmaDataIncNone;
+
+        efm::dma::CfgDescrScatterGather(chain.TX.data(), count, &tx);
+        efm::dma::CfgDescrScatterGather(chain.RX.data(), count, &rx);
+
+        position.Offset += part;
+        count++;
+    }
+
+    return count;
+}
+
+void EFMSPIInterface::StartChain(Chain& chain, std::uint8_t count)
+{
+    DMA_CfgChannel_TypeDef rx;
+    rx.highPri = false;
+    rx.enableInt = true;
+    rx.select = efm::DMASignal<efm::DMASignalUSART::RXDATAV>(io_map::SPI::Peripheral);
+    rx.cb = &this->_rxChainCallback;
+
+    DMA_CfgChannel_TypeDef tx;
+    tx.highPri = false;
+    tx.enableInt = true;
+    tx.select = efm::DMASignal<efm::DMASignalUSART::TXBL>(io_map::SPI::Peripheral);
+    tx.cb = &this->_txChainCallback;
+
+    efm::dma::CfgChannel(this->_rxChannel, &rx);
+    efm::dma::CfgChannel(this->_txChannel, &tx);
+
+    efm::dma::ActivateScatterGather(this->_rxChannel, false, chain.RX.data(), count);
+    efm::dma::ActivateScatterGather(this->_txChannel, false, chain.TX.data(), count);
+}
+
+void EFMSPIInterface::OnChainFinished(unsigned int channel, bool primary, void* param)
+{
+    UNUSED(primary);
+
+    OnTransferFinished(channel, 0, param);
+}
+
 bool EFMSPIInterface::OnTransferFinished(unsigned int channel, unsigned int sequenceNo, void* param)
 {
     UNUSED(channel, sequenceNo);
@@ -148,13 +275,20 @@ bool EFMSPIInterface::OnTransferFinished(unsigned int channel, unsigned int sequ
 
     return true;
 }
-EFMSPISlaveInterface::EFMSPISlaveInterface(EFMSPIInterface& spi, const drivers::gpio::Pin& pin) : _spi(spi), _pin(pin)
+EFMSPISlaveInterface::EFMSPISlaveInterface(EFMSPIInterface& spi, const drivers::gpio::Pin& pin, SPIPriority priority)
+    : _spi(spi), _pin(pin), _priority(priority), _utilisation{0, 0, std::chrono::milliseconds(0)}
 {
 }
 
 void EFMSPISlaveInterface::Select()
 {
-    this->_spi.Lock();
+    const auto start = System::GetUptime();
+
+    this->_spi.Lock(this->_priority);
+
+    this->_utilisation.Transactions++;
+    this->_utilisation.MaxWait = std::max(this->_utilisation.MaxWait, System::GetUptime() - start);
+
     this->_pin.Low();
 }
 
@@ -166,17 +300,66 @@ void EFMSPISlaveInterface::Deselect()
 
 OSResult EFMSPISlaveInterface::Write(gsl::span<const std::uint8_t> buffer)
 {
+    this->_utilisation.Bytes += buffer.size();
     return this->_spi.Write(buffer);
 }
 
 OSResult EFMSPISlaveInterface::Read(gsl::span<std::uint8_t> buffer)
 {
+    this->_utilisation.Bytes += buffer.size();
     return this->_spi.Read(buffer);
 }
 
-void drivers::spi::EFMSPIInterface::Lock()
+OSResult EFMSPISlaveInterface::Transaction(gsl::span<const SPITransfer> transfers)
+{
+    for (auto& transfer : transfers)
+    {
+        this->_utilisation.Bytes += transfer.Output.size() + transfer.Input.size();
+    }
+
+    return this->_spi.Transaction(transfers);
+}
+
+SPIUtilisation EFMSPISlaveInterface::Utilisation() const
+{
+    return this->_utilisation;
+}
+
+void drivers::spi::EFMSPIInterface::Lock(SPIPriority priority)
 {
+    if (priority == SPIPriority::Critical)
+    {
+        this->UpdateCriticalPending(1);
+    }
+    else
+    {
+        this->_transferGroup.WaitAll(BulkAllowed, false, InfiniteTimeout);
+    }
+
     System::TakeSemaphore(this->_lock, InfiniteTimeout);
+
+    if (priority == SPIPriority::Critical)
+    {
+        this->UpdateCriticalPending(-1);
+    }
+}
+
+void drivers::spi::EFMSPIInterface::UpdateCriticalPending(std::int8_t change)
+{
+    System::TakeSemaphore(this->_arbitrationLock, InfiniteTimeout);
+
+    this->_criticalPending += change;
+
+    if (this->_criticalPending == 0)
+    {
+        this->_transferGroup.Set(BulkAllowed);
+    }
+    else
+    {
+        this->_transferGroup.Clear(BulkAllowed);
+    }
+
+    System::GiveSemaphore(this->_arbitrationLock);
 }
 
 void drivers::spi::EFMSPIInterface::Unlock()
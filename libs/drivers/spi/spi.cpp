@@ -4,6 +4,31 @@
 using namespace drivers::spi;
 using drivers::gpio::Pin;
 
+SPITransfer SPITransfer::Write(gsl::span<const std::uint8_t> buffer)
+{
+    return SPITransfer{buffer, gsl::span<std::uint8_t>()};
+}
+
+SPITransfer SPITransfer::Read(gsl::span<std::uint8_t> buffer)
+{
+    return SPITransfer{gsl::span<const std::uint8_t>(), buffer};
+}
+
+OSResult ISPIInterface::Transaction(gsl::span<const SPITransfer> transfers)
+{
+    for (auto& transfer : transfers)
+    {
+        const auto result = transfer.Input.empty() ? this->Write(transfer.Output) : this->Read(transfer.Input);
+
+        if (OS_RESULT_FAILED(result))
+        {
+            return result;
+        }
+    }
+
+    return OSResult::Success;
+}
+
 SPISelectSlave::SPISelectSlave(ISPIInterface& spi) : _spi(spi)
 {
     this->_spi.Select();
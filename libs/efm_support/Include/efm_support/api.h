@@ -265,6 +265,58 @@ namespace efm
             DMADRV_DataSize_t size,
             DMADRV_Callback_t callback,
             void* cbUserParam);
+
+        /***************************************************************************/ /**
+          * @brief
+          *  Configure a DMA channel.
+          *
+          * @param[in] channel
+          *  DMA channel to configure.
+          *
+          * @param[in] cfg
+          *  Configuration to use. Referenced callback structure must outlive all transfers
+          *  performed on the channel.
+          *
+          * @ingroup efm_support
+          ******************************************************************************/
+        void CfgChannel(unsigned int channel, DMA_CfgChannel_TypeDef* cfg);
+
+        /***************************************************************************/ /**
+          * @brief
+          *  Configure an alternate DMA descriptor for use with scatter-gather DMA cycles.
+          *
+          * @param[in] descr
+          *  Points to start of memory area holding the alternate descriptors.
+          *
+          * @param[in] indx
+          *  Alternate descriptor index number to configure.
+          *
+          * @param[in] cfg
+          *  Descriptor configuration to use.
+          *
+          * @ingroup efm_support
+          ******************************************************************************/
+        void CfgDescrScatterGather(DMA_DESCRIPTOR_TypeDef* descr, unsigned int indx, DMA_CfgDescrSGAlt_TypeDef* cfg);
+
+        /***************************************************************************/ /**
+          * @brief
+          *  Activate DMA scatter-gather cycle (chain of alternate descriptors).
+          *
+          * @param[in] channel
+          *  DMA channel to activate DMA cycle for.
+          *
+          * @param[in] useBurst
+          *  If true, burst feature is used.
+          *
+          * @param[in] altDescr
+          *  Points to list of alternate descriptors configured with @ref CfgDescrScatterGather.
+          *
+          * @param[in] count
+          *  Number of alternate descriptors in @a altDescr list.
+          *
+          * @ingroup efm_support
+          ******************************************************************************/
+        void ActivateScatterGather(unsigned int channel, bool useBurst, DMA_DESCRIPTOR_TypeDef* altDescr, unsigned int count);
     }
 
     namespace mcu
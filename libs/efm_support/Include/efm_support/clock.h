@@ -38,6 +38,12 @@ namespace efm
     {
         if (hw == TIMER0)
             return cmuClock_TIMER0;
+        if (hw == TIMER1)
+            return cmuClock_TIMER1;
+        if (hw == TIMER2)
+            return cmuClock_TIMER2;
+        if (hw == TIMER3)
+            return cmuClock_TIMER3;
 
         return static_cast<CMU_Clock_TypeDef>(0);
     }
@@ -77,6 +77,21 @@ namespace efm
         {
             return DMADRV_MemoryPeripheral(channelId, peripheralSignal, dst, src, srcInc, len, size, callback, cbUserParam);
         }
+
+        void CfgChannel(unsigned int channel, DMA_CfgChannel_TypeDef* cfg)
+        {
+            DMA_CfgChannel(channel, cfg);
+        }
+
+        void CfgDescrScatterGather(DMA_DESCRIPTOR_TypeDef* descr, unsigned int indx, DMA_CfgDescrSGAlt_TypeDef* cfg)
+        {
+            DMA_CfgDescrScatterGather(descr, indx, cfg);
+        }
+
+        void ActivateScatterGather(unsigned int channel, bool useBurst, DMA_DESCRIPTOR_TypeDef* altDescr, unsigned int count)
+        {
+            DMA_ActivateScatterGather(channel, useBurst, altDescr, count);
+        }
     }
 
     namespace mcu
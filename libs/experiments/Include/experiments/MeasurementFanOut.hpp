@@ -0,0 +1,125 @@
+#ifndef LIBS_EXPERIMENTS_INCLUDE_EXPERIMENTS_MEASUREMENT_FAN_OUT_HPP_
+#define LIBS_EXPERIMENTS_INCLUDE_EXPERIMENTS_MEASUREMENT_FAN_OUT_HPP_
+
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace experiments
+{
+    /**
+     * @addtogroup experiments
+     * @{
+     */
+
+    /**
+     * @brief Measurement split into start and completion phases
+     * @tparam Start Callable returning bool that triggers measurement
+     * @tparam Complete Callable returning bool that waits for measurement and retrieves its result
+     */
+    template <typename Start, typename Complete> class SplitMeasurement final
+    {
+      public:
+        /**
+         * @brief Ctor
+         * @param[in] start Callable triggering measurement
+         * @param[in] complete Callable collecting measurement result
+         */
+        SplitMeasurement(Start start, Complete complete);
+
+        /**
+         * @brief Triggers measurement
+         * @return Operation status
+         */
+        bool Begin();
+
+        /**
+         * @brief Collects measurement result
+         * @return Operation status. Measurement that failed to start is not collected and reported as failed.
+         */
+        bool End();
+
+      private:
+        /** @brief Callable triggering measurement */
+        Start _start;
+        /** @brief Callable collecting measurement result */
+        Complete _complete;
+        /** @brief true if measurement has been started successfully */
+        bool _started;
+    };
+
+    template <typename Start, typename Complete>
+    SplitMeasurement<Start, Complete>::SplitMeasurement(Start start, Complete complete)
+        : _start(std::move(start)), _complete(std::move(complete)), _started(false)
+    {
+    }
+
+    template <typename Start, typename Complete> bool SplitMeasurement<Start, Complete>::Begin()
+    {
+        this->_started = this->_start();
+        return this->_started;
+    }
+
+    template <typename Start, typename Complete> bool SplitMeasurement<Start, Complete>::End()
+    {
+        if (!this->_started)
+        {
+            return false;
+        }
+
+        this->_started = false;
+        return this->_complete();
+    }
+
+    /**
+     * @brief Creates measurement triggered by one call and collected by another (e.g. interrupt driven device)
+     * @param[in] start Callable returning bool that triggers measurement
+     * @param[in] complete Callable returning bool that waits for measurement and retrieves its result
+     * @return Split measurement
+     */
+    template <typename Start, typename Complete> inline SplitMeasurement<Start, Complete> Split(Start start, Complete complete)
+    {
+        return SplitMeasurement<Start, Complete>(std::move(start), std::move(complete));
+    }
+
+    /**
+     * @brief Creates measurement performed completely in start phase (e.g. synchronous I2C read)
+     * @param[in] read Callable returning bool that performs measurement
+     * @return Split measurement with empty completion phase
+     */
+    template <typename Read> inline auto Immediate(Read read)
+    {
+        return Split(std::move(read), []() { return true; });
+    }
+
+    /**
+     * @brief Gathers measurements of independent devices concurrently
+     * @param[in] measurements Measurements created with @ref Split or @ref Immediate
+     * @return true if all measurements succeeded
+     *
+     * All measurements are started in order they are passed before any of them is collected, then they are
+     * collected in the same order. Passing interrupt driven measurements first makes them integrate while
+     * subsequent immediate reads are performed, so single data point takes roughly as long as the slowest
+     * measurement instead of the sum of all of them and its samples are taken closer to each other.
+     *
+     * Measurements that share single device (and its data ready line) must not be passed together.
+     */
+    template <typename... Measurements> bool FanOut(Measurements&&... measurements)
+    {
+        static_assert(sizeof...(Measurements) > 0, "At least one measurement is required");
+
+        // braced initializer lists guarantee left to right evaluation
+        const bool started[] = {measurements.Begin()...};
+        const bool completed[] = {measurements.End()...};
+
+        static_cast<void>(started);
+
+        return std::all_of(std::begin(completed), std::end(completed), [](bool result) { return result; });
+    }
+
+    /** @} */
+}
+
+#endif /* LIBS_EXPERIMENTS_INCLUDE_EXPERIMENTS_MEASUREMENT_FAN_OUT_HPP_ */
@@ -0,0 +1,81 @@
+#ifndef LIBS_EXPERIMENTS_INCLUDE_EXPERIMENTS_PERIODIC_SAMPLER_HPP_
+#define LIBS_EXPERIMENTS_INCLUDE_EXPERIMENTS_PERIODIC_SAMPLER_HPP_
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace experiments
+{
+    /**
+     * @addtogroup experiments
+     * @{
+     */
+
+    /**
+     * @brief Statistics of periodic sampling performed by experiment
+     */
+    struct SamplingStatistics
+    {
+        /** @brief Requested sampling period */
+        std::chrono::milliseconds Period;
+        /** @brief Average period between consecutive samples */
+        std::chrono::milliseconds AchievedPeriod;
+        /** @brief Largest delay between sampling deadline and the moment sample was taken */
+        std::chrono::milliseconds MaxJitter;
+        /** @brief Number of taken samples */
+        std::uint32_t Samples;
+        /** @brief Number of sampling deadlines skipped as previous sample took longer than whole period */
+        std::uint32_t MissedDeadlines;
+    };
+
+    /**
+     * @brief Drift free periodic sampling schedule
+     *
+     * Sample n is due at start + n * period. Waiting is done with absolute deadlines (see System::SleepUntil),
+     * so time spent on taking sample (e.g. I2C transfers) does not shift subsequent samples.
+     * Sample that is late less than one period is taken immediately. Deadlines that passed completely
+     * are skipped and counted as missed so that samples stay aligned to the original schedule.
+     */
+    class PeriodicSampler final
+    {
+      public:
+        /**
+         * @brief Ctor
+         */
+        PeriodicSampler();
+
+        /**
+         * @brief Starts new schedule and resets statistics
+         * @param period Sampling period
+         * @remark First sample is due immediately.
+         */
+        void Start(std::chrono::milliseconds period);
+
+        /**
+         * @brief Waits until next sample is due and records it as taken
+         */
+        void WaitForNextSample();
+
+        /**
+         * @brief Returns sampling statistics
+         * @return Sampling statistics since last @ref Start
+         */
+        const SamplingStatistics& Statistics() const;
+
+      private:
+        /** @brief Deadline of next sample (system uptime) */
+        std::chrono::milliseconds _nextDeadline;
+
+        /** @brief Moment at which first sample was taken (system uptime) */
+        std::chrono::milliseconds _firstSample;
+
+        /** @brief Sampling statistics */
+        SamplingStatistics _statistics;
+    };
+
+    /** @} */
+}
+
+#endif /* LIBS_EXPERIMENTS_INCLUDE_EXPERIMENTS_PERIODIC_SAMPLER_HPP_ */
@@ -1,6 +1,7 @@
 #ifndef LIBS_MISSION_EXPERIMENTS_INCLUDE_MISSION_EXPERIMENTS_H_
 #define LIBS_MISSION_EXPERIMENTS_INCLUDE_MISSION_EXPERIMENTS_H_
 
+#include "PeriodicSampler.hpp"
 #include "base/os.h"
 #include "gsl/span"
 
@@ -53,6 +54,8 @@ namespace experiments
         Option<IterationResult> LastIterationResult;
         /** @brief Experiment iteration counter */
         std::uint32_t IterationCounter;
+        /** @brief Sampling statistics of current (or last) experiment */
+        SamplingStatistics Sampling;
     };
 
     /**
@@ -82,8 +85,19 @@ namespace experiments
          * @param lastResult Result of last iteration
          */
         virtual void Stop(IterationResult lastResult) = 0;
+
+        /**
+         * @brief Returns statistics of periodic sampling performed by experiment
+         * @return Sampling statistics. Experiments that do not sample periodically report empty statistics.
+         */
+        virtual SamplingStatistics Sampling();
     };
 
+    inline SamplingStatistics IExperiment::Sampling()
+    {
+        return SamplingStatistics{};
+    }
+
     /**
      * @brief Interface of object responsible for controlling currently performed experiment.
      */
@@ -212,6 +226,9 @@ namespace experiments
         /** @brief Experiment iterations counter */
         std::uint32_t _iterationCounter;
 
+        /** @brief Sampling statistics of current experiment */
+        SamplingStatistics _sampling;
+
         /** @brief Background task */
         Task<ExperimentController*, 4_KB, TaskPriority::P4> _task;
     };
@@ -0,0 +1,59 @@
+#include "PeriodicSampler.hpp"
+#include <algorithm>
+#include "base/os.h"
+
+using namespace std::chrono_literals;
+
+namespace experiments
+{
+    PeriodicSampler::PeriodicSampler() : _nextDeadline(0ms), _firstSample(0ms), _statistics{}
+    {
+    }
+
+    void PeriodicSampler::Start(std::chrono::milliseconds period)
+    {
+        this->_statistics = SamplingStatistics{};
+        this->_statistics.Period = period;
+        this->_nextDeadline = System::GetUptime();
+        this->_firstSample = this->_nextDeadline;
+    }
+
+    void PeriodicSampler::WaitForNextSample()
+    {
+        const auto period = this->_statistics.Period;
+        const auto now = System::GetUptime();
+
+        if (period > 0ms && now >= this->_nextDeadline + period)
+        {
+            const auto missed = (now - this->_nextDeadline) / period;
+            this->_nextDeadline += missed * period;
+            this->_statistics.MissedDeadlines += static_cast<std::uint32_t>(missed);
+        }
+
+        auto sampleAt = now;
+        if (now < this->_nextDeadline)
+        {
+            System::SleepUntil(this->_nextDeadline);
+            sampleAt = std::max(System::GetUptime(), this->_nextDeadline);
+        }
+
+        this->_statistics.MaxJitter = std::max(this->_statistics.MaxJitter, sampleAt - this->_nextDeadline);
+
+        if (this->_statistics.Samples == 0)
+        {
+            this->_firstSample = sampleAt;
+        }
+        else
+        {
+            this->_statistics.AchievedPeriod = (sampleAt - this->_firstSample) / this->_statistics.Samples;
+        }
+
+        this->_statistics.Samples++;
+        this->_nextDeadline += period;
+    }
+
+    const SamplingStatistics& PeriodicSampler::Statistics() const
+    {
+        return this->_statistics;
+    }
+}
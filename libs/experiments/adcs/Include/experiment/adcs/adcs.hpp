@@ -33,6 +33,11 @@ namespace experiment
              * @param interval Interval between samples
              */
             virtual void SampleRate(std::chrono::seconds interval) = 0;
+            /**
+             * @brief Selects format of gyroscope, magnetometer and dipoles records
+             * @param enabled true to store them as delta records, false to store raw telemetry
+             */
+            virtual void DeltaRecords(bool enabled) = 0;
         };
 
         struct DetumblingDataPoint;
@@ -67,11 +72,19 @@ namespace experiment
 
             virtual void Duration(std::chrono::seconds duration) override;
             virtual void SampleRate(std::chrono::seconds interval) override;
+            virtual void DeltaRecords(bool enabled) override;
 
             virtual experiments::ExperimentCode Type() override;
             virtual experiments::StartResult Start() override;
             virtual experiments::IterationResult Iteration() override;
             virtual void Stop(experiments::IterationResult lastResult) override;
+            virtual experiments::SamplingStatistics Sampling() override;
+
+            /**
+             * @brief Attaches background writer for experiment file
+             * @param writer Background writer. nullptr selects synchronous writes.
+             */
+            void SetFileWriter(experiments::fs::ExperimentFileWriter* writer);
 
             /**
              * @brief Gathers measurements from sensors and builds single data point
@@ -91,7 +104,12 @@ namespace experiment
             services::time::ICurrentTime& _time;
             /** @brief Experiment duration */
             std::chrono::milliseconds _duration;
+            /** @brief Interval between samples */
             std::chrono::seconds _sampleRate;
+            /** @brief Store sensor samples as delta records */
+            bool _deltaRecords = false;
+            /** @brief Sampling schedule */
+            experiments::PeriodicSampler _sampler;
             /** @brief Point at time at which experiment should stop */
             std::chrono::milliseconds _endAt;
             /** @brief Power control */
@@ -35,8 +35,9 @@ namespace experiment
             /**
              * @brief Writes data point to experiment file
              * @param file Experiment file
+             * @param deltaRecords Store gyroscope, magnetometer and dipoles as delta records instead of raw telemetry
              */
-            void WriteTo(experiments::fs::ExperimentFile& file);
+            void WriteTo(experiments::fs::ExperimentFile& file, bool deltaRecords = false);
         };
     }
 }
@@ -1,10 +1,13 @@
 #include "adcs.hpp"
 #include "data_point.hpp"
+#include "experiments/MeasurementFanOut.hpp"
 #include "gyro/driver.hpp"
 #include "logger/logger.h"
 #include "power/power.h"
 
+using experiments::Immediate;
 using experiments::IterationResult;
+using experiments::Split;
 using experiments::StartResult;
 using PID = experiments::fs::ExperimentFile::PID;
 using services::fs::FileOpen;
@@ -37,6 +40,11 @@ namespace experiment
             this->_sampleRate = interval;
         }
 
+        void DetumblingExperiment::DeltaRecords(bool enabled)
+        {
+            this->_deltaRecords = enabled;
+        }
+
         experiments::ExperimentCode DetumblingExperiment::Type()
         {
             return Code;
@@ -77,6 +85,7 @@ namespace experiment
                 System::SleepTask(2s);
 
                 this->_endAt = start.Value + this->_duration;
+                this->_sampler.Start(this->_sampleRate);
 
                 return StartResult::Success;
 
@@ -101,6 +110,16 @@ namespace experiment
             CleanUp();
         }
 
+        experiments::SamplingStatistics DetumblingExperiment::Sampling()
+        {
+            return this->_sampler.Statistics();
+        }
+
+        void DetumblingExperiment::SetFileWriter(experiments::fs::ExperimentFileWriter* writer)
+        {
+            this->_dataSet.SetWriter(writer);
+        }
+
         IterationResult DetumblingExperiment::Iteration()
         {
             auto now = this->_time.GetCurrentTime();
@@ -115,11 +134,11 @@ namespace experiment
                 return IterationResult::Finished;
             }
 
-            auto point = GatherSingleMeasurement();
+            this->_sampler.WaitForNextSample();
 
-            point.WriteTo(this->_dataSet);
+            auto point = GatherSingleMeasurement();
 
-            System::SleepTask(this->_sampleRate);
+            point.WriteTo(this->_dataSet, this->_deltaRecords);
 
             return IterationResult::LoopImmediately;
         }
@@ -129,18 +148,41 @@ namespace experiment
             DetumblingDataPoint point;
 
             point.Timestamp = this->_time.GetCurrentTime().Value;
-            point.Gyro = this->_gyro.read().Value;
 
-            this->_payload.MeasureSunSRef(point.ReferenceSunS);
+            // gyroscope and iMTQ state are read while payload measures SunS reference voltages
+            experiments::FanOut(
+                Split([this]() { return this->_payload.BeginSunSRefMeasurement() == OSResult::Success; },
+                    [this, &point]() { return this->_payload.EndSunSRefMeasurement(point.ReferenceSunS) == OSResult::Success; }),
+                Immediate([this, &point]() {
+                    point.Gyro = this->_gyro.read().Value;
+                    return true;
+                }),
+                Immediate([this, &point]() { return this->_imtq.GetLastAdcsState(point.Magnetometer, point.Dipoles); }));
+
+            // payload performs single measurement at a time
             this->_payload.MeasurePhotodiodes(point.Photodiodes);
             this->_payload.MeasureTemperatures(point.Temperatures);
 
-            this->_imtq.GetLastAdcsState(point.Magnetometer, point.Dipoles);
-
             return point;
         }
 
-        void DetumblingDataPoint::WriteTo(experiments::fs::ExperimentFile& file)
+        /**
+         * @brief Writes single BitWriter-serialized telemetry element as experiment file record
+         * @param file Experiment file
+         * @param pid Record PID
+         * @param element Telemetry element
+         */
+        template <typename Element> static void WriteElement(experiments::fs::ExperimentFile& file, PID pid, const Element& element)
+        {
+            std::array<std::uint8_t, (Element::BitSize() + 7) / 8> buf;
+            BitWriter w(buf);
+
+            element.Write(w);
+
+            file.Write(pid, w.Capture());
+        }
+
+        void DetumblingDataPoint::WriteTo(experiments::fs::ExperimentFile& file, bool deltaRecords)
         {
             {
                 std::array<std::uint8_t, 8> buf;
@@ -150,13 +192,15 @@ namespace experiment
                 file.Write(PID::Timestamp, w.Capture());
             }
 
+            if (deltaRecords)
             {
-                std::array<std::uint8_t, (decltype(this->Gyro)::BitSize() + 7) / 8> buf;
-                BitWriter w(buf);
-
-                this->Gyro.Write(w);
+                std::array<std::int32_t, 4> fields{this->Gyro.X(), this->Gyro.Y(), this->Gyro.Z(), this->Gyro.Temperature()};
 
-                file.Write(PID::Gyro, w.Capture());
+                file.WriteDelta(PID::Gyro, fields);
+            }
+            else
+            {
+                WriteElement(file, PID::Gyro, this->Gyro);
             }
 
             {
@@ -186,22 +230,22 @@ namespace experiment
                 file.Write(PID::PayloadPhotodiodes, w.Capture());
             }
 
+            if (deltaRecords)
             {
-                std::array<std::uint8_t, (decltype(this->Magnetometer)::BitSize() + 7) / 8> buf;
-                BitWriter w(buf);
+                const auto& mtm = this->Magnetometer.GetValue();
+                std::array<std::int32_t, 3> fields{mtm[0], mtm[1], mtm[2]};
 
-                this->Magnetometer.Write(w);
+                file.WriteDelta(PID::Magnetometer, fields);
 
-                file.Write(PID::Magnetometer, w.Capture());
-            }
+                const auto& dipoles = this->Dipoles.GetValue();
+                std::array<std::int32_t, 3> dipoleFields{dipoles[0], dipoles[1], dipoles[2]};
 
+                file.WriteDelta(PID::Dipoles, dipoleFields);
+            }
+            else
             {
-                std::array<std::uint8_t, (decltype(this->Dipoles)::BitSize() + 7) / 8> buf;
-                BitWriter w(buf);
-
-                this->Dipoles.Write(w);
-
-                file.Write(PID::Dipoles, w.Capture());
+                WriteElement(file, PID::Magnetometer, this->Magnetometer);
+                WriteElement(file, PID::Dipoles, this->Dipoles);
             }
         }
     }
@@ -15,6 +15,7 @@ namespace experiments
 
     ExperimentController::ExperimentController()
         : _iterationCounter(0), //
+          _sampling{},          //
           _task("Mission experiment", this, TaskEntryPoint)
     {
     }
@@ -81,6 +82,7 @@ namespace experiments
                 this->_lastIterationResult = None<IterationResult>();
                 this->_lastStartResult = None<StartResult>();
                 this->_iterationCounter = 0;
+                this->_sampling = SamplingStatistics{};
             }
 
             RunExperiment(**experiment);
@@ -127,11 +129,13 @@ namespace experiments
             this->_event.Clear(Event::MissionLoopIterationStarted);
 
             iterationResult = experiment.Iteration();
+            const auto sampling = experiment.Sampling();
 
             {
                 Lock lock(this->_sync, InfiniteTimeout);
                 this->_lastIterationResult = Some(iterationResult);
                 this->_iterationCounter++;
+                this->_sampling = sampling;
             }
 
             if (iterationResult == IterationResult::Finished)
@@ -205,6 +209,7 @@ namespace experiments
         state.LastStartResult = this->_lastStartResult;
         state.LastIterationResult = this->_lastIterationResult;
         state.IterationCounter = this->_iterationCounter;
+        state.Sampling = this->_sampling;
 
         return state;
     }
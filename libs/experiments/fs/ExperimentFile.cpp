@@ -1,14 +1,20 @@
 #include "ExperimentFile.hpp"
 #include <utility>
+#include "ExperimentFileWriter.hpp"
 
 using namespace experiments::fs;
 using namespace services::fs;
 
+constexpr uint8_t ExperimentFile::PaddingData;
+constexpr std::chrono::milliseconds ExperimentFile::CloseTimeout;
+
 ExperimentFile::ExperimentFile(services::time::ICurrentTime* time)
     : _time(time), _writer(_buffer), _hasPayloadInFrame(false),
-      onFlush(OnFlushDelegate::make_delegate<ExperimentFile, &ExperimentFile::DoNothing>(this))
+      onFlush(OnFlushDelegate::make_delegate<ExperimentFile, &ExperimentFile::DoNothing>(this)), _asyncWriter(nullptr),
+      _asyncStatus(OSResult::Success)
 {
     _buffer.fill(0xAA);
+    ResetDeltaChannels();
 }
 
 ExperimentFile::~ExperimentFile()
@@ -17,12 +23,21 @@ ExperimentFile::~ExperimentFile()
     {
         Close();
     }
+
+    // packets submitted by earlier flushes still reference this file
+    WaitForWriter();
 }
 
 ExperimentFile::ExperimentFile(ExperimentFile&& other)
     : _buffer(other._buffer), _time(other._time), _writer(_buffer), _hasPayloadInFrame(other._hasPayloadInFrame),
-      onFlush(OnFlushDelegate::make_delegate<ExperimentFile, &ExperimentFile::DoNothing>(this))
+      onFlush(OnFlushDelegate::make_delegate<ExperimentFile, &ExperimentFile::DoNothing>(this)), _deltaChannels(other._deltaChannels),
+      _asyncWriter(other._asyncWriter),
+      _asyncStatus(OSResult::Success)
 {
+    // pending packets reference other's file
+    other.WaitForWriter();
+    _asyncStatus = other._asyncStatus;
+
     other._time = nullptr;
     other._hasPayloadInFrame = 0;
     _file = std::move(other._file);
@@ -31,6 +46,9 @@ ExperimentFile::ExperimentFile(ExperimentFile&& other)
 
 ExperimentFile& ExperimentFile::operator=(ExperimentFile&& other)
 {
+    // pending packets reference this object's file, which is about to be replaced
+    WaitForWriter();
+
     ExperimentFile tmp(std::move(other));
 
     std::swap(_buffer, tmp._buffer);
@@ -38,13 +56,19 @@ ExperimentFile& ExperimentFile::operator=(ExperimentFile&& other)
     std::swap(_time, tmp._time);
     std::swap(_writer, tmp._writer);
     std::swap(_hasPayloadInFrame, tmp._hasPayloadInFrame);
+    std::swap(_deltaChannels, tmp._deltaChannels);
+    std::swap(_asyncWriter, tmp._asyncWriter);
+    std::swap(_asyncStatus, tmp._asyncStatus);
 
     return *this;
 }
 
 bool ExperimentFile::Open(IFileSystem& fs, const char* path, FileOpen mode, FileAccess access)
 {
+    WaitForWriter();
+
     _file = File(fs, path, mode, access);
+    _asyncStatus = OSResult::Success;
 
     if (!_file)
         return false;
@@ -83,6 +107,87 @@ OSResult ExperimentFile::Write(PID pid, const gsl::span<uint8_t>& data)
     return OSResult::Success;
 }
 
+OSResult ExperimentFile::WriteDelta(PID pid, gsl::span<const std::int32_t> fields)
+{
+    if (num(pid) < num(PID::Gyro) || num(pid) >= DeltaFlag || pid == PID::Synchronization || fields.size() > MaxDeltaFields)
+    {
+        return OSResult::InvalidArgument;
+    }
+
+    DeltaRecord record;
+    auto length = EncodeDelta(pid, fields, record);
+
+    if (length > static_cast<uint32_t>(_writer.RemainingSize()) || (FindDeltaChannel(pid) == nullptr && FindDeltaChannel(PID::Reserved) == nullptr))
+    {
+        // new packet resets all references
+        auto result = Flush();
+        if (OS_RESULT_FAILED(result))
+        {
+            return result;
+        }
+
+        length = EncodeDelta(pid, fields, record);
+    }
+
+    _writer.WriteArray(gsl::make_span(record).subspan(0, length));
+    _hasPayloadInFrame = true;
+
+    auto channel = FindDeltaChannel(pid);
+    if (channel == nullptr)
+    {
+        channel = FindDeltaChannel(PID::Reserved);
+    }
+
+    channel->Pid = pid;
+    channel->Count = static_cast<uint8_t>(fields.size());
+    std::copy(fields.begin(), fields.end(), channel->Previous.begin());
+
+    return OSResult::Success;
+}
+
+ExperimentFile::DeltaChannel* ExperimentFile::FindDeltaChannel(PID pid)
+{
+    for (auto& channel : _deltaChannels)
+    {
+        if (channel.Pid == pid)
+        {
+            return &channel;
+        }
+    }
+
+    return nullptr;
+}
+
+size_t ExperimentFile::EncodeDelta(PID pid, gsl::span<const std::int32_t> fields, DeltaRecord& record)
+{
+    auto channel = FindDeltaChannel(pid);
+    if (channel != nullptr && channel->Count != fields.size())
+    {
+        channel = nullptr;
+    }
+
+    size_t length = 0;
+    record[length++] = num(pid) | DeltaFlag;
+    record[length++] = static_cast<uint8_t>(fields.size());
+
+    for (auto i = 0; i < fields.size(); i++)
+    {
+        const auto previous = channel != nullptr ? static_cast<uint32_t>(channel->Previous[i]) : 0U;
+        const auto delta = static_cast<int32_t>(static_cast<uint32_t>(fields[i]) - previous);
+        auto zigzag = (static_cast<uint32_t>(delta) << 1) ^ static_cast<uint32_t>(delta >> 31);
+
+        while (zigzag >= 0x80)
+        {
+            record[length++] = static_cast<uint8_t>(zigzag | 0x80);
+            zigzag >>= 7;
+        }
+
+        record[length++] = static_cast<uint8_t>(zigzag);
+    }
+
+    return length;
+}
+
 OSResult ExperimentFile::WriteDataBiggerThanFrame(PID pid, const gsl::span<uint8_t>& data)
 {
     uint32_t offset = 0;
@@ -122,13 +227,25 @@ OSResult ExperimentFile::Flush()
 OSResult ExperimentFile::FlushInternal(bool initialize)
 {
     FillBufferWithPadding();
-    auto result = _file.Write(_buffer);
-    if (OS_RESULT_FAILED(result.Status))
+
+    if (_asyncWriter != nullptr)
     {
-        return result.Status;
+        auto result = _asyncWriter->Submit(_file, _buffer, onFlush, &_asyncStatus);
+        if (OS_RESULT_FAILED(result))
+        {
+            return result;
+        }
     }
+    else
+    {
+        auto result = _file.Write(_buffer);
+        if (OS_RESULT_FAILED(result.Status))
+        {
+            return result.Status;
+        }
 
-    onFlush(gsl::make_span(_buffer));
+        onFlush(gsl::make_span(_buffer));
+    }
 
     if (initialize)
     {
@@ -143,6 +260,28 @@ void ExperimentFile::SetOnFlush(OnFlushDelegate onFlush)
     this->onFlush = onFlush;
 }
 
+void ExperimentFile::SetWriter(ExperimentFileWriter* writer)
+{
+    WaitForWriter();
+    this->_asyncWriter = writer;
+}
+
+OSResult ExperimentFile::WaitForWriter()
+{
+    if (_asyncWriter == nullptr)
+    {
+        return OSResult::Success;
+    }
+
+    auto result = _asyncWriter->WaitForIdle(CloseTimeout);
+    if (OS_RESULT_FAILED(result))
+    {
+        return result;
+    }
+
+    return _asyncStatus;
+}
+
 void ExperimentFile::DoNothing(const gsl::span<uint8_t>&)
 {
 }
@@ -159,8 +298,19 @@ void ExperimentFile::FillBufferWithPadding()
     _hasPayloadInFrame = true;
 }
 
+void ExperimentFile::ResetDeltaChannels()
+{
+    for (auto& channel : _deltaChannels)
+    {
+        channel.Pid = PID::Reserved;
+        channel.Count = 0;
+    }
+}
+
 void ExperimentFile::InitializePacket()
 {
+    ResetDeltaChannels();
+
     _writer.Reset();
     _writer.WriteByte(num(PID::Synchronization));
     if (_time != nullptr)
@@ -178,14 +328,26 @@ void ExperimentFile::InitializePacket()
 
 OSResult ExperimentFile::Close()
 {
+    auto result = OSResult::Success;
+
     if (_hasPayloadInFrame)
     {
-        auto result = FlushInternal(false);
-        if (OS_RESULT_FAILED(result))
-        {
-            return result;
-        }
+        result = FlushInternal(false);
+        _hasPayloadInFrame = false;
+    }
+
+    // pending packets have to reach the file before it is closed
+    const auto writerResult = WaitForWriter();
+    if (OS_RESULT_SUCCEEDED(result))
+    {
+        result = writerResult;
+    }
+
+    const auto closeResult = _file.Close();
+    if (OS_RESULT_SUCCEEDED(result))
+    {
+        result = closeResult;
     }
 
-    return _file.Close();
+    return result;
 }
@@ -0,0 +1,165 @@
+#include "ExperimentFileWriter.hpp"
+#include <algorithm>
+#include "logger/logger.h"
+
+using namespace experiments::fs;
+using namespace services::fs;
+using namespace std::chrono_literals;
+
+constexpr std::chrono::milliseconds ExperimentFileWriter::SubmitTimeout;
+
+ExperimentFileWriter::Slot::Slot() : Target(nullptr), Status(nullptr), OnFlush(nullptr, nullptr)
+{
+}
+
+ExperimentFileWriter::ExperimentFileWriter()
+    : _head(0), _count(0), _overruns(0), _written(0), _sync(nullptr), _task("ExpWriter", this, TaskProc)
+{
+}
+
+OSResult ExperimentFileWriter::Initialize()
+{
+    this->_sync = System::CreateBinarySemaphore();
+    if (this->_sync == nullptr)
+    {
+        return OSResult::NotEnoughMemory;
+    }
+
+    System::GiveSemaphore(this->_sync);
+
+    auto result = this->_events.Initialize();
+    if (OS_RESULT_FAILED(result))
+    {
+        return result;
+    }
+
+    return this->_task.Create();
+}
+
+OSResult ExperimentFileWriter::Submit(File& file, gsl::span<const std::uint8_t> packet, ExperimentFile::OnFlushDelegate onFlush, OSResult* status)
+{
+    Lock lock(this->_sync, SubmitTimeout);
+    if (!lock())
+    {
+        return OSResult::Timeout;
+    }
+
+    if (this->_count == BuffersCount)
+    {
+        this->_overruns++;
+        LOG(LOG_LEVEL_WARNING, "[exp_writer] All packet buffers occupied");
+
+        while (this->_count == BuffersCount)
+        {
+            auto bits = this->_events.WaitAny(Event::SlotReleased, true, SubmitTimeout);
+            if (!has_flag(bits, Event::SlotReleased))
+            {
+                return OSResult::Timeout;
+            }
+        }
+    }
+
+    std::uint8_t tail;
+    {
+        // writer task advances head and count together, so both have to be read in the same critical section
+        CriticalSection critical;
+        tail = (this->_head + this->_count) % BuffersCount;
+    }
+
+    auto& slot = this->_slots[tail];
+
+    const auto length = std::min<std::size_t>(packet.size(), slot.Packet.size());
+    std::copy(packet.begin(), packet.begin() + length, slot.Packet.begin());
+    std::fill(slot.Packet.begin() + length, slot.Packet.end(), ExperimentFile::PaddingData);
+    slot.Target = &file;
+    slot.Status = status;
+    slot.OnFlush = onFlush;
+
+    {
+        CriticalSection critical;
+        this->_count++;
+    }
+
+    this->_events.Set(Event::PacketAvailable);
+
+    return OSResult::Success;
+}
+
+OSResult ExperimentFileWriter::WaitForIdle(std::chrono::milliseconds timeout)
+{
+    while (this->_count != 0)
+    {
+        auto bits = this->_events.WaitAny(Event::Idle, true, timeout);
+        if (!has_flag(bits, Event::Idle))
+        {
+            return OSResult::Timeout;
+        }
+    }
+
+    return OSResult::Success;
+}
+
+bool ExperimentFileWriter::WriteNext()
+{
+    std::uint8_t head;
+    {
+        CriticalSection critical;
+        if (this->_count == 0)
+        {
+            return false;
+        }
+
+        head = this->_head;
+    }
+
+    auto& slot = this->_slots[head];
+
+    auto result = slot.Target->Write(slot.Packet);
+    if (OS_RESULT_FAILED(result.Status))
+    {
+        LOGF(LOG_LEVEL_ERROR, "[exp_writer] Unable to write packet (%d)", num(result.Status));
+        if (slot.Status != nullptr)
+        {
+            *slot.Status = result.Status;
+        }
+    }
+    else
+    {
+        this->_written++;
+        slot.OnFlush(gsl::make_span(slot.Packet));
+    }
+
+    slot.Target = nullptr;
+    slot.Status = nullptr;
+
+    bool idle;
+    {
+        CriticalSection critical;
+        this->_head = (this->_head + 1) % BuffersCount;
+        this->_count--;
+        idle = this->_count == 0;
+    }
+
+    this->_events.Set(Event::SlotReleased);
+
+    if (idle)
+    {
+        this->_events.Set(Event::Idle);
+    }
+
+    return true;
+}
+
+void ExperimentFileWriter::TaskProc(ExperimentFileWriter* This)
+{
+    LOG(LOG_LEVEL_INFO, "[exp_writer] Starting task");
+
+    while (1)
+    {
+        This->_events.WaitAny(Event::PacketAvailable, true, InfiniteTimeout);
+
+        while (This->WriteNext())
+        {
+        }
+    }
+}
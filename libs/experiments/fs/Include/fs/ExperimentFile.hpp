@@ -13,6 +13,8 @@ namespace experiments
 {
     namespace fs
     {
+        class ExperimentFileWriter;
+
         /**
          * @brief Container file for experiment results
          * @ingroup experiments
@@ -35,6 +37,16 @@ namespace experiments
          * ...
          * near packet end - PID::Padding - 8b
          * until the end - padding data (0xFF)
+         *
+         * Samples written with @ref WriteDelta are stored as delta-encoded records:
+         * byte 0 - PID of payload data with @ref DeltaFlag set - 8b
+         * byte 1 - number of fields (N) - 8b
+         * byte 2 - N zig-zag encoded varints, each being difference between field value and the same field of
+         * previous record with the same PID in current packet. First record of given PID in packet (or record
+         * with different number of fields) is encoded against zeros so every packet can be decoded on its own.
+         *
+         * By default packets are written synchronously on flush. When @ref ExperimentFileWriter is attached
+         * complete packets are handed over to its background task and flush handler is invoked from that task.
          */
         class ExperimentFile final : NotCopyable
         {
@@ -82,6 +94,15 @@ namespace experiments
              */
             static constexpr uint8_t PaddingData = 0xFF;
 
+            /** @brief Flag set in PID of delta-encoded record */
+            static constexpr uint8_t DeltaFlag = 0x80;
+
+            /** @brief Maximal number of fields in single delta-encoded sample */
+            static constexpr uint8_t MaxDeltaFields = 24;
+
+            /** @brief Number of different PIDs that can be delta-encoded in single packet */
+            static constexpr uint8_t DeltaChannels = 4;
+
             /**
              * @brief Default constructor
              * @param time Optional time provider. If set, each packet automatically have a timestamp.
@@ -124,6 +145,14 @@ namespace experiments
              */
             OSResult Write(PID pid, const gsl::span<uint8_t>& data);
 
+            /**
+             * @brief Writes sample as delta against previous sample with the same PID.
+             * @param pid The Packet Identifier of provided data. Only data PIDs (below @ref DeltaFlag, except Synchronization) are allowed.
+             * @param fields Sample fields.
+             * @returns Status of operation.
+             */
+            OSResult WriteDelta(PID pid, gsl::span<const std::int32_t> fields);
+
             /**
              * @brief Closes the file.
              * @returns Status of operation.
@@ -147,6 +176,15 @@ namespace experiments
              */
             void SetOnFlush(OnFlushDelegate onFlush);
 
+            /**
+             * @brief Attaches background writer used to commit packets
+             * @param[in] writer Writer to use. nullptr restores synchronous writes.
+             */
+            void SetWriter(ExperimentFileWriter* writer);
+
+            /** @brief Maximal time to wait for background writer on close */
+            static constexpr std::chrono::milliseconds CloseTimeout = std::chrono::seconds(30);
+
           private:
             /** @brief The byte size of PID type.  */
             static constexpr size_t PIDSize = sizeof(PID);
@@ -158,6 +196,29 @@ namespace experiments
 
             OSResult FlushInternal(bool initialize);
 
+            /** @brief Maximal size of zig-zag varint encoded field */
+            static constexpr size_t MaxVarintSize = 5;
+
+            /** @brief Buffer for single delta-encoded record */
+            using DeltaRecord = std::array<uint8_t, 2 + MaxDeltaFields * MaxVarintSize>;
+
+            /** @brief Previous sample of single delta-encoded PID */
+            struct DeltaChannel
+            {
+                /** @brief PID (Reserved when channel is not used) */
+                PID Pid;
+                /** @brief Number of fields */
+                uint8_t Count;
+                /** @brief Fields of previous sample */
+                std::array<std::int32_t, MaxDeltaFields> Previous;
+            };
+
+            void ResetDeltaChannels();
+            DeltaChannel* FindDeltaChannel(PID pid);
+            size_t EncodeDelta(PID pid, gsl::span<const std::int32_t> fields, DeltaRecord& record);
+
+            OSResult WaitForWriter();
+
             void DoNothing(const gsl::span<uint8_t>&);
 
             /** @brief Buffer for data.  */
@@ -173,6 +234,15 @@ namespace experiments
             bool _hasPayloadInFrame;
 
             OnFlushDelegate onFlush;
+
+            /** @brief Previous samples of delta-encoded PIDs in current packet */
+            std::array<DeltaChannel, DeltaChannels> _deltaChannels;
+
+            /** @brief Background writer (optional) */
+            ExperimentFileWriter* _asyncWriter;
+
+            /** @brief Status of last failed background write */
+            OSResult _asyncStatus;
         };
     }
 }
@@ -0,0 +1,166 @@
+#ifndef LIBS_EXPERIMENTS_FS_INCLUDE_FS_EXPERIMENTFILEWRITER_HPP_
+#define LIBS_EXPERIMENTS_FS_INCLUDE_FS_EXPERIMENTFILEWRITER_HPP_
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <gsl/span>
+#include "ExperimentFile.hpp"
+#include "base/os.h"
+#include "fs/fs.h"
+#include "utils.h"
+
+namespace experiments
+{
+    namespace fs
+    {
+        /**
+         * @brief Background writer for experiment file packets
+         * @ingroup experiments
+         *
+         * Writer owns a small ring of packet buffers. Experiment file submits complete packet and continues
+         * with filling next one while background task commits previous packets to file system and invokes
+         * their flush handlers.
+         *
+         * Packets are committed in the order of submission. When all buffers are occupied submitting task
+         * waits for free buffer and overrun is counted.
+         */
+        class ExperimentFileWriter final : private NotCopyable, private NotMoveable
+        {
+          public:
+            /** @brief Number of packet buffers */
+            static constexpr std::uint8_t BuffersCount = 3;
+
+            /** @brief Maximal time to wait for free packet buffer */
+            static constexpr std::chrono::milliseconds SubmitTimeout = std::chrono::seconds(10);
+
+            /**
+             * @brief Ctor
+             */
+            ExperimentFileWriter();
+
+            /**
+             * @brief Initializes writer and starts background task
+             * @return Operation result
+             */
+            OSResult Initialize();
+
+            /**
+             * @brief Submits packet for writing
+             * @param file File to which packet should be written
+             * @param packet Packet contents
+             * @param onFlush Delegate called after packet is written
+             * @param status Pointer to variable that will receive error code if write fails
+             * @return Operation result
+             */
+            OSResult Submit(services::fs::File& file,
+                gsl::span<const std::uint8_t> packet,
+                ExperimentFile::OnFlushDelegate onFlush,
+                OSResult* status);
+
+            /**
+             * @brief Waits until all submitted packets are written
+             * @param timeout Timeout
+             * @return Operation result
+             */
+            OSResult WaitForIdle(std::chrono::milliseconds timeout);
+
+            /**
+             * @brief (Internal use) Writes oldest pending packet
+             * @return true if packet has been written, false if there was nothing to write
+             */
+            bool WriteNext();
+
+            /**
+             * @brief Returns number of submissions that had to wait for free buffer
+             * @return Number of overruns
+             */
+            inline std::uint32_t Overruns() const;
+
+            /**
+             * @brief Returns number of packets written to file system
+             * @return Number of written packets
+             */
+            inline std::uint32_t PacketsWritten() const;
+
+            /**
+             * @brief Returns number of packets waiting to be written
+             * @return Number of pending packets
+             */
+            inline std::uint8_t Pending() const;
+
+          private:
+            /**
+             * @brief Background task procedure
+             * @param This Pointer to writer object
+             */
+            static void TaskProc(ExperimentFileWriter* This);
+
+            /** @brief Single packet buffer */
+            struct Slot
+            {
+                /** @brief Ctor */
+                Slot();
+
+                /** @brief Packet contents */
+                std::array<std::uint8_t, ExperimentFile::PacketLength> Packet;
+                /** @brief Target file */
+                services::fs::File* Target;
+                /** @brief Write status */
+                OSResult* Status;
+                /** @brief Flush handler */
+                ExperimentFile::OnFlushDelegate OnFlush;
+            };
+
+            /** @brief Events */
+            struct Event
+            {
+                /** @brief Packet has been submitted */
+                static constexpr OSEventBits PacketAvailable = 1 << 0;
+                /** @brief Packet buffer has been released */
+                static constexpr OSEventBits SlotReleased = 1 << 1;
+                /** @brief All packets have been written */
+                static constexpr OSEventBits Idle = 1 << 2;
+            };
+
+            /** @brief Packet buffers */
+            std::array<Slot, BuffersCount> _slots;
+            /** @brief Index of oldest pending packet, updated together with @ref _count in critical section */
+            std::uint8_t _head;
+            /** @brief Number of pending packets */
+            std::atomic<std::uint8_t> _count;
+
+            /** @brief Overruns counter */
+            std::uint32_t _overruns;
+            /** @brief Written packets counter */
+            std::uint32_t _written;
+
+            /** @brief Submission lock */
+            OSSemaphoreHandle _sync;
+            /** @brief Writer events */
+            EventGroup _events;
+            /** @brief Background task */
+            Task<ExperimentFileWriter*, 4_KB, TaskPriority::P3> _task;
+        };
+
+        std::uint32_t ExperimentFileWriter::Overruns() const
+        {
+            return this->_overruns;
+        }
+
+        std::uint32_t ExperimentFileWriter::PacketsWritten() const
+        {
+            return this->_written;
+        }
+
+        std::uint8_t ExperimentFileWriter::Pending() const
+        {
+            return this->_count;
+        }
+    }
+}
+
+#endif /* LIBS_EXPERIMENTS_FS_INCLUDE_FS_EXPERIMENTFILEWRITER_HPP_ */
@@ -82,6 +82,12 @@ namespace experiment
              */
             virtual void SetOutputFile(gsl::cstring_span<> fileName) override;
 
+            /**
+             * @brief Attaches background writer for experiment file
+             * @param writer Background writer. nullptr selects synchronous writes.
+             */
+            void SetFileWriter(experiments::fs::ExperimentFileWriter* writer);
+
             virtual experiments::ExperimentCode Type() override;
             virtual experiments::StartResult Start() override;
             virtual experiments::IterationResult Iteration() override;
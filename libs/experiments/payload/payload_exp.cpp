@@ -54,6 +54,11 @@ namespace experiment
             _cameraCommisioningController.SetPhotoFilesBaseName(this->_fileName);
         }
 
+        void PayloadCommissioningExperiment::SetFileWriter(experiments::fs::ExperimentFileWriter* writer)
+        {
+            this->_experimentFile.SetWriter(writer);
+        }
+
         experiments::ExperimentCode PayloadCommissioningExperiment::Type()
         {
             return Code;
@@ -69,6 +69,12 @@ namespace experiment
              */
             void SetSailController(mission::IOpenSail& sailController);
 
+            /**
+             * @brief Attaches background writer for experiment file
+             * @param writer Background writer. nullptr selects synchronous writes.
+             */
+            void SetFileWriter(experiments::fs::ExperimentFileWriter* writer);
+
             /**
              * @brief Returns time to next experiment telemetry acquisition.
              * @param time Current mission time.
@@ -241,6 +247,11 @@ namespace experiment
             this->_sailController = &sailController;
         }
 
+        inline void SailExperiment::SetFileWriter(experiments::fs::ExperimentFileWriter* writer)
+        {
+            this->_file.SetWriter(writer);
+        }
+
         inline services::photo::Camera SailExperiment::GetNextCamera() const
         {
             return (this->_lastCamera == services::photo::Camera::Wing) ? services::photo::Camera::Nadir : services::photo::Camera::Wing;
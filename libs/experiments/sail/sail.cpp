@@ -343,7 +343,7 @@ namespace experiment
 
             message.PayloadWriter().WriteArray(data);
 
-            transmitter.SendFrame(message.Frame());
+            transmitter.SendFrameInPlace(message.FrameWithHeadroom());
         }
     }
 }
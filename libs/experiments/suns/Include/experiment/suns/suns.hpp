@@ -219,6 +219,7 @@ namespace experiment
             virtual experiments::StartResult Start() override;
             virtual experiments::IterationResult Iteration() override;
             virtual void Stop(experiments::IterationResult lastResult) override;
+            virtual experiments::SamplingStatistics Sampling() override;
 
             /**
              * @brief Gathers single data point from all sensors
@@ -242,6 +243,9 @@ namespace experiment
             std::uint8_t _remainingSessions;
             std::chrono::milliseconds _nextSessionAt;
 
+            /** @brief Sampling schedule of current session */
+            experiments::PeriodicSampler _sampler;
+
             char _primaryFileName[30];
             char _secondaryFileName[sizeof(_primaryFileName) + 4];
 
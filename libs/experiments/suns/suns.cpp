@@ -1,5 +1,6 @@
 #include "suns.hpp"
 #include <cstring>
+#include "experiments/MeasurementFanOut.hpp"
 #include "fs/fs.h"
 #include "logger/logger.h"
 #include "power/power.h"
@@ -106,12 +107,11 @@ namespace experiment
 
             System::SleepTask(3s);
 
+            this->_sampler.Start(this->_parameters.ShortDelay());
+
             for (auto i = 0; i < this->_parameters.SamplesCount(); i++)
             {
-                if (i > 0)
-                {
-                    System::SleepTask(this->_parameters.ShortDelay());
-                }
+                this->_sampler.WaitForNextSample();
 
                 LOGF(LOG_LEVEL_INFO, "[suns] Sampling %d/%d", i, this->_parameters.SamplesCount());
 
@@ -144,21 +144,34 @@ namespace experiment
             this->_secondaryDataSet.Close();
         }
 
+        SamplingStatistics SunSExperiment::Sampling()
+        {
+            return this->_sampler.Statistics();
+        }
+
         DataPoint SunSExperiment::GatherSingleMeasurement()
         {
             DataPoint point;
 
             point.Timestamp = this->_currentTime.GetCurrentTime().Value;
 
-            this->_experimentalSunS.StartMeasurement(this->_parameters.Gain(), this->_parameters.ITime());
-
-            this->_payload.MeasureSunSRef(point.ReferenceSunS);
-
-            this->_experimentalSunS.WaitForData();
-
-            this->_experimentalSunS.GetMeasuredData(point.ExperimentalSunS);
-
-            point.Gyro = this->_gyro.read().Value;
+            // both SunS integrate at the same time, gyroscope is read in the meantime
+            FanOut(
+                Split(
+                    [this]() {
+                        const auto status = this->_experimentalSunS.StartMeasurement(this->_parameters.Gain(), this->_parameters.ITime());
+                        return status == devices::suns::OperationStatus::OK;
+                    },
+                    [this, &point]() {
+                        return this->_experimentalSunS.WaitForData() == OSResult::Success &&
+                            this->_experimentalSunS.GetMeasuredData(point.ExperimentalSunS) == devices::suns::OperationStatus::OK;
+                    }),
+                Split([this]() { return this->_payload.BeginSunSRefMeasurement() == OSResult::Success; },
+                    [this, &point]() { return this->_payload.EndSunSRefMeasurement(point.ReferenceSunS) == OSResult::Success; }),
+                Immediate([this, &point]() {
+                    point.Gyro = this->_gyro.read().Value;
+                    return true;
+                }));
 
             return point;
         }
@@ -201,6 +201,10 @@ int yaffs2_checkpt_open(struct yaffs_dev* dev, int writing)
         !dev->drv.drv_mark_bad_fn)
         return 0;
 
+    /* Block states stored in checkpoint must match flash content */
+    if (writing && dev->drv.drv_flush_erases_fn && !dev->drv.drv_flush_erases_fn(dev, YAFFS_FLUSH_ALL_ERASES))
+        return 0;
+
     if (writing && !yaffs2_checkpt_space_ok(dev))
         return 0;
 
@@ -2360,6 +2360,14 @@ void yaffs_block_became_dirty(struct yaffs_dev* dev, int block_no)
     if (!bi->needs_retiring)
     {
         yaffs2_checkpt_invalidate(dev);
+
+        if (dev->drv.drv_defer_erase_fn && dev->drv.drv_defer_erase_fn(dev, block_no) == YAFFS_OK)
+        {
+            /* Block stays dirty until driver erases it and calls yaffs_block_erased */
+            yaffs_tracef(YAFFS_TRACE_ERASE, "Erase of block %d deferred", block_no);
+            return;
+        }
+
         erased_ok = yaffs_erase_block(dev, block_no);
         if (!erased_ok)
         {
@@ -2389,6 +2397,13 @@ void yaffs_block_became_dirty(struct yaffs_dev* dev, int block_no)
         return;
     }
 
+    yaffs_block_erased(dev, block_no);
+}
+
+void yaffs_block_erased(struct yaffs_dev* dev, int block_no)
+{
+    struct yaffs_block_info* bi = yaffs_get_block_info(dev, block_no);
+
     /* Clean it up... */
     bi->block_state = YAFFS_BLOCK_STATE_EMPTY;
     bi->seq_number = 0;
@@ -2839,7 +2854,11 @@ static int yaffs_check_gc(struct yaffs_dev* dev, int background)
         min_erased = dev->param.n_reserved_blocks + checkpt_block_adjust + 1;
         erased_chunks = dev->n_erased_blocks * dev->param.chunks_per_block;
 
-        /* If we need a block soon then do aggressive gc. */
+        /* If we need a block soon then complete just enough deferred erasures first */
+        if (dev->n_erased_blocks < min_erased && dev->drv.drv_flush_erases_fn)
+            dev->drv.drv_flush_erases_fn(dev, min_erased);
+
+        /* If we still need a block soon then do aggressive gc. */
         if (dev->n_erased_blocks < min_erased)
             aggressive = 1;
         else
@@ -4988,6 +5007,7 @@ int yaffs_count_free_chunks(struct yaffs_dev* dev)
             case YAFFS_BLOCK_STATE_ALLOCATING:
             case YAFFS_BLOCK_STATE_COLLECTING:
             case YAFFS_BLOCK_STATE_FULL:
+            case YAFFS_BLOCK_STATE_DIRTY: /* waiting for deferred erase */
                 n_free += (dev->param.chunks_per_block - blk->pages_in_use + blk->soft_del_pages);
                 break;
             default:
@@ -21,6 +21,9 @@
 #define YAFFS_OK	1
 #define YAFFS_FAIL  0
 
+/* min_erased passed to drv_flush_erases_fn to complete all deferred erasures */
+#define YAFFS_FLUSH_ALL_ERASES	(-1)
+
 /* Give us a  Y=0x59,
  * Give us an A=0x41,
  * Give us an FF=0xff
@@ -627,6 +630,17 @@ struct yaffs_driver {
 	int (*drv_check_bad_fn) (struct yaffs_dev *dev, int block_no);
 	int (*drv_initialise_fn) (struct yaffs_dev *dev);
 	int (*drv_deinitialise_fn) (struct yaffs_dev *dev);
+
+	/* Optional deferred erasure. When drv_defer_erase_fn accepts a block
+	 * released by garbage collection (returns YAFFS_OK) the block stays
+	 * dirty until the driver erases it and calls yaffs_block_erased().
+	 * drv_flush_erases_fn must complete deferred erasures until device has
+	 * at least min_erased erased blocks; it is called with min_erased set to
+	 * YAFFS_FLUSH_ALL_ERASES before checkpoint is written and with number of
+	 * blocks garbage collection needs when erased blocks run out.
+	 */
+	int (*drv_defer_erase_fn) (struct yaffs_dev *dev, int block_no);
+	int (*drv_flush_erases_fn) (struct yaffs_dev *dev, int min_erased);
 };
 
 struct yaffs_tags_handler {
@@ -975,6 +989,7 @@ void yaffs_add_obj_to_dir(struct yaffs_obj *directory, struct yaffs_obj *obj);
 YCHAR *yaffs_clone_str(const YCHAR *str);
 void yaffs_link_fixup(struct yaffs_dev *dev, struct list_head *hard_list);
 void yaffs_block_became_dirty(struct yaffs_dev *dev, int block_no);
+void yaffs_block_erased(struct yaffs_dev *dev, int block_no);
 int yaffs_update_oh(struct yaffs_obj *in, const YCHAR *name,
 		    int force, int is_shrink, int shadows,
 		    struct yaffs_xattr_mod *xop);
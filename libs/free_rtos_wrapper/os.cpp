@@ -1,4 +1,6 @@
 #include "base/os.h"
+#include <algorithm>
+#include <array>
 #include "FreeRTOS.h"
 #include "FreeRTOSConfig.h"
 #include "event_groups.h"
@@ -24,6 +26,14 @@ static inline TickType_t ConvertTimeToTicks(const milliseconds span)
     return pdMS_TO_TICKS(span.count());
 }
 
+static inline milliseconds ConvertTicksToTime(const TickType_t ticks)
+{
+    typedef std::ratio<portTICK_PERIOD_MS, 1000> ticksPerMs;
+    typedef std::chrono::duration<int64_t, ticksPerMs> tickDuration;
+
+    return std::chrono::duration_cast<milliseconds>(tickDuration(ticks));
+}
+
 OSResult System::CreateTask(OSTaskProcedure entryPoint, //
     const char* taskName,                               //
     std::uint16_t stackSize,                            //
@@ -55,6 +65,17 @@ void System::SleepTask(const milliseconds time)
     vTaskDelay(ConvertTimeToTicks(time));
 }
 
+void System::SleepUntil(const milliseconds time)
+{
+    auto wakeTime = xTaskGetTickCount();
+    const auto now = ConvertTicksToTime(wakeTime);
+    if (time > now)
+    {
+        // only the remaining span is converted to ticks, so tick conversion does not overflow for long uptimes
+        vTaskDelayUntil(&wakeTime, ConvertTimeToTicks(time - now));
+    }
+}
+
 void System::SuspendTask(OSTaskHandle task)
 {
     vTaskSuspend(task);
@@ -238,10 +259,45 @@ void System::PulseSet(OSPulseHandle handle)
 
 milliseconds System::GetUptime()
 {
-    typedef std::ratio<portTICK_PERIOD_MS, 1000> ticksPerMs;
-    typedef std::chrono::duration<int64_t, ticksPerMs> ticks;
+    return ConvertTicksToTime(xTaskGetTickCount());
+}
+
+std::size_t System::GetTaskRunTimes(gsl::span<TaskRunTime> tasks, std::uint32_t& totalRunTime)
+{
+    static std::array<TaskStatus_t, 32> statuses;
+
+    vTaskSuspendAll();
+
+    const auto captured = uxTaskGetSystemState(statuses.data(), statuses.size(), &totalRunTime);
+    const auto count = std::min<std::size_t>(captured, tasks.size());
+    const auto idle = xTaskGetIdleTaskHandle();
+
+    if (count > 0 && count < captured)
+    {
+        // keep idle task among reported ones so idle time remains available when task list is truncated
+        const auto idleStatus =
+            std::find_if(statuses.begin(), statuses.begin() + captured, [idle](const TaskStatus_t& s) { return s.xHandle == idle; });
+        if (idleStatus >= statuses.begin() + count && idleStatus != statuses.begin() + captured)
+        {
+            std::swap(*idleStatus, statuses[count - 1]);
+        }
+    }
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        auto& status = statuses[i];
+        auto& task = tasks[i];
+
+        task.Name = status.pcTaskName;
+        task.Number = status.xTaskNumber;
+        task.RunTime = status.ulRunTimeCounter;
+        task.StackHighWaterMark = status.usStackHighWaterMark * sizeof(StackType_t);
+        task.IsIdle = status.xHandle == idle;
+    }
+
+    xTaskResumeAll();
 
-    return std::chrono::duration_cast<milliseconds>(ticks(xTaskGetTickCount()));
+    return count;
 }
 
 void System::Yield()
@@ -0,0 +1,101 @@
+#ifndef LIBS_FS_INCLUDE_FS_DIRECTORY_CACHE_HPP_
+#define LIBS_FS_INCLUDE_FS_DIRECTORY_CACHE_HPP_
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <gsl/span>
+#include "fs.h"
+
+namespace services
+{
+    namespace fs
+    {
+        /**
+         * @brief Sorted window of directory entry names used to serve paginated listings
+         * @ingroup fs
+         *
+         * Cache holds names and object identifiers of up to @ref Capacity consecutive (in name order) entries of single directory
+         * that match single prefix. Window is filled in one pass over directory: every entry is offered to the cache
+         * which keeps only the smallest names following the position from which listing continues.
+         *
+         * Consecutive pages of the same listing are served from the window without walking the directory again.
+         * Entry metadata (size, modification time) is not cached as it changes with every write - it is read from object
+         * identified by cached identifier. Cache has to be invalidated whenever entries are created, removed or renamed.
+         */
+        class DirectoryCache final
+        {
+          public:
+            /** @brief Maximum number of cached entries */
+            static constexpr std::size_t Capacity = 8;
+
+            /** @brief Cached entry */
+            struct Entry
+            {
+                /** @brief Null-terminated entry name */
+                char Name[MaxListedNameLength + 1];
+                /** @brief Identifier of file system object */
+                std::uint32_t ObjectId;
+            };
+
+            DirectoryCache();
+
+            /** @brief Drops cached window */
+            void Invalidate();
+
+            /**
+             * @brief Checks whether listing can be continued from cached window
+             * @param[in] directory Identifier of listed directory
+             * @param[in] prefix Listing prefix
+             * @param[in] cursor Name after which listing continues
+             * @return true if window contains all entries following cursor or at least one of them and window is contiguous
+             */
+            bool Covers(const void* directory, const char* prefix, const char* cursor) const;
+
+            /**
+             * @brief Starts filling window for new position
+             * @param[in] directory Identifier of listed directory
+             * @param[in] prefix Listing prefix
+             * @param[in] cursor Name after which listing continues
+             */
+            void Refill(const void* directory, const char* prefix, const char* cursor);
+
+            /**
+             * @brief Offers directory entry to window that is being filled
+             * @param[in] name Entry name
+             * @param[in] objectId Identifier of file system object
+             */
+            void Offer(const char* name, std::uint32_t objectId);
+
+            /**
+             * @brief Returns cached entries following given name
+             * @param[in] cursor Name after which listing continues
+             * @return Cached entries
+             */
+            gsl::span<const Entry> After(const char* cursor) const;
+
+            /**
+             * @brief Checks whether window reaches last matching entry of directory
+             * @return true if there are no more entries after last cached one
+             */
+            bool Complete() const;
+
+          private:
+            /** @brief Listed directory, nullptr if cache is invalid */
+            const void* _directory;
+            /** @brief Listing prefix */
+            char _prefix[MaxListedNameLength + 1];
+            /** @brief Name after which window starts */
+            char _start[MaxListedNameLength + 1];
+            /** @brief Cached entries */
+            std::array<Entry, Capacity> _entries;
+            /** @brief Number of cached entries */
+            std::size_t _count;
+            /** @brief true if matching entry has been dropped as window was full */
+            bool _truncated;
+        };
+    }
+}
+
+#endif /* LIBS_FS_INCLUDE_FS_DIRECTORY_CACHE_HPP_ */
@@ -72,6 +72,25 @@ namespace services
         /** @brief Read/Write operation result */
         using IOResult = IOOperationResult<gsl::span<const uint8_t>>;
 
+        /** @brief Type that represents directory listing status (number of listed entries). */
+        using ListDirectoryResult = IOOperationResult<std::size_t>;
+
+        /** @brief Longest entry name that is reported by directory listing */
+        constexpr std::size_t MaxListedNameLength = 90;
+
+        /**
+         * @brief Single entry of directory listing
+         */
+        struct DirectoryEntry
+        {
+            /** @brief Null-terminated entry name */
+            char Name[MaxListedNameLength + 1];
+            /** @brief Entry size */
+            FileSize Size;
+            /** @brief Time of last modification in seconds of mission time */
+            std::uint32_t ModificationTime;
+        };
+
         /**
          * @brief Enumerator of all possible file opening modes.
          */
@@ -219,6 +238,20 @@ namespace services
              */
             virtual OSResult CloseDirectory(DirectoryHandle directory) = 0;
 
+            /**
+             * @brief Lists single page of directory entries together with their metadata
+             * @param[in] path Directory path
+             * @param[in] startAfter Name of last entry of previous page. Empty string or nullptr starts from first entry.
+             * @param[in] prefix Only entries whose name starts with given prefix are listed. Empty string or nullptr lists all entries.
+             * @param[out] entries Buffer for listed entries
+             * @return Number of entries stored in buffer. Page shorter than buffer is the last one.
+             *
+             * Entries are sorted by name, so listing can be resumed with name of last received entry even if directory has been
+             * modified in the meantime. Entries with names longer than @ref MaxListedNameLength are skipped.
+             */
+            virtual ListDirectoryResult ListDirectory(
+                const char* path, const char* startAfter, const char* prefix, gsl::span<DirectoryEntry> entries) = 0;
+
             /**
              * @brief Checks if path is directory
              * @param[in] path Path
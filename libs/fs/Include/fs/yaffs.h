@@ -1,7 +1,10 @@
 #ifndef LIBS_FS_INCLUDE_FS_YAFFS_H_
 #define LIBS_FS_INCLUDE_FS_YAFFS_H_
 
+#include <chrono>
+#include "directory_cache.hpp"
 #include "fs.h"
+#include "yaffs_pools.hpp"
 
 namespace services
 {
@@ -16,6 +19,42 @@ namespace services
          * @{
          */
 
+        /**
+         * @brief YAFFS device driver that postpones erasure of blocks released by YAFFS
+         *
+         * Blocks released during garbage collection stay dirty in YAFFS until they are physically erased, either
+         * in background or when YAFFS runs out of erased blocks or writes checkpoint.
+         */
+        struct IEraseAheadDevice
+        {
+            /**
+             * @brief Physically erases next block released by YAFFS and reports it to YAFFS as erased
+             * @return true if block has been erased, false if there is no block to erase or erase failed
+             *
+             * Must be called with YAFFS lock taken, as erase goes through the same driver as YAFFS reads and writes.
+             * Block that failed to erase stays pending.
+             */
+            virtual bool EraseNext() = 0;
+        };
+
+        /**
+         * @brief File system maintenance statistics
+         */
+        struct IFileSystemMaintenance
+        {
+            /**
+             * @brief Returns number of free blocks that are physically erased and can be written without stall
+             * @return Number of blocks, 0 if background maintenance is not running
+             */
+            virtual std::uint16_t ErasedReserve() = 0;
+
+            /**
+             * @brief Returns longest file write observed since previous call
+             * @return Worst write latency
+             */
+            virtual std::chrono::milliseconds TakeWorstWriteLatency() = 0;
+        };
+
         /**
          * @brief API for mounting YAFFS device
          */
@@ -39,19 +78,40 @@ namespace services
              * @brief Syncs file system (speeds up next mount)
              */
             virtual void Sync() = 0;
+
+            /**
+             * @brief Starts background maintenance of mounted device
+             * @param[in] device YAFFS device
+             * @param[in] eraseAhead Driver of the device
+             * @param[in] erasedReserve Number of erased blocks below which garbage is collected in background
+             * @return Operation result
+             */
+            virtual OSResult StartMaintenance(yaffs_dev* device, IEraseAheadDevice& eraseAhead, std::uint16_t erasedReserve) = 0;
         };
 
         /**
          * @brief Yaffs implementation of file system interface
+         *
+         * Once @ref StartMaintenance is called, low priority task erases blocks released by YAFFS while system is idle
+         * and runs background garbage collection whenever number of erased blocks drops below requested reserve, so that
+         * file writes rarely have to wait for erase.
          */
-        class YaffsFileSystem final : public IFileSystem, public IYaffsDeviceOperations
+        class YaffsFileSystem final : public IFileSystem, public IYaffsDeviceOperations, public IFileSystemMaintenance
         {
           public:
+            YaffsFileSystem();
+
             /**
              * @brief Initializes file system interface
              */
             void Initialize();
 
+            /**
+             * @brief Initializes file system interface that serves YAFFS allocations from dedicated memory pools
+             * @param[in] memoryPools Memory pools used by YAFFS
+             */
+            void Initialize(IYaffsMemoryPools& memoryPools);
+
             virtual FileOpenResult Open(const char* path, FileOpen openFlag, FileAccess accessMode) override;
             virtual OSResult Unlink(const char* path) override;
             virtual OSResult Move(const char* from, const char* to) override;
@@ -63,6 +123,8 @@ namespace services
             virtual DirectoryOpenResult OpenDirectory(const char* dirname) override;
             virtual char* ReadDirectory(DirectoryHandle directory) override;
             virtual OSResult CloseDirectory(DirectoryHandle directory) override;
+            virtual ListDirectoryResult ListDirectory(
+                const char* path, const char* startAfter, const char* prefix, gsl::span<DirectoryEntry> entries) override;
             virtual bool IsDirectory(const char* path) override;
             virtual OSResult Format(const char* mountPoint) override;
             virtual OSResult MakeDirectory(const char* path) override;
@@ -78,6 +140,52 @@ namespace services
             virtual void Sync() override;
 
             virtual OSResult AddDeviceAndMount(yaffs_dev* device) override;
+
+            virtual OSResult StartMaintenance(yaffs_dev* device, IEraseAheadDevice& eraseAhead, std::uint16_t erasedReserve) override;
+
+            virtual std::uint16_t ErasedReserve() override;
+
+            virtual std::chrono::milliseconds TakeWorstWriteLatency() override;
+
+            /**
+             * @brief Performs single step of background maintenance
+             * @return true if any work has been done, false if there is nothing to do at the moment
+             */
+            bool RunMaintenance();
+
+            /** @brief Interval between maintenance checks when there is nothing to do */
+            static constexpr std::chrono::milliseconds MaintenanceInterval = std::chrono::seconds(5);
+
+          private:
+            /**
+             * @brief Maintenance task entry point
+             * @param This Pointer to file system
+             */
+            static void MaintenanceTask(YaffsFileSystem* This);
+
+            /**
+             * @brief Walks directory once and fills directory cache with entries following cursor, YAFFS lock must be taken
+             * @param[in] directory Listed directory
+             * @param[in] prefix Listing prefix
+             * @param[in] cursor Name after which listing continues
+             */
+            void FillDirectoryCache(yaffs_obj* directory, const char* prefix, const char* cursor);
+
+            /** @brief Drops cached directory entries after directory structure has changed */
+            void InvalidateDirectoryCache();
+
+            /** @brief Maintained device */
+            yaffs_dev* _maintainedDevice;
+            /** @brief Driver of maintained device */
+            IEraseAheadDevice* _eraseAhead;
+            /** @brief Number of erased blocks below which garbage is collected in background */
+            std::uint16_t _erasedReserve;
+            /** @brief Longest write since last @ref TakeWorstWriteLatency call */
+            std::chrono::milliseconds _worstWriteLatency;
+            /** @brief Maintenance task */
+            Task<YaffsFileSystem*, 1_KB, TaskPriority::P1> _maintenanceTask;
+            /** @brief Window of recently listed directory */
+            DirectoryCache _directoryCache;
         };
     }
 }
@@ -0,0 +1,293 @@
+#ifndef LIBS_FS_INCLUDE_FS_YAFFS_POOLS_HPP_
+#define LIBS_FS_INCLUDE_FS_YAFFS_POOLS_HPP_
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "base/block_pool.hpp"
+#include "base/os.h"
+#include "yaffs.hpp"
+
+namespace services
+{
+    namespace fs
+    {
+        /**
+         * @defgroup fs_yaffs_pools Dedicated memory pools for YAFFS
+         * @ingroup fs
+         *
+         * @brief Fixed-size block pools serving YAFFS allocations without touching OS heap
+         *
+         * @{
+         */
+
+        /**
+         * @brief Policy applied when pool dedicated to given allocation is exhausted
+         */
+        enum class PoolFallback
+        {
+            Heap, //!< Allocate from OS heap
+            Fail  //!< Fail allocation
+        };
+
+        /**
+         * @brief Usage statistics of YAFFS memory pools
+         */
+        struct YaffsMemoryStatistics
+        {
+            /** @brief Pool for small allocations (allocator bookkeeping, names) */
+            BlockPoolStatistics Small;
+            /** @brief Pool for tnode batches */
+            BlockPoolStatistics Tnodes;
+            /** @brief Pool for object batches */
+            BlockPoolStatistics Objects;
+            /** @brief Pool for chunk buffers */
+            BlockPoolStatistics ChunkBuffers;
+            /** @brief Number of allocations served by OS heap */
+            std::uint32_t HeapAllocations;
+
+            /**
+             * @brief Checks if any pool has run out of blocks since startup
+             * @return true if at least one allocation found its pool empty
+             */
+            inline bool Exhausted() const;
+        };
+
+        bool YaffsMemoryStatistics::Exhausted() const
+        {
+            return this->Small.Exhaustions > 0 || this->Tnodes.Exhaustions > 0 || this->Objects.Exhaustions > 0 ||
+                this->ChunkBuffers.Exhaustions > 0;
+        }
+
+        /**
+         * @brief Memory provider for YAFFS
+         */
+        struct IYaffsMemoryPools
+        {
+            /**
+             * @brief Allocates memory block
+             * @param[in] size Requested size
+             * @return Pointer to memory or nullptr on failure
+             */
+            virtual void* Allocate(std::size_t size) = 0;
+
+            /**
+             * @brief Releases memory block
+             * @param[in] pointer Pointer returned by @ref Allocate
+             */
+            virtual void Free(void* pointer) = 0;
+
+            /**
+             * @brief Returns usage statistics
+             * @return Usage statistics
+             * @remark Can be called without YAFFS lock, returned values are snapshot of independent counters.
+             */
+            virtual YaffsMemoryStatistics Statistics() = 0;
+        };
+
+        namespace details
+        {
+            /**
+             * @brief Calculates tnode width for given number of chunks (mirrors calculation done by YAFFS during mount)
+             * @param[in] chunks Number of chunks
+             * @return Tnode width in bits
+             */
+            constexpr std::size_t CalculateTnodeWidth(std::size_t chunks)
+            {
+                std::size_t bits = 0;
+                while ((static_cast<std::size_t>(1) << bits) < chunks)
+                {
+                    bits++;
+                }
+
+                if (bits & 1)
+                {
+                    bits++;
+                }
+
+                return bits < 16 ? 16 : bits;
+            }
+        }
+
+        /**
+         * @brief Memory pools sized for single YAFFS device
+         * @tparam ChunkSize Size of single chunk
+         * @tparam ChunksPerBlock Number of chunks in single block
+         * @tparam EndBlock Last block used by file system
+         * @tparam MaxObjects Number of files and directories that can be tracked without falling back to heap
+         *
+         * YAFFS allocates tnodes and objects in batches of YAFFS_ALLOCATION_NTNODES and YAFFS_ALLOCATION_NOBJECTS entries,
+         * so each batch is served by single pool block. Allocation is routed to pool by its size,
+         * sizes that do not match any pool (tables allocated once during mount) are always taken from heap.
+         *
+         * Pools are not synchronized - YAFFS calls allocator with its global lock held.
+         */
+        template <std::size_t ChunkSize, std::size_t ChunksPerBlock, std::size_t EndBlock, std::size_t MaxObjects>
+        class YaffsMemoryPools final : public IYaffsMemoryPools
+        {
+          public:
+            /** @brief Width of tnode entry in bits */
+            static constexpr std::size_t TnodeWidth = details::CalculateTnodeWidth(ChunksPerBlock * (EndBlock + 1));
+
+            /** @brief Size of single tnode */
+            static constexpr std::size_t TnodeSize =
+                TnodeWidth * YAFFS_NTNODES_LEVEL0 / 8 < sizeof(yaffs_tnode) ? sizeof(yaffs_tnode) : TnodeWidth * YAFFS_NTNODES_LEVEL0 / 8;
+
+            /** @brief Number of tnodes needed to map every chunk once plus one partially filled tnode per object */
+            static constexpr std::size_t MaxTnodes = (ChunksPerBlock * (EndBlock + 1)) * 8 / (YAFFS_NTNODES_LEVEL0 * 7) + MaxObjects;
+
+            /** @brief Size of single tnode batch */
+            static constexpr std::size_t TnodeBatchSize = YAFFS_ALLOCATION_NTNODES * TnodeSize;
+
+            /** @brief Size of single object batch */
+            static constexpr std::size_t ObjectBatchSize = YAFFS_ALLOCATION_NOBJECTS * sizeof(yaffs_obj);
+
+            /** @brief Number of tnode batches */
+            static constexpr std::size_t TnodeBatches = (MaxTnodes + YAFFS_ALLOCATION_NTNODES - 1) / YAFFS_ALLOCATION_NTNODES;
+
+            /** @brief Number of object batches (including fake root, lost+found, unlinked and deleted directories) */
+            static constexpr std::size_t ObjectBatches = (MaxObjects + 4 + YAFFS_ALLOCATION_NOBJECTS - 1) / YAFFS_ALLOCATION_NOBJECTS;
+
+            /** @brief Number of chunk buffers: temporary buffers, checkpoint buffer and one spare */
+            static constexpr std::size_t ChunkBuffers = YAFFS_N_TEMP_BUFFERS + 2;
+
+            /** @brief Size of small block */
+            static constexpr std::size_t SmallBlockSize = 16;
+
+            /** @brief Number of small blocks: one list entry per batch plus short names */
+            static constexpr std::size_t SmallBlocks = TnodeBatches + ObjectBatches + 16;
+
+            /**
+             * @brief Ctor
+             * @param[in] fallback Policy applied when pool is exhausted
+             */
+            YaffsMemoryPools(PoolFallback fallback = PoolFallback::Heap);
+
+            virtual void* Allocate(std::size_t size) override;
+
+            virtual void Free(void* pointer) override;
+
+            virtual YaffsMemoryStatistics Statistics() override;
+
+          private:
+            /**
+             * @brief Allocates memory from OS heap
+             * @param[in] size Requested size
+             * @return Pointer to memory or nullptr on failure
+             */
+            void* AllocateFromHeap(std::size_t size);
+
+            /** @brief Exhaustion policy */
+            const PoolFallback _fallback;
+
+            /** @brief Number of allocations served by heap */
+            std::uint32_t _heapAllocations;
+
+            /** @brief Small blocks */
+            BlockPool<SmallBlockSize, SmallBlocks> _small;
+
+            /** @brief Tnode batches */
+            BlockPool<TnodeBatchSize, TnodeBatches> _tnodes;
+
+            /** @brief Object batches */
+            BlockPool<ObjectBatchSize, ObjectBatches> _objects;
+
+            /** @brief Chunk buffers */
+            BlockPool<ChunkSize, ChunkBuffers> _chunkBuffers;
+        };
+
+        template <std::size_t ChunkSize, std::size_t ChunksPerBlock, std::size_t EndBlock, std::size_t MaxObjects>
+        YaffsMemoryPools<ChunkSize, ChunksPerBlock, EndBlock, MaxObjects>::YaffsMemoryPools(PoolFallback fallback)
+            : _fallback(fallback), _heapAllocations(0)
+        {
+        }
+
+        template <std::size_t ChunkSize, std::size_t ChunksPerBlock, std::size_t EndBlock, std::size_t MaxObjects>
+        void* YaffsMemoryPools<ChunkSize, ChunksPerBlock, EndBlock, MaxObjects>::Allocate(std::size_t size)
+        {
+            void* pointer;
+
+            if (size <= SmallBlockSize)
+            {
+                pointer = this->_small.Allocate();
+            }
+            else if (size == TnodeBatchSize)
+            {
+                pointer = this->_tnodes.Allocate();
+            }
+            else if (size == ObjectBatchSize)
+            {
+                pointer = this->_objects.Allocate();
+            }
+            else if (size > ChunkSize / 2 && size <= ChunkSize)
+            {
+                pointer = this->_chunkBuffers.Allocate();
+            }
+            else
+            {
+                return AllocateFromHeap(size);
+            }
+
+            if (pointer == nullptr && this->_fallback == PoolFallback::Heap)
+            {
+                pointer = AllocateFromHeap(size);
+            }
+
+            return pointer;
+        }
+
+        template <std::size_t ChunkSize, std::size_t ChunksPerBlock, std::size_t EndBlock, std::size_t MaxObjects>
+        void YaffsMemoryPools<ChunkSize, ChunksPerBlock, EndBlock, MaxObjects>::Free(void* pointer)
+        {
+            if (this->_small.Contains(pointer))
+            {
+                this->_small.Free(pointer);
+            }
+            else if (this->_tnodes.Contains(pointer))
+            {
+                this->_tnodes.Free(pointer);
+            }
+            else if (this->_objects.Contains(pointer))
+            {
+                this->_objects.Free(pointer);
+            }
+            else if (this->_chunkBuffers.Contains(pointer))
+            {
+                this->_chunkBuffers.Free(pointer);
+            }
+            else
+            {
+                System::Free(pointer);
+            }
+        }
+
+        template <std::size_t ChunkSize, std::size_t ChunksPerBlock, std::size_t EndBlock, std::size_t MaxObjects>
+        YaffsMemoryStatistics YaffsMemoryPools<ChunkSize, ChunksPerBlock, EndBlock, MaxObjects>::Statistics()
+        {
+            YaffsMemoryStatistics statistics;
+            statistics.Small = this->_small.Statistics();
+            statistics.Tnodes = this->_tnodes.Statistics();
+            statistics.Objects = this->_objects.Statistics();
+            statistics.ChunkBuffers = this->_chunkBuffers.Statistics();
+            statistics.HeapAllocations = this->_heapAllocations;
+            return statistics;
+        }
+
+        template <std::size_t ChunkSize, std::size_t ChunksPerBlock, std::size_t EndBlock, std::size_t MaxObjects>
+        void* YaffsMemoryPools<ChunkSize, ChunksPerBlock, EndBlock, MaxObjects>::AllocateFromHeap(std::size_t size)
+        {
+            auto pointer = System::Alloc(size);
+            if (pointer != nullptr)
+            {
+                this->_heapAllocations++;
+            }
+
+            return pointer;
+        }
+
+        /** @} */
+    }
+}
+
+#endif /* LIBS_FS_INCLUDE_FS_YAFFS_POOLS_HPP_ */
@@ -0,0 +1,93 @@
+#include "directory_cache.hpp"
+#include <algorithm>
+#include <cstring>
+#include "utils.h"
+
+using namespace services::fs;
+
+constexpr std::size_t DirectoryCache::Capacity;
+
+DirectoryCache::DirectoryCache() : _directory(nullptr), _prefix{0}, _start{0}, _count(0), _truncated(false)
+{
+}
+
+void DirectoryCache::Invalidate()
+{
+    this->_directory = nullptr;
+    this->_count = 0;
+}
+
+bool DirectoryCache::Covers(const void* directory, const char* prefix, const char* cursor) const
+{
+    if (this->_directory == nullptr || this->_directory != directory)
+    {
+        return false;
+    }
+
+    if (strcmp(this->_prefix, prefix) != 0 || strcmp(this->_start, cursor) > 0)
+    {
+        return false;
+    }
+
+    if (!this->_truncated)
+    {
+        return true;
+    }
+
+    return this->_count > 0 && strcmp(cursor, this->_entries[this->_count - 1].Name) < 0;
+}
+
+void DirectoryCache::Refill(const void* directory, const char* prefix, const char* cursor)
+{
+    this->_directory = directory;
+    strsafecpy(this->_prefix, prefix, MaxListedNameLength);
+    strsafecpy(this->_start, cursor, MaxListedNameLength);
+    this->_count = 0;
+    this->_truncated = false;
+}
+
+void DirectoryCache::Offer(const char* name, std::uint32_t objectId)
+{
+    if (strncmp(name, this->_prefix, strlen(this->_prefix)) != 0 || strcmp(name, this->_start) <= 0)
+    {
+        return;
+    }
+
+    const auto end = this->_entries.begin() + this->_count;
+    const auto position = std::upper_bound(
+        this->_entries.begin(), end, name, [](const char* value, const Entry& entry) { return strcmp(value, entry.Name) < 0; });
+
+    if (this->_count == Capacity)
+    {
+        // window keeps only the smallest names, so either offered or last cached entry has to be dropped
+        this->_truncated = true;
+
+        if (position == end)
+        {
+            return;
+        }
+    }
+    else
+    {
+        this->_count++;
+    }
+
+    std::move_backward(position, this->_entries.begin() + this->_count - 1, this->_entries.begin() + this->_count);
+
+    strsafecpy(position->Name, name, MaxListedNameLength);
+    position->ObjectId = objectId;
+}
+
+gsl::span<const DirectoryCache::Entry> DirectoryCache::After(const char* cursor) const
+{
+    const auto end = this->_entries.begin() + this->_count;
+    const auto first = std::upper_bound(
+        this->_entries.begin(), end, cursor, [](const char* value, const Entry& entry) { return strcmp(value, entry.Name) < 0; });
+
+    return gsl::make_span(this->_entries.data() + (first - this->_entries.begin()), end - first);
+}
+
+bool DirectoryCache::Complete() const
+{
+    return !this->_truncated;
+}
@@ -1,11 +1,16 @@
 #include "yaffs.hpp"
 #include <stdbool.h>
+#include <algorithm>
+#include <cstring>
 #include <logger/logger.h>
 #include "yaffs.h"
 
 using namespace services::fs;
+using namespace std::chrono_literals;
 
-extern void YaffsGlueInit(void);
+constexpr std::chrono::milliseconds YaffsFileSystem::MaintenanceInterval;
+
+extern void YaffsGlueInit(IYaffsMemoryPools* memoryPools);
 
 static inline OSResult YaffsTranslateError(int error)
 {
@@ -19,6 +24,12 @@ static inline OSResult YaffsTranslateError(int error)
     }
 }
 
+YaffsFileSystem::YaffsFileSystem()
+    : _maintainedDevice(nullptr), _eraseAhead(nullptr), _erasedReserve(0), _worstWriteLatency(0ms),
+      _maintenanceTask("FSMaintenance", this, YaffsFileSystem::MaintenanceTask)
+{
+}
+
 char* YaffsFileSystem::ReadDirectory(DirectoryHandle directory)
 {
     struct yaffs_dirent* entry = yaffs_readdir((yaffs_DIR*)directory);
@@ -36,18 +47,25 @@ FileOpenResult YaffsFileSystem::Open(const char* path, FileOpen openFlag, FileAc
 {
     const int status = yaffs_open(path, num(openFlag) | num(accessMode), S_IRWXU);
 
+    if ((num(openFlag) & O_CREAT) != 0)
+    {
+        this->InvalidateDirectoryCache();
+    }
+
     return FileOpenResult(YaffsTranslateError(status), status);
 }
 
 OSResult YaffsFileSystem::Unlink(const char* path)
 {
     auto status = yaffs_unlink(path);
+    this->InvalidateDirectoryCache();
     return YaffsTranslateError(status);
 }
 
 OSResult YaffsFileSystem::Move(const char* from, const char* to)
 {
     auto status = yaffs_rename(from, to);
+    this->InvalidateDirectoryCache();
     return YaffsTranslateError(status);
 }
 
@@ -60,6 +78,8 @@ OSResult YaffsFileSystem::Copy(const char* from, const char* to)
     }
 
     const int destFile = yaffs_open(to, O_CREAT | O_WRONLY | O_TRUNC, S_IRWXU);
+    this->InvalidateDirectoryCache();
+
     if (destFile == -1)
     {
         yaffs_close(srcFile);
@@ -111,7 +131,13 @@ OSResult YaffsFileSystem::TruncateFile(FileHandle file, FileSize length)
 
 IOResult YaffsFileSystem::Write(FileHandle file, gsl::span<const std::uint8_t> buffer)
 {
+    const auto start = System::GetUptime();
     const int status = yaffs_write(file, buffer.data(), buffer.size());
+    const auto latency = System::GetUptime() - start;
+
+    yaffsfs_Lock();
+    this->_worstWriteLatency = std::max(this->_worstWriteLatency, latency);
+    yaffsfs_Unlock();
 
     if (status >= 0)
     {
@@ -150,6 +176,106 @@ OSResult YaffsFileSystem::CloseDirectory(DirectoryHandle directory)
     return YaffsTranslateError(yaffs_closedir((yaffs_DIR*)directory));
 }
 
+ListDirectoryResult YaffsFileSystem::ListDirectory(
+    const char* path, const char* startAfter, const char* prefix, gsl::span<DirectoryEntry> entries)
+{
+    startAfter = startAfter != nullptr ? startAfter : "";
+    prefix = prefix != nullptr ? prefix : "";
+
+    if (strlen(startAfter) > MaxListedNameLength || strlen(prefix) > MaxListedNameLength)
+    {
+        return ListDirectoryResult(OSResult::InvalidArgument, 0);
+    }
+
+    yaffsfs_Lock();
+
+    auto directory = yaffsfs_FindObject(nullptr, path, 0, 1, nullptr, nullptr, nullptr);
+    if (directory != nullptr)
+    {
+        directory = yaffs_get_equivalent_obj(directory);
+    }
+
+    if (directory == nullptr || directory->variant_type != YAFFS_OBJECT_TYPE_DIRECTORY)
+    {
+        yaffsfs_Unlock();
+        return ListDirectoryResult(directory == nullptr ? OSResult::NotFound : OSResult::NotADirectory, 0);
+    }
+
+    // cached names are overwritten on refill, so position is kept in separate buffer
+    char cursor[MaxListedNameLength + 1];
+    strsafecpy(cursor, startAfter, MaxListedNameLength);
+
+    std::ptrdiff_t count = 0;
+
+    while (count < entries.size())
+    {
+        if (!this->_directoryCache.Covers(directory, prefix, cursor))
+        {
+            this->FillDirectoryCache(directory, prefix, cursor);
+        }
+
+        const auto cached = this->_directoryCache.After(cursor);
+
+        for (const auto& entry : cached)
+        {
+            if (count == entries.size())
+            {
+                break;
+            }
+
+            strsafecpy(cursor, entry.Name, MaxListedNameLength);
+
+            auto object = yaffs_find_by_number(directory->my_dev, entry.ObjectId);
+            if (object == nullptr)
+            {
+                continue;
+            }
+
+            auto& listed = entries[count++];
+            strsafecpy(listed.Name, entry.Name, MaxListedNameLength);
+            listed.Size = yaffs_get_obj_length(object);
+            listed.ModificationTime = yaffs_get_equivalent_obj(object)->yst_mtime;
+        }
+
+        if (this->_directoryCache.Complete())
+        {
+            break;
+        }
+    }
+
+    yaffsfs_Unlock();
+
+    return ListDirectoryResult(OSResult::Success, static_cast<std::size_t>(count));
+}
+
+void YaffsFileSystem::FillDirectoryCache(yaffs_obj* directory, const char* prefix, const char* cursor)
+{
+    this->_directoryCache.Refill(directory, prefix, cursor);
+
+    char name[MaxListedNameLength + 2];
+
+    list_head* i;
+    list_for_each(i, &directory->variant.dir_variant.children)
+    {
+        auto child = list_entry(i, yaffs_obj, siblings);
+
+        // names that do not fit into listing entry are reported one character too long and skipped
+        if (yaffs_get_obj_name(child, name, sizeof(name)) > static_cast<int>(MaxListedNameLength))
+        {
+            continue;
+        }
+
+        this->_directoryCache.Offer(name, child->obj_id);
+    }
+}
+
+void YaffsFileSystem::InvalidateDirectoryCache()
+{
+    yaffsfs_Lock();
+    this->_directoryCache.Invalidate();
+    yaffsfs_Unlock();
+}
+
 static bool YaffsPathExists(const char* path)
 {
     struct yaffs_stat stat;
@@ -179,6 +305,7 @@ OSResult YaffsFileSystem::MakeDirectory(const char* path)
         if (!YaffsPathExists(buf))
         {
             status = yaffs_mkdir(buf, 0777);
+            this->InvalidateDirectoryCache();
 
             if (status < 0)
             {
@@ -195,6 +322,7 @@ OSResult YaffsFileSystem::MakeDirectory(const char* path)
 OSResult YaffsFileSystem::Format(const char* mountPoint)
 {
     const int status = yaffs_format(mountPoint, true, true, true);
+    this->InvalidateDirectoryCache();
 
     return YaffsTranslateError(status);
 }
@@ -273,7 +401,9 @@ OSResult YaffsFileSystem::ClearDevice(yaffs_dev* device)
 {
     auto root = yaffs_root(device);
 
-    return RemoveDirectoryContents(root);
+    const auto result = RemoveDirectoryContents(root);
+    this->InvalidateDirectoryCache();
+    return result;
 }
 
 void YaffsFileSystem::Sync()
@@ -292,7 +422,12 @@ void YaffsFileSystem::Sync()
 
 void YaffsFileSystem::Initialize()
 {
-    YaffsGlueInit();
+    YaffsGlueInit(nullptr);
+}
+
+void YaffsFileSystem::Initialize(IYaffsMemoryPools& memoryPools)
+{
+    YaffsGlueInit(&memoryPools);
 }
 
 FileSize YaffsFileSystem::GetFileSize(FileHandle file)
@@ -356,6 +491,7 @@ OSResult YaffsFileSystem::AddDeviceAndMount(yaffs_dev* device)
 {
     yaffs_add_device(device);
     int result = yaffs_mount(device->param.name);
+    this->InvalidateDirectoryCache();
 
     if (result == 0)
     {
@@ -369,3 +505,86 @@ OSResult YaffsFileSystem::AddDeviceAndMount(yaffs_dev* device)
         return static_cast<OSResult>(error);
     }
 }
+
+OSResult YaffsFileSystem::StartMaintenance(yaffs_dev* device, IEraseAheadDevice& eraseAhead, std::uint16_t erasedReserve)
+{
+    if (this->_maintainedDevice != nullptr)
+    {
+        LOG(LOG_LEVEL_ERROR, "[fs] Maintenance already running");
+        return OSResult::Busy;
+    }
+
+    this->_maintainedDevice = device;
+    this->_eraseAhead = &eraseAhead;
+    this->_erasedReserve = erasedReserve;
+
+    return this->_maintenanceTask.Create();
+}
+
+std::uint16_t YaffsFileSystem::ErasedReserve()
+{
+    if (this->_maintainedDevice == nullptr)
+    {
+        return 0;
+    }
+
+    yaffsfs_Lock();
+    const auto reserve = static_cast<std::uint16_t>(this->_maintainedDevice->n_erased_blocks);
+    yaffsfs_Unlock();
+
+    return reserve;
+}
+
+std::chrono::milliseconds YaffsFileSystem::TakeWorstWriteLatency()
+{
+    yaffsfs_Lock();
+    const auto latency = this->_worstWriteLatency;
+    this->_worstWriteLatency = 0ms;
+    yaffsfs_Unlock();
+
+    return latency;
+}
+
+bool YaffsFileSystem::RunMaintenance()
+{
+    if (this->_maintainedDevice == nullptr)
+    {
+        return false;
+    }
+
+    yaffsfs_Lock();
+
+    // erasing blocks that are already released is cheaper than collecting new ones, so it always goes first
+    // single block is erased per step, so file operations wait for at most one erase
+    bool progress = this->_eraseAhead->EraseNext();
+
+    if (!progress && this->_maintainedDevice->n_erased_blocks < this->_erasedReserve)
+    {
+        const auto collectedBefore = this->_maintainedDevice->n_gc_blocks;
+        const auto copiesBefore = this->_maintainedDevice->n_gc_copies;
+
+        yaffs_bg_gc(this->_maintainedDevice, 0);
+
+        progress = this->_maintainedDevice->n_gc_blocks != collectedBefore || this->_maintainedDevice->n_gc_copies != copiesBefore;
+    }
+
+    yaffsfs_Unlock();
+
+    return progress;
+}
+
+void YaffsFileSystem::MaintenanceTask(YaffsFileSystem* This)
+{
+    while (1)
+    {
+        if (!This->RunMaintenance())
+        {
+            System::SleepTask(MaintenanceInterval);
+        }
+        else
+        {
+            // let tasks of the same priority run between steps
+            System::Yield();
+        }
+    }
+}
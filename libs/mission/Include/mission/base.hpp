@@ -58,6 +58,30 @@ namespace mission
     {
     };
 
+    /**
+     * @brief Tag type used for marking the state update action as the one that can run concurrently with other update actions.
+     *
+     * Inherit from it together with mission::Update. Concurrent updates are executed by dedicated task in parallel with
+     * regular update actions declared before them. Regular update actions declared after the last concurrent update
+     * are executed once all concurrent updates are finished, so they can rely on their results.
+     *
+     * Concurrent update should neither modify the same portion of state nor talk to the same device as any regular
+     * update action that may run at the same time. Typical example is acquisition of telemetry from devices
+     * connected to different I2C bus than the one used by remaining update actions.
+     */
+    struct ConcurrentUpdate
+    {
+    };
+
+    /**
+     * @brief Adapter that marks existing state update action as concurrent one.
+     * @tparam Base Type of state update action.
+     */
+    template <typename Base> struct Concurrent : public Base, public ConcurrentUpdate
+    {
+        using Base::Base;
+    };
+
     /**
      * @brief Tag type used for marking the type as mission state validator that is executed for checking current mission state.
      *
@@ -32,7 +32,8 @@ namespace mission
      * This mission loop implementation is based on three separate phases:
      *
      *  - \b Update - all update descriptors are executed. After that state contain the most accurate information
-     * about overall satellite state. Examples: Time, power level from EPS, antenna status (opened or not)
+     * about overall satellite state. Examples: Time, power level from EPS, antenna status (opened or not).
+     * Update descriptors marked as mission::ConcurrentUpdate are executed by separate task in parallel with the remaining ones
      *  - \b Verify - Checks if state makes any sense. Examples of such invalid state are: negative time, antenna opened before
      * first 30 minutes passed, etc. It is possible that such state is result of malfunction of some device and needs further
      * investigation
@@ -116,6 +117,18 @@ namespace mission
          */
         template <typename Type> using IsUpdate = std::is_base_of<Update, Type>;
 
+        /**
+         * @brief Predicate that checks whether passed type is an Update action executed by mission loop task.
+         */
+        template <typename Type>
+        using IsSequentialUpdate = std::integral_constant<bool, IsUpdate<Type>::value && !std::is_base_of<ConcurrentUpdate, Type>::value>;
+
+        /**
+         * @brief Predicate that checks whether passed type is an Update action executed concurrently with other updates.
+         */
+        template <typename Type>
+        using IsConcurrentUpdate = std::integral_constant<bool, IsUpdate<Type>::value && std::is_base_of<ConcurrentUpdate, Type>::value>;
+
         /**
          * @brief Predicate that checks whether passed type is a Verify action.
          */
@@ -137,9 +150,14 @@ namespace mission
         static constexpr std::uint32_t CountAction = CountHelper<IsAction, T...>::value;
 
         /**
-         * @brief Constant that contains current number of Update actions.
+         * @brief Constant that contains current number of Update actions executed by mission loop task.
          */
-        static constexpr std::uint32_t CountUpdate = CountHelper<IsUpdate, T...>::value;
+        static constexpr std::uint32_t CountUpdate = CountHelper<IsSequentialUpdate, T...>::value;
+
+        /**
+         * @brief Constant that contains current number of concurrent Update actions.
+         */
+        static constexpr std::uint32_t CountConcurrentUpdate = CountHelper<IsConcurrentUpdate, T...>::value;
 
         /**
          * @brief Constant that contains current number of Verify actions.
@@ -156,6 +174,11 @@ namespace mission
          */
         typedef std::array<UpdateDescriptor<State>, CountUpdate> UpdateList;
 
+        /**
+         * @brief Type of collection that contains concurrent update descriptors.
+         */
+        typedef std::array<UpdateDescriptor<State>, CountConcurrentUpdate> ConcurrentUpdateList;
+
         /**
          * @brief Type of collection that contains verify descriptors.
          */
@@ -244,11 +267,54 @@ namespace mission
 
         static constexpr std::uint32_t RunOnceFinishedFlag = 0x8;
 
+        /**
+         * @brief Flag signaled when concurrent updates should be executed.
+         */
+        static constexpr std::uint32_t ConcurrentUpdateRequestFlag = 0x10;
+
+        /**
+         * @brief Flag signaled when concurrent updates are finished.
+         */
+        static constexpr std::uint32_t ConcurrentUpdateFinishedFlag = 0x20;
+
+        /**
+         * @brief Stack size of task executing concurrent updates.
+         */
+        static constexpr std::uint16_t ConcurrentUpdateStackSize = 2_KB;
+
         /**
          * @brief Initializes all descriptor lists.
          */
         void Setup();
 
+        /**
+         * @brief Executes all update descriptors.
+         * @return System state update result.
+         */
+        UpdateResult UpdateState();
+
+        /**
+         * @brief Starts execution of concurrent updates.
+         */
+        void StartConcurrentUpdates();
+
+        /**
+         * @brief Waits for concurrent updates to finish (or executes them if there is no task for them).
+         * @return Result of concurrent updates.
+         */
+        UpdateResult FinishConcurrentUpdates();
+
+        /**
+         * @brief Concurrent updates loop.
+         */
+        void ConcurrentUpdateLoop();
+
+        /**
+         * @brief Concurrent updates task entry point.
+         * @param[in] param Task context.
+         */
+        static void ConcurrentUpdateTask(void* param);
+
         template <size_t i, template <typename Type> class Pred, typename Action, typename Collection, typename P, typename... U>
         void Process(Collection& collection, std::true_type);
 
@@ -300,6 +366,18 @@ namespace mission
         /** List of currently executed update actions. */
         UpdateList updates;
 
+        /** List of currently executed concurrent update actions. */
+        ConcurrentUpdateList concurrentUpdates;
+
+        /** Number of update actions that are executed in parallel with concurrent updates. */
+        std::size_t concurrentJoinIndex;
+
+        /** Result of last execution of concurrent updates. */
+        UpdateResult concurrentResult;
+
+        /** Handle to system task that executes concurrent updates. */
+        OSTaskHandle concurrentTaskHandle;
+
         /** List of currently used verification actions. */
         VerifyList verifications;
 
@@ -310,7 +388,9 @@ namespace mission
         OSEventGroupHandle eventGroup;
     };
 
-    template <typename State, typename... T> MissionLoop<State, T...>::MissionLoop() : taskHandle(nullptr), eventGroup(nullptr)
+    template <typename State, typename... T>
+    MissionLoop<State, T...>::MissionLoop()
+        : concurrentJoinIndex(0), concurrentResult(UpdateResult::Ok), concurrentTaskHandle(nullptr), taskHandle(nullptr), eventGroup(nullptr)
     {
         Setup();
     }
@@ -319,6 +399,9 @@ namespace mission
     template <typename... Args>
     MissionLoop<State, T...>::MissionLoop(Args&&... args) //
         : T(std::forward<Args>(args))...,
+          concurrentJoinIndex(0),
+          concurrentResult(UpdateResult::Ok),
+          concurrentTaskHandle(nullptr),
           taskHandle(nullptr),
           eventGroup(nullptr)
     {
@@ -328,9 +411,27 @@ namespace mission
 
     template <typename State, typename... T> void MissionLoop<State, T...>::Setup()
     {
-        Process<0, IsUpdate, GetUpdateDescriptor, UpdateList, T...>(updates, HasMore<T...>());
+        Process<0, IsSequentialUpdate, GetUpdateDescriptor, UpdateList, T...>(updates, HasMore<T...>());
+        Process<0, IsConcurrentUpdate, GetUpdateDescriptor, ConcurrentUpdateList, T...>(concurrentUpdates, HasMore<T...>());
         Process<0, IsAction, GetActionDescriptor, ActionList, T...>(actions, HasMore<T...>());
         Process<0, IsVerify, GetVerifyDescriptor, VerifyList, T...>(verifications, HasMore<T...>());
+
+        const bool sequential[] = {false, IsSequentialUpdate<T>::value...};
+        const bool concurrent[] = {false, IsConcurrentUpdate<T>::value...};
+
+        std::size_t sequentialCount = 0;
+        for (std::size_t i = 1; i < sizeof...(T) + 1; i++)
+        {
+            if (concurrent[i])
+            {
+                this->concurrentJoinIndex = sequentialCount;
+            }
+
+            if (sequential[i])
+            {
+                sequentialCount++;
+            }
+        }
     }
 
     template <typename State, typename... T>
@@ -385,6 +486,17 @@ namespace mission
             return false;
         }
 
+        if (CountConcurrentUpdate > 0 && OS_RESULT_FAILED(System::CreateTask(ConcurrentUpdateTask,
+                                             "MissionLoopConcurrent",
+                                             ConcurrentUpdateStackSize,
+                                             this,
+                                             TaskPriority::P4,
+                                             &this->concurrentTaskHandle)))
+        {
+            LOG(LOG_LEVEL_ERROR, "Unable to initialize mission state. Reason: unable to create concurrent update task. ");
+            return false;
+        }
+
         if (OS_RESULT_FAILED(
                 System::CreateTask(MissionLoopControlTask, "MissionLoopControl", 4_KB, this, TaskPriority::P4, &this->taskHandle)))
         {
@@ -447,7 +559,7 @@ namespace mission
         std::array<VerifyDescriptorResult, CountVerify> detailedVerifyResult;
         LOG(LOG_LEVEL_TRACE, "Updating system state");
 
-        auto updateResult = SystemStateUpdate(state, gsl::make_span(updates));
+        auto updateResult = UpdateState();
 
         LOGF(LOG_LEVEL_TRACE, "System state update result %d", static_cast<int>(updateResult));
 
@@ -466,6 +578,71 @@ namespace mission
         SystemDispatchActions(state, runableSpan);
     }
 
+    template <typename State, typename... T> UpdateResult MissionLoop<State, T...>::UpdateState()
+    {
+        auto sequentialUpdates = gsl::make_span(this->updates);
+
+        StartConcurrentUpdates();
+
+        auto result = SystemStateUpdate(state, sequentialUpdates.subspan(0, this->concurrentJoinIndex));
+
+        const auto concurrentUpdateResult = FinishConcurrentUpdates();
+        if (concurrentUpdateResult == UpdateResult::Failure || (concurrentUpdateResult == UpdateResult::Warning && result == UpdateResult::Ok))
+        {
+            result = concurrentUpdateResult;
+        }
+
+        if (result == UpdateResult::Failure)
+        {
+            return result;
+        }
+
+        const auto remainingResult = SystemStateUpdate(state, sequentialUpdates.subspan(this->concurrentJoinIndex));
+        if (remainingResult != UpdateResult::Ok)
+        {
+            result = remainingResult;
+        }
+
+        return result;
+    }
+
+    template <typename State, typename... T> void MissionLoop<State, T...>::StartConcurrentUpdates()
+    {
+        if (this->concurrentTaskHandle != nullptr)
+        {
+            System::EventGroupSetBits(this->eventGroup, ConcurrentUpdateRequestFlag);
+        }
+    }
+
+    template <typename State, typename... T> UpdateResult MissionLoop<State, T...>::FinishConcurrentUpdates()
+    {
+        if (this->concurrentTaskHandle == nullptr)
+        {
+            return SystemStateUpdate(state, gsl::make_span(this->concurrentUpdates));
+        }
+
+        System::EventGroupWaitForBits(this->eventGroup, ConcurrentUpdateFinishedFlag, true, true, InfiniteTimeout);
+        return this->concurrentResult;
+    }
+
+    template <typename State, typename... T> void MissionLoop<State, T...>::ConcurrentUpdateTask(void* param)
+    {
+        auto missionState = static_cast<MissionLoop<State, T...>*>(param);
+        missionState->ConcurrentUpdateLoop();
+    }
+
+    template <typename State, typename... T> void MissionLoop<State, T...>::ConcurrentUpdateLoop()
+    {
+        for (;;)
+        {
+            System::EventGroupWaitForBits(this->eventGroup, ConcurrentUpdateRequestFlag, true, true, InfiniteTimeout);
+
+            this->concurrentResult = SystemStateUpdate(state, gsl::make_span(this->concurrentUpdates));
+
+            System::EventGroupSetBits(this->eventGroup, ConcurrentUpdateFinishedFlag);
+        }
+    }
+
     template <typename State, typename... T> void MissionLoop<State, T...>::RequestSingleIteration()
     {
         System::EventGroupSetBits(this->eventGroup, RunOnceRequestFlag | PauseRequestFlag);
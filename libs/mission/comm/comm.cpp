@@ -143,7 +143,7 @@ namespace mission
 
         for (auto i = 0; i < settings.RepeatCount(); i++)
         {
-            This->_transmitter.SendFrame(frame.Frame());
+            This->_transmitter.SendFrameInPlace(frame.FrameWithHeadroom());
         }
 
         This->_lastSentAt = Some(state.Time);
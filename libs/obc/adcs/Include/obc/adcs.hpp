@@ -45,6 +45,12 @@ namespace obc
          */
         adcs::IAdcsCoordinator& GetAdcsCoordinator();
 
+        /**
+         * @brief Returns experimental detumbling algorithm controller.
+         * @return Reference to experimental detumbling algorithm controller.
+         */
+        adcs::ExperimentalDetumbling& GetExperimentalDetumbling();
+
       private:
         adcs::BuiltinDetumbling builtinDetumbling;
         adcs::ExperimentalDetumbling experimentalDetumbling;
@@ -61,6 +67,11 @@ namespace obc
         return this->coordinator;
     }
 
+    inline adcs::ExperimentalDetumbling& Adcs::GetExperimentalDetumbling()
+    {
+        return this->experimentalDetumbling;
+    }
+
     /** @} */
 }
 
@@ -23,6 +23,7 @@
 #include "obc/telecommands/flash.hpp"
 #include "obc/telecommands/i2c.hpp"
 #include "obc/telecommands/memory.hpp"
+#include "obc/telecommands/os.hpp"
 #include "obc/telecommands/periodic_message.hpp"
 #include "obc/telecommands/photo.hpp"
 #include "obc/telecommands/ping.hpp"
@@ -32,6 +33,7 @@
 #include "obc/telecommands/state.hpp"
 #include "obc/telecommands/suns.hpp"
 #include "obc/telecommands/time.hpp"
+#include "program_flash/compressed_writer.hpp"
 #include "program_flash/fwd.hpp"
 #include "telecommunication/telecommand_handling.h"
 #include "telecommunication/uplink.h"
@@ -138,6 +140,7 @@ namespace obc
         obc::telecommands::PerformDetumblingExperiment,
         obc::telecommands::AbortExperiment,
         obc::telecommands::ListFilesTelecommand,
+        obc::telecommands::ListFilesPageTelecommand,
         obc::telecommands::EraseBootTableEntry,
         obc::telecommands::WriteProgramPart,
         obc::telecommands::FinalizeProgramEntry,
@@ -170,7 +173,13 @@ namespace obc
         obc::telecommands::SetBuiltinDetumblingBlockMaskTelecommand,
         obc::telecommands::SetAdcsModeTelecommand,
         obc::telecommands::StopSailDeployment,
-        obc::telecommands::ReadMemoryTelecommand>;
+        obc::telecommands::ReadMemoryTelecommand,
+        obc::telecommands::ReadMemoryCompressedTelecommand,
+        obc::telecommands::WriteCompressedProgramPart,
+        obc::telecommands::BeginProgramPatch,
+        obc::telecommands::GetTaskStatisticsTelecommand,
+        obc::telecommands::GetI2CStatisticsTelecommand,
+        obc::telecommands::GetFileSystemMaintenanceTelecommand>;
 
     /**
      * @brief OBC <-> Earth communication
@@ -201,6 +210,9 @@ namespace obc
          * @param[in] photo Reference to service capable of taking photos
          * @param[in] epsDriver Reference to EPS driver object
          * @param[in] adcsCoordinator Reference to Adcs subsystem controller
+         * @param[in] cpuUsage Reference to object that measures CPU usage of tasks
+         * @param[in] i2cStatistics Reference to object that provides I2C bus statistics
+         * @param[in] fsMaintenance Reference to object that provides file system maintenance statistics
          */
         OBCCommunication(obc::FDIR& fdir,
             devices::comm::CommObject& commDriver,
@@ -223,7 +235,10 @@ namespace obc
             devices::gyro::IGyroscopeDriver& gyro,
             services::photo::IPhotoService& photo,
             devices::eps::IEPSDriver& epsDriver,
-            adcs::IAdcsCoordinator& adcsCoordinator);
+            adcs::IAdcsCoordinator& adcsCoordinator,
+            telemetry::ICpuUsage& cpuUsage,
+            drivers::i2c::II2CFallbackStatistics& i2cStatistics,
+            services::fs::IFileSystemMaintenance& fsMaintenance);
 
         /**
          * @brief Initializes all communication at runlevel 1
@@ -241,6 +256,9 @@ namespace obc
         /** @brief Uplink protocol decoder */
         telecommunication::uplink::UplinkProtocol UplinkProtocolDecoder;
 
+        /** @brief Compressed program upload session */
+        program_flash::CompressedProgramWriter CompressedProgramUpload;
+
         /** @brief Object aggregating supported telecommands */
         Telecommands SupportedTelecommands;
 
@@ -33,9 +33,13 @@ OBCCommunication::OBCCommunication(obc::FDIR& fdir,
     devices::gyro::IGyroscopeDriver& gyro,
     services::photo::IPhotoService& photo,
     devices::eps::IEPSDriver& epsDriver,
-    adcs::IAdcsCoordinator& adcsCoordinator)
+    adcs::IAdcsCoordinator& adcsCoordinator,
+    telemetry::ICpuUsage& cpuUsage,
+    drivers::i2c::II2CFallbackStatistics& i2cStatistics,
+    services::fs::IFileSystemMaintenance& fsMaintenance)
     : Comm(commDriver),                                                                                                               //
       UplinkProtocolDecoder(settings::CommSecurityCode),                                                                              //
+      CompressedProgramUpload(bootTable),                                                                                             //
       SupportedTelecommands(                                                                                                          //
           PingTelecommand(),                                                                                                          //
           DownloadFileTelecommand(fs),                                                                                                //
@@ -49,8 +53,9 @@ OBCCommunication::OBCCommunication(obc::FDIR& fdir,
               ),                                                                                                                      //
           AbortExperiment(experiments.ExperimentsController),                                                                         //
           ListFilesTelecommand(fs),                                                                                                   //
-          EraseBootTableEntry(bootTable),                                                                                             //
-          WriteProgramPart(bootTable),                                                                                                //
+          ListFilesPageTelecommand(fs),                                                                                               //
+          EraseBootTableEntry(bootTable, CompressedProgramUpload),                                                                    //
+          WriteProgramPart(bootTable, CompressedProgramUpload),                                                                       //
           FinalizeProgramEntry(bootTable),                                                                                            //
           SetBootSlotsTelecommand(bootSettings),                                                                                      //
           SendBeaconTelecommand(telemetry),                                                                                           //
@@ -84,8 +89,14 @@ OBCCommunication::OBCCommunication(obc::FDIR& fdir,
           SetBuiltinDetumblingBlockMaskTelecommand(stateContainer, adcsCoordinator),                               //
           SetAdcsModeTelecommand(adcsCoordinator),                                                                 //
           StopSailDeployment(stateContainer),
-          obc::telecommands::ReadMemoryTelecommand() //
-          ),                                         //
+          obc::telecommands::ReadMemoryTelecommand(),                     //
+          obc::telecommands::ReadMemoryCompressedTelecommand(),           //
+          WriteCompressedProgramPart(bootTable, CompressedProgramUpload), //
+          BeginProgramPatch(bootTable, CompressedProgramUpload),          //
+          GetTaskStatisticsTelecommand(cpuUsage),                         //
+          GetI2CStatisticsTelecommand(i2cStatistics),                     //
+          GetFileSystemMaintenanceTelecommand(fsMaintenance)              //
+          ),                                                              //
       TelecommandHandler(UplinkProtocolDecoder, SupportedTelecommands.Get())
 {
 }
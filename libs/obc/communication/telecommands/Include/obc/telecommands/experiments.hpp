@@ -19,6 +19,7 @@ namespace obc
          * Parameters:
          *  * 32-bit LE - experiment duration in seconds
          *  * 8-bit - sampling interval in seconds
+         *  * 8-bit - (optional) flags. Bit 0 - store gyroscope, magnetometer and dipoles as delta records
          */
         class PerformDetumblingExperiment final : public telecommunication::uplink::Telecommand<0x0D>
         {
@@ -2,6 +2,7 @@
 #define LIBS_OBC_COMMUNICATION_TELECOMMANDS_INCLUDE_OBC_TELECOMMANDS_FILE_SYSTEM_HPP_
 
 #include "fs/fs.h"
+#include "fs/yaffs.h"
 #include "telecommunication/downlink.h"
 #include "telecommunication/telecommand_handling.h"
 
@@ -157,6 +158,90 @@ namespace obc
             /** @brief File system */
             services::fs::IFileSystem& _fs;
         };
+
+        /**
+         * @brief List single page of files in given path
+         * @ingroup telecommands
+         * @telecommand
+         *
+         * Command code: 0x11
+         * Parameters:
+         *  - 8-bit - correlation id
+         *  - 8-bit - maximum number of listed files, 0 - as many as fit into single frame
+         *  - string - path to directory
+         *  - 8-bit - byte '0'
+         *  - string - name prefix, empty to list all files
+         *  - 8-bit - byte '0'
+         *  - string - name after which listing starts, empty to start from first file
+         *  - 8-bit - byte '0'
+         *
+         * Response is single frame with APID FileListPage:
+         *  - 8-bit - operation status
+         *  - 8-bit - 1 if there are more files after last listed one, 0 otherwise
+         *  - for each file: name, byte '0', 32-bit size, 32-bit modification time (mission time in seconds)
+         *
+         * Files are listed in name order, so next page is requested with name of last listed file.
+         */
+        class ListFilesPageTelecommand final : public telecommunication::uplink::Telecommand<0x11>
+        {
+          public:
+            /**
+             * @brief ctor.
+             * @param[in] fs Reference to object providing access to filesystem services.
+             */
+            ListFilesPageTelecommand(services::fs::IFileSystem& fs);
+
+            virtual void Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters) override;
+
+          private:
+            /**
+             * @brief Lists files into frame payload
+             * @param[in] writer Writer of listed entries
+             * @param[in] path Path to directory
+             * @param[in] prefix Name prefix
+             * @param[in] startAfter Name after which listing starts
+             * @param[in] maxEntries Maximum number of listed files, 0 for no limit
+             * @param[out] more Set to true if there are more files after last listed one
+             * @return Operation status
+             */
+            OSResult List(
+                Writer& writer, const char* path, const char* prefix, const char* startAfter, std::uint8_t maxEntries, bool& more);
+
+            /** @brief Number of entries retrieved from file system at once */
+            static constexpr std::size_t BatchSize = 2;
+
+            /** @brief File system */
+            services::fs::IFileSystem& _fs;
+        };
+
+        /**
+         * @brief Get file system maintenance statistics telecommand
+         * @ingroup telecommands
+         * @telecommand
+         *
+         * Command code: 0x2E
+         *
+         * Parameters: None
+         *
+         * Response is single frame with APID FileSystemMaintenance:
+         *  - 16-bit - number of erased blocks ready for writing
+         *  - 32-bit - longest file write since statistics were previously taken, in milliseconds
+         */
+        class GetFileSystemMaintenanceTelecommand final : public telecommunication::uplink::Telecommand<0x2E>
+        {
+          public:
+            /**
+             * @brief ctor.
+             * @param[in] maintenance Object providing file system maintenance statistics
+             */
+            GetFileSystemMaintenanceTelecommand(services::fs::IFileSystemMaintenance& maintenance);
+
+            virtual void Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters) override;
+
+          private:
+            /** @brief File system maintenance statistics */
+            services::fs::IFileSystemMaintenance& _maintenance;
+        };
     }
 }
 
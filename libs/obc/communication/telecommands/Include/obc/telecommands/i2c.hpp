@@ -2,6 +2,7 @@
 #define LIBS_OBC_COMMUNICATION_TELECOMMANDS_INCLUDE_OBC_TELECOMMANDS_I2C_HPP_
 
 #include "i2c/i2c.h"
+#include "i2c/wrappers.h"
 #include "telecommunication/downlink.h"
 #include "telecommunication/telecommand_handling.h"
 
@@ -68,6 +69,39 @@ namespace obc
             /** @brief Payload. */
             drivers::i2c::II2CBus& payload;
         };
+
+        /**
+         * @brief Get I2C bus statistics telecommand
+         * @ingroup telecommands
+         * @telecommand
+         *
+         * Command code: 0x2B
+         *
+         * Parameters: None
+         *
+         * Response (single frame):
+         *  - For system bus and then for payload bus:
+         *      - Number of transfers (32 bits)
+         *      - Number of failed transfers (32 bits)
+         *      - Total transfer time in milliseconds (32 bits)
+         *      - Longest transfer in milliseconds (16 bits)
+         *  - Number of transfers routed to payload bus first (32 bits)
+         */
+        class GetI2CStatisticsTelecommand final : public telecommunication::uplink::Telecommand<0x2B>
+        {
+          public:
+            /**
+             * @brief Ctor
+             * @param statistics Object providing I2C bus statistics
+             */
+            GetI2CStatisticsTelecommand(drivers::i2c::II2CFallbackStatistics& statistics);
+
+            virtual void Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters) override;
+
+          private:
+            /** @brief Object providing I2C bus statistics */
+            drivers::i2c::II2CFallbackStatistics& _statistics;
+        };
     }
 }
 
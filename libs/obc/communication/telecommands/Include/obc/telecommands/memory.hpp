@@ -1,7 +1,9 @@
 #ifndef LIBS_OBC_COMMUNICATION_TELECOMMANDS_INCLUDE_OBC_TELECOMMANDS_MEMORY_HPP_
 #define LIBS_OBC_COMMUNICATION_TELECOMMANDS_INCLUDE_OBC_TELECOMMANDS_MEMORY_HPP_
 
+#include <chrono>
 #include "comm/comm.hpp"
+#include "telecommunication/downlink.h"
 #include "telecommunication/telecommand_handling.h"
 
 namespace obc
@@ -23,6 +25,57 @@ namespace obc
           public:
             virtual void Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters) override;
         };
+
+        /**
+         * @brief Telecommand for reading memory compressed with LZSS
+         * @telecommand
+         * @ingroup telecommands
+         *
+         * Parameters:
+         * - Correlation ID (8-bit)
+         * - Offset (32-bit)
+         * - Size (32-bit)
+         *
+         * Memory is sent in frames with @ref telecommunication::downlink::DownlinkAPID::MemoryContentCompressed APID. Payload:
+         * - Correlation ID (8-bit)
+         * - Offset of first byte covered by frame (32-bit)
+         * - Number of bytes covered by frame (16-bit)
+         * - CRC of bytes covered by frame (16-bit)
+         * - LZSS stream
+         *
+         * Each frame is compressed independently, so frames that were lost can be requested again using the same telecommand
+         * with offset and size of the gap. Sending slows down when transmitter reports few free slots in its buffer.
+         */
+        class ReadMemoryCompressedTelecommand : public telecommunication::uplink::Telecommand<0x2C>
+        {
+          public:
+            virtual void Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters) override;
+
+            /** @brief Size of frame header preceding compressed data */
+            static constexpr std::uint8_t HeaderSize = 8;
+
+            /** @brief Maximal size of compressed data in single frame */
+            static constexpr std::uint8_t MaxCompressedSize =
+                telecommunication::downlink::CorrelatedDownlinkFrame::MaxPayloadSize - HeaderSize;
+
+            /** @brief Number of free transmitter slots below which sending is delayed */
+            static constexpr std::uint8_t MinFreeSlots = 4;
+
+            /** @brief Time needed to transmit single frame at the lowest bitrate */
+            static constexpr std::chrono::milliseconds FrameTransmissionTime = std::chrono::milliseconds(1700);
+
+            /** @brief Number of attempts to queue single frame */
+            static constexpr std::uint8_t MaxSendAttempts = 3;
+
+          private:
+            /**
+             * @brief Queues frame waiting for transmitter to free slots in its buffer
+             * @param transmitter Transmitter
+             * @param frame Frame to send
+             * @return true if frame has been queued
+             */
+            static bool SendPaced(devices::comm::ITransmitter& transmitter, telecommunication::downlink::CorrelatedDownlinkFrame& frame);
+        };
     }
 }
 
@@ -0,0 +1,57 @@
+#ifndef LIBS_OBC_COMMUNICATION_TELECOMMANDS_OBC_OS_HPP
+#define LIBS_OBC_COMMUNICATION_TELECOMMANDS_OBC_OS_HPP
+
+#pragma once
+
+#include <cstdint>
+#include "gsl/span"
+#include "telecommunication/telecommand_handling.h"
+#include "telemetry/cpu_usage.hpp"
+
+namespace obc
+{
+    namespace telecommands
+    {
+        /**
+         * @brief Get CPU usage of tasks telecommand
+         * @ingroup telecommands
+         * @telecommand
+         *
+         * Command code: 0x2A
+         *
+         * Parameters: None
+         *
+         * Response (single frame):
+         *  - Idle time in 0.1% units (16 bits)
+         *  - Number of reported tasks (8 bits)
+         *  - For each task, starting from the most demanding one:
+         *      - CPU usage in 0.1% units (16 bits)
+         *      - Stack high water mark in bytes (16 bits)
+         *      - Zero-terminated task name
+         *
+         * Tasks that do not fit into single frame are omitted.
+         */
+        class GetTaskStatisticsTelecommand final : public telecommunication::uplink::Telecommand<0x2A>
+        {
+          public:
+            /**
+             * @brief Ctor
+             * @param cpuUsage Object providing CPU usage of tasks
+             */
+            GetTaskStatisticsTelecommand(telemetry::ICpuUsage& cpuUsage);
+
+            /**
+             * @brief Method called when telecommand is received.
+             * @param[in] transmitter Reference to object that can be used to send response back
+             * @param[in] parameters Parameters contained in telecommand frame
+             */
+            virtual void Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters) override;
+
+          private:
+            /** @brief Object providing CPU usage of tasks */
+            telemetry::ICpuUsage& _cpuUsage;
+        };
+    }
+}
+
+#endif
@@ -22,14 +22,17 @@ namespace obc
             /**
              * @brief Ctor
              * @param bootTable Reference to boot table
+             * @param compressedWriter Compressed upload session invalidated when entries are modified
              */
-            EraseBootTableEntry(program_flash::BootTable& bootTable);
+            EraseBootTableEntry(program_flash::BootTable& bootTable, program_flash::CompressedProgramWriter& compressedWriter);
 
             virtual void Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters) override;
 
           private:
             /** @brief Boot table */
             program_flash::BootTable& _bootTable;
+            /** @brief Compressed upload session */
+            program_flash::CompressedProgramWriter& _compressedWriter;
         };
 
         /**
@@ -47,14 +50,17 @@ namespace obc
             /**
              * @brief Ctor
              * @param bootTable Reference to boot table
+             * @param compressedWriter Compressed upload session invalidated when entries are modified
              */
-            WriteProgramPart(program_flash::BootTable& bootTable);
+            WriteProgramPart(program_flash::BootTable& bootTable, program_flash::CompressedProgramWriter& compressedWriter);
 
             virtual void Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters) override;
 
           private:
             /** @brief Boot table */
             program_flash::BootTable& _bootTable;
+            /** @brief Compressed upload session */
+            program_flash::CompressedProgramWriter& _compressedWriter;
         };
 
         /**
@@ -67,6 +73,9 @@ namespace obc
          *   - 32-bit -  Program length
          *   - 16-bit - Expected CRC
          *   - Remaining - Program entry description
+         *
+         * If entry content was written sequentially since erase, CRC of programmed data read back from flash during upload is
+         * used instead of scanning whole entry (see @ref program_flash::ContentTracker).
          */
         class FinalizeProgramEntry : public telecommunication::uplink::Telecommand<0xB2>
         {
@@ -83,6 +92,72 @@ namespace obc
             /** @brief Boot table */
             program_flash::BootTable& _bootTable;
         };
+
+        /**
+         * @brief Write LZSS compressed program part telecommand
+         * @telecommand
+         *
+         * Code: 0xB3
+         * Parameters:
+         *   - 8-bit - Entry indexes - bit flag (like in @ref EraseBootTableEntry)
+         *   - 32-bit - Offset of part in compressed stream
+         *   - Remaining - Compressed part
+         *
+         * Part is decompressed directly into selected entries (see @ref program_flash::CompressedProgramWriter).
+         * Response contains offset in compressed stream from which upload should be continued.
+         */
+        class WriteCompressedProgramPart : public telecommunication::uplink::Telecommand<0xB3>
+        {
+          public:
+            /**
+             * @brief Ctor
+             * @param bootTable Reference to boot table
+             * @param compressedWriter Compressed upload session
+             */
+            WriteCompressedProgramPart(program_flash::BootTable& bootTable, program_flash::CompressedProgramWriter& compressedWriter);
+
+            virtual void Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters) override;
+
+          private:
+            /** @brief Boot table */
+            program_flash::BootTable& _bootTable;
+            /** @brief Compressed upload session */
+            program_flash::CompressedProgramWriter& _compressedWriter;
+        };
+
+        /**
+         * @brief Begin applying patch to existing program telecommand
+         * @telecommand
+         *
+         * Code: 0xB4
+         * Parameters:
+         *   - 8-bit - Target entry indexes - bit flag (like in @ref EraseBootTableEntry)
+         *   - 8-bit - Source entry index
+         *   - 32-bit - Source program length
+         *   - 16-bit - Expected source program CRC
+         *
+         * Source program is verified and compressed upload session applying patch to it is started.
+         * Patch (see @ref program_flash::PatchOperation) is uploaded using @ref WriteCompressedProgramPart and new program
+         * is verified by @ref FinalizeProgramEntry.
+         */
+        class BeginProgramPatch : public telecommunication::uplink::Telecommand<0xB4>
+        {
+          public:
+            /**
+             * @brief Ctor
+             * @param bootTable Reference to boot table
+             * @param compressedWriter Compressed upload session
+             */
+            BeginProgramPatch(program_flash::BootTable& bootTable, program_flash::CompressedProgramWriter& compressedWriter);
+
+            virtual void Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters) override;
+
+          private:
+            /** @brief Boot table */
+            program_flash::BootTable& _bootTable;
+            /** @brief Compressed upload session */
+            program_flash::CompressedProgramWriter& _compressedWriter;
+        };
     }
 }
 
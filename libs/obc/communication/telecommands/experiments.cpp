@@ -43,6 +43,8 @@ namespace obc
 
             auto samplingInterval = std::chrono::seconds(r.ReadByte());
 
+            const std::uint8_t flags = r.RemainingSize() > 0 ? r.ReadByte() : 0;
+
             if (!r.Status())
             {
                 SendStandardResponse(transmitter, correlationId, DownlinkGenericResponse::MalformedRequest);
@@ -53,6 +55,7 @@ namespace obc
 
             this->_setupExperiment.Duration(duration);
             this->_setupExperiment.SampleRate(samplingInterval);
+            this->_setupExperiment.DeltaRecords((flags & 0x01) != 0);
 
             auto status = this->_experiments.RequestExperiment(experiment::adcs::DetumblingExperiment::Code);
 
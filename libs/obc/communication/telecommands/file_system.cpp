@@ -1,4 +1,6 @@
 #include "file_system.hpp"
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstring>
 #include "base/reader.h"
@@ -10,7 +12,10 @@
 
 using telecommunication::downlink::CorrelatedDownlinkFrame;
 using telecommunication::downlink::DownlinkAPID;
+using telecommunication::downlink::DownlinkFrame;
+using services::fs::DirectoryEntry;
 using services::fs::File;
+using services::fs::MaxListedNameLength;
 using services::fs::SeekOrigin;
 
 namespace obc
@@ -62,7 +67,7 @@ namespace obc
 
             this->_file.Read(buf);
 
-            return this->_transmitter.SendFrame(response.Frame());
+            return this->_transmitter.SendFrameInPlace(response.FrameWithHeadroom());
         }
 
         DownloadFileTelecommand::DownloadFileTelecommand(services::fs::IFileSystem& fs) : _fs(fs)
@@ -279,5 +284,125 @@ namespace obc
 
             this->_fs.CloseDirectory(dir.Result);
         }
+
+        constexpr std::size_t ListFilesPageTelecommand::BatchSize;
+
+        ListFilesPageTelecommand::ListFilesPageTelecommand(services::fs::IFileSystem& fs) : _fs(fs)
+        {
+        }
+
+        void ListFilesPageTelecommand::Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters)
+        {
+            Reader r(parameters);
+
+            const auto correlationId = r.ReadByte();
+            const auto maxEntries = r.ReadByte();
+            const auto path = r.ReadString(MaxListedNameLength);
+            const auto pathTerminator = r.ReadByte();
+            const auto prefix = r.ReadString(MaxListedNameLength);
+            const auto prefixTerminator = r.ReadByte();
+            const auto startAfter = r.ReadString(MaxListedNameLength);
+            const auto startAfterTerminator = r.ReadByte();
+
+            CorrelatedDownlinkFrame response(DownlinkAPID::FileListPage, 0, correlationId);
+            auto& writer = response.PayloadWriter();
+
+            if (!r.Status() || path.empty() || pathTerminator != 0 || prefixTerminator != 0 || startAfterTerminator != 0)
+            {
+                LOG(LOG_LEVEL_ERROR, "List files page: malformed request");
+                writer.WriteByte(num(OSResult::InvalidArgument));
+                transmitter.SendFrame(response.Frame());
+                return;
+            }
+
+            // status and continuation flag precede entries
+            std::array<std::uint8_t, CorrelatedDownlinkFrame::MaxPayloadSize - 2> entries;
+            Writer entriesWriter(entries);
+            bool more = false;
+
+            const auto status = this->List(entriesWriter, path.data(), prefix.data(), startAfter.data(), maxEntries, more);
+
+            writer.WriteByte(num(status));
+
+            if (OS_RESULT_SUCCEEDED(status))
+            {
+                writer.WriteByte(more ? 1 : 0);
+                writer.WriteArray(entriesWriter.Capture());
+            }
+
+            transmitter.SendFrame(response.Frame());
+        }
+
+        OSResult ListFilesPageTelecommand::List(
+            Writer& writer, const char* path, const char* prefix, const char* startAfter, std::uint8_t maxEntries, bool& more)
+        {
+            std::array<DirectoryEntry, BatchSize> batch;
+            char cursor[MaxListedNameLength + 1];
+            strsafecpy(cursor, startAfter, MaxListedNameLength);
+
+            std::size_t listed = 0;
+
+            while (true)
+            {
+                const auto requested = maxEntries == 0 ? batch.size() : std::min(batch.size(), maxEntries - listed);
+
+                if (requested == 0)
+                {
+                    // limit reached - check whether anything follows last listed entry
+                    auto probe = this->_fs.ListDirectory(path, cursor, prefix, gsl::make_span(batch).first(1));
+                    more = probe && probe.Result > 0;
+                    return OSResult::Success;
+                }
+
+                auto result = this->_fs.ListDirectory(path, cursor, prefix, gsl::make_span(batch).first(requested));
+                if (!result)
+                {
+                    return result.Status;
+                }
+
+                for (std::size_t i = 0; i < result.Result; i++)
+                {
+                    const auto& entry = batch[i];
+                    const auto nameLength = strlen(entry.Name);
+
+                    if (writer.RemainingSize() < static_cast<std::int32_t>(nameLength + 9))
+                    {
+                        more = true;
+                        return OSResult::Success;
+                    }
+
+                    writer.WriteArray(gsl::make_span(reinterpret_cast<const uint8_t*>(entry.Name), nameLength));
+                    writer.WriteByte(0);
+                    writer.WriteDoubleWordLE(entry.Size);
+                    writer.WriteDoubleWordLE(entry.ModificationTime);
+
+                    strsafecpy(cursor, entry.Name, MaxListedNameLength);
+                    listed++;
+                }
+
+                if (result.Result < requested)
+                {
+                    more = false;
+                    return OSResult::Success;
+                }
+            }
+        }
+
+        GetFileSystemMaintenanceTelecommand::GetFileSystemMaintenanceTelecommand(services::fs::IFileSystemMaintenance& maintenance)
+            : _maintenance(maintenance)
+        {
+        }
+
+        void GetFileSystemMaintenanceTelecommand::Handle(
+            devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> /*parameters*/)
+        {
+            DownlinkFrame response(DownlinkAPID::FileSystemMaintenance, 0);
+            auto& writer = response.PayloadWriter();
+
+            writer.WriteWordLE(this->_maintenance.ErasedReserve());
+            writer.WriteDoubleWordLE(static_cast<std::uint32_t>(this->_maintenance.TakeWorstWriteLatency().count()));
+
+            transmitter.SendFrame(response.Frame());
+        }
     }
 }
@@ -1,12 +1,14 @@
 #include "i2c.hpp"
 #include <algorithm>
 #include "base/reader.h"
+#include "base/writer.h"
 #include "comm/ITransmitter.hpp"
 #include "logger/logger.h"
 #include "system.h"
 #include "telecommunication/downlink.h"
 
 using telecommunication::downlink::CorrelatedDownlinkFrame;
+using telecommunication::downlink::DownlinkFrame;
 using telecommunication::downlink::DownlinkAPID;
 using drivers::i2c::I2CResult;
 
@@ -117,5 +119,32 @@ namespace obc
 
             return readResult;
         }
+
+        static void WriteBusStatistics(Writer& writer, const drivers::i2c::I2CBusStatistics& statistics)
+        {
+            writer.WriteDoubleWordLE(statistics.Transfers);
+            writer.WriteDoubleWordLE(statistics.Failures);
+            writer.WriteDoubleWordLE(statistics.TotalLatency);
+            writer.WriteWordLE(statistics.MaxLatency);
+        }
+
+        GetI2CStatisticsTelecommand::GetI2CStatisticsTelecommand(drivers::i2c::II2CFallbackStatistics& statistics)
+            : _statistics(statistics)
+        {
+        }
+
+        void GetI2CStatisticsTelecommand::Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> /*parameters*/)
+        {
+            const auto statistics = this->_statistics.Statistics();
+
+            DownlinkFrame response(DownlinkAPID::I2CStatistics, 0);
+            auto& writer = response.PayloadWriter();
+
+            WriteBusStatistics(writer, statistics.System);
+            WriteBusStatistics(writer, statistics.Payload);
+            writer.WriteDoubleWordLE(statistics.Rerouted);
+
+            transmitter.SendFrame(response.Frame());
+        }
     }
 }
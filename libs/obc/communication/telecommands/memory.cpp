@@ -1,8 +1,13 @@
 #include "memory.hpp"
 #include <algorithm>
+#include <array>
+#include "base/crc.h"
 #include "base/gcc_workaround.hpp"
+#include "base/lzss.hpp"
+#include "base/os.h"
 #include "base/reader.h"
 #include "comm/ITransmitter.hpp"
+#include "logger/logger.h"
 #include "telecommunication/downlink.h"
 #include "telecommunication/telecommand_handling.h"
 
@@ -51,12 +56,104 @@ namespace obc
 
                 frame.PayloadWriter().WriteArray(part);
 
-                transmitter.SendFrame(frame.Frame());
+                transmitter.SendFrameInPlace(frame.FrameWithHeadroom());
 
                 size -= partSize;
                 memoryToRead += partSize;
                 seq++;
             }
         }
+
+        constexpr std::uint8_t ReadMemoryCompressedTelecommand::HeaderSize;
+        constexpr std::uint8_t ReadMemoryCompressedTelecommand::MaxCompressedSize;
+        constexpr std::uint8_t ReadMemoryCompressedTelecommand::MinFreeSlots;
+        constexpr std::chrono::milliseconds ReadMemoryCompressedTelecommand::FrameTransmissionTime;
+        constexpr std::uint8_t ReadMemoryCompressedTelecommand::MaxSendAttempts;
+
+        void ReadMemoryCompressedTelecommand::Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters)
+        {
+            Reader r(parameters);
+            auto correlationId = r.ReadByte();
+            auto offset = r.ReadDoubleWordLE();
+            auto size = r.ReadDoubleWordLE();
+
+            if (!r.Status())
+            {
+                CorrelatedDownlinkFrame frame(DownlinkAPID::Operation, 0, correlationId);
+                frame.PayloadWriter().WriteByte(1);
+
+                transmitter.SendFrame(frame.Frame());
+                return;
+            }
+
+            size = std::min(size, std::numeric_limits<std::size_t>::max() - offset);
+
+            std::array<std::uint8_t, MaxCompressedSize> compressed;
+            std::uint32_t seq = 0;
+
+            while (size > 0)
+            {
+                std::array<std::uint8_t, 1> firstByte;
+                gsl::span<const std::uint8_t> input;
+
+                if (offset == 0)
+                {
+                    // address 0 cannot be dereferenced directly, so its content is sent in separate frame
+                    firstByte[0] = gcc_workaround::ReadByte0();
+                    input = firstByte;
+                }
+                else
+                {
+                    // uncompressed length in frame header is 16-bit
+                    input = gsl::make_span(reinterpret_cast<const std::uint8_t*>(offset), std::min<std::size_t>(size, 0xFFFF));
+                }
+
+                std::size_t consumed = 0;
+                const auto compressedSize = lzss::Encode(input, compressed, consumed);
+
+                CorrelatedDownlinkFrame frame(DownlinkAPID::MemoryContentCompressed, seq, correlationId);
+                auto& writer = frame.PayloadWriter();
+                writer.WriteDoubleWordLE(offset);
+                writer.WriteWordLE(static_cast<std::uint16_t>(consumed));
+                writer.WriteWordLE(CRC_calc(input.subspan(0, consumed)));
+                writer.WriteArray(gsl::make_span(compressed).subspan(0, compressedSize));
+
+                if (!SendPaced(transmitter, frame))
+                {
+                    LOGF(LOG_LEVEL_ERROR, "[memory] Dump aborted at 0x%lX", offset);
+                    return;
+                }
+
+                offset += consumed;
+                size -= consumed;
+                seq++;
+            }
+        }
+
+        bool ReadMemoryCompressedTelecommand::SendPaced(devices::comm::ITransmitter& transmitter, CorrelatedDownlinkFrame& frame)
+        {
+            for (auto attempt = 0; attempt < MaxSendAttempts; attempt++)
+            {
+                const auto sent = transmitter.SendFrameInPlace(frame.FrameWithHeadroom());
+                const auto freeSlots = transmitter.FreeSlots();
+
+                if (freeSlots.HasValue && freeSlots.Value < MinFreeSlots)
+                {
+                    // transmitter frees at least one slot per frame transmission time regardless of bitrate
+                    System::SleepTask((MinFreeSlots - freeSlots.Value) * FrameTransmissionTime);
+                }
+                else if (!sent)
+                {
+                    System::SleepTask(MinFreeSlots * FrameTransmissionTime);
+                }
+
+                if (sent)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
     }
 }
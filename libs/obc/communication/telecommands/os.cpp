@@ -0,0 +1,50 @@
+#include "os.hpp"
+#include <array>
+#include <cstring>
+#include "comm/ITransmitter.hpp"
+#include "telecommunication/downlink.h"
+
+using telecommunication::downlink::DownlinkFrame;
+using telecommunication::downlink::DownlinkAPID;
+
+namespace obc
+{
+    namespace telecommands
+    {
+        GetTaskStatisticsTelecommand::GetTaskStatisticsTelecommand(telemetry::ICpuUsage& cpuUsage) : _cpuUsage(cpuUsage)
+        {
+        }
+
+        void GetTaskStatisticsTelecommand::Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> /*parameters*/)
+        {
+            std::array<telemetry::TaskCpuUsage, telemetry::CpuUsageMonitor::MaxTasks> tasks;
+            const auto count = this->_cpuUsage.Report(tasks);
+
+            DownlinkFrame response(DownlinkAPID::TaskStatistics, 0);
+            auto& writer = response.PayloadWriter();
+
+            writer.WriteWordLE(this->_cpuUsage.IdleLoad());
+            auto reported = writer.Reserve(1);
+            reported[0] = 0;
+
+            for (std::size_t i = 0; i < count; i++)
+            {
+                const auto& task = tasks[i];
+                const auto name = gsl::make_span(reinterpret_cast<const std::uint8_t*>(task.Name), std::strlen(task.Name) + 1);
+
+                if (writer.RemainingSize() < static_cast<std::int32_t>(2 * sizeof(std::uint16_t) + name.size()))
+                {
+                    break;
+                }
+
+                writer.WriteWordLE(task.Load);
+                writer.WriteWordLE(task.StackHighWaterMark);
+                writer.WriteArray(name);
+
+                reported[0]++;
+            }
+
+            transmitter.SendFrame(response.Frame());
+        }
+    }
+}
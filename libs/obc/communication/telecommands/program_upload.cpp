@@ -1,15 +1,18 @@
 #include "program_upload.hpp"
 #include <array>
 #include <bitset>
+#include "base/crc.h"
 #include "base/reader.h"
 #include "comm/ITransmitter.hpp"
 #include "logger/logger.h"
 #include "program_flash/boot_table.hpp"
+#include "program_flash/compressed_writer.hpp"
 #include "telecommunication/downlink.h"
 
 using telecommunication::downlink::DownlinkAPID;
 using telecommunication::downlink::DownlinkFrame;
 using program_flash::FlashStatus;
+using program_flash::CompressedWriteStatus;
 using std::get;
 
 namespace obc
@@ -132,7 +135,81 @@ namespace obc
             return frame;
         }
 
-        EraseBootTableEntry::EraseBootTableEntry(program_flash::BootTable& bootTable) : _bootTable(bootTable)
+        static inline DownlinkFrame WriteCompressedSuccess(std::uint8_t entries, std::uint32_t streamOffset, std::uint32_t programLength)
+        {
+            DownlinkFrame response(DownlinkAPID::ProgramUpload, 0);
+            auto& writer = response.PayloadWriter();
+            writer.WriteByte(3);
+            writer.WriteByte(0);
+            writer.WriteByte(entries);
+            writer.WriteDoubleWordLE(streamOffset);
+            writer.WriteDoubleWordLE(programLength);
+
+            return response;
+        }
+
+        static inline DownlinkFrame WriteCompressedError(std::uint8_t errorCode, std::uint8_t entry, std::uint32_t streamOffset)
+        {
+            DownlinkFrame response(DownlinkAPID::ProgramUpload, 0);
+            auto& writer = response.PayloadWriter();
+            writer.WriteByte(3);
+            writer.WriteByte(1);
+            writer.WriteByte(errorCode);
+            writer.WriteByte(1 << entry);
+            writer.WriteDoubleWordLE(streamOffset);
+
+            return response;
+        }
+
+        static inline DownlinkFrame WriteCompressedStreamError(std::uint8_t status, std::uint8_t entries, std::uint32_t streamOffset)
+        {
+            DownlinkFrame response(DownlinkAPID::ProgramUpload, 0);
+            auto& writer = response.PayloadWriter();
+            writer.WriteByte(3);
+            writer.WriteByte(status);
+            writer.WriteByte(entries);
+            writer.WriteDoubleWordLE(streamOffset);
+
+            return response;
+        }
+
+        static inline DownlinkFrame WriteCompressedMalformedError()
+        {
+            DownlinkFrame frame(DownlinkAPID::ProgramUpload, 0);
+            auto& writer = frame.PayloadWriter();
+            writer.WriteByte(3);
+            writer.WriteByte(1);
+            writer.WriteByte(10);
+
+            return frame;
+        }
+
+        static inline DownlinkFrame BeginPatchResponse(std::uint8_t status, std::uint8_t entries, std::uint16_t crc)
+        {
+            DownlinkFrame response(DownlinkAPID::ProgramUpload, 0);
+            auto& writer = response.PayloadWriter();
+            writer.WriteByte(4);
+            writer.WriteByte(status);
+            writer.WriteByte(entries);
+            writer.WriteWordLE(crc);
+
+            return response;
+        }
+
+        static inline DownlinkFrame BeginPatchMalformedError()
+        {
+            DownlinkFrame frame(DownlinkAPID::ProgramUpload, 0);
+            auto& writer = frame.PayloadWriter();
+            writer.WriteByte(4);
+            writer.WriteByte(1);
+            writer.WriteByte(10);
+
+            return frame;
+        }
+
+        EraseBootTableEntry::EraseBootTableEntry(
+            program_flash::BootTable& bootTable, program_flash::CompressedProgramWriter& compressedWriter)
+            : _bootTable(bootTable), _compressedWriter(compressedWriter)
         {
         }
 
@@ -149,6 +226,8 @@ namespace obc
 
             UniqueLock<program_flash::BootTable> lock(this->_bootTable, InfiniteTimeout);
 
+            this->_compressedWriter.Invalidate(parameters[0]);
+
             for (auto i = 0; i < program_flash::BootTable::EntriesCount; i++)
             {
                 if (selectedEntries[i])
@@ -166,7 +245,8 @@ namespace obc
             transmitter.SendFrame(EraseEntrySuccess(parameters[0]).Frame());
         }
 
-        WriteProgramPart::WriteProgramPart(program_flash::BootTable& bootTable) : _bootTable(bootTable)
+        WriteProgramPart::WriteProgramPart(program_flash::BootTable& bootTable, program_flash::CompressedProgramWriter& compressedWriter)
+            : _bootTable(bootTable), _compressedWriter(compressedWriter)
         {
         }
 
@@ -174,7 +254,7 @@ namespace obc
         {
             Reader r(parameters);
 
-            std::bitset<program_flash::BootTable::EntriesCount> selectedEntries(r.ReadByte());
+            auto entries = r.ReadByte();
             auto offset = r.ReadDoubleWordLE();
             auto content = r.ReadToEnd();
 
@@ -188,18 +268,14 @@ namespace obc
 
             UniqueLock<program_flash::BootTable> lock(this->_bootTable, InfiniteTimeout);
 
-            for (auto i = 0; i < program_flash::BootTable::EntriesCount; i++)
-            {
-                if (selectedEntries[i])
-                {
-                    auto r = this->_bootTable.Entry(i).WriteContent(offset, content);
+            this->_compressedWriter.Invalidate(entries);
 
-                    if (r != FlashStatus::NotBusy)
-                    {
-                        transmitter.SendFrame(WriteProgramError(num(r), i, offset).Frame());
-                        return;
-                    }
-                }
+            auto result = this->_bootTable.WriteContent(entries, offset, content);
+
+            if (!result)
+            {
+                transmitter.SendFrame(WriteProgramError(num(get<0>(result.Error())), get<1>(result.Error()), offset).Frame());
+                return;
             }
 
             transmitter.SendFrame(WriteProgramSuccess(parameters[0], offset, content.size()).Frame());
@@ -258,7 +334,8 @@ namespace obc
                         return;
                     }
 
-                    auto actualCrc = e.CalculateCrc();
+                    auto knownCrc = e.WrittenContentCrc(length);
+                    auto actualCrc = knownCrc.HasValue ? knownCrc.Value : e.CalculateCrc();
 
                     if (actualCrc != expectedCrc)
                     {
@@ -270,5 +347,94 @@ namespace obc
 
             transmitter.SendFrame(FinalizeEntrySuccess(parameters[0], expectedCrc).Frame());
         }
+
+        WriteCompressedProgramPart::WriteCompressedProgramPart(
+            program_flash::BootTable& bootTable, program_flash::CompressedProgramWriter& compressedWriter)
+            : _bootTable(bootTable), _compressedWriter(compressedWriter)
+        {
+        }
+
+        void WriteCompressedProgramPart::Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters)
+        {
+            Reader r(parameters);
+
+            auto entries = r.ReadByte();
+            auto streamOffset = r.ReadDoubleWordLE();
+            auto content = r.ReadToEnd();
+
+            if (!r.Status() || content.size() == 0)
+            {
+                transmitter.SendFrame(WriteCompressedMalformedError().Frame());
+                return;
+            }
+
+            LOGF(LOG_LEVEL_INFO, "Uploading compressed program part %d from stream offset 0x%lX", content.size(), streamOffset);
+
+            UniqueLock<program_flash::BootTable> lock(this->_bootTable, InfiniteTimeout);
+
+            auto result = this->_compressedWriter.Write(entries, streamOffset, content);
+
+            switch (result.Status)
+            {
+                case CompressedWriteStatus::Success:
+                    transmitter.SendFrame(WriteCompressedSuccess(entries,
+                        this->_compressedWriter.StreamOffset(entries),
+                        this->_compressedWriter.ProgramLength())
+                                              .Frame());
+                    break;
+
+                case CompressedWriteStatus::OutOfSequence:
+                    transmitter.SendFrame(WriteCompressedStreamError(30, entries, this->_compressedWriter.StreamOffset(entries)).Frame());
+                    break;
+
+                case CompressedWriteStatus::CorruptedStream:
+                    transmitter.SendFrame(WriteCompressedStreamError(31, entries, streamOffset).Frame());
+                    break;
+
+                case CompressedWriteStatus::FlashError:
+                    transmitter.SendFrame(WriteCompressedError(num(result.Flash), result.Entry, streamOffset).Frame());
+                    break;
+            }
+        }
+
+        BeginProgramPatch::BeginProgramPatch(program_flash::BootTable& bootTable, program_flash::CompressedProgramWriter& compressedWriter)
+            : _bootTable(bootTable), _compressedWriter(compressedWriter)
+        {
+        }
+
+        void BeginProgramPatch::Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters)
+        {
+            Reader r(parameters);
+
+            auto entries = r.ReadByte();
+            auto sourceEntry = r.ReadByte();
+            auto sourceLength = r.ReadDoubleWordLE();
+            auto expectedCrc = r.ReadWordLE();
+
+            const bool validSource = sourceEntry < program_flash::BootTable::EntriesCount && !has_flag(entries, 1 << sourceEntry);
+
+            if (!r.Status() || entries == 0 || !validSource || sourceLength > program_flash::CompressedProgramWriter::MaxProgramLength)
+            {
+                transmitter.SendFrame(BeginPatchMalformedError().Frame());
+                return;
+            }
+
+            LOGF(LOG_LEVEL_INFO, "Starting patch from entry %d (%ld bytes)", sourceEntry, sourceLength);
+
+            UniqueLock<program_flash::BootTable> lock(this->_bootTable, InfiniteTimeout);
+
+            auto source = gsl::make_span(this->_bootTable.Entry(sourceEntry).Content(), sourceLength);
+            auto actualCrc = CRC_calc(source);
+
+            if (actualCrc != expectedCrc)
+            {
+                transmitter.SendFrame(BeginPatchResponse(20, entries, actualCrc).Frame());
+                return;
+            }
+
+            this->_compressedWriter.StartPatch(entries, sourceEntry, source);
+
+            transmitter.SendFrame(BeginPatchResponse(0, entries, actualCrc).Frame());
+        }
     }
 }
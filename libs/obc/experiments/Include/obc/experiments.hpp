@@ -16,6 +16,7 @@
 #include "experiment/sail/sail.hpp"
 #include "experiment/suns/suns.hpp"
 #include "experiments/experiments.h"
+#include "fs/ExperimentFileWriter.hpp"
 #include "fs/fs.h"
 #include "gpio/forward.h"
 #include "payload/interfaces.h"
@@ -167,6 +168,9 @@ namespace obc
             return this->Experiments.Get<Experiment>();
         }
 
+        /** @brief Background writer for experiment files */
+        experiments::fs::ExperimentFileWriter FileWriter;
+
         /** @brief Container with all experiments */
         AllExperiments Experiments;
 
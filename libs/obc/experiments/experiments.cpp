@@ -1,4 +1,5 @@
 #include "experiments.hpp"
+#include "logger/logger.h"
 
 namespace obc
 {
@@ -47,5 +48,16 @@ namespace obc
     {
         this->ExperimentsController.SetExperiments(this->Experiments.All());
         this->ExperimentsController.Initialize();
+
+        if (OS_RESULT_SUCCEEDED(this->FileWriter.Initialize()))
+        {
+            this->Experiments.Get<experiment::adcs::DetumblingExperiment>().SetFileWriter(&this->FileWriter);
+            this->Experiments.Get<experiment::sail::SailExperiment>().SetFileWriter(&this->FileWriter);
+            this->Experiments.Get<experiment::payload::PayloadCommissioningExperiment>().SetFileWriter(&this->FileWriter);
+        }
+        else
+        {
+            LOG(LOG_LEVEL_ERROR, "[exp] Unable to start experiment file writer");
+        }
     }
 }
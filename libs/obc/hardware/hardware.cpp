@@ -103,9 +103,9 @@ OBCHardware::OBCHardware(
       FlashDriver(io_map::ProgramFlash::FlashBase),                                       //
       Burtc(burtcTickHandler),                                                            //
       FramSpi{                                                                            //
-          {SPI, Pins.Fram1ChipSelect},                                                    //
-          {SPI, Pins.Fram2ChipSelect},                                                    //
-          {SPI, Pins.Fram3ChipSelect}},                                                   //
+          {SPI, Pins.Fram1ChipSelect, drivers::spi::SPIPriority::Critical},               //
+          {SPI, Pins.Fram2ChipSelect, drivers::spi::SPIPriority::Critical},               //
+          {SPI, Pins.Fram3ChipSelect, drivers::spi::SPIPriority::Critical}},              //
       PersistentStorage{errorCounting,                                                    //
           {&FramSpi[0],                                                                   //
               &FramSpi[1],                                                                //
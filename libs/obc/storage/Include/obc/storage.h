@@ -33,6 +33,9 @@ namespace obc
     template <typename Storage> class OBCStorageHandler final
     {
       public:
+        /** @brief Memory pools sized for file system placed on this storage */
+        using MemoryPools = typename Storage::MemoryPools;
+
         /**
          * @brief Initializes @ref OBCStorageHandler instance
          * @param errors Error counting service
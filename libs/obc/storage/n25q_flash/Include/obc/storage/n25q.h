@@ -26,6 +26,15 @@ namespace obc
         class N25QStorage final
         {
           public:
+            /** @brief Type of YAFFS device placed on external flash */
+            using YaffsDevice = devices::n25q::N25QYaffsDevice<devices::n25q::BlockMapping::Sector, 2_KB, 16_MB>;
+
+            /** @brief Memory pools sized for @ref YaffsDevice geometry */
+            using MemoryPools = services::fs::YaffsMemoryPools<2_KB, YaffsDevice::ChunksPerBlock, YaffsDevice::EndBlock, 128>;
+
+            /** @brief Number of erased blocks kept ready by background garbage collection */
+            static constexpr std::uint16_t ErasedReserve = 8;
+
             /**
              * @brief Constructs @ref N25QStorage instance
              * @param[in] errors Error counting service
@@ -65,6 +74,13 @@ namespace obc
              */
             devices::n25q::N25QDriver& GetDriver(uint8_t index);
 
+            /**
+             * @brief Returns SPI bus utilisation counters of single N25Q chip
+             * @param[in] index Index (0, 1 or 2) of the chip
+             * @return Utilisation counters
+             */
+            drivers::spi::SPIUtilisation GetSpiUtilisation(uint8_t index) const;
+
             /**
              * @brief Returns top (redundant) driver
              * @return Reference to driver
@@ -80,7 +96,7 @@ namespace obc
 
             devices::n25q::RedundantN25QDriver _driver;
 
-            devices::n25q::N25QYaffsDevice<devices::n25q::BlockMapping::Sector, 2_KB, 16_MB> Device;
+            YaffsDevice Device;
         };
 
         namespace error_counters
@@ -8,6 +8,8 @@ using services::fs::IYaffsDeviceOperations;
 using drivers::gpio::OutputPin;
 using namespace obc::storage::error_counters;
 
+constexpr std::uint16_t N25QStorage::ErasedReserve;
+
 N25QStorage::N25QStorage(                     //
     error_counter::ErrorCounting& errors,     //
     drivers::spi::EFMSPIInterface& spi,       //
@@ -36,7 +38,13 @@ OSResult N25QStorage::Initialize()
         return OSResult::DeviceNotFound;
     }
 
-    return this->Device.Mount(this->_deviceOperations);
+    const auto result = this->Device.Mount(this->_deviceOperations);
+    if (OS_RESULT_FAILED(result))
+    {
+        return result;
+    }
+
+    return this->_deviceOperations.StartMaintenance(this->Device.Device(), this->Device, ErasedReserve);
 }
 
 OSResult N25QStorage::ClearStorage()
@@ -63,3 +71,8 @@ devices::n25q::N25QDriver& N25QStorage::GetDriver(uint8_t index)
 {
     return _n25qDrivers[index];
 }
+
+drivers::spi::SPIUtilisation N25QStorage::GetSpiUtilisation(uint8_t index) const
+{
+    return _spiSlaves[index].Utilisation();
+}
@@ -26,6 +26,9 @@ namespace obc
         class STKStorage final
         {
           public:
+            /** @brief Memory pools sized for NAND geometry set in @ref InitializeRunlevel1 (512B chunks, 32 chunks per block, 1MB) */
+            using MemoryPools = services::fs::YaffsMemoryPools<512, 32, 60, 64>;
+
             /**
              * @brief Constructs @ref STKStorage instance
              * @param[in] spi SPI interface used by external memories
@@ -0,0 +1,54 @@
+#include <cstdint>
+#include <em_cmu.h>
+#include <em_timer.h>
+#include "efm_support/clock.h"
+#include "mcu/io_map.h"
+
+using io_map::RunTimeStats;
+
+/**
+ * @brief Configures timers used as source of FreeRTOS run time statistics
+ *
+ * Low timer counts prescaled HF peripheral clock and high timer counts its overflows, together
+ * forming single 32-bit counter that runs in EM1 so time spent by idle task is accounted for.
+ */
+extern "C" void ConfigureRunTimeStatsTimer(void)
+{
+    CMU_ClockEnable(efm::Clock(RunTimeStats::LowTimerHW), true);
+    CMU_ClockEnable(efm::Clock(RunTimeStats::HighTimerHW), true);
+
+    TIMER_Init_TypeDef high = TIMER_INIT_DEFAULT;
+    high.enable = false;
+    high.mode = timerModeUp;
+    high.clkSel = timerClkSelCascade;
+
+    TIMER_Init(RunTimeStats::HighTimerHW, &high);
+
+    TIMER_Init_TypeDef low = TIMER_INIT_DEFAULT;
+    low.enable = false;
+    low.mode = timerModeUp;
+    low.prescale = RunTimeStats::Prescaler;
+
+    TIMER_Init(RunTimeStats::LowTimerHW, &low);
+
+    TIMER_Enable(RunTimeStats::HighTimerHW, true);
+    TIMER_Enable(RunTimeStats::LowTimerHW, true);
+}
+
+/**
+ * @brief Reads current value of FreeRTOS run time statistics counter
+ * @return Counter value
+ */
+extern "C" std::uint32_t GetRunTimeStatsCounter(void)
+{
+    std::uint32_t high;
+    std::uint32_t low;
+
+    do
+    {
+        high = TIMER_CounterGet(RunTimeStats::HighTimerHW);
+        low = TIMER_CounterGet(RunTimeStats::LowTimerHW);
+    } while (high != TIMER_CounterGet(RunTimeStats::HighTimerHW));
+
+    return (high << 16) | low;
+}
@@ -0,0 +1,149 @@
+#ifndef LIBS_SCRUBBER_INCLUDE_SCRUBBER_N25Q_HPP_
+#define LIBS_SCRUBBER_INCLUDE_SCRUBBER_N25Q_HPP_
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <gsl/span>
+#include "fm25w/fm25w.hpp"
+#include "n25q/n25q.h"
+#include "utils.h"
+
+namespace scrubber
+{
+    /**
+     * @brief N25Q recovery status
+     * @ingroup scrubbing
+     */
+    struct N25QRecoveryStatus
+    {
+        /** @brief Index of block that will be processed next */
+        std::uint16_t NextBlock;
+        /** @brief Number of blocks repaired by rewriting disagreeing copies */
+        std::uint16_t Recovered;
+        /** @brief Number of blocks erased on all chips as they could not be voted */
+        std::uint16_t Erased;
+    };
+
+    /**
+     * @brief Block-level recovery of data stored on three N25Q chips
+     * @ingroup scrubbing
+     *
+     * Each block (64KB sector, single YAFFS block) is compared subsector by subsector using 2-of-3 byte vote.
+     *  - Subsectors where all copies agree are left untouched.
+     *  - Copies that disagree with voted content (or could not be read) are erased and rewritten with voted content.
+     *  - Block containing byte on which no two copies agree, which could not be read from two chips or whose copy could not be
+     *    rewritten is erased on all chips, so that file system finds it empty instead of inconsistent.
+     *
+     * Progress is stored in FRAM after each block, so recovery interrupted by reset continues from the block it was processing.
+     * Progress record is cleared once all blocks have been processed.
+     */
+    class N25QRecovery final
+    {
+      public:
+        /** @brief Size of single recovered block */
+        static constexpr std::size_t BlockSize = 64_KB;
+        /** @brief Size of area voted at once */
+        static constexpr std::size_t VoteSize = 4_KB;
+        /** @brief Minimal size of working buffer (three copies and voted content) */
+        static constexpr std::size_t BufferSize = 4 * VoteSize;
+        /** @brief Size of progress record stored in FRAM */
+        static constexpr std::size_t ProgressSize = 10;
+
+        /**
+         * @brief Ctor
+         * @param buffer Working buffer, at least @ref BufferSize bytes
+         * @param flashes Drivers of three N25Q chips holding the same content
+         * @param fram FRAM driver used to store progress
+         * @param progressAddress Address of progress record in FRAM
+         * @param blocksCount Number of blocks to process
+         */
+        N25QRecovery(gsl::span<std::uint8_t> buffer,
+            std::array<devices::n25q::IN25QDriver*, 3> flashes,
+            devices::fm25w::IFM25WDriver& fram,
+            devices::fm25w::Address progressAddress,
+            std::uint16_t blocksCount);
+
+        /**
+         * @brief Loads progress of interrupted recovery
+         * @return true if recovery is resumed, false if it starts from the first block
+         */
+        bool Resume();
+
+        /**
+         * @brief Processes next block
+         * @return true if block has been processed, false if there are no more blocks
+         */
+        bool RecoverNextBlock();
+
+        /**
+         * @brief Returns current recovery status
+         * @return Recovery status
+         */
+        N25QRecoveryStatus Status() const;
+
+      private:
+        /** @brief Result of processing single block */
+        enum class BlockResult
+        {
+            Intact,
+            Recovered,
+            Erased
+        };
+
+        /**
+         * @brief Votes and repairs single block
+         * @param address Block base address
+         * @return Block result
+         */
+        BlockResult RecoverBlock(std::size_t address);
+
+        /**
+         * @brief Votes and repairs single subsector
+         * @param address Subsector address
+         * @param[out] repaired Set to true if any copy has been rewritten
+         * @return true if subsector is consistent on all chips, false if block has to be erased
+         */
+        bool RecoverSubSector(std::size_t address, bool& repaired);
+
+        /**
+         * @brief Replaces content of single subsector on one chip
+         * @param flash Chip driver
+         * @param address Subsector address
+         * @param content New subsector content
+         * @return true on success
+         */
+        static bool Rewrite(devices::n25q::IN25QDriver& flash, std::size_t address, gsl::span<const std::uint8_t> content);
+
+        /**
+         * @brief Erases block on all chips
+         * @param address Block base address
+         */
+        void EraseBlock(std::size_t address);
+
+        /** @brief Stores progress record */
+        void SaveProgress();
+
+        /** @brief Clears progress record */
+        void ClearProgress();
+
+        /** @brief Magic number marking valid progress record */
+        static constexpr std::uint32_t MagicNumber = 0x2E5C0B3A;
+
+        /** @brief Working buffer */
+        gsl::span<std::uint8_t> _buffer;
+        /** @brief N25Q chips */
+        std::array<devices::n25q::IN25QDriver*, 3> _flashes;
+        /** @brief FRAM driver */
+        devices::fm25w::IFM25WDriver& _fram;
+        /** @brief Address of progress record */
+        const devices::fm25w::Address _progressAddress;
+        /** @brief Number of processed blocks */
+        const std::uint16_t _blocksCount;
+        /** @brief Current status */
+        N25QRecoveryStatus _status;
+    };
+}
+
+#endif /* LIBS_SCRUBBER_INCLUDE_SCRUBBER_N25Q_HPP_ */
@@ -0,0 +1,240 @@
+#include "n25q.hpp"
+#include <algorithm>
+#include <cstring>
+#include "base/reader.h"
+#include "base/writer.h"
+#include "logger/logger.h"
+#include "redundancy.hpp"
+
+using devices::n25q::IN25QDriver;
+using devices::n25q::N25QDriver;
+using devices::n25q::OperationResult;
+
+namespace scrubber
+{
+    N25QRecovery::N25QRecovery(gsl::span<std::uint8_t> buffer,
+        std::array<IN25QDriver*, 3> flashes,
+        devices::fm25w::IFM25WDriver& fram,
+        devices::fm25w::Address progressAddress,
+        std::uint16_t blocksCount)
+        : _buffer(buffer), _flashes(flashes), _fram(fram), _progressAddress(progressAddress), _blocksCount(blocksCount),
+          _status{0, 0, 0}
+    {
+    }
+
+    bool N25QRecovery::Resume()
+    {
+        std::array<std::uint8_t, ProgressSize> record;
+        this->_fram.Read(this->_progressAddress, record);
+
+        Reader r(record);
+
+        const auto magic = r.ReadDoubleWordLE();
+        const auto nextBlock = r.ReadWordLE();
+        const auto recovered = r.ReadWordLE();
+        const auto erased = r.ReadWordLE();
+
+        if (!r.Status() || magic != MagicNumber || nextBlock >= this->_blocksCount)
+        {
+            this->_status = N25QRecoveryStatus{0, 0, 0};
+            return false;
+        }
+
+        this->_status = N25QRecoveryStatus{nextBlock, recovered, erased};
+        return true;
+    }
+
+    bool N25QRecovery::RecoverNextBlock()
+    {
+        if (this->_status.NextBlock >= this->_blocksCount)
+        {
+            return false;
+        }
+
+        if (this->_buffer.size() < static_cast<std::ptrdiff_t>(BufferSize))
+        {
+            LOG(LOG_LEVEL_ERROR, "[n25q] Recovery buffer too small");
+            return false;
+        }
+
+        const auto block = this->_status.NextBlock;
+
+        switch (this->RecoverBlock(block * BlockSize))
+        {
+            case BlockResult::Recovered:
+                LOGF(LOG_LEVEL_WARNING, "[n25q] Block %d recovered", block);
+                this->_status.Recovered++;
+                break;
+            case BlockResult::Erased:
+                LOGF(LOG_LEVEL_ERROR, "[n25q] Block %d could not be voted - erased", block);
+                this->_status.Erased++;
+                break;
+            case BlockResult::Intact:
+            default:
+                break;
+        }
+
+        this->_status.NextBlock++;
+
+        if (this->_status.NextBlock >= this->_blocksCount)
+        {
+            this->ClearProgress();
+        }
+        else
+        {
+            this->SaveProgress();
+        }
+
+        return true;
+    }
+
+    N25QRecoveryStatus N25QRecovery::Status() const
+    {
+        return this->_status;
+    }
+
+    N25QRecovery::BlockResult N25QRecovery::RecoverBlock(std::size_t address)
+    {
+        bool repaired = false;
+
+        for (std::size_t offset = 0; offset < BlockSize; offset += VoteSize)
+        {
+            if (!this->RecoverSubSector(address + offset, repaired))
+            {
+                this->EraseBlock(address);
+                return BlockResult::Erased;
+            }
+        }
+
+        return repaired ? BlockResult::Recovered : BlockResult::Intact;
+    }
+
+    bool N25QRecovery::RecoverSubSector(std::size_t address, bool& repaired)
+    {
+        std::array<gsl::span<std::uint8_t>, 3> copies;
+        std::array<bool, 3> readOk;
+        auto voted = this->_buffer.subspan(3 * VoteSize, VoteSize);
+
+        for (std::uint8_t i = 0; i < 3; i++)
+        {
+            copies[i] = this->_buffer.subspan(i * VoteSize, VoteSize);
+            readOk[i] = OS_RESULT_SUCCEEDED(this->_flashes[i]->ReadMemory(address, copies[i]));
+        }
+
+        const auto failedReads = std::count(readOk.begin(), readOk.end(), false);
+
+        if (failedReads > 1)
+        {
+            return false;
+        }
+
+        if (failedReads == 1)
+        {
+            // vote degrades to comparison of two remaining copies
+            const auto failed = std::distance(readOk.begin(), std::find(readOk.begin(), readOk.end(), false));
+            const auto& first = copies[(failed + 1) % 3];
+            const auto& second = copies[(failed + 2) % 3];
+
+            if (memcmp(first.data(), second.data(), VoteSize) != 0)
+            {
+                return false;
+            }
+
+            std::copy(first.begin(), first.end(), voted.begin());
+        }
+        else
+        {
+            for (std::ptrdiff_t i = 0; i < voted.size(); i++)
+            {
+                const auto value = redundancy::Vote(copies[0][i], copies[1][i], copies[2][i]);
+                if (!value.HasValue)
+                {
+                    return false;
+                }
+
+                voted[i] = value.Value;
+            }
+        }
+
+        for (std::uint8_t i = 0; i < 3; i++)
+        {
+            if (readOk[i] && memcmp(copies[i].data(), voted.data(), VoteSize) == 0)
+            {
+                continue;
+            }
+
+            LOGF(LOG_LEVEL_WARNING, "[n25q] Rewriting subsector 0x%X on flash %d", static_cast<unsigned int>(address), i + 1);
+
+            if (!Rewrite(*this->_flashes[i], address, voted))
+            {
+                return false;
+            }
+
+            repaired = true;
+        }
+
+        return true;
+    }
+
+    bool N25QRecovery::Rewrite(IN25QDriver& flash, std::size_t address, gsl::span<const std::uint8_t> content)
+    {
+        if (flash.BeginEraseSubSector(address).Wait() != OperationResult::Success)
+        {
+            return false;
+        }
+
+        for (std::ptrdiff_t offset = 0; offset < content.size(); offset += N25QDriver::PageSize)
+        {
+            const auto page = content.subspan(offset, std::min(N25QDriver::PageSize, content.size() - offset));
+
+            if (flash.BeginWritePage(address, offset, page).Wait() != OperationResult::Success)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void N25QRecovery::EraseBlock(std::size_t address)
+    {
+        auto wait1 = this->_flashes[0]->BeginEraseSector(address);
+        auto wait2 = this->_flashes[1]->BeginEraseSector(address);
+        auto wait3 = this->_flashes[2]->BeginEraseSector(address);
+
+        const auto result1 = wait1.Wait();
+        const auto result2 = wait2.Wait();
+        const auto result3 = wait3.Wait();
+
+        if (result1 != OperationResult::Success || result2 != OperationResult::Success || result3 != OperationResult::Success)
+        {
+            LOGF(LOG_LEVEL_ERROR,
+                "[n25q] Block 0x%X erase failed (%d, %d, %d)",
+                static_cast<unsigned int>(address),
+                num(result1),
+                num(result2),
+                num(result3));
+        }
+    }
+
+    void N25QRecovery::SaveProgress()
+    {
+        std::array<std::uint8_t, ProgressSize> record;
+        Writer w(record);
+
+        w.WriteDoubleWordLE(MagicNumber);
+        w.WriteWordLE(this->_status.NextBlock);
+        w.WriteWordLE(this->_status.Recovered);
+        w.WriteWordLE(this->_status.Erased);
+
+        this->_fram.Write(this->_progressAddress, w.Capture());
+    }
+
+    void N25QRecovery::ClearProgress()
+    {
+        std::array<std::uint8_t, ProgressSize> record;
+        record.fill(0);
+
+        this->_fram.Write(this->_progressAddress, record);
+    }
+}
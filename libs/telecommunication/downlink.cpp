@@ -8,15 +8,16 @@ namespace telecommunication
     {
         static_assert(num(DownlinkAPID::LastItem) - 1 <= MaxValueOnBits(6), "APID is 6-bit value");
 
-        RawFrame::RawFrame() : _payloadWriter(gsl::make_span(_frame))
+        RawFrame::RawFrame() : _payloadWriter(gsl::make_span(_frame).subspan(devices::comm::FrameHeadroom))
         {
         }
 
-        DownlinkFrame::DownlinkFrame(DownlinkAPID apid, std::uint32_t seq) : _payloadWriter(gsl::make_span(_frame).subspan(3))
+        DownlinkFrame::DownlinkFrame(DownlinkAPID apid, std::uint32_t seq)
+            : _payloadWriter(gsl::make_span(_frame).subspan(devices::comm::FrameHeadroom + HeaderSize))
         {
             this->_frame.fill(0);
 
-            BitWriter w(this->_frame);
+            BitWriter w(gsl::make_span(this->_frame).subspan(devices::comm::FrameHeadroom, HeaderSize));
             w.WriteWord(num(apid), 6);
             w.WriteDoubleWord(seq, 18);
         }
@@ -12,6 +12,6 @@
  * @param[out] writer Writer object that should be updated with latest beacon payload.
  * @return Operation status, true on success, false otherwise.
  */
-bool WriteBeaconPayload(telemetry::TelemetryState& state, Writer& writer);
+bool WriteBeaconPayload(const telemetry::TelemetryState& state, Writer& writer);
 
 #endif /* LIBS_TELECOMMUNICATION_INCLUDE_TELECOMMUNICATION_BEACON_HPP_ */
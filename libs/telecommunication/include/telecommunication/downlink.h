@@ -63,6 +63,11 @@ namespace telecommunication
             MemoryContent = 0x21,              //!< Memory contents
             BeaconError = 0x22,                //!< Beacon Error
             DisableAntennaDeployment = 0x23,   //!< Disable automatic antenna deployment
+            TaskStatistics = 0x24,             //!< CPU usage of tasks
+            I2CStatistics = 0x25,              //!< I2C bus statistics
+            FileListPage = 0x26,               //!< Single page of paginated file list
+            MemoryContentCompressed = 0x27,    //!< Compressed memory contents
+            FileSystemMaintenance = 0x28,      //!< File system maintenance statistics
             Telemetry = 0x3F,                  //!< TelemetryLong
             LastItem                           //!< LastItem
         };
@@ -100,9 +105,15 @@ namespace telecommunication
              */
             gsl::span<const uint8_t> Frame();
 
+            /**
+             * @brief Returns frame preceded by headroom reserved for transmitter command
+             * @return Buffer that can be passed to @ref devices::comm::ITransmitter::SendFrameInPlace
+             */
+            gsl::span<uint8_t> FrameWithHeadroom();
+
           private:
-            /** @brief Buffer in which frame is built */
-            std::array<uint8_t, devices::comm::MaxDownlinkFrameSize> _frame;
+            /** @brief Buffer in which frame is built, preceded by headroom for transmitter command */
+            std::array<uint8_t, devices::comm::FrameHeadroom + devices::comm::MaxDownlinkFrameSize> _frame;
 
             /** @brief Writer instance used to build frame payload */
             Writer _payloadWriter;
@@ -118,6 +129,11 @@ namespace telecommunication
             return this->_payloadWriter.Capture();
         }
 
+        inline gsl::span<uint8_t> RawFrame::FrameWithHeadroom()
+        {
+            return gsl::make_span(this->_frame).subspan(0, devices::comm::FrameHeadroom + this->_payloadWriter.GetDataLength());
+        }
+
         /**
          * @brief Downlink frame implementation
          */
@@ -143,14 +159,20 @@ namespace telecommunication
              */
             inline gsl::span<const uint8_t> Frame();
 
+            /**
+             * @brief Returns frame preceded by headroom reserved for transmitter command
+             * @return Buffer that can be passed to @ref devices::comm::ITransmitter::SendFrameInPlace
+             */
+            inline gsl::span<uint8_t> FrameWithHeadroom();
+
             /** @brief Size of header size */
             static constexpr std::uint8_t HeaderSize = 3;
             /** @brief Maximum size of payload inside single frame */
             static constexpr std::uint8_t MaxPayloadSize = devices::comm::MaxDownlinkFrameSize - HeaderSize;
 
           private:
-            /** @brief Buffer in which frame is built */
-            std::array<uint8_t, devices::comm::MaxDownlinkFrameSize> _frame;
+            /** @brief Buffer in which frame is built, preceded by headroom for transmitter command */
+            std::array<uint8_t, devices::comm::FrameHeadroom + devices::comm::MaxDownlinkFrameSize> _frame;
 
             /** @brief Writer instance used to build frame payload */
             Writer _payloadWriter;
@@ -163,7 +185,13 @@ namespace telecommunication
 
         inline gsl::span<const uint8_t> DownlinkFrame::Frame()
         {
-            return gsl::make_span(this->_frame).subspan(0, HeaderSize + this->_payloadWriter.GetDataLength());
+            return gsl::make_span(this->_frame).subspan(devices::comm::FrameHeadroom, HeaderSize + this->_payloadWriter.GetDataLength());
+        }
+
+        inline gsl::span<uint8_t> DownlinkFrame::FrameWithHeadroom()
+        {
+            const auto frameLength = HeaderSize + this->_payloadWriter.GetDataLength();
+            return gsl::make_span(this->_frame).subspan(0, devices::comm::FrameHeadroom + frameLength);
         }
 
         /**
@@ -3,9 +3,15 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cassert>
 #include <cstdint>
+#include <gsl/span>
 #include <limits>
 #include <tuple>
+#include <type_traits>
+#include "base/BitWriter.hpp"
 #include "base/ITelemetryContainer.hpp"
 #include "base/writer.h"
 #include "fwd.hpp"
@@ -158,6 +164,88 @@ namespace telemetry
              */
             static constexpr int Value = Base::BitSize();
         };
+
+        /**
+         * @brief Helper type that calculates position of telemetry element in serialized telemetry.
+         * @ingroup telemetry_details
+         */
+        template <typename Arg, typename... Args> struct BitOffset;
+
+        /**
+         * @brief Helper type that calculates position of telemetry element in serialized telemetry.
+         * @ingroup telemetry_details
+         *
+         * @remark Specialization for non empty list of telemetry element types.
+         */
+        template <typename Arg, typename Base, typename... Args> struct BitOffset<Arg, Base, Args...>
+        {
+            /**
+             * @brief This variable contains sum of serialized sizes of all types that precede Arg in {Base, Args...} list.
+             */
+            static constexpr int Value = std::is_same<Arg, Base>::value ? 0 : Base::BitSize() + BitOffset<Arg, Args...>::Value;
+        };
+
+        /**
+         * @brief Helper type that calculates position of telemetry element in serialized telemetry.
+         * @ingroup telemetry_details
+         *
+         * @remark Specialization for empty list of telemetry element types.
+         */
+        template <typename Arg> struct BitOffset<Arg>
+        {
+            /**
+             * @brief This variable terminates the summation.
+             */
+            static constexpr int Value = 0;
+        };
+
+        /**
+         * @brief Replaces masked bits of single byte.
+         * @ingroup telemetry_details
+         * @param[in,out] byte Modified byte.
+         * @param[in] mask Mask of bits that should be replaced.
+         * @param[in] bits New values of masked bits.
+         * @return True if value of byte has changed, false otherwise.
+         */
+        inline bool MergeBits(std::uint8_t& byte, std::uint8_t mask, std::uint8_t bits)
+        {
+            const auto value = static_cast<std::uint8_t>((byte & ~mask) | (bits & mask));
+            const auto changed = value != byte;
+            byte = value;
+            return changed;
+        }
+
+        /**
+         * @brief Copies bit sequence to the passed buffer at arbitrary bit position.
+         * @ingroup telemetry_details
+         * @param[in,out] target Buffer that should be updated.
+         * @param[in] position Bit position in the target buffer at which the sequence should start.
+         * @param[in] source Buffer that contains the bit sequence starting at its first bit.
+         * @param[in] length Length of bit sequence in bits.
+         * @return True if at least one bit in the target buffer has changed, false otherwise.
+         *
+         * Bits are ordered the same way as in BitWriter: from the least significant bit of each byte.
+         */
+        inline bool CopyBits(gsl::span<std::uint8_t> target, std::uint32_t position, gsl::span<const std::uint8_t> source, std::uint32_t length)
+        {
+            bool changed = false;
+            for (std::uint32_t offset = 0; offset < length; offset += 8)
+            {
+                const auto count = std::min<std::uint32_t>(8, length - offset);
+                const auto shift = (position + offset) % 8;
+                const auto index = (position + offset) / 8;
+                const auto mask = static_cast<std::uint16_t>(((1u << count) - 1) << shift);
+                const auto bits = static_cast<std::uint16_t>(source[offset / 8] << shift);
+
+                changed |= MergeBits(target[index], static_cast<std::uint8_t>(mask), static_cast<std::uint8_t>(bits));
+                if ((mask >> 8) != 0)
+                {
+                    changed |= MergeBits(target[index + 1], static_cast<std::uint8_t>(mask >> 8), static_cast<std::uint8_t>(bits >> 8));
+                }
+            }
+
+            return changed;
+        }
     }
 
     /**
@@ -248,6 +336,13 @@ namespace telemetry
          */
         template <typename Arg> const Arg& Get() const;
 
+        /**
+         * @brief Returns position of telemetry element in serialized telemetry.
+         * @tparam Arg Type of queried telemetry element.
+         * @return Offset of the first bit of Arg's serialized form from the beginning of serialized telemetry.
+         */
+        template <typename Arg> static constexpr int BitOffset();
+
         /**
          * @brief This function returns information whether there is at least one modified telemetry element.
          * @return True if there is at least one modified telemetry element, false otherwise.
@@ -266,6 +361,20 @@ namespace telemetry
          */
         template <typename WriterType> void Write(WriterType& writer) const;
 
+        /**
+         * @brief Encodes telemetry elements in place of their previous serialized form.
+         * @param[in,out] buffer Buffer with serialized telemetry, it should be at least TotalSerializedSize bytes long.
+         * @param[in] full True to encode all elements, false to encode only elements that have been updated
+         * since they were last encoded.
+         * @return True if contents of the buffer has changed, false otherwise.
+         *
+         * Every element occupies exactly Type::BitSize() bits starting at BitOffset<Type>(), so re-encoding single element
+         * does not move any other one. Unused tail of variable sized element is filled with zeros.
+         * Both Set and SetVolatile mark element for encoding. This tracking is independent of the one used by
+         * WriteModified & CommitCapture.
+         */
+        bool Encode(gsl::span<std::uint8_t> buffer, bool full);
+
         /**
          * @brief Informs telemetry container that all changes have been saved. And from now on the telemetry
          * elements should be considered unmodified.
@@ -275,10 +384,20 @@ namespace telemetry
       private:
         /**
          * @brief Telemetry element wrapper that attaches precalculated information whether it
-         * has been mofidied since last save.
+         * has been mofidied since last save and since last encoding.
          * @tparam Arg Telemetry element type.
          */
-        template <typename Arg> using ElementContainer = std::pair<Arg, bool>;
+        template <typename Arg> struct ElementContainer
+        {
+            /** @brief Telemetry element. */
+            Arg value;
+
+            /** @brief Flag indicating whether element has been modified since last save. */
+            bool modified;
+
+            /** @brief Flag indicating whether element has been updated since last encoding. */
+            bool encodePending;
+        };
 
         typedef std::tuple<ElementContainer<Type>...> Container;
 
@@ -294,6 +413,10 @@ namespace telemetry
 
         template <typename WriterType> void WriteInternal(WriterType& writer) const;
 
+        template <int Tag, typename T, typename... Args> bool EncodeInternal(gsl::span<std::uint8_t> buffer, bool full);
+
+        template <int Tag> bool EncodeInternal(gsl::span<std::uint8_t> buffer, bool full);
+
         template <int Tag, typename T, typename... Args> void CommitCaptureInternal();
 
         template <int Tag> void CommitCaptureInternal();
@@ -321,18 +444,26 @@ namespace telemetry
     template <typename... Type> template <typename Arg> void Telemetry<Type...>::Set(const Arg& arg)
     {
         auto& entry = std::get<ElementContainer<Arg>>(this->storage);
-        entry.first = arg;
-        entry.second = true;
+        entry.value = arg;
+        entry.modified = true;
+        entry.encodePending = true;
     }
 
     template <typename... Type> template <typename Arg> void Telemetry<Type...>::SetVolatile(const Arg& arg)
     {
-        std::get<ElementContainer<Arg>>(this->storage).first = arg;
+        auto& entry = std::get<ElementContainer<Arg>>(this->storage);
+        entry.value = arg;
+        entry.encodePending = true;
     }
 
     template <typename... Type> template <typename Arg> const Arg& Telemetry<Type...>::Get() const
     {
-        return std::get<ElementContainer<Arg>>(this->storage).first;
+        return std::get<ElementContainer<Arg>>(this->storage).value;
+    }
+
+    template <typename... Type> template <typename Arg> constexpr int Telemetry<Type...>::BitOffset()
+    {
+        return details::BitOffset<Arg, Type...>::Value;
     }
 
     template <typename... Type> inline bool Telemetry<Type...>::IsModified() const
@@ -342,7 +473,7 @@ namespace telemetry
 
     template <typename... Type> template <int Tag, typename T, typename... Args> inline bool Telemetry<Type...>::IsModifiedInternal() const
     {
-        return std::get<ElementContainer<T>>(this->storage).second || IsModifiedInternal<0, Args...>();
+        return std::get<ElementContainer<T>>(this->storage).modified || IsModifiedInternal<0, Args...>();
     }
 
     template <typename... Type> template <int Tag> inline bool Telemetry<Type...>::IsModifiedInternal() const
@@ -360,6 +491,12 @@ namespace telemetry
         return WriteInternal<WriterType, Type...>(writer);
     }
 
+    template <typename... Type> inline bool Telemetry<Type...>::Encode(gsl::span<std::uint8_t> buffer, bool full)
+    {
+        assert(buffer.size() >= TotalSerializedSize);
+        return EncodeInternal<0, Type...>(buffer, full);
+    }
+
     template <typename... Type> inline void Telemetry<Type...>::CommitCapture()
     {
         CommitCaptureInternal<0, Type...>();
@@ -370,9 +507,9 @@ namespace telemetry
     inline void Telemetry<Type...>::WriteModifiedInternal(WriterType& writer) const
     {
         const auto& entry = std::get<ElementContainer<T>>(this->storage);
-        if (entry.second)
+        if (entry.modified)
         {
-            entry.first.Write(writer);
+            entry.value.Write(writer);
         }
 
         WriteModifiedInternal<WriterType, Args...>(writer);
@@ -389,7 +526,7 @@ namespace telemetry
     inline void Telemetry<Type...>::WriteInternal(WriterType& writer) const
     {
         const auto& entry = std::get<ElementContainer<T>>(this->storage);
-        entry.first.Write(writer);
+        entry.value.Write(writer);
         WriteInternal<WriterType, Args...>(writer);
     }
 
@@ -397,9 +534,36 @@ namespace telemetry
     {
     }
 
+    template <typename... Type>
+    template <int Tag, typename T, typename... Args>
+    inline bool Telemetry<Type...>::EncodeInternal(gsl::span<std::uint8_t> buffer, bool full)
+    {
+        auto& entry = std::get<ElementContainer<T>>(this->storage);
+        bool changed = false;
+        if (full || entry.encodePending)
+        {
+            std::array<std::uint8_t, (T::BitSize() + 7) / 8> element{};
+            BitWriter writer(element);
+            entry.value.Write(writer);
+            assert(writer.Status());
+
+            changed = details::CopyBits(buffer, BitOffset<T>(), element, T::BitSize());
+            entry.encodePending = false;
+        }
+
+        return EncodeInternal<0, Args...>(buffer, full) || changed;
+    }
+
+    template <typename... Type>
+    template <int Tag>
+    inline bool Telemetry<Type...>::EncodeInternal(gsl::span<std::uint8_t> /*buffer*/, bool /*full*/)
+    {
+        return false;
+    }
+
     template <typename... Type> template <int Tag, typename T, typename... Args> inline void Telemetry<Type...>::CommitCaptureInternal()
     {
-        std::get<ElementContainer<T>>(this->storage).second = false;
+        std::get<ElementContainer<T>>(this->storage).modified = false;
         CommitCaptureInternal<0, Args...>();
     }
 
@@ -27,6 +27,7 @@ namespace telemetry
     namespace details
     {
         struct FileSystemTelemetryTag;
+        struct FileSystemPoolsExhaustedTag;
         struct GpioStateTag;
         struct McuTemperatureTag;
         struct ProgramStateTag;
@@ -41,6 +42,7 @@ namespace telemetry
         struct CoilsActiveTag;
         struct ImtqStatusTag;
         struct OSStateTag;
+        struct OSIdleTimeTag;
     }
 
     /**
@@ -50,6 +52,13 @@ namespace telemetry
      */
     typedef SimpleTelemetryElement<std::uint32_t, ::telemetry::details::FileSystemTelemetryTag> FileSystemTelemetry;
 
+    /**
+     * @brief This type represents telemetry element related to exhaustion of file system memory pools.
+     * @telemetry_element
+     * @ingroup telemetry
+     */
+    typedef SimpleTelemetryElement<bool, ::telemetry::details::FileSystemPoolsExhaustedTag> FileSystemPoolsExhausted;
+
     /**
      * @brief This class represents the state that is observed by the mcu via its gpios.
      * @telemetry_element
@@ -70,6 +79,13 @@ namespace telemetry
      */
     typedef SimpleTelemetryElement<BitValue<std::uint32_t, 22>, ::telemetry::details::OSStateTag> OSState;
 
+    /**
+     * @brief This type represents telemetry element related to percentage of CPU time spent in idle task.
+     * @telemetry_element
+     * @ingroup telemetry
+     */
+    typedef SimpleTelemetryElement<BitValue<std::uint8_t, 7>, ::telemetry::details::OSIdleTimeTag> OSIdleTime;
+
     /**
      * @brief This type represents telemetry element related to
      * state of the currently executed program.
@@ -191,7 +207,9 @@ namespace telemetry
         ImtqCoilTemperature,                    //
         ImtqStatus,                             //
         ImtqState,                              //
-        ImtqSelfTest                            //
+        ImtqSelfTest,                           //
+        OSIdleTime,                             //
+        FileSystemPoolsExhausted                //
         >
         ManagedTelemetry;
 }
@@ -11,6 +11,7 @@
 #include "Telemetry.hpp"
 #include "TimeTelemetry.hpp"
 #include "antenna/telemetry.hpp"
+#include "base/seqlock.hpp"
 #include "comm/CommTelemetry.hpp"
 #include "fwd.hpp"
 #include "gyro/telemetry.hpp"
@@ -25,6 +26,9 @@ namespace telemetry
      */
     struct TelemetryState
     {
+        /** @brief Buffer holding serialized telemetry snapshot. */
+        using SerializedTelemetry = SeqLockBuffer<ManagedTelemetry::TotalSerializedSize>;
+
         /**
          * @brief Initializes telemetry state.
          * @return Operation status, true in case of success, false otherwise.
@@ -37,14 +41,11 @@ namespace telemetry
         ManagedTelemetry telemetry;
 
         /**
-         * @brief Handle to semaphore that protects access to serialized telemetry.
-         */
-        OSSemaphoreHandle bufferLock;
-
-        /**
-         * @brief Buffer that contains serialized state of the last seen telemetry state.
+         * @brief Serialized state of the last seen telemetry state.
+         *
+         * Published by telemetry acquisition loop and read without locking by beacon, telemetry archive and telecommands.
          */
-        std::array<std::uint8_t, ManagedTelemetry::TotalSerializedSize> lastSerializedTelemetry;
+        SerializedTelemetry lastSerializedTelemetry;
     };
 
     static_assert(ProgramState::BitSize() == 16, "Invalid serialized size");
@@ -52,7 +53,9 @@ namespace telemetry
     static_assert(FlashSecondarySlotsScrubbing::BitSize() == 3, "Invalid serialized size");
     static_assert(RAMScrubbing::BitSize() == 32, "Invalid serialized size");
     static_assert(FileSystemTelemetry::BitSize() == 32, "Invalid serialized size");
+    static_assert(FileSystemPoolsExhausted::BitSize() == 1, "Invalid serialized size");
     static_assert(OSState::BitSize() == 22, "Invalid serialized size");
+    static_assert(OSIdleTime::BitSize() == 7, "Invalid serialized size");
     static_assert(GpioState::BitSize() == 1, "Invalid serialized size");
     static_assert(McuTemperature::BitSize() == 12, "Invalid serialized size");
     static_assert(ImtqMagnetometerMeasurements::BitSize() == 96, "Invalid serialized size");
@@ -65,7 +68,7 @@ namespace telemetry
     static_assert(ImtqSelfTest::BitSize() == 64, "Invalid serialized size");
 
     static_assert(ManagedTelemetry::TotalSerializedSize <= 230, "Telemetry is too large");
-    static_assert(ManagedTelemetry::PayloadSize == 1832, "Invalid Telemetry Size");
+    static_assert(ManagedTelemetry::PayloadSize == 1840, "Invalid Telemetry Size");
 }
 
 #endif
@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <tuple>
 #include "fs/fs.h"
+#include "fs/yaffs_pools.hpp"
 #include "mission/base.hpp"
 #include "telemetry/state.hpp"
 
@@ -19,9 +21,9 @@ namespace telemetry
       public:
         /**
          * @brief ctor.
-         * @param[in] fs Reference to antenna driver that will provide this module with hardware telemetry
+         * @param[in] arguments Tuple of file system and its memory pools that provide this module with telemetry
          */
-        FileSystemTelemetryAcquisition(services::fs::IFileSystem& fs);
+        FileSystemTelemetryAcquisition(std::tuple<services::fs::IFileSystem&, services::fs::IYaffsMemoryPools&> arguments);
 
         /**
          * @brief Builds update descriptor for this task.
@@ -48,6 +50,11 @@ namespace telemetry
          * @brief Reference to file system service provider.
          */
         services::fs::IFileSystem* provider;
+
+        /**
+         * @brief Reference to file system memory pools.
+         */
+        services::fs::IYaffsMemoryPools* memoryPools;
     };
 }
 
@@ -3,7 +3,9 @@
 
 namespace telemetry
 {
-    FileSystemTelemetryAcquisition::FileSystemTelemetryAcquisition(services::fs::IFileSystem& fs) : provider(&fs)
+    FileSystemTelemetryAcquisition::FileSystemTelemetryAcquisition(
+        std::tuple<services::fs::IFileSystem&, services::fs::IYaffsMemoryPools&> arguments)
+        : provider(&std::get<0>(arguments)), memoryPools(&std::get<1>(arguments))
     {
     }
 
@@ -27,6 +29,7 @@ namespace telemetry
         else
         {
             state.telemetry.Set(FileSystemTelemetry(size));
+            state.telemetry.Set(FileSystemPoolsExhausted(this->memoryPools->Statistics().Exhausted()));
             return mission::UpdateResult::Ok;
         }
     }
@@ -56,6 +56,17 @@ namespace devices
             return Update(status, ElementId::Magnetometer, telemetry::ImtqMagnetometerMeasurements(result), this->magnetometers);
         }
 
+        bool ImtqTelemetryCollector::BeginMagnetometerMeasurement(MagnetometerMeasurementToken& token)
+        {
+            return this->next.BeginMagnetometerMeasurement(token);
+        }
+
+        bool ImtqTelemetryCollector::EndMagnetometerMeasurement(MagnetometerMeasurementToken& token, Vector3<MagnetometerMeasurement>& result)
+        {
+            const auto status = this->next.EndMagnetometerMeasurement(token, result);
+            return Update(status, ElementId::Magnetometer, telemetry::ImtqMagnetometerMeasurements(result), this->magnetometers);
+        }
+
         bool ImtqTelemetryCollector::SoftwareReset()
         {
             return this->next.SoftwareReset();
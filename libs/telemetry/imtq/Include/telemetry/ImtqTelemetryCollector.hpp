@@ -59,6 +59,10 @@ namespace devices
 
             virtual bool MeasureMagnetometer(Vector3<MagnetometerMeasurement>& result) final override;
 
+            virtual bool BeginMagnetometerMeasurement(MagnetometerMeasurementToken& token) final override;
+
+            virtual bool EndMagnetometerMeasurement(MagnetometerMeasurementToken& token, Vector3<MagnetometerMeasurement>& result) final override;
+
             virtual bool SoftwareReset() final override;
 
             virtual bool SendNoOperation() final override;
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "mission/base.hpp"
+#include "telemetry/cpu_usage.hpp"
 #include "telemetry/state.hpp"
 
 namespace telemetry
@@ -17,16 +18,24 @@ namespace telemetry
     {
       public:
         /**
-        * @brief dummy
-        * @param value ignored
+        * @brief ctor.
+        * @param[in] cpuUsage Reference to object that measures CPU usage of tasks
         */
-        SystemTelemetryAcquisition(int value);
+        SystemTelemetryAcquisition(CpuUsageMonitor& cpuUsage);
+
         /**
         * @brief Builds update descriptor for this task.
         * @return Update descriptor - the antenna telemetry acquisition update task.
         */
         mission::UpdateDescriptor<telemetry::TelemetryState> BuildUpdate();
 
+        /**
+        * @brief Acquires operating system telemetry & stores it in passed state object.
+        * @param[in] state Object that should be updated with new operating system telemetry.
+        * @return Telemetry acquisition result.
+        */
+        mission::UpdateResult UpdateTelemetry(telemetry::TelemetryState& state);
+
         /**
         * @brief Updates current operating system telemetry in global state.
         * @param[in] state Reference to global state.
@@ -34,6 +43,12 @@ namespace telemetry
         * @return Telemetry acquisition result.
         */
         static mission::UpdateResult UpdateProc(telemetry::TelemetryState& state, void* param);
+
+      private:
+        /**
+        * @brief Reference to object that measures CPU usage of tasks.
+        */
+        CpuUsageMonitor& _cpuUsage;
     };
 }
 
@@ -0,0 +1,142 @@
+#ifndef LIBS_TELEMETRY_OS_CPU_USAGE_HPP
+#define LIBS_TELEMETRY_OS_CPU_USAGE_HPP
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <gsl/span>
+#include "base/os.h"
+
+namespace telemetry
+{
+    /**
+     * @brief CPU usage of single task measured over the sliding window.
+     * @ingroup telemetry
+     */
+    struct TaskCpuUsage
+    {
+        /** @brief Task name */
+        const char* Name;
+        /** @brief Unique task number */
+        std::uint32_t Number;
+        /** @brief Part of CPU time used by task (in 0.1% units) */
+        std::uint16_t Load;
+        /** @brief Minimal amount of free stack space observed so far (in bytes) */
+        std::uint16_t StackHighWaterMark;
+    };
+
+    /**
+     * @brief Interface of object providing most recent CPU usage measurement.
+     * @ingroup telemetry
+     */
+    struct ICpuUsage
+    {
+        /**
+         * @brief Returns part of CPU time spent in idle task.
+         * @return Idle time (in 0.1% units).
+         */
+        virtual std::uint16_t IdleLoad() = 0;
+
+        /**
+         * @brief Copies CPU usage of all tasks sorted from the most demanding one.
+         * @param[out] usage Buffer for CPU usage of tasks.
+         * @return Number of tasks written to buffer.
+         */
+        virtual std::size_t Report(gsl::span<TaskCpuUsage> usage) = 0;
+    };
+
+    /**
+     * @brief This class calculates per-task CPU usage based on operating system run time statistics.
+     * @ingroup telemetry
+     *
+     * Each call to @ref Sample captures run time counters of all tasks and compares them with counters
+     * captured @ref WindowSamples calls earlier. Until the window is filled usage is calculated since system start.
+     * When there are more than @ref MaxTasks tasks in the system only part of them (including idle task) is tracked.
+     */
+    class CpuUsageMonitor final : public ICpuUsage
+    {
+      public:
+        /** @brief Maximal number of tracked tasks (tasks created by software with margin for future ones) */
+        static constexpr std::size_t MaxTasks = 24;
+
+        /** @brief Number of samples that form the sliding window */
+        static constexpr std::size_t WindowSamples = 4;
+
+        /**
+         * @brief Ctor.
+         */
+        CpuUsageMonitor();
+
+        /**
+         * @brief Initializes this object & prepares it to work.
+         */
+        void Initialize();
+
+        /**
+         * @brief Captures run time statistics and recalculates CPU usage.
+         * @return True if CPU usage has been updated, false otherwise.
+         */
+        bool Sample();
+
+        /**
+         * @brief Returns part of CPU time spent in idle task.
+         * @return Idle time (in 0.1% units). Zero if calculated usage could not be locked.
+         */
+        virtual std::uint16_t IdleLoad() override;
+
+        virtual std::size_t Report(gsl::span<TaskCpuUsage> usage) override;
+
+      private:
+        /** @brief Run time counter of single task */
+        struct Counter
+        {
+            /** @brief Unique task number */
+            std::uint32_t Number;
+            /** @brief Run time counter value */
+            std::uint32_t RunTime;
+        };
+
+        /** @brief Run time counters captured in single sample */
+        struct Snapshot
+        {
+            /** @brief Total run time counter value */
+            std::uint32_t TotalRunTime;
+            /** @brief Number of captured tasks */
+            std::size_t Count;
+            /** @brief Counters of captured tasks */
+            std::array<Counter, MaxTasks> Tasks;
+        };
+
+        /**
+         * @brief Finds task's run time counter value in snapshot.
+         * @param snapshot Snapshot to search
+         * @param number Unique task number
+         * @return Counter value or 0 if task did not exist when snapshot was taken.
+         */
+        static std::uint32_t FindRunTime(const Snapshot& snapshot, std::uint32_t number);
+
+        /** @brief Semaphore protecting calculated usage */
+        OSSemaphoreHandle _semaphore;
+
+        /** @brief Snapshots forming sliding window */
+        std::array<Snapshot, WindowSamples> _window;
+
+        /** @brief Index of the oldest snapshot */
+        std::size_t _oldest;
+
+        /** @brief Buffer for run time statistics */
+        std::array<TaskRunTime, MaxTasks> _tasks;
+
+        /** @brief Calculated CPU usage of tasks */
+        std::array<TaskCpuUsage, MaxTasks> _usage;
+
+        /** @brief Number of valid entries in @ref _usage */
+        std::size_t _usageCount;
+
+        /** @brief Calculated idle time */
+        std::uint16_t _idle;
+    };
+}
+
+#endif
@@ -3,7 +3,7 @@
 
 namespace telemetry
 {
-    SystemTelemetryAcquisition::SystemTelemetryAcquisition(int /*value*/)
+    SystemTelemetryAcquisition::SystemTelemetryAcquisition(CpuUsageMonitor& cpuUsage) : _cpuUsage(cpuUsage)
     {
     }
 
@@ -12,14 +12,26 @@ namespace telemetry
         mission::UpdateDescriptor<telemetry::TelemetryState> descriptor;
         descriptor.name = "OS Telemetry Acquisition";
         descriptor.updateProc = UpdateProc;
-        descriptor.param = nullptr;
+        descriptor.param = this;
         return descriptor;
     }
 
-    mission::UpdateResult SystemTelemetryAcquisition::UpdateProc(telemetry::TelemetryState& state, void* /*param*/)
+    mission::UpdateResult SystemTelemetryAcquisition::UpdateTelemetry(telemetry::TelemetryState& state)
     {
         const auto uptime = std::chrono::duration_cast<std::chrono::seconds>(System::GetUptime());
         state.telemetry.Set(OSState(uptime.count()));
+
+        if (this->_cpuUsage.Sample())
+        {
+            state.telemetry.Set(OSIdleTime((this->_cpuUsage.IdleLoad() + 5) / 10));
+        }
+
         return mission::UpdateResult::Ok;
     }
+
+    mission::UpdateResult SystemTelemetryAcquisition::UpdateProc(telemetry::TelemetryState& state, void* param)
+    {
+        auto This = static_cast<SystemTelemetryAcquisition*>(param);
+        return This->UpdateTelemetry(state);
+    }
 }
@@ -0,0 +1,119 @@
+#include "telemetry/cpu_usage.hpp"
+#include <algorithm>
+
+namespace telemetry
+{
+    using namespace std::chrono_literals;
+
+    CpuUsageMonitor::CpuUsageMonitor() : _semaphore(nullptr), _oldest(0), _usageCount(0), _idle(0)
+    {
+        for (auto& snapshot : this->_window)
+        {
+            snapshot.TotalRunTime = 0;
+            snapshot.Count = 0;
+        }
+    }
+
+    void CpuUsageMonitor::Initialize()
+    {
+        this->_semaphore = System::CreateBinarySemaphore();
+        System::GiveSemaphore(this->_semaphore);
+    }
+
+    std::uint32_t CpuUsageMonitor::FindRunTime(const Snapshot& snapshot, std::uint32_t number)
+    {
+        for (std::size_t i = 0; i < snapshot.Count; i++)
+        {
+            if (snapshot.Tasks[i].Number == number)
+            {
+                return snapshot.Tasks[i].RunTime;
+            }
+        }
+
+        return 0;
+    }
+
+    bool CpuUsageMonitor::Sample()
+    {
+        std::uint32_t totalRunTime;
+        const auto count = System::GetTaskRunTimes(this->_tasks, totalRunTime);
+        if (count == 0)
+        {
+            return false;
+        }
+
+        auto& oldest = this->_window[this->_oldest];
+        const std::uint32_t window = totalRunTime - oldest.TotalRunTime;
+        if (window == 0)
+        {
+            return false;
+        }
+
+        Lock lock(this->_semaphore, 50ms);
+        if (!lock())
+        {
+            return false;
+        }
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const auto& task = this->_tasks[i];
+            const std::uint32_t runTime = task.RunTime - FindRunTime(oldest, task.Number);
+            const auto load = std::min<std::uint64_t>(static_cast<std::uint64_t>(runTime) * 1000 / window, 1000);
+
+            auto& usage = this->_usage[i];
+            usage.Name = task.Name;
+            usage.Number = task.Number;
+            usage.Load = static_cast<std::uint16_t>(load);
+            usage.StackHighWaterMark = task.StackHighWaterMark;
+
+            if (task.IsIdle)
+            {
+                this->_idle = usage.Load;
+            }
+        }
+
+        std::sort(this->_usage.begin(), this->_usage.begin() + count, [](const TaskCpuUsage& a, const TaskCpuUsage& b) {
+            return a.Load > b.Load;
+        });
+
+        this->_usageCount = count;
+
+        oldest.TotalRunTime = totalRunTime;
+        oldest.Count = count;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            oldest.Tasks[i].Number = this->_tasks[i].Number;
+            oldest.Tasks[i].RunTime = this->_tasks[i].RunTime;
+        }
+
+        this->_oldest = (this->_oldest + 1) % WindowSamples;
+
+        return true;
+    }
+
+    std::uint16_t CpuUsageMonitor::IdleLoad()
+    {
+        Lock lock(this->_semaphore, 50ms);
+        if (!lock())
+        {
+            return 0;
+        }
+
+        return this->_idle;
+    }
+
+    std::size_t CpuUsageMonitor::Report(gsl::span<TaskCpuUsage> usage)
+    {
+        Lock lock(this->_semaphore, 50ms);
+        if (!lock())
+        {
+            return 0;
+        }
+
+        const auto count = std::min<std::size_t>(this->_usageCount, usage.size());
+        std::copy(this->_usage.begin(), this->_usage.begin() + count, usage.begin());
+
+        return count;
+    }
+}
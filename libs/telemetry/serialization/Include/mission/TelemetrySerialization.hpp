@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include "mission/base.hpp"
 #include "telemetry/state.hpp"
 
@@ -11,6 +13,9 @@ namespace telemetry
     /**
      * @brief This task is responsible for observing the telemetry container state and as soon
      * as change is observed prepare its serialized form.
+     *
+     * Serialized form is kept between runs and only elements updated since previous run are re-encoded in place.
+     * New snapshot is published only when it differs from the previous one.
      * @telemetry_acquisition
      * @ingroup telemetry
      */
@@ -37,6 +42,12 @@ namespace telemetry
 
       private:
         static mission::UpdateResult Proxy(TelemetryState& state, void* param);
+
+        /** @brief Telemetry encoded in previous run. */
+        std::array<std::uint8_t, ManagedTelemetry::TotalSerializedSize> encoded;
+
+        /** @brief Flag indicating whether encoded buffer contains complete telemetry. */
+        bool isEncoded;
     };
 }
 
@@ -1,15 +1,11 @@
 #include "mission/TelemetrySerialization.hpp"
-#include <cassert>
-#include <cstring>
-#include "base/BitWriter.hpp"
-#include "logger/logger.h"
-
 namespace telemetry
 {
     using namespace std::chrono_literals;
 
-    TelemetrySerialization::TelemetrySerialization(int /*p*/)
+    TelemetrySerialization::TelemetrySerialization(int /*p*/) : isEncoded(false)
     {
+        this->encoded.fill(0);
     }
 
     mission::UpdateDescriptor<TelemetryState> TelemetrySerialization::BuildUpdate()
@@ -23,28 +19,14 @@ namespace telemetry
 
     mission::UpdateResult TelemetrySerialization::SaveTelemetry(TelemetryState& state)
     {
-        decltype(TelemetryState::lastSerializedTelemetry) buffer;
-        BitWriter writer(buffer);
-        state.telemetry.Write(writer);
-        assert(writer.Status());
-        if (!writer.Status())
-        {
-            LOGF(LOG_LEVEL_ERROR, "Insufficient buffer space for telemetry: '%d'.", static_cast<int>(writer.GetBitDataLength()));
-            return mission::UpdateResult::Failure;
-        }
-
-        auto content = writer.Capture();
-        if (content.empty())
-        {
-            return mission::UpdateResult::Warning;
-        }
-
-        Lock lock(state.bufferLock, 5s);
-        if (static_cast<bool>(lock))
+        const auto changed = state.telemetry.Encode(this->encoded, !this->isEncoded);
+        if (!changed && this->isEncoded)
         {
-            std::memcpy(state.lastSerializedTelemetry.data(), buffer.data(), buffer.size());
+            return mission::UpdateResult::Ok;
         }
 
+        this->isEncoded = true;
+        state.lastSerializedTelemetry.Publish(this->encoded);
         return mission::UpdateResult::Ok;
     }
 
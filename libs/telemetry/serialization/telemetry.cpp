@@ -45,19 +45,12 @@ namespace mission
 
     void TelemetryTask::Save(telemetry::TelemetryState& stateObject)
     {
-        decltype(telemetry::TelemetryState::lastSerializedTelemetry) content;
+        std::array<std::uint8_t, telemetry::TelemetryState::SerializedTelemetry::Length> content;
 
+        if (!stateObject.lastSerializedTelemetry.CopyTo(content))
         {
-            Lock lock(stateObject.bufferLock, 5s);
-            if (static_cast<bool>(lock))
-            {
-                memcpy(content.data(), stateObject.lastSerializedTelemetry.data(), content.size());
-            }
-            else
-            {
-                LOG(LOG_LEVEL_WARNING, "Unable to acquire access to serialized telemetry. ");
-                return;
-            }
+            LOG(LOG_LEVEL_WARNING, "Unable to acquire consistent serialized telemetry. ");
+            return;
         }
 
         if (SaveToFile(content))
@@ -6,11 +6,15 @@
 #include <yaffsfs.h>
 
 #include "base/os.h"
+#include "fs/yaffs_pools.hpp"
 #include "logger/logger.h"
 #include "system.h"
+#include "time/ICurrentTime.hpp"
 #include "yaffs_trace.h"
 
 static OSSemaphoreHandle yaffsLock;
+static services::fs::IYaffsMemoryPools* memoryPools = nullptr;
+static services::time::ICurrentTime* currentTime = nullptr;
 int yaffsError = 0;
 unsigned int yaffs_trace_mask =
     YAFFS_TRACE_ERASE | YAFFS_TRACE_ERROR | YAFFS_TRACE_BUG | YAFFS_TRACE_BAD_BLOCKS | YAFFS_TRACE_BUFFERS | YAFFS_TRACE_MOUNT;
@@ -29,7 +33,18 @@ void yaffsfs_Unlock(void)
 
 u32 yaffsfs_CurrentTime(void)
 {
-    return 0;
+    if (currentTime == nullptr)
+    {
+        return 0;
+    }
+
+    const auto now = currentTime->GetCurrentTime();
+    if (!now.HasValue)
+    {
+        return 0;
+    }
+
+    return static_cast<u32>(std::chrono::duration_cast<std::chrono::seconds>(now.Value).count());
 }
 
 void yaffsfs_SetError(int err)
@@ -48,7 +63,7 @@ int yaffsfs_GetLastError(void)
 
 void* yaffsfs_malloc(size_t size)
 {
-    void* ptr = System::Alloc(size);
+    void* ptr = memoryPools != nullptr ? memoryPools->Allocate(size) : System::Alloc(size);
 
     if (!ptr)
     {
@@ -59,7 +74,14 @@ void* yaffsfs_malloc(size_t size)
 }
 void yaffsfs_free(void* ptr)
 {
-    System::Free(ptr);
+    if (memoryPools != nullptr)
+    {
+        memoryPools->Free(ptr);
+    }
+    else
+    {
+        System::Free(ptr);
+    }
 }
 
 int yaffsfs_CheckMemRegion(const void* addr, size_t size, int write_request)
@@ -93,8 +115,14 @@ void yaffs_log(const char* fmt, ...)
 }
 }
 
-void YaffsGlueInit(void)
+void YaffsGlueInit(services::fs::IYaffsMemoryPools* pools)
 {
+    memoryPools = pools;
     yaffsLock = System::CreateBinarySemaphore();
     System::GiveSemaphore(yaffsLock);
 }
+
+void YaffsGlueSetClock(services::time::ICurrentTime* clock)
+{
+    currentTime = clock;
+}
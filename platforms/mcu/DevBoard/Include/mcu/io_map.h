@@ -104,6 +104,13 @@ namespace io_map
         static constexpr std::size_t MemorySize = 128_KB;
         static constexpr std::size_t CycleSize = 8;
     };
+
+    struct RunTimeStats
+    {
+        static constexpr auto LowTimerHW = TIMER1;
+        static constexpr auto HighTimerHW = TIMER2;
+        static constexpr auto Prescaler = timerPrescale1024;
+    };
 }
 
 // NAND Flash
@@ -112,7 +112,13 @@ extern void assertFailed(const char* source, const char* file, uint16_t line);
 #define configCHECK_FOR_STACK_OVERFLOW 2
 #define configUSE_RECURSIVE_MUTEXES 1
 #define configQUEUE_REGISTRY_SIZE 0
-#define configGENERATE_RUN_TIME_STATS 0
+#define configGENERATE_RUN_TIME_STATS 1
+
+/* Run time statistics are counted by spare hardware timer (see io_map::RunTimeStats) */
+extern void ConfigureRunTimeStatsTimer(void);
+extern uint32_t GetRunTimeStatsCounter(void);
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() ConfigureRunTimeStatsTimer()
+#define portGET_RUN_TIME_COUNTER_VALUE() GetRunTimeStatsCounter()
 
 /* Set the following definitions to 1 to include the API function, or zero
 to exclude the API function. */
@@ -123,6 +129,7 @@ to exclude the API function. */
 #define INCLUDE_vTaskSuspend 1
 #define INCLUDE_vTaskDelayUntil 1
 #define INCLUDE_vTaskDelay 1
+#define INCLUDE_xTaskGetIdleTaskHandle 1
 #define INCLUDE_xTimerPendFunctionCall 1
 
 /* Timers */
@@ -133,6 +133,13 @@ namespace io_map
         static constexpr std::size_t CycleSize = 8;
     };
 
+    struct RunTimeStats
+    {
+        static constexpr auto LowTimerHW = TIMER1;
+        static constexpr auto HighTimerHW = TIMER2;
+        static constexpr auto Prescaler = timerPrescale1024;
+    };
+
     struct XTAL : public PinGroupTag
     {
         struct HF
@@ -1,24 +1,33 @@
 #include "step.hpp"
+#include "boot/fwd.hpp"
 #include "logger/logger.h"
 #include "safe_mode.hpp"
+#include "scrubber/n25q.hpp"
+
+using scrubber::N25QRecovery;
+
+/** @brief Size of single N25Q chip */
+static constexpr std::size_t FlashSize = 16_MB;
 
 void EraseN25QStep::Perform()
 {
-    LOG(LOG_LEVEL_INFO, "Erasing N25Q flashes");
+    LOG(LOG_LEVEL_INFO, "Recovering N25Q flashes");
 
-    auto wait1 = SafeMode.Flash1.BeginEraseChip();
-    auto wait2 = SafeMode.Flash2.BeginEraseChip();
-    auto wait3 = SafeMode.Flash3.BeginEraseChip();
+    N25QRecovery recovery(SafeMode.Buffer,
+        {&SafeMode.Flash1, &SafeMode.Flash2, &SafeMode.Flash3},
+        SafeMode.Fram,
+        boot::SafeModeRecoveryProgressAddress,
+        FlashSize / N25QRecovery::BlockSize);
 
-    LOG(LOG_LEVEL_INFO, "Flash1: Waiting for erase finish");
-    auto result1 = wait1.Wait();
-    LOGF(LOG_LEVEL_INFO, "Flash1 erase result: %d", num(result1));
+    if (recovery.Resume())
+    {
+        LOGF(LOG_LEVEL_INFO, "Resuming N25Q recovery at block %d", recovery.Status().NextBlock);
+    }
 
-    LOG(LOG_LEVEL_INFO, "Flash2: Waiting for erase finish");
-    auto result2 = wait2.Wait();
-    LOGF(LOG_LEVEL_INFO, "Flash2 erase result: %d", num(result2));
+    while (recovery.RecoverNextBlock())
+    {
+    }
 
-    LOG(LOG_LEVEL_INFO, "Flash3: Waiting for erase finish");
-    auto result3 = wait3.Wait();
-    LOGF(LOG_LEVEL_INFO, "Flash3 erase result: %d", num(result3));
+    const auto status = recovery.Status();
+    LOGF(LOG_LEVEL_INFO, "N25Q recovery finished: recovered=%d erased=%d", status.Recovered, status.Erased);
 }
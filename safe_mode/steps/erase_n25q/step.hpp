@@ -1,6 +1,12 @@
 #ifndef SAFE_MODE_STEPS_ERASE_N25Q_STEP_HPP_
 #define SAFE_MODE_STEPS_ERASE_N25Q_STEP_HPP_
 
+/**
+ * @brief Safe mode step recovering N25Q flashes
+ *
+ * Copies are voted and repaired block by block (see scrubber::N25QRecovery), only blocks that cannot be voted are erased.
+ * Recovery interrupted by reset is resumed on next safe mode entry.
+ */
 class EraseN25QStep
 {
   public:
@@ -32,6 +32,16 @@ void AdcsCommand(std::uint16_t argc, char* argv[])
 
         GetTerminal().Printf("Switching to experimental detumbling...Result: %d", num(r));
     }
+    else if (argc == 1 && strcmp(argv[0], "exp_dtb_stats") == 0)
+    {
+        const auto statistics = GetAdcs().GetExperimentalDetumbling().GetTimingStatistics();
+
+        GetTerminal().Printf("%lu %lu %lu %d",
+            statistics.Iterations,
+            static_cast<std::uint32_t>(statistics.ActuationTime.count()),
+            static_cast<std::uint32_t>(statistics.IdleTime.count()),
+            statistics.DutyCycle);
+    }
     else if (argc == 1 && strcmp(argv[0], "stop") == 0)
     {
         auto r = adcs.Stop();
@@ -40,6 +50,6 @@ void AdcsCommand(std::uint16_t argc, char* argv[])
     }
     else
     {
-        GetTerminal().Puts("adcs <current|disable|builtin|exp_dtb|stop>");
+        GetTerminal().Puts("adcs <current|disable|builtin|exp_dtb|exp_dtb_stats|stop>");
     }
 }
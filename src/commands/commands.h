@@ -19,6 +19,8 @@ void MountList(std::uint16_t argc, char* argv[]);
 void MakeDirectory(std::uint16_t argc, char* argv[]);
 void EraseFlash(std::uint16_t argc, char* argv[]);
 void SyncFS(std::uint16_t argc, char* argv[]);
+void FSMaintenance(std::uint16_t argc, char* argv[]);
+void SPIStats(std::uint16_t argc, char* argv[]);
 void CommandByTerminal(std::uint16_t argc, char* args[]);
 void I2CTestCommandHandler(std::uint16_t argc, char* argv[]);
 void HeapInfoCommand(std::uint16_t argc, char* argv[]);
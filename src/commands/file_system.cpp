@@ -240,6 +240,16 @@ void SyncFS(uint16_t argc, char* argv[])
     GetFileSystem().Sync();
 }
 
+void FSMaintenance(uint16_t argc, char* argv[])
+{
+    UNUSED(argc, argv);
+
+    auto& fs = GetFileSystem();
+
+    GetTerminal().Printf("Erased reserve: %d\n", fs.ErasedReserve());
+    GetTerminal().Printf("Worst write latency: %ld ms\n", static_cast<std::int32_t>(fs.TakeWorstWriteLatency().count()));
+}
+
 void RemoveFile(uint16_t /*argc*/, char* argv[])
 {
     const char* path = argv[0];
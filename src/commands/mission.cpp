@@ -92,4 +92,10 @@ void ExperimentInfo(std::uint16_t argc, char* argv[])
         GetTerminal().Puts("LastIterationResult\tNone\n");
 
     GetTerminal().Printf("IterationCounter\t%ld\n", state.IterationCounter);
+
+    GetTerminal().Printf("SamplingPeriod\t%ld\n", static_cast<std::int32_t>(state.Sampling.Period.count()));
+    GetTerminal().Printf("AchievedPeriod\t%ld\n", static_cast<std::int32_t>(state.Sampling.AchievedPeriod.count()));
+    GetTerminal().Printf("MaxJitter\t%ld\n", static_cast<std::int32_t>(state.Sampling.MaxJitter.count()));
+    GetTerminal().Printf("Samples\t%ld\n", state.Sampling.Samples);
+    GetTerminal().Printf("MissedDeadlines\t%ld\n", state.Sampling.MissedDeadlines);
 }
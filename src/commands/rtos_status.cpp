@@ -9,7 +9,9 @@
 #include "terminal/terminal.h"
 
 using std::uint16_t;
+using std::uint32_t;
 using std::array;
+using std::max;
 using std::min;
 
 static const char TaskStatuses[] = "RPBSD";
@@ -22,19 +24,26 @@ void TaskListCommand(uint16_t argc, char* argv[])
 
     auto tasksCount = min(static_cast<uint16_t>(uxTaskGetNumberOfTasks()), static_cast<uint16_t>(tasks.size()));
 
-    uxTaskGetSystemState(tasks.data(), tasksCount, nullptr);
+    uint32_t totalRunTime = 0;
+    uxTaskGetSystemState(tasks.data(), tasksCount, &totalRunTime);
 
-    GetTerminal().Puts("Status\tName      \tStack WM\tCur. Pri\tBase Pri\n");
+    const uint32_t runTimePerMille = max<uint32_t>(totalRunTime / 1000, 1);
+
+    GetTerminal().Puts("Status\tName      \tStack WM\tCur. Pri\tBase Pri\t   CPU %\n");
 
     for (auto i = 0; i < tasksCount; i++)
     {
         auto& t = tasks[i];
 
-        GetTerminal().Printf("%-6c\t%-10s\t%8d\t%8ld\t%8ld\n",
+        const auto load = t.ulRunTimeCounter / runTimePerMille;
+
+        GetTerminal().Printf("%-6c\t%-10s\t%8d\t%8ld\t%8ld\t%6ld.%ld\n",
             TaskStatuses[t.eCurrentState],
             t.pcTaskName,
             t.usStackHighWaterMark * sizeof(StackType_t),
             t.uxCurrentPriority,
-            t.uxBasePriority);
+            t.uxBasePriority,
+            load / 10,
+            load % 10);
     }
 }
@@ -0,0 +1,35 @@
+#include <cstdint>
+#include "commands.h"
+#include "obc.h"
+#include "obc_access.hpp"
+#include "spi/efm.h"
+#include "terminal/terminal.h"
+
+using drivers::spi::SPIUtilisation;
+
+static void PrintUtilisation(const char* slave, std::uint8_t index, const SPIUtilisation& utilisation)
+{
+    GetTerminal().Printf("%s%d: transactions=%lu bytes=%lu max_wait=%lu ms\n",
+        slave,
+        index,
+        utilisation.Transactions,
+        utilisation.Bytes,
+        static_cast<std::uint32_t>(utilisation.MaxWait.count()));
+}
+
+void SPIStats(std::uint16_t argc, char* argv[])
+{
+    UNUSED(argc, argv);
+
+    for (std::uint8_t i = 0; i < 3; i++)
+    {
+        PrintUtilisation("fram", i, Main.Hardware.FramSpi[i].Utilisation());
+    }
+
+#ifdef USE_EXTERNAL_FLASH
+    for (std::uint8_t i = 0; i < 3; i++)
+    {
+        PrintUtilisation("flash", i, Main.Storage.GetInternalStorage().GetSpiUtilisation(i));
+    }
+#endif
+}
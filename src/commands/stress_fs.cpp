@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <array>
 #include <cstdint>
 #include "fs/fs.h"
@@ -5,34 +6,6 @@
 #include "obc.h"
 #include "yaffs.hpp"
 
-extern "C" {
-struct yaffs_tnode_list
-{
-    struct yaffs_tnode_list* next;
-    struct yaffs_tnode* tnodes;
-};
-
-struct yaffs_obj_list
-{
-    struct yaffs_obj_list* next;
-    struct yaffs_obj* objects;
-};
-}
-
-struct yaffs_allocator
-{
-    int n_tnodes_created;
-    struct yaffs_tnode* free_tnodes;
-    int n_free_tnodes;
-    struct yaffs_tnode_list* alloc_tnode_list;
-
-    int n_obj_created;
-    struct list_head free_objs;
-    int n_free_objects;
-
-    struct yaffs_obj_list* allocated_obj_list;
-};
-
 static std::array<std::uint8_t, 1024> buffer;
 
 void StressFS(std::uint16_t /*argc*/, char* /*argv*/ [])
@@ -42,15 +15,12 @@ void StressFS(std::uint16_t /*argc*/, char* /*argv*/ [])
         buffer[i] = i % 256;
     }
 
-    auto& flash = Main.Storage._storage._flashes[0];
-
-    auto dev = flash.Device.Device();
-    auto alloc = reinterpret_cast<yaffs_allocator*>(dev->allocator);
+    auto dev = static_cast<yaffs_dev*>(yaffs_getdev("/"));
 
     int prev[YAFFS_NUMBER_OF_BLOCK_STATES] = {0};
     int next[YAFFS_NUMBER_OF_BLOCK_STATES] = {0};
 
-    Main.terminal.Puts("Emp\tAlloc\tFull\tDirty\t   FT\t   CT\t   FO\t   CO\n");
+    Main.terminal.Puts("Emp\tAlloc\tFull\tDirty\t   UT\t   HT\t   UO\t   HO\t Heap\n");
 
     int file_no = 0;
 
@@ -83,19 +53,23 @@ void StressFS(std::uint16_t /*argc*/, char* /*argv*/ [])
             auto full = next[YAFFS_BLOCK_STATE_FULL];
             auto dirty = next[YAFFS_BLOCK_STATE_DIRTY];
 
-            if (prev != next)
+            if (!std::equal(std::begin(prev), std::end(prev), std::begin(next)))
             {
                 std::copy(std::begin(next), std::end(next), std::begin(prev));
+
+                const auto memory = Main.FileSystemPools.Statistics();
+
                 Main.terminal.Printf( //
-                    "%3d\t%5d\t%4d\t%5d\t%5d\t%5d\t%5d\t%5d\n",
+                    "%3d\t%5d\t%4d\t%5d\t%5d\t%5d\t%5d\t%5d\t%5ld\n",
                     empty,
                     allocating,
                     full,
                     dirty,
-                    alloc->n_free_tnodes,
-                    alloc->n_tnodes_created,
-                    alloc->n_free_objects,
-                    alloc->n_tnodes_created);
+                    memory.Tnodes.InUse,
+                    memory.Tnodes.HighWaterMark,
+                    memory.Objects.InUse,
+                    memory.Objects.HighWaterMark,
+                    memory.HeapAllocations);
             }
         }
 
@@ -56,21 +56,21 @@ devices::comm::ICommHardwareObserver* GetCommHardwareObserver()
 }
 
 telemetry::ObcTelemetryAcquisition TelemetryAcquisition(Main.Hardware.CommDriver,
-    Main.Hardware.Gyro,
     Main.Fdir,
     Main.Hardware.EPS,
     Main.Experiments.ExperimentsController,
     Main.Hardware.MCUTemperature,
     Mission,
     0,
-    Main.fs,
+    std::tie(Main.fs, Main.FileSystemPools),
     Main.timeProvider,
-    Main.Hardware.rtc,
     Main.BootTable,
     Main.Scrubbing,
     0,
     Main.Hardware.imtqTelemetryCollector,
-    0,
+    Main.CpuUsage,
+    Main.Hardware.Gyro,
+    Main.Hardware.rtc,
     0,
     std::make_tuple(std::ref(Main.fs), mission::TelemetryConfiguration{"/telemetry.current", "/telemetry.previous", 512_KB, 30s}));
 
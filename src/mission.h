@@ -72,23 +72,23 @@ namespace telemetry
 {
     typedef mission::MissionLoop<TelemetryState, //
         CommTelemetryAcquisition,                //
-        GyroTelemetryAcquisition,                //
         ErrorCounterTelemetryAcquisition,        //
         EpsTelemetryAcquisition,                 //
         ExperimentTelemetryAcquisition,          //
         McuTempTelemetryAcquisition,             //
         AntennaTelemetryAcquisition,             //
         GpioTelemetryAcquisition<io_map::SailDeployed>,
-        FileSystemTelemetryAcquisition,             //
-        InternalTimeTelemetryAcquisition,           //
-        ExternalTimeTelemetryAcquisition,           //
-        ProgramCrcTelemetryAcquisition,             //
-        FlashScrubbingTelemetryAcquisition,         //
-        RamScrubbingTelemetryAcquisition<Scrubber>, //
-        ImtqTelemetryAcquisition,                   //
-        SystemTelemetryAcquisition,                 //
-        TelemetrySerialization,                     //
-        mission::TelemetryTask                      //
+        FileSystemTelemetryAcquisition,                        //
+        InternalTimeTelemetryAcquisition,                      //
+        ProgramCrcTelemetryAcquisition,                        //
+        FlashScrubbingTelemetryAcquisition,                    //
+        RamScrubbingTelemetryAcquisition<Scrubber>,            //
+        ImtqTelemetryAcquisition,                              //
+        SystemTelemetryAcquisition,                            //
+        mission::Concurrent<GyroTelemetryAcquisition>,         //
+        mission::Concurrent<ExternalTimeTelemetryAcquisition>, //
+        TelemetrySerialization,                                //
+        mission::TelemetryTask                                 //
         >
         ObcTelemetryAcquisition;
 }
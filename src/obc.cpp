@@ -7,6 +7,12 @@
 #include "terminal.h"
 #include "watchdog/internal.hpp"
 
+extern void YaffsGlueSetClock(services::time::ICurrentTime* clock);
+
+static_assert(PersistentStateBaseAddress + state::SystemPersistentState::Size() + 2 * sizeof(std::uint32_t) <=
+                  boot::SafeModeRecoveryProgressAddress,
+    "Persistent state must not overlap safe mode N25Q recovery progress");
+
 static void ProcessState(OBC* obc)
 {
     auto& persistentState = Mission.GetState().PersistentState;
@@ -117,7 +123,10 @@ OBC::OBC()
           Hardware.Gyro,
           Camera.PhotoService,
           Hardware.EPS,
-          adcs.GetAdcsCoordinator()),
+          adcs.GetAdcsCoordinator(),
+          CpuUsage,
+          Hardware.I2C.Fallback,
+          fs),
       Scrubbing(this->Hardware, this->BootTable, this->BootSettings, boot::Index),         //
       terminal(this->Hardware.Terminal),                                                   //
       camera(this->Fdir.ErrorCounting(), this->Hardware.Camera),                           //
@@ -142,6 +151,8 @@ OSResult OBC::InitializeRunlevel1()
 
     this->Fdir.Initalize();
 
+    this->CpuUsage.Initialize();
+
     this->Hardware.Initialize();
     InitializeTerminal();
 
@@ -149,7 +160,7 @@ OSResult OBC::InitializeRunlevel1()
 
     this->BootSettings.Initialize();
 
-    this->fs.Initialize();
+    this->fs.Initialize(this->FileSystemPools);
 
     this->Communication.InitializeRunlevel1();
 
@@ -178,6 +189,10 @@ OSResult OBC::InitializeRunlevel1()
         {
             LOG(LOG_LEVEL_ERROR, "[obc] Unable to initialize persistent timer. ");
         }
+        else
+        {
+            YaffsGlueSetClock(&this->timeProvider);
+        }
     }
 
     state::ErrorCountersConfigState errorCountersConfig;
@@ -32,6 +32,7 @@
 #include "scrubber/ram.hpp"
 #include "spi/efm.h"
 #include "state/fwd.hpp"
+#include "telemetry/cpu_usage.hpp"
 #include "terminal/terminal.h"
 #include "time/timer.h"
 #include "utils.h"
@@ -90,6 +91,9 @@ struct OBC
     /** @brief File system object */
     services::fs::YaffsFileSystem fs;
 
+    /** @brief Memory pools dedicated to file system */
+    obc::OBCStorage::MemoryPools FileSystemPools;
+
     /** @brief Handle to OBC initialization task. */
     OSTaskHandle initTask;
 
@@ -114,6 +118,9 @@ struct OBC
     /** @brief FDIR mechanisms */
     obc::FDIR Fdir;
 
+    /** @brief CPU usage of tasks */
+    telemetry::CpuUsageMonitor CpuUsage;
+
     /** @brief OBC storage */
     obc::OBCStorage Storage;
 
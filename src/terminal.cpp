@@ -18,6 +18,8 @@ static const TerminalCommandDescription commands[] = {
     {"mkdir", MakeDirectory},
     {"erase", EraseFlash},
     {"sync_fs", SyncFS},
+    {"fs_maintenance", FSMaintenance},
+    {"spi_stats", SPIStats},
     {"i2c", I2CTestCommandHandler},
     {"antenna_deploy", AntennaDeploy},
     {"antenna_cancel", AntennaCancelDeployment},
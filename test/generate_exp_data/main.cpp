@@ -99,6 +99,14 @@ class PosixFileSystem : public IFileSystem
         return OSResult::NotSupported;
     }
 
+    virtual ListDirectoryResult ListDirectory(const char* /*path*/,
+        const char* /*startAfter*/,
+        const char* /*prefix*/,
+        gsl::span<DirectoryEntry> /*entries*/) override
+    {
+        return ListDirectoryResult(OSResult::NotSupported, 0);
+    }
+
     virtual bool IsDirectory(const char* /*dirname*/) override
     {
         return false;
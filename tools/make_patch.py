@@ -0,0 +1,171 @@
+# Generates patch for BeginProgramPatch/WriteCompressedProgramPart telecommands
+# usage: python make_patch.py source.bin target.bin patch.bin
+from __future__ import print_function
+
+import argparse
+import os
+import struct
+import sys
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'integration_tests'))
+
+import lzss
+from crc import calc_crc, pad
+
+OP_COPY = 0
+OP_ADD = 1
+OP_INSERT = 2
+
+KEY_LENGTH = 8
+MAX_CANDIDATES = 8
+MIN_MATCH = 16
+
+
+def build_index(source):
+    index = {}
+    for i in range(0, len(source) - KEY_LENGTH + 1):
+        candidates = index.setdefault(bytes(source[i:i + KEY_LENGTH]), [])
+        if len(candidates) < MAX_CANDIDATES:
+            candidates.append(i)
+    return index
+
+
+def exact_length(source, s, target, t):
+    length = 0
+    while s + length < len(source) and t + length < len(target) and source[s + length] == target[t + length]:
+        length += 1
+    return length
+
+
+def approximate_length(source, s, target, t):
+    # extends aligned region up to the point maximizing (matching - differing) bytes (like bsdiff)
+    best, best_score, score, length = 0, 0, 0, 0
+    while s + length < len(source) and t + length < len(target):
+        score += 1 if source[s + length] == target[t + length] else -1
+        length += 1
+        if score > best_score:
+            best, best_score = length, score
+        if score < best_score - KEY_LENGTH:
+            break
+    return best
+
+
+def find_match(index, source, target, t, last_alignment):
+    best_s, best_length = None, 0
+
+    candidates = list(index.get(bytes(target[t:t + KEY_LENGTH]), []))
+    if last_alignment is not None and 0 <= t + last_alignment < len(source):
+        candidates.insert(0, t + last_alignment)
+
+    for s in candidates:
+        length = exact_length(source, s, target, t)
+        if length > best_length:
+            best_s, best_length = s, length
+
+    return best_s, best_length
+
+
+def diff(source, target):
+    index = build_index(source)
+    operations = []
+    literals = bytearray()
+    last_alignment = None
+
+    t = 0
+    while t < len(target):
+        s, length = find_match(index, source, target, t, last_alignment)
+
+        if length < MIN_MATCH:
+            literals.append(target[t])
+            t += 1
+            continue
+
+        if literals:
+            operations.append((OP_INSERT, None, literals))
+            literals = bytearray()
+
+        length = max(length, approximate_length(source, s, target, t))
+        region = bytearray((target[t + i] - source[s + i]) & 0xFF for i in range(0, length))
+
+        if any(region):
+            operations.append((OP_ADD, s, region))
+        else:
+            operations.append((OP_COPY, s, length))
+
+        last_alignment = s - t
+        t += length
+
+    if literals:
+        operations.append((OP_INSERT, None, literals))
+
+    return operations
+
+
+def encode(operations):
+    output = bytearray()
+    for (op, s, data) in operations:
+        if op == OP_COPY:
+            output += struct.pack('<BII', op, s, data)
+        elif op == OP_ADD:
+            output += struct.pack('<BII', op, s, len(data)) + data
+        else:
+            output += struct.pack('<BI', op, len(data)) + data
+    return output
+
+
+def apply_patch(source, patch):
+    output = bytearray()
+    position = 0
+    while position < len(patch):
+        op = patch[position]
+        if op == OP_INSERT:
+            (length,) = struct.unpack_from('<I', bytes(patch), position + 1)
+            output += patch[position + 5:position + 5 + length]
+            position += 5 + length
+            continue
+
+        (s, length) = struct.unpack_from('<II', bytes(patch), position + 1)
+        position += 9
+        if op == OP_COPY:
+            output += source[s:s + length]
+        else:
+            output += bytearray((source[s + i] + patch[position + i]) & 0xFF for i in range(0, length))
+            position += length
+    return output
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('source', help='Program currently stored in source boot slot')
+    parser.add_argument('target', help='New program')
+    parser.add_argument('patch', help='Output file with compressed patch')
+    parser.add_argument('--no-pad', action='store_true', help='Do not pad programs like upload scripts do')
+    args = parser.parse_args()
+
+    with open(args.source, 'rb') as f:
+        source = bytearray(f.read())
+    with open(args.target, 'rb') as f:
+        target = bytearray(f.read())
+
+    if not args.no_pad:
+        source = pad(source, multiply_of=128, pad_with=0x1A)
+        target = pad(target, multiply_of=128, pad_with=0x1A)
+
+    operations = encode(diff(source, target))
+    if apply_patch(source, operations) != target:
+        print('Patch verification failed')
+        sys.exit(1)
+
+    patch = lzss.compress(operations)
+
+    with open(args.patch, 'wb') as f:
+        f.write(patch)
+
+    print('Source: {} bytes, CRC 0x{:04X}'.format(len(source), calc_crc(source)))
+    print('Target: {} bytes, CRC 0x{:04X}'.format(len(target), calc_crc(target)))
+    print('Patch: {} bytes ({} before compression, {:.1f}x smaller than target)'.format(
+        len(patch), len(operations), float(len(target)) / max(len(patch), 1)))
+
+
+if __name__ == '__main__':
+    main()
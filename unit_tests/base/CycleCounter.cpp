@@ -0,0 +1,40 @@
+#include "CycleCounter.hpp"
+#include <em_device.h>
+#include <algorithm>
+
+void CycleCounter::Enable()
+{
+    SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+    SysTick->VAL = 0;
+    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+}
+
+std::uint32_t CycleCounter::Now()
+{
+    // SysTick counts down
+    return (SysTick_LOAD_RELOAD_Msk - SysTick->VAL) & SysTick_LOAD_RELOAD_Msk;
+}
+
+std::uint32_t CycleCounter::Elapsed(std::uint32_t start)
+{
+    return (Now() - start) & SysTick_LOAD_RELOAD_Msk;
+}
+
+void CycleStatistics::Add(std::uint32_t cycles)
+{
+    if (this->Samples == 0)
+    {
+        this->Min = cycles;
+        this->Max = cycles;
+    }
+
+    this->Samples++;
+    this->Min = std::min(this->Min, cycles);
+    this->Max = std::max(this->Max, cycles);
+    this->Total += cycles;
+}
+
+std::uint32_t CycleStatistics::Average() const
+{
+    return this->Samples == 0 ? 0 : static_cast<std::uint32_t>(this->Total / this->Samples);
+}
@@ -0,0 +1,63 @@
+#ifndef UNIT_TESTS_BASE_CYCLE_COUNTER_HPP
+#define UNIT_TESTS_BASE_CYCLE_COUNTER_HPP
+
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Cycle counter based on SysTick timer clocked from core clock.
+ *
+ * Unit tests do not start scheduler, so SysTick is free to use. Counter is 24-bit wide, so single measurement
+ * must not exceed 2^24 cycles. QEMU models SysTick using virtual clock, cycle-accurate numbers come only from hardware runs.
+ */
+class CycleCounter final
+{
+  public:
+    /**
+     * @brief Starts free running counter
+     */
+    static void Enable();
+
+    /**
+     * @brief Returns current counter value
+     * @return Counter value (modulo 2^24)
+     */
+    static std::uint32_t Now();
+
+    /**
+     * @brief Returns number of cycles elapsed since given point
+     * @param[in] start Value returned by @ref Now
+     * @return Elapsed cycles
+     */
+    static std::uint32_t Elapsed(std::uint32_t start);
+};
+
+/**
+ * @brief Statistics of measured code fragment
+ */
+struct CycleStatistics
+{
+    /** @brief Number of samples */
+    std::uint32_t Samples;
+    /** @brief Minimal cycle count */
+    std::uint32_t Min;
+    /** @brief Maximal cycle count */
+    std::uint32_t Max;
+    /** @brief Sum of cycle counts */
+    std::uint64_t Total;
+
+    /**
+     * @brief Adds sample
+     * @param[in] cycles Cycle count
+     */
+    void Add(std::uint32_t cycles);
+
+    /**
+     * @brief Returns average cycle count
+     * @return Average cycle count
+     */
+    std::uint32_t Average() const;
+};
+
+#endif /* UNIT_TESTS_BASE_CYCLE_COUNTER_HPP */
@@ -27,6 +27,8 @@ struct OSMock : IOS
 
     MOCK_METHOD1(Sleep, void(const std::chrono::milliseconds time));
 
+    MOCK_METHOD1(SleepUntil, void(const std::chrono::milliseconds time));
+
     MOCK_METHOD1(CreateBinarySemaphore, OSSemaphoreHandle(uint8_t semaphoreId));
 
     MOCK_METHOD2(TakeSemaphore, OSResult(const OSSemaphoreHandle semaphore, const std::chrono::milliseconds time));
@@ -71,6 +73,8 @@ struct OSMock : IOS
 
     MOCK_METHOD0(GetUptime, std::chrono::milliseconds());
 
+    MOCK_METHOD2(GetTaskRunTimes, std::size_t(gsl::span<TaskRunTime> tasks, std::uint32_t& totalRunTime));
+
     MOCK_METHOD0(Yield, void());
 };
 
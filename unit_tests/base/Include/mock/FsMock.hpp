@@ -40,6 +40,9 @@ class FsMock : public services::fs::IFileSystem
     MOCK_METHOD1(OpenDirectory, services::fs::DirectoryOpenResult(const char*));
     MOCK_METHOD1(ReadDirectory, char*(services::fs::DirectoryHandle));
     MOCK_METHOD1(CloseDirectory, OSResult(services::fs::DirectoryHandle));
+    MOCK_METHOD4(ListDirectory,
+        services::fs::ListDirectoryResult(
+            const char* path, const char* startAfter, const char* prefix, gsl::span<services::fs::DirectoryEntry> entries));
     MOCK_METHOD1(IsDirectory, bool(const char*));
     MOCK_METHOD1(Format, OSResult(const char*));
     MOCK_METHOD1(MakeDirectory, OSResult(const char*));
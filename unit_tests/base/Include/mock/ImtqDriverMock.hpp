@@ -14,6 +14,9 @@ struct ImtqDriverMock : public devices::imtq::IImtqDriver
 
     MOCK_METHOD2(PerformSelfTest, bool(devices::imtq::SelfTestResult&, bool tryToFixIsisErrors));
     MOCK_METHOD1(MeasureMagnetometer, bool(devices::imtq::Vector3<devices::imtq::MagnetometerMeasurement>&));
+    MOCK_METHOD1(BeginMagnetometerMeasurement, bool(devices::imtq::MagnetometerMeasurementToken&));
+    MOCK_METHOD2(EndMagnetometerMeasurement,
+        bool(devices::imtq::MagnetometerMeasurementToken&, devices::imtq::Vector3<devices::imtq::MagnetometerMeasurement>&));
     MOCK_METHOD0(SoftwareReset, bool());
     MOCK_METHOD0(SendNoOperation, bool());
     MOCK_METHOD0(CancelOperation, bool());
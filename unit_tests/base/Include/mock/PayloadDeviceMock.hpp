@@ -10,6 +10,8 @@ struct PayloadDeviceMock : public devices::payload::IPayloadDeviceDriver
     ~PayloadDeviceMock();
 
     MOCK_METHOD1(MeasureSunSRef, OSResult(devices::payload::PayloadTelemetry::SunsRef& output));
+    MOCK_METHOD0(BeginSunSRefMeasurement, OSResult());
+    MOCK_METHOD1(EndSunSRefMeasurement, OSResult(devices::payload::PayloadTelemetry::SunsRef& output));
     MOCK_METHOD1(MeasureTemperatures, OSResult(devices::payload::PayloadTelemetry::Temperatures& output));
     MOCK_METHOD1(MeasurePhotodiodes, OSResult(devices::payload::PayloadTelemetry::Photodiodes& output));
     MOCK_METHOD1(MeasureHousekeeping, OSResult(devices::payload::PayloadTelemetry::Housekeeping& output));
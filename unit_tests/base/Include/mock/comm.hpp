@@ -16,6 +16,7 @@ struct TransmitterMock : public devices::comm::ITransmitter
     TransmitterMock();
     ~TransmitterMock();
     MOCK_METHOD1(SendFrame, bool(gsl::span<const std::uint8_t>));
+    MOCK_METHOD0(FreeSlots, Option<std::uint8_t>());
     MOCK_METHOD1(GetTransmitterTelemetry, bool(devices::comm::TransmitterTelemetry&));
     MOCK_METHOD1(SetTransmitterStateWhenIdle, bool(devices::comm::IdleState));
     MOCK_METHOD1(SetTransmitterBitRate, bool(devices::comm::Bitrate));
@@ -70,6 +70,12 @@ struct IDMA
         DMADRV_DataSize_t size,
         DMADRV_Callback_t callback,
         void* cbUserParam) = 0;
+
+    virtual void CfgChannel(unsigned int channel, DMA_CfgChannel_TypeDef* cfg) = 0;
+
+    virtual void CfgDescrScatterGather(DMA_DESCRIPTOR_TypeDef* descr, unsigned int indx, DMA_CfgDescrSGAlt_TypeDef* cfg) = 0;
+
+    virtual void ActivateScatterGather(unsigned int channel, bool useBurst, DMA_DESCRIPTOR_TypeDef* altDescr, unsigned int count) = 0;
 };
 
 struct DMAMock : public IDMA
@@ -97,6 +103,12 @@ struct DMAMock : public IDMA
             DMADRV_DataSize_t size,
             DMADRV_Callback_t callback,
             void* cbUserParam));
+
+    MOCK_METHOD2(CfgChannel, void(unsigned int channel, DMA_CfgChannel_TypeDef* cfg));
+
+    MOCK_METHOD3(CfgDescrScatterGather, void(DMA_DESCRIPTOR_TypeDef* descr, unsigned int indx, DMA_CfgDescrSGAlt_TypeDef* cfg));
+
+    MOCK_METHOD4(ActivateScatterGather, void(unsigned int channel, bool useBurst, DMA_DESCRIPTOR_TypeDef* altDescr, unsigned int count));
 };
 
 template <typename Mock> class ProxyReset
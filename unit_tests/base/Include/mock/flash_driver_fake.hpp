@@ -0,0 +1,143 @@
+#ifndef UNIT_TESTS_BASE_INCLUDE_MOCK_FLASH_DRIVER_FAKE_HPP_
+#define UNIT_TESTS_BASE_INCLUDE_MOCK_FLASH_DRIVER_FAKE_HPP_
+
+#include <cstdint>
+#include <gsl/span>
+#include "flash/s29jl.hpp"
+
+/**
+ * @brief RAM-backed S29JL flash simulating NOR program timing
+ *
+ * Fake provides device side of low level driver commands used by @ref devices::s29jl::FlashDriver, so real driver logic
+ * runs against RAM buffer. Only one instance can exist at a time.
+ *
+ * Time is counted in ticks. Each status poll takes one tick and programming single byte keeps device busy
+ * for configured number of ticks. Work done by caller between polls is simulated with @ref Advance.
+ * Programming clears bits only, so writing to area that was not erased results in verify error.
+ * Failed program operation leaves device in status mode, in which commands are ignored until device is reset.
+ *
+ * @remark Low level driver functions are defined next to the fake, so they replace the real ones from bspFlash.
+ */
+class FlashDriverFake : public devices::s29jl::FlashDriver
+{
+  public:
+    FlashDriverFake(gsl::span<std::uint8_t> storage, std::uint32_t byteProgramTime);
+    ~FlashDriverFake();
+
+    /**
+     * @brief Simulates passing of time spent by caller on other work
+     * @param ticks Number of ticks
+     */
+    void Advance(std::uint32_t ticks);
+
+    /**
+     * @brief Makes program operation at given offset fail
+     * @param offset Offset of failing byte
+     * @param status Status reported by device
+     */
+    void FailProgramAt(std::size_t offset, program_flash::FlashStatus status);
+
+    /**
+     * @brief Keeps device busy with other operation
+     * @param ticks Number of ticks device remains busy
+     */
+    void HoldBusy(std::uint32_t ticks);
+
+    /**
+     * @brief Returns status of device (single poll)
+     * @param offset Polled offset
+     * @return Device status
+     */
+    program_flash::FlashStatus StatusGet(std::size_t offset);
+
+    /** @brief Handles unlock bypass entry command */
+    void UnlockBypassEntry();
+
+    /** @brief Handles unlock bypass reset command */
+    void UnlockBypassReset();
+
+    /** @brief Handles reset command */
+    void Reset();
+
+    /**
+     * @brief Handles program command
+     * @param offset Offset
+     * @param value Value to program
+     */
+    void ProgramCommand(std::size_t offset, std::uint8_t value);
+
+    /**
+     * @brief Handles sector erase command
+     * @param offset Offset inside erased sector
+     */
+    void EraseCommand(std::size_t offset);
+
+    /** @brief Currently existing instance */
+    static FlashDriverFake* Instance;
+
+    /** @brief Total simulated time */
+    inline std::uint32_t Ticks() const;
+    /** @brief Number of byte program cycles */
+    inline std::uint32_t ProgramCycles() const;
+    /** @brief Number of polls that found device busy */
+    inline std::uint32_t BusyPolls() const;
+    /** @brief Number of ticks device spent programming */
+    inline std::uint32_t BusyTicks() const;
+    /** @brief Number of reset commands */
+    inline std::uint32_t Resets() const;
+    /** @brief Is device in unlock bypass mode */
+    inline bool InUnlockBypass() const;
+    /** @brief Is device stuck in status mode after failed operation */
+    inline bool InStatusMode() const;
+
+  private:
+    gsl::span<std::uint8_t> _storage;
+    const std::uint32_t _byteProgramTime;
+    std::uint32_t _ticks;
+    std::uint32_t _busyUntil;
+    std::uint32_t _programCycles;
+    std::uint32_t _busyPolls;
+    std::uint32_t _resets;
+    bool _unlockBypass;
+    std::size_t _failOffset;
+    program_flash::FlashStatus _failStatus;
+    program_flash::FlashStatus _pendingStatus;
+    program_flash::FlashStatus _status;
+};
+
+std::uint32_t FlashDriverFake::Ticks() const
+{
+    return this->_ticks;
+}
+
+std::uint32_t FlashDriverFake::ProgramCycles() const
+{
+    return this->_programCycles;
+}
+
+std::uint32_t FlashDriverFake::BusyPolls() const
+{
+    return this->_busyPolls;
+}
+
+std::uint32_t FlashDriverFake::BusyTicks() const
+{
+    return this->_programCycles * this->_byteProgramTime;
+}
+
+std::uint32_t FlashDriverFake::Resets() const
+{
+    return this->_resets;
+}
+
+bool FlashDriverFake::InUnlockBypass() const
+{
+    return this->_unlockBypass;
+}
+
+bool FlashDriverFake::InStatusMode() const
+{
+    return this->_status != program_flash::FlashStatus::NotBusy;
+}
+
+#endif /* UNIT_TESTS_BASE_INCLUDE_MOCK_FLASH_DRIVER_FAKE_HPP_ */
@@ -22,6 +22,8 @@ struct N25QDriverMock : public devices::n25q::IN25QDriver
     MOCK_METHOD0(Reset, devices::n25q::OperationResult());
 
     MOCK_METHOD2(WaitForOperation, devices::n25q::OperationResult(std::chrono::milliseconds timeout, devices::n25q::FlagStatus status));
+
+    MOCK_METHOD0(IsBusy, bool());
 };
 
 #endif /* UNIT_TESTS_BASE_INCLUDE_MOCK_N25Q_HPP_ */
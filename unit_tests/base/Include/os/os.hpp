@@ -24,6 +24,8 @@ struct IOS
 
     virtual void Sleep(const std::chrono::milliseconds time) = 0;
 
+    virtual void SleepUntil(const std::chrono::milliseconds time) = 0;
+
     virtual OSSemaphoreHandle CreateBinarySemaphore(uint8_t semaphoreId = 0) = 0;
 
     virtual OSResult GiveSemaphore(const OSSemaphoreHandle semaphore) = 0;
@@ -68,6 +70,8 @@ struct IOS
 
     virtual std::chrono::milliseconds GetUptime() = 0;
 
+    virtual std::size_t GetTaskRunTimes(gsl::span<TaskRunTime> tasks, std::uint32_t& totalRunTime) = 0;
+
     virtual void Yield() = 0;
 };
 
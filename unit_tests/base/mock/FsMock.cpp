@@ -196,6 +196,49 @@ FsMock::FsMock() : _nextHandle(100), _nextDirHandle(200)
         return nullptr;
     }));
     ON_CALL(*this, CloseDirectory(_)).WillByDefault(Invoke([this](DirectoryHandle /*handle*/) { return OSResult::Success; }));
+
+    ON_CALL(*this, ListDirectory(_, _, _, _))
+        .WillByDefault(Invoke([this](const char* path, const char* startAfter, const char* prefix, gsl::span<DirectoryEntry> entries) {
+            string directory = path;
+            if (directory.empty() || directory.back() != '/')
+            {
+                directory += "/";
+            }
+
+            const string after = startAfter != nullptr ? startAfter : "";
+            const string filter = prefix != nullptr ? prefix : "";
+
+            std::ptrdiff_t count = 0;
+
+            for (auto& file : this->_files)
+            {
+                if (count == entries.size())
+                {
+                    break;
+                }
+
+                if (file.first.compare(0, directory.size(), directory) != 0)
+                {
+                    continue;
+                }
+
+                const auto name = file.first.substr(directory.size());
+
+                if (name.find('/') != string::npos || name <= after || name.compare(0, filter.size(), filter) != 0 ||
+                    name.size() > MaxListedNameLength)
+                {
+                    continue;
+                }
+
+                auto& entry = entries[count++];
+                std::copy(name.begin(), name.end(), entry.Name);
+                entry.Name[name.size()] = '\0';
+                entry.Size = file.second.size();
+                entry.ModificationTime = 0;
+            }
+
+            return ListDirectoryResult(OSResult::Success, static_cast<std::size_t>(count));
+        }));
 }
 
 FsMock::~FsMock()
@@ -117,6 +117,30 @@ namespace efm
 
             return ECODE_EMDRV_DMADRV_NOT_INITIALIZED;
         }
+
+        void CfgChannel(unsigned int channel, DMA_CfgChannel_TypeDef* cfg)
+        {
+            if (dmaProxy != nullptr)
+            {
+                dmaProxy->CfgChannel(channel, cfg);
+            }
+        }
+
+        void CfgDescrScatterGather(DMA_DESCRIPTOR_TypeDef* descr, unsigned int indx, DMA_CfgDescrSGAlt_TypeDef* cfg)
+        {
+            if (dmaProxy != nullptr)
+            {
+                dmaProxy->CfgDescrScatterGather(descr, indx, cfg);
+            }
+        }
+
+        void ActivateScatterGather(unsigned int channel, bool useBurst, DMA_DESCRIPTOR_TypeDef* altDescr, unsigned int count)
+        {
+            if (dmaProxy != nullptr)
+            {
+                dmaProxy->ActivateScatterGather(channel, useBurst, altDescr, count);
+            }
+        }
     }
 }
 
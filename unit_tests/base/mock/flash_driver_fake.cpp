@@ -0,0 +1,176 @@
+#include "flash_driver_fake.hpp"
+#include <algorithm>
+#include <limits>
+#include "lld.h"
+
+using program_flash::FlashStatus;
+
+FlashDriverFake* FlashDriverFake::Instance = nullptr;
+
+FlashDriverFake::FlashDriverFake(gsl::span<std::uint8_t> storage, std::uint32_t byteProgramTime)
+    : FlashDriver(storage.data()),                          //
+      _storage(storage),                                    //
+      _byteProgramTime(byteProgramTime),                    //
+      _ticks(0),                                            //
+      _busyUntil(0),                                        //
+      _programCycles(0),                                    //
+      _busyPolls(0),                                        //
+      _resets(0),                                           //
+      _unlockBypass(false),                                 //
+      _failOffset(std::numeric_limits<std::size_t>::max()), //
+      _failStatus(FlashStatus::NotBusy),                    //
+      _pendingStatus(FlashStatus::NotBusy),                 //
+      _status(FlashStatus::NotBusy)
+{
+    std::fill(this->_storage.begin(), this->_storage.end(), 0xFF);
+
+    Instance = this;
+}
+
+FlashDriverFake::~FlashDriverFake()
+{
+    Instance = nullptr;
+}
+
+void FlashDriverFake::Advance(std::uint32_t ticks)
+{
+    this->_ticks += ticks;
+}
+
+void FlashDriverFake::FailProgramAt(std::size_t offset, FlashStatus status)
+{
+    this->_failOffset = offset;
+    this->_failStatus = status;
+}
+
+void FlashDriverFake::HoldBusy(std::uint32_t ticks)
+{
+    this->_busyUntil = this->_ticks + ticks;
+}
+
+FlashStatus FlashDriverFake::StatusGet(std::size_t /*offset*/)
+{
+    this->_ticks++;
+
+    if (InStatusMode())
+    {
+        return this->_status;
+    }
+
+    if (this->_ticks < this->_busyUntil)
+    {
+        this->_busyPolls++;
+        return FlashStatus::Busy;
+    }
+
+    this->_status = this->_pendingStatus;
+    this->_pendingStatus = FlashStatus::NotBusy;
+
+    return this->_status;
+}
+
+void FlashDriverFake::UnlockBypassEntry()
+{
+    this->_unlockBypass = true;
+}
+
+void FlashDriverFake::UnlockBypassReset()
+{
+    this->_unlockBypass = false;
+}
+
+void FlashDriverFake::Reset()
+{
+    this->_resets++;
+    this->_status = FlashStatus::NotBusy;
+}
+
+void FlashDriverFake::ProgramCommand(std::size_t offset, std::uint8_t value)
+{
+    if (InStatusMode() || this->_ticks < this->_busyUntil)
+    {
+        return;
+    }
+
+    if (offset == this->_failOffset)
+    {
+        this->_pendingStatus = this->_failStatus;
+    }
+    else
+    {
+        this->_storage[offset] &= value;
+        this->_programCycles++;
+    }
+
+    this->_busyUntil = this->_ticks + this->_byteProgramTime;
+}
+
+void FlashDriverFake::EraseCommand(std::size_t offset)
+{
+    // first 64KB of flash is using 8KB sectors
+    const std::size_t sectorSize = offset < 64_KB ? 8_KB : LargeSectorSize;
+    const std::size_t sectorOffset = offset - offset % sectorSize;
+    const std::size_t available = this->_storage.size() - sectorOffset;
+
+    auto sector = this->_storage.subspan(sectorOffset, std::min(available, sectorSize));
+    std::fill(sector.begin(), sector.end(), 0xFF);
+}
+
+unsigned int lld_GetDeviceId(FLASHDATA* /*base_addr*/)
+{
+    return 0x00530000;
+}
+
+FLASHDATA lld_ReadCfiWord(FLASHDATA* /*base_addr*/, ADDRESS /*offset*/)
+{
+    return 0x02;
+}
+
+DEVSTATUS lld_StatusGet(FLASHDATA* /*base_addr*/, ADDRESS offset)
+{
+    return static_cast<DEVSTATUS>(FlashDriverFake::Instance->StatusGet(offset));
+}
+
+void lld_ResetCmd(FLASHDATA* /*base_addr*/)
+{
+    FlashDriverFake::Instance->Reset();
+}
+
+void lld_UnlockBypassEntryCmd(FLASHDATA* /*base_addr*/)
+{
+    FlashDriverFake::Instance->UnlockBypassEntry();
+}
+
+void lld_UnlockBypassProgramCmd(FLASHDATA* /*base_addr*/, ADDRESS offset, FLASHDATA* pgm_data_ptr)
+{
+    if (FlashDriverFake::Instance->InUnlockBypass())
+    {
+        FlashDriverFake::Instance->ProgramCommand(offset, *pgm_data_ptr);
+    }
+}
+
+void lld_UnlockBypassResetCmd(FLASHDATA* /*base_addr*/)
+{
+    FlashDriverFake::Instance->UnlockBypassReset();
+}
+
+DEVSTATUS lld_ProgramOp(FLASHDATA* base_addr, ADDRESS offset, FLASHDATA write_data)
+{
+    FlashDriverFake::Instance->ProgramCommand(offset, write_data);
+
+    DEVSTATUS status;
+
+    do
+    {
+        status = lld_StatusGet(base_addr, offset);
+    } while (status == DEV_BUSY);
+
+    return status;
+}
+
+DEVSTATUS lld_SectorEraseOp(FLASHDATA* base_addr, ADDRESS offset)
+{
+    FlashDriverFake::Instance->EraseCommand(offset);
+
+    return lld_StatusGet(base_addr, offset);
+}
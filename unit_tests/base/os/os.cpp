@@ -39,6 +39,14 @@ void System::SleepTask(const std::chrono::milliseconds time)
     }
 }
 
+void System::SleepUntil(const std::chrono::milliseconds time)
+{
+    if (OSProxy != nullptr)
+    {
+        OSProxy->SleepUntil(time);
+    }
+}
+
 void System::SuspendTask(OSTaskHandle task)
 {
     if (OSProxy != nullptr)
@@ -286,6 +294,17 @@ std::chrono::milliseconds System::GetUptime()
     return 0ms;
 }
 
+std::size_t System::GetTaskRunTimes(gsl::span<TaskRunTime> tasks, std::uint32_t& totalRunTime)
+{
+    if (OSProxy != nullptr)
+    {
+        return OSProxy->GetTaskRunTimes(tasks, totalRunTime);
+    }
+
+    totalRunTime = 0;
+    return 0;
+}
+
 void System::Yield()
 {
     if (OSProxy != nullptr)
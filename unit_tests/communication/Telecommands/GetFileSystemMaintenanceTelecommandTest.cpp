@@ -0,0 +1,41 @@
+#include <array>
+#include <chrono>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "mock/comm.hpp"
+#include "obc/telecommands/file_system.hpp"
+
+using telecommunication::downlink::DownlinkAPID;
+using testing::Return;
+using namespace std::chrono_literals;
+
+namespace
+{
+    struct FileSystemMaintenanceMock : services::fs::IFileSystemMaintenance
+    {
+        MOCK_METHOD0(ErasedReserve, std::uint16_t());
+        MOCK_METHOD0(TakeWorstWriteLatency, std::chrono::milliseconds());
+    };
+
+    class GetFileSystemMaintenanceTelecommandTest : public testing::Test
+    {
+      protected:
+        testing::NiceMock<TransmitterMock> _transmitter;
+
+        testing::NiceMock<FileSystemMaintenanceMock> _maintenance;
+
+        obc::telecommands::GetFileSystemMaintenanceTelecommand _telecommand{_maintenance};
+    };
+
+    TEST_F(GetFileSystemMaintenanceTelecommandTest, ShouldRespondWithReserveAndWorstWriteLatency)
+    {
+        ON_CALL(_maintenance, ErasedReserve()).WillByDefault(Return(0x0108));
+        EXPECT_CALL(_maintenance, TakeWorstWriteLatency()).WillOnce(Return(0x00020304ms));
+
+        std::array<std::uint8_t, 6> expectedPayload = {0x08, 0x01, 0x04, 0x03, 0x02, 0x00};
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSystemMaintenance, 0, expectedPayload)));
+
+        _telecommand.Handle(_transmitter, gsl::span<const std::uint8_t>());
+    }
+}
@@ -0,0 +1,49 @@
+#include <array>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "mock/comm.hpp"
+#include "obc/telecommands/i2c.hpp"
+
+using drivers::i2c::I2CFallbackStatistics;
+using telecommunication::downlink::DownlinkAPID;
+using testing::Return;
+
+namespace
+{
+    struct I2CFallbackStatisticsMock : drivers::i2c::II2CFallbackStatistics
+    {
+        MOCK_METHOD0(Statistics, I2CFallbackStatistics());
+    };
+
+    class GetI2CStatisticsTelecommandTest : public testing::Test
+    {
+      protected:
+        testing::NiceMock<TransmitterMock> _transmitter;
+
+        testing::NiceMock<I2CFallbackStatisticsMock> _statistics;
+
+        obc::telecommands::GetI2CStatisticsTelecommand _telecommand{_statistics};
+    };
+
+    TEST_F(GetI2CStatisticsTelecommandTest, ShouldRespondWithBusStatistics)
+    {
+        I2CFallbackStatistics statistics;
+        statistics.System = {0x04030201, 0x00000102, 0x00030000, 0x0506};
+        statistics.Payload = {0x00000010, 0x00000001, 0x00000020, 0x0002};
+        statistics.Rerouted = 0x0000000F;
+
+        ON_CALL(_statistics, Statistics()).WillByDefault(Return(statistics));
+
+        // clang-format off
+        std::array<std::uint8_t, 32> expectedPayload = {
+            0x01, 0x02, 0x03, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x06, 0x05,
+            0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00,
+            0x0F, 0x00, 0x00, 0x00
+        };
+        // clang-format on
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::I2CStatistics, 0, expectedPayload)));
+
+        _telecommand.Handle(_transmitter, gsl::span<const std::uint8_t>());
+    }
+}
@@ -0,0 +1,79 @@
+#include <algorithm>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "mock/comm.hpp"
+#include "obc/telecommands/os.hpp"
+
+using telecommunication::downlink::DownlinkAPID;
+using telecommunication::downlink::DownlinkFrame;
+using telemetry::TaskCpuUsage;
+using testing::_;
+using testing::Invoke;
+using testing::Return;
+
+namespace
+{
+    struct CpuUsageMock : telemetry::ICpuUsage
+    {
+        MOCK_METHOD0(IdleLoad, std::uint16_t());
+        MOCK_METHOD1(Report, std::size_t(gsl::span<TaskCpuUsage> usage));
+    };
+
+    class GetTaskStatisticsTelecommandTest : public testing::Test
+    {
+      protected:
+        void ReportTasks(const std::vector<TaskCpuUsage>& tasks);
+
+        testing::NiceMock<TransmitterMock> _transmitter;
+
+        testing::NiceMock<CpuUsageMock> _cpuUsage;
+
+        obc::telecommands::GetTaskStatisticsTelecommand _telecommand{_cpuUsage};
+    };
+
+    void GetTaskStatisticsTelecommandTest::ReportTasks(const std::vector<TaskCpuUsage>& tasks)
+    {
+        EXPECT_CALL(_cpuUsage, Report(_)).WillOnce(Invoke([tasks](gsl::span<TaskCpuUsage> usage) {
+            std::copy(tasks.begin(), tasks.end(), usage.begin());
+            return tasks.size();
+        }));
+    }
+
+    TEST_F(GetTaskStatisticsTelecommandTest, ShouldRespondWithTaskStatistics)
+    {
+        ON_CALL(_cpuUsage, IdleLoad()).WillByDefault(Return(0x0302));
+        ReportTasks({{"IDLE", 1, 0x0302, 0x0100}, {"Comm", 2, 0x0010, 0x0220}});
+
+        // clang-format off
+        std::array<std::uint8_t, 21> expectedPayload = {
+            0x02, 0x03,
+            2,
+            0x02, 0x03, 0x00, 0x01, 'I', 'D', 'L', 'E', 0,
+            0x10, 0x00, 0x20, 0x02, 'C', 'o', 'm', 'm', 0
+        };
+        // clang-format on
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TaskStatistics, 0, expectedPayload)));
+
+        _telecommand.Handle(_transmitter, gsl::span<const std::uint8_t>());
+    }
+
+    TEST_F(GetTaskStatisticsTelecommandTest, ShouldOmitTasksThatDoNotFitIntoFrame)
+    {
+        std::vector<TaskCpuUsage> tasks(20, TaskCpuUsage{"Task12345", 1, 10, 20});
+        ReportTasks(tasks);
+
+        EXPECT_CALL(_transmitter, SendFrame(_)).WillOnce(Invoke([](gsl::span<const std::uint8_t> frame) {
+            const auto payload = frame.subspan(DownlinkFrame::HeaderSize);
+            constexpr auto entrySize = 2 * sizeof(std::uint16_t) + 10;
+            constexpr auto expectedCount = (DownlinkFrame::MaxPayloadSize - 3) / entrySize;
+
+            EXPECT_EQ(payload[2], expectedCount);
+            EXPECT_EQ(payload.size(), static_cast<std::ptrdiff_t>(3 + expectedCount * entrySize));
+            return true;
+        }));
+
+        _telecommand.Handle(_transmitter, gsl::span<const std::uint8_t>());
+    }
+}
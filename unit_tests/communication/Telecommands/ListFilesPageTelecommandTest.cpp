@@ -0,0 +1,223 @@
+#include <array>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "base/reader.h"
+#include "mock/FsMock.hpp"
+#include "mock/comm.hpp"
+#include "obc/telecommands/file_system.hpp"
+#include "telecommunication/uplink.h"
+
+using std::array;
+using std::uint8_t;
+using std::string;
+using testing::Eq;
+using testing::StrEq;
+using testing::_;
+using testing::Invoke;
+using testing::Return;
+using testing::ElementsAre;
+using telecommunication::downlink::DownlinkAPID;
+using telecommunication::downlink::DownlinkFrame;
+using obc::telecommands::ListFilesPageTelecommand;
+using services::fs::ListDirectoryResult;
+
+template <std::size_t Size> using BufferArray = array<uint8_t, Size>;
+
+namespace
+{
+    struct Page
+    {
+        uint8_t Status = 0xFF;
+        bool More = false;
+        std::vector<string> Names;
+        std::vector<std::uint32_t> Sizes;
+    };
+
+    class ListFilesPageTelecommandTest : public testing::Test
+    {
+      protected:
+        void ReceiveTo(Page& page);
+
+        template <typename... T> void Run(T... args);
+
+        testing::NiceMock<FsMock> _fs;
+        testing::NiceMock<TransmitterMock> _transmitter;
+
+        ListFilesPageTelecommand _telecommand{_fs};
+    };
+
+    void ListFilesPageTelecommandTest::ReceiveTo(Page& page)
+    {
+        EXPECT_CALL(this->_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileListPage, 0, _)))
+            .WillOnce(Invoke([&page](gsl::span<const std::uint8_t> frame) {
+                Reader r(frame);
+                r.Skip(DownlinkFrame::HeaderSize);
+                r.ReadByte();
+                page.Status = r.ReadByte();
+
+                if (r.RemainingSize() == 0)
+                {
+                    return true;
+                }
+
+                page.More = r.ReadByte() != 0;
+
+                while (r.Status() && r.RemainingSize() > 0)
+                {
+                    const auto name = r.ReadString(200);
+                    r.ReadByte();
+                    page.Names.emplace_back(name.data(), name.size());
+                    page.Sizes.push_back(r.ReadDoubleWordLE());
+                    r.ReadDoubleWordLE();
+                }
+
+                return true;
+            }));
+    }
+
+    template <typename... T> void ListFilesPageTelecommandTest::Run(T... args)
+    {
+        BufferArray<sizeof...(T)> parameters{static_cast<uint8_t>(args)...};
+        this->_telecommand.Handle(this->_transmitter, parameters);
+    }
+
+    TEST_F(ListFilesPageTelecommandTest, ShouldListFilesWithSizes)
+    {
+        BufferArray<3> small;
+        BufferArray<10> large;
+
+        this->_fs.AddFile("/a/file2", large);
+        this->_fs.AddFile("/a/file1", small);
+        this->_fs.AddFile("/b/file3", small);
+
+        Page page;
+        ReceiveTo(page);
+
+        Run(0x22, 0, '/', 'a', 0, 0, 0);
+
+        ASSERT_THAT(page.Status, Eq(0));
+        ASSERT_THAT(page.More, Eq(false));
+        ASSERT_THAT(page.Names, ElementsAre("file1", "file2"));
+        ASSERT_THAT(page.Sizes, ElementsAre(3U, 10U));
+    }
+
+    TEST_F(ListFilesPageTelecommandTest, ShouldContinueAfterGivenName)
+    {
+        BufferArray<1> file;
+
+        this->_fs.AddFile("/a/file1", file);
+        this->_fs.AddFile("/a/file2", file);
+        this->_fs.AddFile("/a/file3", file);
+
+        Page page;
+        ReceiveTo(page);
+
+        Run(0x22, 0, '/', 'a', 0, 0, 'f', 'i', 'l', 'e', '1', 0);
+
+        ASSERT_THAT(page.Status, Eq(0));
+        ASSERT_THAT(page.Names, ElementsAre("file2", "file3"));
+    }
+
+    TEST_F(ListFilesPageTelecommandTest, ShouldFilterByPrefix)
+    {
+        BufferArray<1> file;
+
+        this->_fs.AddFile("/a/log1", file);
+        this->_fs.AddFile("/a/photo1", file);
+        this->_fs.AddFile("/a/log2", file);
+
+        Page page;
+        ReceiveTo(page);
+
+        Run(0x22, 0, '/', 'a', 0, 'l', 'o', 'g', 0, 0);
+
+        ASSERT_THAT(page.Names, ElementsAre("log1", "log2"));
+    }
+
+    TEST_F(ListFilesPageTelecommandTest, ShouldStopAtRequestedNumberOfEntries)
+    {
+        BufferArray<1> file;
+
+        this->_fs.AddFile("/a/file1", file);
+        this->_fs.AddFile("/a/file2", file);
+        this->_fs.AddFile("/a/file3", file);
+        this->_fs.AddFile("/a/file4", file);
+
+        Page page;
+        ReceiveTo(page);
+
+        Run(0x22, 3, '/', 'a', 0, 0, 0);
+
+        ASSERT_THAT(page.Names, ElementsAre("file1", "file2", "file3"));
+        ASSERT_THAT(page.More, Eq(true));
+    }
+
+    TEST_F(ListFilesPageTelecommandTest, ShouldNotReportMoreEntriesWhenLimitMatchesDirectorySize)
+    {
+        BufferArray<1> file;
+
+        this->_fs.AddFile("/a/file1", file);
+        this->_fs.AddFile("/a/file2", file);
+
+        Page page;
+        ReceiveTo(page);
+
+        Run(0x22, 2, '/', 'a', 0, 0, 0);
+
+        ASSERT_THAT(page.Names, ElementsAre("file1", "file2"));
+        ASSERT_THAT(page.More, Eq(false));
+    }
+
+    TEST_F(ListFilesPageTelecommandTest, ShouldFillSingleFrameAndReportMoreEntries)
+    {
+        BufferArray<1> file;
+        std::vector<string> paths;
+
+        for (auto i = 0; i < 40; i++)
+        {
+            paths.push_back("/a/file_with_long_name_" + std::to_string(100 + i));
+        }
+
+        for (auto& path : paths)
+        {
+            this->_fs.AddFile(path.c_str(), file);
+        }
+
+        Page page;
+        ReceiveTo(page);
+
+        Run(0x22, 0, '/', 'a', 0, 0, 0);
+
+        ASSERT_THAT(page.More, Eq(true));
+        ASSERT_THAT(page.Names.size(), Eq(7U));
+        ASSERT_THAT(page.Names.back(), StrEq("file_with_long_name_106"));
+    }
+
+    TEST_F(ListFilesPageTelecommandTest, ShouldReportFileSystemError)
+    {
+        EXPECT_CALL(this->_fs, ListDirectory(StrEq("/a"), _, _, _))
+            .WillOnce(Return(ListDirectoryResult(OSResult::NotFound, 0)));
+
+        Page page;
+        ReceiveTo(page);
+
+        Run(0x22, 0, '/', 'a', 0, 0, 0);
+
+        ASSERT_THAT(page.Status, Eq(static_cast<uint8_t>(num(OSResult::NotFound))));
+        ASSERT_THAT(page.Names.size(), Eq(0U));
+    }
+
+    TEST_F(ListFilesPageTelecommandTest, ShouldRejectRequestWithoutTerminators)
+    {
+        EXPECT_CALL(this->_fs, ListDirectory(_, _, _, _)).Times(0);
+
+        Page page;
+        ReceiveTo(page);
+
+        Run(0x22, 0, '/', 'a', 0, 'x');
+
+        ASSERT_THAT(page.Status, Eq(static_cast<uint8_t>(num(OSResult::InvalidArgument))));
+    }
+}
@@ -14,6 +14,7 @@ struct SetupDetumblingExperimentMock : public experiment::adcs::ISetupDetumbling
 {
     MOCK_METHOD1(Duration, void(std::chrono::seconds duration));
     MOCK_METHOD1(SampleRate, void(std::chrono::seconds interval));
+    MOCK_METHOD1(DeltaRecords, void(bool enabled));
 };
 
 namespace
@@ -60,11 +61,23 @@ namespace
         EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::Experiment, 0, ElementsAre(0x94, 0))));
         EXPECT_CALL(this->_setup, Duration(0x04030201s));
         EXPECT_CALL(this->_setup, SampleRate(10s));
+        EXPECT_CALL(this->_setup, DeltaRecords(false));
         EXPECT_CALL(this->_experiments, RequestExperiment(experiment::adcs::DetumblingExperiment::Code)).WillOnce(Return(true));
 
         Run(0x94, 0x01, 0x02, 0x03, 0x04, 0x0A);
     }
 
+    TEST_F(PerformDetumblingExperimentTelecommandTest, ShouldEnableDeltaRecordsWhenRequested)
+    {
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::Experiment, 0, ElementsAre(0x94, 0))));
+        EXPECT_CALL(this->_setup, Duration(0x04030201s));
+        EXPECT_CALL(this->_setup, SampleRate(10s));
+        EXPECT_CALL(this->_setup, DeltaRecords(true));
+        EXPECT_CALL(this->_experiments, RequestExperiment(experiment::adcs::DetumblingExperiment::Code)).WillOnce(Return(true));
+
+        Run(0x94, 0x01, 0x02, 0x03, 0x04, 0x0A, 0x01);
+    }
+
     TEST_F(PerformDetumblingExperimentTelecommandTest, ShouldRespondWithErrorIfRequestFails)
     {
         EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::Experiment, 0, ElementsAre(0x94, 2))));
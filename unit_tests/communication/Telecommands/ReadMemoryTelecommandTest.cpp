@@ -1,5 +1,10 @@
+#include <vector>
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
+#include "OsMock.hpp"
+#include "base/crc.h"
+#include "base/lzss.hpp"
+#include "base/reader.h"
 #include "base/writer.h"
 #include "mock/comm.hpp"
 #include "obc/telecommands/memory.hpp"
@@ -9,9 +14,14 @@ namespace
 {
     using namespace obc::telecommands;
     using telecommunication::downlink::DownlinkAPID;
+    using telecommunication::downlink::DownlinkFrame;
     using telecommunication::downlink::CorrelatedDownlinkFrame;
     using testing::_;
     using testing::ElementsAre;
+    using testing::ElementsAreArray;
+    using testing::Eq;
+    using testing::Invoke;
+    using testing::Return;
 
     class ReadMemoryTelecommandTest : public testing::Test
     {
@@ -79,4 +89,172 @@ namespace
 
         _telecommand.Handle(_transmitter, args);
     }
+
+    struct CompressedPart
+    {
+        std::uint32_t Offset;
+        std::uint16_t CRC;
+        std::vector<std::uint8_t> Content;
+    };
+
+    class ReadMemoryCompressedTelecommandTest : public testing::Test
+    {
+      protected:
+        ReadMemoryCompressedTelecommandTest();
+
+        void ReceiveParts();
+
+        void Run(std::uint32_t offset, std::uint32_t size);
+
+        testing::NiceMock<TransmitterMock> _transmitter;
+        testing::NiceMock<OSMock> _os;
+        OSReset _reset;
+        ReadMemoryCompressedTelecommand _telecommand;
+
+        std::vector<CompressedPart> _parts;
+    };
+
+    ReadMemoryCompressedTelecommandTest::ReadMemoryCompressedTelecommandTest()
+    {
+        _reset = InstallProxy(&_os);
+    }
+
+    void ReadMemoryCompressedTelecommandTest::ReceiveParts()
+    {
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::MemoryContentCompressed, _, 0x12, _)))
+            .WillRepeatedly(Invoke([this](gsl::span<const std::uint8_t> frame) {
+                Reader r(frame);
+                r.Skip(DownlinkFrame::HeaderSize + 1);
+
+                CompressedPart part;
+                part.Offset = r.ReadDoubleWordLE();
+                part.Content.resize(r.ReadWordLE());
+                part.CRC = r.ReadWordLE();
+
+                auto stream = r.ReadToEnd();
+
+                lzss::Decoder decoder;
+                std::size_t consumed = 0;
+                std::size_t produced = 0;
+
+                EXPECT_THAT(decoder.Decode(stream, part.Content, consumed, produced), Eq(lzss::DecoderStatus::Ok));
+                EXPECT_THAT(produced, Eq(part.Content.size()));
+
+                _parts.push_back(part);
+                return true;
+            }));
+    }
+
+    void ReadMemoryCompressedTelecommandTest::Run(std::uint32_t offset, std::uint32_t size)
+    {
+        std::array<std::uint8_t, 9> args;
+        Writer w(args);
+        w.WriteByte(0x12);
+        w.WriteDoubleWordLE(offset);
+        w.WriteDoubleWordLE(size);
+
+        _telecommand.Handle(_transmitter, args);
+    }
+
+    TEST_F(ReadMemoryCompressedTelecommandTest, ShouldSendCompressibleMemoryInSingleFrame)
+    {
+        std::array<std::uint8_t, 2000> memoryToRead;
+        memoryToRead.fill(0xFF);
+
+        ReceiveParts();
+
+        Run(reinterpret_cast<std::uint32_t>(memoryToRead.data()), memoryToRead.size());
+
+        ASSERT_THAT(_parts.size(), Eq(1U));
+        ASSERT_THAT(_parts[0].Offset, Eq(reinterpret_cast<std::uint32_t>(memoryToRead.data())));
+        ASSERT_THAT(_parts[0].Content, ElementsAreArray(memoryToRead));
+        ASSERT_THAT(_parts[0].CRC, Eq(CRC_calc(memoryToRead)));
+    }
+
+    TEST_F(ReadMemoryCompressedTelecommandTest, ShouldSplitMemoryIntoIndependentFrames)
+    {
+        std::array<std::uint8_t, 700> memoryToRead;
+        std::uint32_t state = 0x1234;
+        for (auto& value : memoryToRead)
+        {
+            state = state * 1103515245 + 12345;
+            value = static_cast<std::uint8_t>(state >> 16);
+        }
+
+        ReceiveParts();
+
+        Run(reinterpret_cast<std::uint32_t>(memoryToRead.data()), memoryToRead.size());
+
+        ASSERT_THAT(_parts.size(), testing::Gt(1U));
+
+        auto expectedOffset = reinterpret_cast<std::uint32_t>(memoryToRead.data());
+        std::vector<std::uint8_t> content;
+
+        for (auto& part : _parts)
+        {
+            ASSERT_THAT(part.Offset, Eq(expectedOffset));
+            ASSERT_THAT(part.CRC, Eq(CRC_calc(part.Content)));
+
+            content.insert(content.end(), part.Content.begin(), part.Content.end());
+            expectedOffset += part.Content.size();
+        }
+
+        ASSERT_THAT(content, ElementsAreArray(memoryToRead));
+    }
+
+    TEST_F(ReadMemoryCompressedTelecommandTest, ShouldSendAddress0InSeparateFrame)
+    {
+        ReceiveParts();
+
+        Run(0, 10);
+
+        ASSERT_THAT(_parts.size(), Eq(2U));
+        ASSERT_THAT(_parts[0].Offset, Eq(0U));
+        ASSERT_THAT(_parts[0].Content.size(), Eq(1U));
+        ASSERT_THAT(_parts[1].Offset, Eq(1U));
+        ASSERT_THAT(_parts[1].Content.size(), Eq(9U));
+    }
+
+    TEST_F(ReadMemoryCompressedTelecommandTest, ShouldDelayWhenTransmitterBufferIsAlmostFull)
+    {
+        std::array<std::uint8_t, 100> memoryToRead;
+        memoryToRead.fill(0);
+
+        ReceiveParts();
+        EXPECT_CALL(_transmitter, FreeSlots()).WillOnce(Return(Option<std::uint8_t>::Some(1)));
+        EXPECT_CALL(_os, Sleep(3 * ReadMemoryCompressedTelecommand::FrameTransmissionTime));
+
+        Run(reinterpret_cast<std::uint32_t>(memoryToRead.data()), memoryToRead.size());
+    }
+
+    TEST_F(ReadMemoryCompressedTelecommandTest, ShouldNotDelayWhenTransmitterHasFreeSlots)
+    {
+        std::array<std::uint8_t, 100> memoryToRead;
+        memoryToRead.fill(0);
+
+        ReceiveParts();
+        EXPECT_CALL(_transmitter, FreeSlots()).WillOnce(Return(Option<std::uint8_t>::Some(ReadMemoryCompressedTelecommand::MinFreeSlots)));
+        EXPECT_CALL(_os, Sleep(_)).Times(0);
+
+        Run(reinterpret_cast<std::uint32_t>(memoryToRead.data()), memoryToRead.size());
+    }
+
+    TEST_F(ReadMemoryCompressedTelecommandTest, ShouldAbortWhenFrameIsRepeatedlyRejected)
+    {
+        std::array<std::uint8_t, 1000> memoryToRead;
+        memoryToRead.fill(0);
+
+        EXPECT_CALL(_transmitter, SendFrame(_)).Times(ReadMemoryCompressedTelecommand::MaxSendAttempts).WillRepeatedly(Return(false));
+
+        Run(reinterpret_cast<std::uint32_t>(memoryToRead.data()), memoryToRead.size());
+    }
+
+    TEST_F(ReadMemoryCompressedTelecommandTest, ShouldRespondWithErrorOnTooShortFrame)
+    {
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::Operation, 0, 0x12, ElementsAre(1))));
+
+        std::array<std::uint8_t, 1> args{0x12};
+
+        _telecommand.Handle(_transmitter, args);
+    }
 }
@@ -7,10 +7,10 @@
 #include "telemetry/state.hpp"
 #include "utils.hpp"
 
+using testing::ElementsAre;
+using testing::Invoke;
 using testing::ReturnRef;
 using testing::_;
-using testing::Return;
-using telecommunication::downlink::DownlinkAPID;
 
 namespace
 {
@@ -27,8 +27,6 @@ namespace
 
     TEST_F(SendBeaconTelecommandTest, ShouldSendBeacon)
     {
-        ON_CALL(_os, TakeSemaphore(_, _)).WillByDefault(Return(OSResult::Success));
-
         telemetry::TelemetryState tm;
 
         ON_CALL(_stateProvider, MockGetState()).WillByDefault(ReturnRef(tm));
@@ -38,15 +36,19 @@ namespace
         _telecommand.Handle(_transmitter, {});
     }
 
-    TEST_F(SendBeaconTelecommandTest, ShouldSendErrorFrameWhenUnableToWriteBeacon)
+    TEST_F(SendBeaconTelecommandTest, ShouldNotLockTelemetry)
     {
-        ON_CALL(_os, TakeSemaphore(_, _)).WillByDefault(Return(OSResult::Timeout));
-
         telemetry::TelemetryState tm;
+        std::array<std::uint8_t, 2> snapshot{0xAB, 0xCD};
+        tm.lastSerializedTelemetry.Publish(snapshot);
 
         ON_CALL(_stateProvider, MockGetState()).WillByDefault(ReturnRef(tm));
 
-        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::BeaconError, 0, _)));
+        EXPECT_CALL(_os, TakeSemaphore(_, _)).Times(0);
+        EXPECT_CALL(_transmitter, SendFrame(_)).WillOnce(Invoke([](gsl::span<const std::uint8_t> frame) {
+            EXPECT_THAT(frame.subspan(0, 3), ElementsAre(telecommunication::downlink::BeaconMarker, 0xAB, 0xCD));
+            return true;
+        }));
 
         _telecommand.Handle(_transmitter, {});
     }
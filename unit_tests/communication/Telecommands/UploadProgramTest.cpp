@@ -2,12 +2,15 @@
 #include <array>
 #include <cstdint>
 #include <gsl/span>
+#include <vector>
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
+#include "base/crc.h"
 #include "mock/comm.hpp"
 #include "mock/flash_driver.hpp"
 #include "obc/telecommands/program_upload.hpp"
 #include "program_flash/boot_table.hpp"
+#include "program_flash/compressed_writer.hpp"
 #include "utils.h"
 
 using testing::_;
@@ -31,12 +34,15 @@ class UploadProgramTest : public testing::Test
     testing::NiceMock<FlashDriverMock> _flashMock;
     gsl::span<std::uint8_t> _flash;
     program_flash::BootTable _bootTable;
+    program_flash::CompressedProgramWriter _compressedWriter;
 
     testing::NiceMock<TransmitterMock> _transmitter;
 
     obc::telecommands::EraseBootTableEntry _eraseTelecommand;
     obc::telecommands::WriteProgramPart _writePartTelecommand;
     obc::telecommands::FinalizeProgramEntry _finalizeTelecommand;
+    obc::telecommands::WriteCompressedProgramPart _writeCompressedTelecommand;
+    obc::telecommands::BeginProgramPatch _beginPatchTelecommand;
 
     template <typename... Values> void HandleFrame(telecommunication::uplink::IHandleTeleCommand& telecommand, Values... parameters)
     {
@@ -44,15 +50,36 @@ class UploadProgramTest : public testing::Test
 
         telecommand.Handle(this->_transmitter, params);
     }
+
+    void WritePatch(std::uint8_t entries, std::initializer_list<std::uint8_t> patch);
 };
 
 UploadProgramTest::UploadProgramTest()
-    : _flash(this->_flashMock.Storage()), _bootTable(_flashMock), _eraseTelecommand(_bootTable), _writePartTelecommand(_bootTable),
-      _finalizeTelecommand(_bootTable)
+    : _flash(this->_flashMock.Storage()), _bootTable(_flashMock), _compressedWriter(_bootTable),
+      _eraseTelecommand(_bootTable, _compressedWriter), _writePartTelecommand(_bootTable, _compressedWriter),
+      _finalizeTelecommand(_bootTable), _writeCompressedTelecommand(_bootTable, _compressedWriter),
+      _beginPatchTelecommand(_bootTable, _compressedWriter)
 {
     this->_bootTable.Initialize();
 }
 
+void UploadProgramTest::WritePatch(std::uint8_t entries, std::initializer_list<std::uint8_t> patch)
+{
+    std::vector<std::uint8_t> params{entries, 0, 0, 0, 0};
+
+    auto it = patch.begin();
+    while (it != patch.end())
+    {
+        params.push_back(0xFF);
+        for (auto i = 0; i < 8 && it != patch.end(); i++, it++)
+        {
+            params.push_back(*it);
+        }
+    }
+
+    this->_writeCompressedTelecommand.Handle(this->_transmitter, params);
+}
+
 TEST_F(UploadProgramTest, ReadFirstProgramDetails)
 {
     this->_flash[0x00000000] = 0x12;
@@ -166,6 +193,67 @@ TEST_F(UploadProgramTest, WriteProgramByTelecommands)
     ASSERT_THAT(reinterpret_cast<const char*>(entry.Content() + 1_KB), StrEq("Part"));
 }
 
+TEST_F(UploadProgramTest, WriteProgramToMultipleEntries)
+{
+    this->HandleFrame(this->_eraseTelecommand, 5);
+
+    EXPECT_CALL(this->_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::ProgramUpload, 0U, ElementsAre(1, 0, 5, 0, 0, 0, 0, 8))))
+        .Times(1);
+    this->HandleFrame(this->_writePartTelecommand, 5, 0x00, 0x00, 0x00, 0x00, 'P', 'r', 'o', 'g', 'r', 'a', 'm', 0);
+
+    ASSERT_THAT(reinterpret_cast<const char*>(this->_bootTable.Entry(0).Content()), StrEq("Program"));
+    ASSERT_THAT(reinterpret_cast<const char*>(this->_bootTable.Entry(2).Content()), StrEq("Program"));
+    ASSERT_THAT(this->_bootTable.Entry(1).Content()[0], Eq(0xA5));
+}
+
+TEST_F(UploadProgramTest, FinalizeUsesCrcCalculatedDuringSequentialWrite)
+{
+    this->HandleFrame(this->_eraseTelecommand, 3);
+    this->HandleFrame(this->_writePartTelecommand, 3, 0x00, 0x00, 0x00, 0x00, 'P', 'r', 'o', 'g');
+    this->HandleFrame(this->_writePartTelecommand, 3, 0x04, 0x00, 0x00, 0x00, 'P', 'r', 'o', 'g', 'P', 'r', 'o', 'g', 0);
+
+    ASSERT_THAT(this->_bootTable.Entry(0).WrittenContentCrc(13), Eq(Some<std::uint16_t>(0xFEA0)));
+    ASSERT_THAT(this->_bootTable.Entry(1).WrittenContentCrc(13), Eq(Some<std::uint16_t>(0xFEA0)));
+
+    EXPECT_CALL(this->_flashMock, At(_)).Times(0);
+    EXPECT_CALL(this->_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::ProgramUpload, 0U, ElementsAre(2, 0, 3, 0xA0, 0xFE))));
+    this->HandleFrame(this->_finalizeTelecommand, 3, 13, 0x00, 0x00, 0x00, 0xA0, 0xFE, 'T', 'e', 's', 't');
+}
+
+TEST_F(UploadProgramTest, RepeatedPartIsAcknowledgedWithoutProgramming)
+{
+    this->HandleFrame(this->_eraseTelecommand, 1);
+    this->HandleFrame(this->_writePartTelecommand, 1, 0x00, 0x00, 0x00, 0x00, 'P', 'r', 'o', 'g');
+
+    EXPECT_CALL(this->_flashMock, Program(_, A<gsl::span<const std::uint8_t>>())).Times(0);
+    EXPECT_CALL(this->_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::ProgramUpload, 0U, ElementsAre(1, 0, 1, 0, 0, 0, 0, 4))))
+        .Times(1);
+    this->HandleFrame(this->_writePartTelecommand, 1, 0x00, 0x00, 0x00, 0x00, 'P', 'r', 'o', 'g');
+
+    ASSERT_THAT(this->_bootTable.Entry(0).WrittenContentCrc(4).HasValue, Eq(true));
+}
+
+TEST_F(UploadProgramTest, NonSequentialWriteFallsBackToCalculatedCrc)
+{
+    this->HandleFrame(this->_eraseTelecommand, 1);
+    this->HandleFrame(this->_writePartTelecommand, 1, 0x04, 0x00, 0x00, 0x00, 'P', 'r', 'o', 'g', 'P', 'r', 'o', 'g', 0);
+    this->HandleFrame(this->_writePartTelecommand, 1, 0x00, 0x00, 0x00, 0x00, 'P', 'r', 'o', 'g');
+
+    ASSERT_THAT(this->_bootTable.Entry(0).WrittenContentCrc(13).HasValue, Eq(false));
+
+    EXPECT_CALL(this->_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::ProgramUpload, 0U, ElementsAre(2, 0, 1, 0xA0, 0xFE))));
+    this->HandleFrame(this->_finalizeTelecommand, 1, 13, 0x00, 0x00, 0x00, 0xA0, 0xFE, 'T', 'e', 's', 't');
+}
+
+TEST_F(UploadProgramTest, RewriteOfWrittenAreaFallsBackToCalculatedCrc)
+{
+    this->HandleFrame(this->_eraseTelecommand, 1);
+    this->HandleFrame(this->_writePartTelecommand, 1, 0x00, 0x00, 0x00, 0x00, 'P', 'r', 'o', 'g');
+    this->HandleFrame(this->_writePartTelecommand, 1, 0x00, 0x00, 0x00, 0x00, 'P', 'r', 'o', 'd');
+
+    ASSERT_THAT(this->_bootTable.Entry(0).WrittenContentCrc(4).HasValue, Eq(false));
+}
+
 TEST_F(UploadProgramTest, ResponseWithEraseError)
 {
     ON_CALL(this->_flashMock, EraseSector(0x00000000 + 5 * 64_KB)).WillByDefault(Return(FlashStatus::EraseError));
@@ -226,3 +314,187 @@ TEST_F(UploadProgramTest, ErrorFrameOnMalformedFinalizeTelecommand)
 
     this->HandleFrame(this->_finalizeTelecommand);
 }
+
+TEST_F(UploadProgramTest, WriteCompressedProgramByTelecommands)
+{
+    EXPECT_CALL(this->_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::ProgramUpload, 0U, ElementsAre(0, 0, 3)))).Times(1);
+    this->HandleFrame(this->_eraseTelecommand, 3);
+
+    EXPECT_CALL(this->_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::ProgramUpload, 0U, ElementsAre(3, 0, 3, 6, 0, 0, 0, 4, 0, 0, 0))))
+        .Times(1);
+    this->HandleFrame(this->_writeCompressedTelecommand, 3, 0x00, 0x00, 0x00, 0x00, 0x2F, 'P', 'r', 'o', 'g', 0x03);
+
+    EXPECT_CALL(this->_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::ProgramUpload, 0U, ElementsAre(3, 0, 3, 8, 0, 0, 0, 13, 0, 0, 0))))
+        .Times(1);
+    this->HandleFrame(this->_writeCompressedTelecommand, 3, 0x06, 0x00, 0x00, 0x00, 0x14, 0x00);
+
+    ASSERT_THAT(this->_bootTable.Entry(0).WrittenContentCrc(13), Eq(Some<std::uint16_t>(0xFEA0)));
+    ASSERT_THAT(this->_bootTable.Entry(1).WrittenContentCrc(13), Eq(Some<std::uint16_t>(0xFEA0)));
+
+    EXPECT_CALL(this->_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::ProgramUpload, 0U, ElementsAre(2, 0, 3, 0xA0, 0xFE))));
+    this->HandleFrame(this->_finalizeTelecommand, 3, 13, 0x00, 0x00, 0x00, 0xA0, 0xFE, 'T', 'e', 's', 't');
+
+    ASSERT_THAT(reinterpret_cast<const char*>(this->_bootTable.Entry(0).Content()), StrEq("ProgProgProg"));
+    ASSERT_THAT(reinterpret_cast<const char*>(this->_bootTable.Entry(1).Content()), StrEq("ProgProgProg"));
+    ASSERT_THAT(this->_bootTable.Entry(0).CalculateCrc(), Eq(0xFEA0));
+}
+
+TEST_F(UploadProgramTest, RepeatedCompressedPartIsAcknowledgedWithoutProgramming)
+{
+    this->HandleFrame(this->_eraseTelecommand, 1);
+    this->HandleFrame(this->_writeCompressedTelecommand, 1, 0x00, 0x00, 0x00, 0x00, 0x2F, 'P', 'r', 'o', 'g', 0x03);
+
+    EXPECT_CALL(this->_flashMock, Program(_, A<gsl::span<const std::uint8_t>>())).Times(0);
+    EXPECT_CALL(this->_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::ProgramUpload, 0U, ElementsAre(3, 0, 1, 6, 0, 0, 0, 4, 0, 0, 0))))
+        .Times(1);
+    this->HandleFrame(this->_writeCompressedTelecommand, 1, 0x00, 0x00, 0x00, 0x00, 0x2F, 'P', 'r', 'o', 'g', 0x03);
+}
+
+TEST_F(UploadProgramTest, OverlappingCompressedPartIsProcessedFromFirstNewByte)
+{
+    this->HandleFrame(this->_writeCompressedTelecommand, 1, 0x00, 0x00, 0x00, 0x00, 0x2F, 'P', 'r', 'o', 'g', 0x03);
+
+    EXPECT_CALL(this->_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::ProgramUpload, 0U, ElementsAre(3, 0, 1, 8, 0, 0, 0, 13, 0, 0, 0))))
+        .Times(1);
+    this->HandleFrame(this->_writeCompressedTelecommand, 1, 0x04, 0x00, 0x00, 0x00, 'g', 0x03, 0x14, 0x00);
+
+    ASSERT_THAT(reinterpret_cast<const char*>(this->_bootTable.Entry(0).Content()), StrEq("ProgProgProg"));
+}
+
+TEST_F(UploadProgramTest, CompressedPartAtOffsetZeroStartsNewUpload)
+{
+    this->HandleFrame(this->_eraseTelecommand, 1);
+    this->HandleFrame(this->_writeCompressedTelecommand, 1, 0x00, 0x00, 0x00, 0x00, 0x2F, 'P', 'r', 'o', 'g', 0x03);
+
+    EXPECT_CALL(this->_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::ProgramUpload, 0U, ElementsAre(3, 0, 1, 6, 0, 0, 0, 4, 0, 0, 0))))
+        .Times(1);
+    this->HandleFrame(this->_writeCompressedTelecommand, 1, 0x00, 0x00, 0x00, 0x00, 0x2F, 'T', 'e', 's', 't', 0x03);
+
+    ASSERT_THAT(gsl::make_span(this->_bootTable.Entry(0).Content(), 4), ElementsAre('T', 'e', 's', 't'));
+    ASSERT_THAT(this->_bootTable.Entry(0).WrittenContentCrc(4).HasValue, Eq(false));
+}
+
+TEST_F(UploadProgramTest, FinalizeUsesCrcOfContentReadBackFromFlash)
+{
+    this->HandleFrame(this->_eraseTelecommand, 1);
+
+    ON_CALL(this->_flashMock, Program(_, A<gsl::span<const std::uint8_t>>()))
+        .WillByDefault(Invoke([this](std::size_t offset, gsl::span<const std::uint8_t> value) {
+            std::copy(value.begin(), value.end(), this->_flash.begin() + offset);
+            this->_flash[offset] = 'X';
+
+            return FlashStatus::NotBusy;
+        }));
+
+    this->HandleFrame(this->_writeCompressedTelecommand, 1, 0x00, 0x00, 0x00, 0x00, 0x2F, 'P', 'r', 'o', 'g', 0x03, 0x14, 0x00);
+
+    const auto actualCrc = CRC_calc(gsl::make_span(this->_bootTable.Entry(0).Content(), 13));
+    ASSERT_THAT(this->_bootTable.Entry(0).WrittenContentCrc(13), Eq(Option<std::uint16_t>::Some(actualCrc)));
+
+    EXPECT_CALL(this->_transmitter,
+        SendFrame(IsDownlinkFrame(DownlinkAPID::ProgramUpload,
+            0U,
+            ElementsAre(2, 20, 1, static_cast<std::uint8_t>(actualCrc & 0xFF), static_cast<std::uint8_t>(actualCrc >> 8)))));
+    this->HandleFrame(this->_finalizeTelecommand, 1, 13, 0x00, 0x00, 0x00, 0xA0, 0xFE, 'T', 'e', 's', 't');
+}
+
+TEST_F(UploadProgramTest, CompressedPartBeyondStreamOffsetIsRejected)
+{
+    this->HandleFrame(this->_writeCompressedTelecommand, 1, 0x00, 0x00, 0x00, 0x00, 0x2F, 'P', 'r', 'o', 'g', 0x03);
+
+    EXPECT_CALL(this->_flashMock, Program(_, A<gsl::span<const std::uint8_t>>())).Times(0);
+    EXPECT_CALL(this->_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::ProgramUpload, 0U, ElementsAre(3, 30, 1, 6, 0, 0, 0)))).Times(1);
+    this->HandleFrame(this->_writeCompressedTelecommand, 1, 0x07, 0x00, 0x00, 0x00, 0x00);
+}
+
+TEST_F(UploadProgramTest, CompressedPartWithoutSessionIsRejected)
+{
+    EXPECT_CALL(this->_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::ProgramUpload, 0U, ElementsAre(3, 30, 1, 0, 0, 0, 0)))).Times(1);
+    this->HandleFrame(this->_writeCompressedTelecommand, 1, 0x06, 0x00, 0x00, 0x00, 0x14, 0x00);
+}
+
+TEST_F(UploadProgramTest, CorruptedCompressedStreamAbortsSession)
+{
+    EXPECT_CALL(this->_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::ProgramUpload, 0U, ElementsAre(3, 31, 1, 0, 0, 0, 0)))).Times(1);
+    this->HandleFrame(this->_writeCompressedTelecommand, 1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00);
+
+    ASSERT_THAT(this->_compressedWriter.StreamOffset(1), Eq(0U));
+}
+
+TEST_F(UploadProgramTest, RawWriteInvalidatesCompressedUploadCrc)
+{
+    this->HandleFrame(this->_eraseTelecommand, 1);
+    this->HandleFrame(this->_writeCompressedTelecommand, 1, 0x00, 0x00, 0x00, 0x00, 0x2F, 'P', 'r', 'o', 'g', 0x03, 0x14, 0x00);
+    ASSERT_THAT(this->_bootTable.Entry(0).WrittenContentCrc(13).HasValue, Eq(true));
+
+    this->HandleFrame(this->_writePartTelecommand, 1, 0x00, 0x00, 0x00, 0x00, 'X');
+
+    ASSERT_THAT(this->_bootTable.Entry(0).WrittenContentCrc(13).HasValue, Eq(false));
+    ASSERT_THAT(this->_compressedWriter.StreamOffset(1), Eq(0U));
+}
+
+TEST_F(UploadProgramTest, ResponseWithProgramErrorOnCompressedPart)
+{
+    ON_CALL(this->_flashMock, Program(0x00000400 + 512_KB, A<gsl::span<const std::uint8_t>>()))
+        .WillByDefault(Return(FlashStatus::ProgramError));
+
+    EXPECT_CALL(
+        this->_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::ProgramUpload, 0U, ElementsAre(3, 1, 10, 2, 0x00, 0x00, 0x00, 0x00))))
+        .Times(1);
+
+    this->HandleFrame(this->_writeCompressedTelecommand, 3, 0x00, 0x00, 0x00, 0x00, 0x2F, 'P', 'r', 'o', 'g', 0x03, 0x14, 0x00);
+}
+
+TEST_F(UploadProgramTest, ApplyPatchByTelecommands)
+{
+    strcpy(reinterpret_cast<char*>(&this->_flash[2 * 512_KB + 1_KB]), "Hello World!");
+
+    EXPECT_CALL(this->_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::ProgramUpload, 0U, ElementsAre(4, 0, 1, 0xD3, 0x0C)))).Times(1);
+    this->HandleFrame(this->_beginPatchTelecommand, 1, 2, 12, 0x00, 0x00, 0x00, 0xD3, 0x0C);
+
+    EXPECT_CALL(this->_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::ProgramUpload, 0U, _))).Times(1);
+    this->WritePatch(1,
+        {
+            0, 0, 0, 0, 0, 6, 0, 0, 0,              // copy "Hello "
+            2, 5, 0, 0, 0, 'P', 'a', 't', 'c', 'h', // insert "Patch"
+            0, 11, 0, 0, 0, 1, 0, 0, 0,             // copy "!"
+            1, 0, 0, 0, 0, 1, 0, 0, 0, 0xB8         // add to "H" giving 0
+        });
+
+    ASSERT_THAT(this->_compressedWriter.ProgramLength(), Eq(13U));
+
+    EXPECT_CALL(this->_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::ProgramUpload, 0U, ElementsAre(2, 0, 1, 0x61, 0xE7))));
+    this->HandleFrame(this->_finalizeTelecommand, 1, 13, 0x00, 0x00, 0x00, 0x61, 0xE7, 'T', 'e', 's', 't');
+
+    ASSERT_THAT(reinterpret_cast<const char*>(this->_bootTable.Entry(0).Content()), StrEq("Hello Patch!"));
+    ASSERT_THAT(this->_bootTable.Entry(0).CalculateCrc(), Eq(0xE761));
+}
+
+TEST_F(UploadProgramTest, BeginPatchFailsOnSourceCrcMismatch)
+{
+    strcpy(reinterpret_cast<char*>(&this->_flash[2 * 512_KB + 1_KB]), "Hello World!");
+
+    EXPECT_CALL(this->_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::ProgramUpload, 0U, ElementsAre(4, 20, 1, 0xD3, 0x0C)))).Times(1);
+    this->HandleFrame(this->_beginPatchTelecommand, 1, 2, 12, 0x00, 0x00, 0x00, 0x00, 0x00);
+
+    ASSERT_THAT(this->_compressedWriter.ProgramLength(), Eq(0U));
+}
+
+TEST_F(UploadProgramTest, BeginPatchRejectsSourceBeingTarget)
+{
+    EXPECT_CALL(this->_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::ProgramUpload, 0U, ElementsAre(4, 1, 10)))).Times(1);
+    this->HandleFrame(this->_beginPatchTelecommand, 5, 2, 12, 0x00, 0x00, 0x00, 0xD3, 0x0C);
+}
+
+TEST_F(UploadProgramTest, ErasingPatchSourceInvalidatesSession)
+{
+    strcpy(reinterpret_cast<char*>(&this->_flash[2 * 512_KB + 1_KB]), "Hello World!");
+    this->HandleFrame(this->_beginPatchTelecommand, 1, 2, 12, 0x00, 0x00, 0x00, 0xD3, 0x0C);
+
+    this->HandleFrame(this->_eraseTelecommand, 4);
+
+    this->WritePatch(1, {0, 0, 0, 0, 0, 6, 0, 0, 0});
+
+    ASSERT_THAT(this->_compressedWriter.ProgramLength(), Eq(9U));
+    ASSERT_THAT(this->_bootTable.Entry(0).Content()[0], Eq(0));
+}
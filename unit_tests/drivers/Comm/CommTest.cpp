@@ -476,6 +476,46 @@ namespace
         ASSERT_THAT(error_counter, Eq(0));
     }
 
+    TEST_F(CommTest, TestSendFrameInPlaceShouldNotCopyFrame)
+    {
+        uint8_t buffer[FrameHeadroom + 4] = {0, 0, 0, 0x1, 0x2, 0x3, 0x4};
+        const uint8_t* written = nullptr;
+
+        EXPECT_CALL(i2c, Write(TransmitterAddress, BeginsWith(TransmitterSendFrame)))
+            .WillOnce(Invoke([&written](uint8_t /*address*/, span<const uint8_t> inData) {
+                written = inData.data();
+                EXPECT_THAT(inData, ElementsAre(TransmitterSendFrame, 0x1, 0x2, 0x3, 0x4));
+                return I2CResult::OK;
+            }));
+        EXPECT_CALL(i2c, Read(TransmitterAddress, _)).WillOnce(Invoke([](uint8_t /*address*/, span<uint8_t> outData) {
+            outData[0] = 0;
+            return I2CResult::OK;
+        }));
+
+        const auto status = comm.SendFrameInPlace(buffer);
+        ASSERT_THAT(status, Eq(true));
+        ASSERT_THAT(written, Eq(buffer + FrameHeadroom - 1));
+        ASSERT_THAT(error_counter, Eq(0));
+    }
+
+    TEST_F(CommTest, TestFreeSlotsReportedBySentFrame)
+    {
+        uint8_t buffer[] = {0x1, 0x2, 0x3};
+
+        ASSERT_THAT(comm.FreeSlots().HasValue, Eq(false));
+
+        ExpectSendFrame(7);
+        comm.SendFrame(span<const uint8_t>(buffer));
+
+        ASSERT_THAT(comm.FreeSlots().HasValue, Eq(true));
+        ASSERT_THAT(comm.FreeSlots().Value, Eq(7));
+
+        ExpectSendFrame(0xff);
+        comm.SendFrame(span<const uint8_t>(buffer));
+
+        ASSERT_THAT(comm.FreeSlots().Value, Eq(0));
+    }
+
     TEST_F(CommTest, TestSendFrameRejectedByHardware)
     {
         uint8_t buffer[] = {0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7, 0x8, 0x9, 0xa, 0xb, 0xc};
@@ -33,6 +33,18 @@ namespace
         ASSERT_THAT(frame.Frame()[3], Eq(0x42));
     }
 
+    TEST(DownlinkFrameTest, ShouldReserveHeadroomBeforeFrame)
+    {
+        DownlinkFrame frame(DownlinkAPID::Operation, 0x1DB55);
+
+        frame.PayloadWriter().WriteByte(0x42);
+
+        auto withHeadroom = frame.FrameWithHeadroom();
+
+        ASSERT_THAT(withHeadroom.length(), Eq(devices::comm::FrameHeadroom + 4));
+        ASSERT_THAT(withHeadroom.subspan(devices::comm::FrameHeadroom).data(), Eq(frame.Frame().data()));
+    }
+
     TEST(DownlinkFrameTest, ShouldPreventBuildingTooBigFrame)
     {
         DownlinkFrame frame(DownlinkAPID::Telemetry, 1);
@@ -0,0 +1,56 @@
+#include <utility>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "comm/FramePool.hpp"
+
+using testing::Eq;
+using testing::Ne;
+using devices::comm::FramePool;
+
+namespace
+{
+    TEST(FramePoolTest, ShouldProvideBuffersLargeEnoughForFrameWithHeadroom)
+    {
+        FramePool pool;
+
+        auto buffer = pool.Acquire();
+
+        ASSERT_THAT(static_cast<bool>(buffer), Eq(true));
+        ASSERT_THAT(buffer.Data().size(), Eq(static_cast<std::ptrdiff_t>(FramePool::BufferSize)));
+    }
+
+    TEST(FramePoolTest, ShouldFailWhenPoolIsExhausted)
+    {
+        FramePool pool;
+
+        auto first = pool.Acquire();
+        auto second = pool.Acquire();
+        auto third = pool.Acquire();
+        auto fourth = pool.Acquire();
+
+        ASSERT_THAT(static_cast<bool>(first), Eq(true));
+        ASSERT_THAT(static_cast<bool>(second), Eq(true));
+        ASSERT_THAT(static_cast<bool>(third), Eq(true));
+        ASSERT_THAT(first.Data().data(), Ne(second.Data().data()));
+        ASSERT_THAT(second.Data().data(), Ne(third.Data().data()));
+        ASSERT_THAT(static_cast<bool>(fourth), Eq(false));
+        ASSERT_THAT(fourth.Data().size(), Eq(0));
+        ASSERT_THAT(pool.Statistics().Exhaustions, Eq(1U));
+    }
+
+    TEST(FramePoolTest, ShouldReturnBufferToPoolOnDestruction)
+    {
+        FramePool pool;
+
+        {
+            auto first = pool.Acquire();
+            auto moved = std::move(first);
+            auto second = pool.Acquire();
+
+            ASSERT_THAT(pool.Statistics().InUse, Eq(2));
+        }
+
+        ASSERT_THAT(pool.Statistics().InUse, Eq(0));
+        ASSERT_THAT(static_cast<bool>(pool.Acquire()), Eq(true));
+    }
+}
@@ -84,4 +84,46 @@ namespace
 
         ASSERT_THAT(r, Eq(I2CResult::OK));
     }
+
+    TEST_F(ErrorHandlingI2CBusTest, SubmittedTransferShouldExecuteOnInnerBusAndPassthroughSuccess)
+    {
+        uint8_t in[] = {1, 2, 3};
+        uint8_t out[3] = {0};
+
+        EXPECT_CALL(innerBus, WriteRead(0x20, _, _)).WillOnce(Return(I2CResult::OK));
+        EXPECT_CALL(*this, Handler(_, _, _, _)).Times(0);
+
+        auto transfer = I2CTransfer::WriteRead(0x20, in, out);
+        bus.Submit(transfer);
+        auto r = bus.Wait(transfer);
+
+        ASSERT_THAT(r, Eq(I2CResult::OK));
+    }
+
+    TEST_F(ErrorHandlingI2CBusTest, SubmittedTransferShouldExecuteHandlerOnError)
+    {
+        uint8_t out[3] = {0};
+
+        EXPECT_CALL(innerBus, Read(0x20, _)).WillOnce(Return(I2CResult::BusErr));
+        EXPECT_CALL(*this, Handler(_, I2CResult::BusErr, 0x20, _)).WillOnce(Return(I2CResult::Nack));
+
+        auto transfer = I2CTransfer::Read(0x20, out);
+        bus.Submit(transfer);
+        auto r = bus.Wait(transfer);
+
+        ASSERT_THAT(r, Eq(I2CResult::Nack));
+        ASSERT_THAT(transfer.Result, Eq(I2CResult::Nack));
+    }
+
+    TEST_F(ErrorHandlingI2CBusTest, SubmittedWriteShouldBeExecutedAsWriteTransfer)
+    {
+        uint8_t in[] = {1, 2, 3};
+
+        EXPECT_CALL(innerBus, Write(0x20, testing::ElementsAre(1, 2, 3))).WillOnce(Return(I2CResult::OK));
+
+        auto transfer = I2CTransfer::Write(0x20, in);
+        bus.Submit(transfer);
+
+        ASSERT_THAT(bus.Wait(transfer), Eq(I2CResult::OK));
+    }
 }
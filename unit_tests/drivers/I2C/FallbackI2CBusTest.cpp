@@ -2,15 +2,22 @@
 #include "gmock/gmock.h"
 #include "gmock/gmock-matchers.h"
 #include "I2C/I2CMock.hpp"
+#include "OsMock.hpp"
 #include "i2c/wrappers.h"
+#include "os/os.hpp"
 #include "system.h"
 
 using testing::Test;
 using testing::_;
 using testing::Return;
 using testing::Eq;
+using testing::Invoke;
+using testing::InSequence;
+using testing::ReturnPointee;
 
 using namespace drivers::i2c;
+using namespace std::chrono_literals;
+
 namespace
 {
     class FallbackI2CBusTest : public Test
@@ -19,6 +26,11 @@ namespace
         testing::NiceMock<I2CBusMock> systemBus;
         testing::NiceMock<I2CBusMock> payloadBus;
 
+        testing::NiceMock<OSMock> os;
+        OSReset osReset;
+
+        std::chrono::milliseconds uptime;
+
         I2CInterface buses;
 
         I2CFallbackBus bus;
@@ -27,8 +39,10 @@ namespace
         FallbackI2CBusTest();
     };
 
-    FallbackI2CBusTest::FallbackI2CBusTest() : buses(systemBus, payloadBus), bus(buses)
+    FallbackI2CBusTest::FallbackI2CBusTest() : uptime(0ms), buses(systemBus, payloadBus), bus(buses, 10s)
     {
+        this->osReset = InstallProxy(&this->os);
+        ON_CALL(this->os, GetUptime()).WillByDefault(ReturnPointee(&this->uptime));
     }
 
     TEST_F(FallbackI2CBusTest, WriteReadShouldNotFallbackToPayloadBusIfSystemBusWorked)
@@ -105,4 +119,125 @@ namespace
 
         ASSERT_THAT(r, Eq(I2CResult::Nack));
     }
+
+    TEST_F(FallbackI2CBusTest, ShouldPreferPayloadBusDuringCoolDown)
+    {
+        uint8_t in[] = {1, 2, 3};
+
+        {
+            InSequence s;
+            EXPECT_CALL(systemBus, Write(0x20, _)).WillOnce(Return(I2CResult::Timeout));
+            EXPECT_CALL(payloadBus, Write(0x20, _)).Times(3).WillRepeatedly(Return(I2CResult::OK));
+        }
+
+        ASSERT_THAT(bus.Write(0x20, in), Eq(I2CResult::OK));
+
+        uptime = 5s;
+        ASSERT_THAT(bus.Write(0x20, in), Eq(I2CResult::OK));
+
+        uptime = 9999ms;
+        ASSERT_THAT(bus.Write(0x20, in), Eq(I2CResult::OK));
+    }
+
+    TEST_F(FallbackI2CBusTest, ShouldTrackBusHealthPerDevice)
+    {
+        uint8_t in[] = {1, 2, 3};
+
+        EXPECT_CALL(systemBus, Write(0x20, _)).WillOnce(Return(I2CResult::Timeout));
+        EXPECT_CALL(payloadBus, Write(0x20, _)).Times(2).WillRepeatedly(Return(I2CResult::OK));
+
+        EXPECT_CALL(systemBus, Write(0x30, _)).WillOnce(Return(I2CResult::OK));
+        EXPECT_CALL(payloadBus, Write(0x30, _)).Times(0);
+
+        bus.Write(0x20, in);
+        bus.Write(0x30, in);
+        bus.Write(0x20, in);
+    }
+
+    TEST_F(FallbackI2CBusTest, ShouldProbeSystemBusAfterCoolDown)
+    {
+        uint8_t in[] = {1, 2, 3};
+
+        {
+            InSequence s;
+            EXPECT_CALL(systemBus, Write(0x20, _)).WillOnce(Return(I2CResult::Timeout));
+            EXPECT_CALL(payloadBus, Write(0x20, _)).WillOnce(Return(I2CResult::OK));
+            EXPECT_CALL(systemBus, Write(0x20, _)).Times(2).WillRepeatedly(Return(I2CResult::OK));
+        }
+
+        bus.Write(0x20, in);
+
+        uptime = 10s;
+        ASSERT_THAT(bus.Write(0x20, in), Eq(I2CResult::OK));
+        ASSERT_THAT(bus.Write(0x20, in), Eq(I2CResult::OK));
+    }
+
+    TEST_F(FallbackI2CBusTest, ShouldRestartCoolDownWhenProbeFails)
+    {
+        uint8_t in[] = {1, 2, 3};
+
+        {
+            InSequence s;
+            EXPECT_CALL(systemBus, Write(0x20, _)).WillOnce(Return(I2CResult::Timeout));
+            EXPECT_CALL(payloadBus, Write(0x20, _)).WillOnce(Return(I2CResult::OK));
+            EXPECT_CALL(systemBus, Write(0x20, _)).WillOnce(Return(I2CResult::Timeout));
+            EXPECT_CALL(payloadBus, Write(0x20, _)).Times(2).WillRepeatedly(Return(I2CResult::OK));
+        }
+
+        bus.Write(0x20, in);
+
+        uptime = 10s;
+        ASSERT_THAT(bus.Write(0x20, in), Eq(I2CResult::OK));
+
+        uptime = 15s;
+        ASSERT_THAT(bus.Write(0x20, in), Eq(I2CResult::OK));
+    }
+
+    TEST_F(FallbackI2CBusTest, ShouldReturnToSystemBusWhenPayloadBusFails)
+    {
+        uint8_t in[] = {1, 2, 3};
+        uint8_t out[3] = {0};
+
+        {
+            InSequence s;
+            EXPECT_CALL(systemBus, Read(0x20, _)).WillOnce(Return(I2CResult::Timeout));
+            EXPECT_CALL(payloadBus, Read(0x20, _)).WillOnce(Return(I2CResult::OK));
+            EXPECT_CALL(payloadBus, WriteRead(0x20, _, _)).WillOnce(Return(I2CResult::Nack));
+            EXPECT_CALL(systemBus, WriteRead(0x20, _, _)).WillOnce(Return(I2CResult::OK));
+            EXPECT_CALL(systemBus, Write(0x20, _)).WillOnce(Return(I2CResult::OK));
+        }
+
+        bus.Read(0x20, out);
+        ASSERT_THAT(bus.WriteRead(0x20, in, out), Eq(I2CResult::OK));
+        ASSERT_THAT(bus.Write(0x20, in), Eq(I2CResult::OK));
+    }
+
+    TEST_F(FallbackI2CBusTest, ShouldCollectTransferStatistics)
+    {
+        uint8_t in[] = {1, 2, 3};
+
+        EXPECT_CALL(systemBus, Write(0x20, _)).WillOnce(Invoke([this](I2CAddress, gsl::span<const uint8_t>) {
+            uptime += 30ms;
+            return I2CResult::Timeout;
+        }));
+        EXPECT_CALL(payloadBus, Write(0x20, _)).WillRepeatedly(Invoke([this](I2CAddress, gsl::span<const uint8_t>) {
+            uptime += 2ms;
+            return I2CResult::OK;
+        }));
+
+        bus.Write(0x20, in);
+        bus.Write(0x20, in);
+
+        const auto statistics = bus.Statistics();
+
+        ASSERT_THAT(statistics.System.Transfers, Eq(1U));
+        ASSERT_THAT(statistics.System.Failures, Eq(1U));
+        ASSERT_THAT(statistics.System.TotalLatency, Eq(30U));
+        ASSERT_THAT(statistics.System.MaxLatency, Eq(30U));
+        ASSERT_THAT(statistics.Payload.Transfers, Eq(2U));
+        ASSERT_THAT(statistics.Payload.Failures, Eq(0U));
+        ASSERT_THAT(statistics.Payload.TotalLatency, Eq(4U));
+        ASSERT_THAT(statistics.Payload.MaxLatency, Eq(2U));
+        ASSERT_THAT(statistics.Rerouted, Eq(1U));
+    }
 }
@@ -1,6 +1,7 @@
 #include <algorithm>
 #include <array>
 #include <limits>
+#include <vector>
 
 #include <gsl/span>
 #include <gtest/gtest.h>
@@ -118,10 +119,12 @@ class N25QDriverTest : public Test
         EXPECT_CALL(this->_spi, Read(testing::_)).WillOnce(Return(OSResult::Timeout));
     }
 
-    void ExpectCommandAndRespondManyTimes(Command command, uint8_t response, uint16_t times)
+    void ExpectSelectedCommandAndRespondManyTimes(Command command, uint8_t response, uint16_t times)
     {
         for (auto i = 0; i < times; i++)
         {
+            auto selected = this->_spi.ExpectSelected();
+
             EXPECT_CALL(this->_spi, Write(CommandCall(command)));
             EXPECT_CALL(this->_spi, Read(SpanOfSize(1))).WillOnce(DoAll(FillBuffer<0>(response), Return(OSResult::Success)));
         }
@@ -129,9 +132,10 @@ class N25QDriverTest : public Test
 
     void ExpectWaitBusy(uint16_t busyCycles)
     {
-        auto selected = this->_spi.ExpectSelected();
+        ExpectSelectedCommandAndRespondManyTimes(
+            Command::ReadStatusRegister, num(Status::WriteEnabled | Status::WriteInProgress), busyCycles);
 
-        ExpectCommandAndRespondManyTimes(Command::ReadStatusRegister, num(Status::WriteEnabled | Status::WriteInProgress), busyCycles);
+        auto selected = this->_spi.ExpectSelected();
 
         ExpectCommandAndRespondOnce(Command::ReadStatusRegister, Status::WriteDisabled);
     }
@@ -327,6 +331,36 @@ TEST_F(N25QDriverTest, ReadRequestShouldBePropertlyFormed)
     ASSERT_THAT(_error_counter, Eq(0));
 }
 
+TEST_F(N25QDriverTest, ShouldSplitLongReadIntoBoundedParts)
+{
+    const uint32_t address = 0xAB0000;
+
+    {
+        InSequence s;
+
+        {
+            auto selected = this->_spi.ExpectSelected();
+
+            EXPECT_CALL(this->_spi, Write(ElementsAre(Command::ReadMemory, 0xAB, 0x00, 0x00)));
+            EXPECT_CALL(this->_spi, Read(SpanOfSize(N25QDriver::MaxReadLength)));
+        }
+
+        {
+            auto selected = this->_spi.ExpectSelected();
+
+            EXPECT_CALL(this->_spi, Write(ElementsAre(Command::ReadMemory, 0xAB, 0x08, 0x00)));
+            EXPECT_CALL(this->_spi, Read(SpanOfSize(100)));
+        }
+    }
+
+    std::vector<uint8_t> buffer(N25QDriver::MaxReadLength + 100);
+
+    auto r = this->_driver.ReadMemory(address, buffer);
+
+    ASSERT_THAT(r, Eq(OSResult::Success));
+    ASSERT_THAT(_error_counter, Eq(0));
+}
+
 TEST_F(N25QDriverTest, ShouldRetryReadOnTimeout)
 {
     const uint32_t address = 0xAB0000;
@@ -583,19 +617,23 @@ TEST_F(N25QDriverTest, ShouldDetectEraseSubsectorTimeout)
             EXPECT_CALL(this->_spi, Write(ElementsAre(0xCD, 0x00, 0x00)));
         }
 
+        EXPECT_CALL(this->_os, GetUptime()).WillRepeatedly(Return(0ms));
+
         {
             auto selected = this->_spi.ExpectSelected();
 
-            EXPECT_CALL(this->_os, GetUptime()).WillRepeatedly(Return(0ms));
-
             ExpectCommandAndRespondOnce(Command::ReadStatusRegister, Status::WriteEnabled | Status::WriteInProgress);
+        }
 
-            EXPECT_CALL(this->_os, GetUptime()).WillRepeatedly(Return(0ms));
+        EXPECT_CALL(this->_os, GetUptime()).WillRepeatedly(Return(0ms));
 
-            ExpectCommandAndRespondOnce(Command::ReadStatusRegister, Status::WriteEnabled | Status::WriteInProgress);
+        {
+            auto selected = this->_spi.ExpectSelected();
 
-            EXPECT_CALL(this->_os, GetUptime()).WillRepeatedly(Return(std::chrono::milliseconds(std::numeric_limits<uint32_t>::max())));
+            ExpectCommandAndRespondOnce(Command::ReadStatusRegister, Status::WriteEnabled | Status::WriteInProgress);
         }
+
+        EXPECT_CALL(this->_os, GetUptime()).WillRepeatedly(Return(std::chrono::milliseconds(std::numeric_limits<uint32_t>::max())));
     }
 
     auto result = this->_driver.BeginEraseSubSector(address).Wait();
@@ -703,19 +741,23 @@ TEST_F(N25QDriverTest, ShouldDetectEraseSectorTimeout)
             EXPECT_CALL(this->_spi, Write(ElementsAre(0xCD, 0x00, 0x00)));
         }
 
+        EXPECT_CALL(this->_os, GetUptime()).WillRepeatedly(Return(0ms));
+
         {
             auto selected = this->_spi.ExpectSelected();
 
-            EXPECT_CALL(this->_os, GetUptime()).WillRepeatedly(Return(0ms));
-
             ExpectCommandAndRespondOnce(Command::ReadStatusRegister, Status::WriteEnabled | Status::WriteInProgress);
+        }
 
-            EXPECT_CALL(this->_os, GetUptime()).WillRepeatedly(Return(0ms));
+        EXPECT_CALL(this->_os, GetUptime()).WillRepeatedly(Return(0ms));
 
-            ExpectCommandAndRespondOnce(Command::ReadStatusRegister, Status::WriteEnabled | Status::WriteInProgress);
+        {
+            auto selected = this->_spi.ExpectSelected();
 
-            EXPECT_CALL(this->_os, GetUptime()).WillRepeatedly(Return(std::chrono::milliseconds(std::numeric_limits<uint32_t>::max())));
+            ExpectCommandAndRespondOnce(Command::ReadStatusRegister, Status::WriteEnabled | Status::WriteInProgress);
         }
+
+        EXPECT_CALL(this->_os, GetUptime()).WillRepeatedly(Return(std::chrono::milliseconds(std::numeric_limits<uint32_t>::max())));
     }
 
     auto result = this->_driver.BeginEraseSector(address).Wait();
@@ -811,19 +853,23 @@ TEST_F(N25QDriverTest, EraseChipOperationWillTimeout)
             ExpectCommand(Command::EraseChip);
         }
 
+        EXPECT_CALL(this->_os, GetUptime()).WillRepeatedly(Return(0ms));
+
         {
             auto selected = this->_spi.ExpectSelected();
 
-            EXPECT_CALL(this->_os, GetUptime()).WillRepeatedly(Return(0ms));
-
             ExpectCommandAndRespondOnce(Command::ReadStatusRegister, Status::WriteEnabled | Status::WriteInProgress);
+        }
 
-            EXPECT_CALL(this->_os, GetUptime()).WillRepeatedly(Return(0ms));
+        EXPECT_CALL(this->_os, GetUptime()).WillRepeatedly(Return(0ms));
 
-            ExpectCommandAndRespondOnce(Command::ReadStatusRegister, Status::WriteEnabled | Status::WriteInProgress);
+        {
+            auto selected = this->_spi.ExpectSelected();
 
-            EXPECT_CALL(this->_os, GetUptime()).WillRepeatedly(Return(std::chrono::milliseconds(std::numeric_limits<uint32_t>::max())));
+            ExpectCommandAndRespondOnce(Command::ReadStatusRegister, Status::WriteEnabled | Status::WriteInProgress);
         }
+
+        EXPECT_CALL(this->_os, GetUptime()).WillRepeatedly(Return(std::chrono::milliseconds(std::numeric_limits<uint32_t>::max())));
     }
 
     auto result = this->_driver.BeginEraseChip().Wait();
@@ -922,19 +968,23 @@ TEST_F(N25QDriverTest, SettingProtectionOnResetCanTimeout)
             EXPECT_CALL(this->_spi, Write(ElementsAre(0x20)));
         }
 
+        EXPECT_CALL(this->_os, GetUptime()).WillRepeatedly(Return(0ms));
+
         {
             auto selected = this->_spi.ExpectSelected();
 
-            EXPECT_CALL(this->_os, GetUptime()).WillRepeatedly(Return(0ms));
-
             ExpectCommandAndRespondOnce(Command::ReadStatusRegister, Status::WriteEnabled | Status::WriteInProgress);
+        }
 
-            EXPECT_CALL(this->_os, GetUptime()).WillRepeatedly(Return(0ms));
+        EXPECT_CALL(this->_os, GetUptime()).WillRepeatedly(Return(0ms));
 
-            ExpectCommandAndRespondOnce(Command::ReadStatusRegister, Status::WriteEnabled | Status::WriteInProgress);
+        {
+            auto selected = this->_spi.ExpectSelected();
 
-            EXPECT_CALL(this->_os, GetUptime()).WillRepeatedly(Return(std::chrono::milliseconds(std::numeric_limits<uint32_t>::max())));
+            ExpectCommandAndRespondOnce(Command::ReadStatusRegister, Status::WriteEnabled | Status::WriteInProgress);
         }
+
+        EXPECT_CALL(this->_os, GetUptime()).WillRepeatedly(Return(std::chrono::milliseconds(std::numeric_limits<uint32_t>::max())));
     }
 
     auto result = this->_driver.Reset();
@@ -32,6 +32,7 @@ using testing::Invoke;
 using testing::ElementsAre;
 using testing::PrintToString;
 using testing::InSequence;
+using testing::Sequence;
 using testing::WithArg;
 using testing::Return;
 using testing::ByMove;
@@ -65,6 +66,14 @@ class RedundantN25QDriverTest : public Test
         EXPECT_CALL(_n25qDriver[2], WaitForOperation(1ms, FlagStatus::EraseError));
     }
 
+    void ExpectChipsIdle()
+    {
+        for (auto& driver : _n25qDriver)
+        {
+            EXPECT_CALL(driver, IsBusy()).WillRepeatedly(Return(false));
+        }
+    }
+
     testing::NiceMock<ErrorCountingConfigrationMock> _errorsConfig;
     error_counter::ErrorCounting _errors;
     error_counter::ErrorCounter<RedundantN25QDriver::ErrorCounter::DeviceId> _error_counter;
@@ -140,6 +149,8 @@ TEST_F(RedundantN25QDriverTest, ShouldWriteSinglePageMemory)
 
     size_t address = 0x0F;
 
+    ExpectChipsIdle();
+
     InSequence s;
 
     EXPECT_CALL(_n25qDriver[0], BeginWritePage(address, 0, span<const uint8_t>(buffer)))
@@ -235,20 +246,21 @@ TEST_F(RedundantN25QDriverTest, ShouldWriteMultiPageMemory)
 
     size_t address = 0x0F;
 
-    InSequence s;
+    ExpectChipsIdle();
+
+    Sequence chips[3];
 
     for (uint8_t i = 0; i < pageCount; ++i)
     {
         auto pageBuffer = span<const uint8_t>(buffer).subspan(i * pageSize, pageSize);
 
-        EXPECT_CALL(_n25qDriver[0], BeginWritePage(address, i * pageSize, pageBuffer))
-            .WillOnce(Return(ByMove(MakeWaiter(&_n25qDriver[0]))));
-        EXPECT_CALL(_n25qDriver[1], BeginWritePage(address, i * pageSize, pageBuffer))
-            .WillOnce(Return(ByMove(MakeWaiter(&_n25qDriver[1]))));
-        EXPECT_CALL(_n25qDriver[2], BeginWritePage(address, i * pageSize, pageBuffer))
-            .WillOnce(Return(ByMove(MakeWaiter(&_n25qDriver[2]))));
-
-        ExpectAllWaiters();
+        for (uint8_t chip = 0; chip < 3; chip++)
+        {
+            EXPECT_CALL(_n25qDriver[chip], BeginWritePage(address, i * pageSize, pageBuffer))
+                .InSequence(chips[chip])
+                .WillOnce(Return(ByMove(MakeWaiter(&_n25qDriver[chip]))));
+            EXPECT_CALL(_n25qDriver[chip], WaitForOperation(1ms, FlagStatus::EraseError)).InSequence(chips[chip]);
+        }
     }
 
     _driver.WriteMemory(address, buffer);
@@ -256,6 +268,113 @@ TEST_F(RedundantN25QDriverTest, ShouldWriteMultiPageMemory)
     ASSERT_THAT(_error_counter, Eq(0));
 }
 
+TEST_F(RedundantN25QDriverTest, ShouldKeepWritingOnFastChipsWhileSlowChipIsBusy)
+{
+    constexpr size_t pageSize = 256;
+
+    array<uint8_t, 2 * pageSize> buffer;
+    buffer.fill(0xCC);
+
+    auto page0 = span<const uint8_t>(buffer).subspan(0, pageSize);
+    auto page1 = span<const uint8_t>(buffer).subspan(pageSize, pageSize);
+
+    EXPECT_CALL(_n25qDriver[0], IsBusy()).WillRepeatedly(Return(false));
+    EXPECT_CALL(_n25qDriver[1], IsBusy()).WillRepeatedly(Return(false));
+    EXPECT_CALL(_n25qDriver[2], IsBusy()).WillOnce(Return(true)).WillOnce(Return(true)).WillRepeatedly(Return(false));
+
+    Sequence fast1, fast2;
+
+    EXPECT_CALL(_n25qDriver[0], BeginWritePage(0, 0, page0)).WillOnce(Return(ByMove(MakeWaiter(&_n25qDriver[0]))));
+    EXPECT_CALL(_n25qDriver[1], BeginWritePage(0, 0, page0)).WillOnce(Return(ByMove(MakeWaiter(&_n25qDriver[1]))));
+    EXPECT_CALL(_n25qDriver[2], BeginWritePage(0, 0, page0)).WillOnce(Return(ByMove(MakeWaiter(&_n25qDriver[2]))));
+
+    EXPECT_CALL(_n25qDriver[0], BeginWritePage(0, pageSize, page1))
+        .InSequence(fast1)
+        .WillOnce(Return(ByMove(MakeWaiter(&_n25qDriver[0]))));
+    EXPECT_CALL(_n25qDriver[1], BeginWritePage(0, pageSize, page1))
+        .InSequence(fast2)
+        .WillOnce(Return(ByMove(MakeWaiter(&_n25qDriver[1]))));
+    EXPECT_CALL(_n25qDriver[2], BeginWritePage(0, pageSize, page1))
+        .InSequence(fast1, fast2)
+        .WillOnce(Return(ByMove(MakeWaiter(&_n25qDriver[2]))));
+
+    EXPECT_CALL(_n25qDriver[0], WaitForOperation(1ms, FlagStatus::EraseError)).Times(2);
+    EXPECT_CALL(_n25qDriver[1], WaitForOperation(1ms, FlagStatus::EraseError)).Times(2);
+    EXPECT_CALL(_n25qDriver[2], WaitForOperation(1ms, FlagStatus::EraseError)).Times(1);
+
+    auto r = _driver.WriteMemory(0, buffer);
+
+    ASSERT_THAT(r, Eq(OperationResult::Success));
+    ASSERT_THAT(_error_counter, Eq(0));
+
+    testing::Mock::VerifyAndClearExpectations(&_n25qDriver[2]);
+
+    EXPECT_CALL(_n25qDriver[2], WaitForOperation(1ms, FlagStatus::EraseError));
+}
+
+TEST_F(RedundantN25QDriverTest, ShouldVerifyLaggingChipWriteOnNextOperation)
+{
+    array<uint8_t, 256> buffer;
+    buffer.fill(0xCC);
+
+    EXPECT_CALL(_n25qDriver[0], IsBusy()).WillRepeatedly(Return(false));
+    EXPECT_CALL(_n25qDriver[1], IsBusy()).WillRepeatedly(Return(false));
+    EXPECT_CALL(_n25qDriver[2], IsBusy()).WillRepeatedly(Return(true));
+
+    for (auto& driver : _n25qDriver)
+    {
+        EXPECT_CALL(driver, BeginWritePage(0, 0, span<const uint8_t>(buffer))).WillOnce(Return(ByMove(MakeWaiter(&driver))));
+    }
+
+    EXPECT_CALL(_n25qDriver[0], WaitForOperation(1ms, FlagStatus::EraseError));
+    EXPECT_CALL(_n25qDriver[1], WaitForOperation(1ms, FlagStatus::EraseError));
+
+    auto r = _driver.WriteMemory(0, buffer);
+
+    ASSERT_THAT(r, Eq(OperationResult::Success));
+    ASSERT_THAT(_error_counter, Eq(0));
+
+    {
+        InSequence s;
+
+        EXPECT_CALL(_n25qDriver[2], WaitForOperation(1ms, FlagStatus::EraseError)).WillOnce(Return(OperationResult::Failure));
+        EXPECT_CALL(_n25qDriver[0], Reset()).WillOnce(Return(OperationResult::Success));
+        EXPECT_CALL(_n25qDriver[1], Reset()).WillOnce(Return(OperationResult::Success));
+        EXPECT_CALL(_n25qDriver[2], Reset()).WillOnce(Return(OperationResult::Success));
+    }
+
+    _driver.Reset();
+
+    ASSERT_THAT(_error_counter, Eq(3));
+}
+
+TEST_F(RedundantN25QDriverTest, ShouldFailWriteWhenTwoChipsFail)
+{
+    constexpr size_t pageSize = 256;
+
+    array<uint8_t, 2 * pageSize> buffer;
+    buffer.fill(0xCC);
+
+    ExpectChipsIdle();
+
+    auto page0 = span<const uint8_t>(buffer).subspan(0, pageSize);
+
+    for (auto& driver : _n25qDriver)
+    {
+        EXPECT_CALL(driver, BeginWritePage(0, 0, page0)).WillOnce(Return(ByMove(MakeWaiter(&driver))));
+    }
+
+    EXPECT_CALL(_n25qDriver[0], WaitForOperation(1ms, FlagStatus::EraseError)).WillOnce(Return(OperationResult::Timeout));
+    EXPECT_CALL(_n25qDriver[1], WaitForOperation(1ms, FlagStatus::EraseError)).WillOnce(Return(OperationResult::Timeout));
+    EXPECT_CALL(_n25qDriver[2], BeginWritePage(0, pageSize, _)).WillOnce(Return(ByMove(MakeWaiter(&_n25qDriver[2]))));
+    EXPECT_CALL(_n25qDriver[2], WaitForOperation(1ms, FlagStatus::EraseError)).Times(2);
+
+    auto r = _driver.WriteMemory(0, buffer);
+
+    ASSERT_THAT(r, Eq(OperationResult::Timeout));
+    ASSERT_THAT(_error_counter, Eq(5));
+}
+
 TEST_F(RedundantN25QDriverTest, ShouldPropagateReadMemoryTimeout)
 {
     array<uint8_t, 256> buffer1;
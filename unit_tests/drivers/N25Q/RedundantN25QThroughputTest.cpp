@@ -0,0 +1,237 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <random>
+
+#include <gsl/span>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "n25q/n25q.h"
+
+#include "mock/error_counter.hpp"
+
+using std::array;
+using std::uint8_t;
+using gsl::span;
+
+using testing::Eq;
+using testing::Gt;
+using testing::NiceMock;
+
+using namespace devices::n25q;
+using namespace std::chrono_literals;
+
+namespace
+{
+    using Microseconds = std::chrono::duration<std::uint64_t, std::micro>;
+
+    /**
+     * @brief Time shared by all chips connected to the same SPI bus
+     *
+     * Every command occupies the bus, so it advances time regardless of chip it was sent to.
+     */
+    struct SimulatedBus
+    {
+        /** @brief Time occupied by transfer of single byte (8MHz SPI clock) */
+        static constexpr Microseconds ByteTime = Microseconds(1);
+        /** @brief Overhead of single command (slave selection, DMA setup) */
+        static constexpr Microseconds CommandOverhead = Microseconds(10);
+
+        void Transfer(std::size_t bytes)
+        {
+            Now += CommandOverhead + bytes * ByteTime;
+        }
+
+        Microseconds Now{0};
+    };
+
+    constexpr Microseconds SimulatedBus::ByteTime;
+    constexpr Microseconds SimulatedBus::CommandOverhead;
+
+    /**
+     * @brief N25Q fake following datasheet timings
+     *
+     * Page program time (tPP) varies between 0.5ms (typical) and 1.5ms, subsector erase time (tSSE) between
+     * 250ms and 800ms and sector erase time (tSE) between 0.7s and 3s. Each chip draws its timings from its own
+     * pseudo-random sequence, so chips finish the same operation at different moments.
+     */
+    class SimulatedN25Q : public IN25QDriver
+    {
+      public:
+        SimulatedN25Q(SimulatedBus& bus, std::uint32_t seed) : _bus(bus), _random(seed), _busyUntil(0)
+        {
+        }
+
+        virtual OSResult ReadMemory(std::size_t /*address*/, gsl::span<uint8_t> buffer) override
+        {
+            _bus.Transfer(4 + buffer.size());
+            std::fill(buffer.begin(), buffer.end(), 0xFF);
+            return OSResult::Success;
+        }
+
+        virtual OperationWaiter BeginWritePage(size_t /*address*/, ptrdiff_t /*offset*/, gsl::span<const uint8_t> page) override
+        {
+            // write enable + page program
+            _bus.Transfer(1);
+            _bus.Transfer(4 + page.size());
+
+            Start(Microseconds(500), Microseconds(1500));
+            return OperationWaiter(this, 5ms, FlagStatus::ProgramError);
+        }
+
+        virtual OperationWaiter BeginEraseSubSector(size_t /*address*/) override
+        {
+            _bus.Transfer(1);
+            _bus.Transfer(4);
+
+            Start(250ms, 800ms);
+            return OperationWaiter(this, 800ms, FlagStatus::EraseError);
+        }
+
+        virtual OperationWaiter BeginEraseSector(size_t /*address*/) override
+        {
+            _bus.Transfer(1);
+            _bus.Transfer(4);
+
+            Start(700ms, 3000ms);
+            return OperationWaiter(this, 3000ms, FlagStatus::EraseError);
+        }
+
+        virtual OperationWaiter BeginEraseChip() override
+        {
+            _bus.Transfer(1);
+            _bus.Transfer(1);
+
+            Start(60s, 240s);
+            return OperationWaiter(this, 240s, FlagStatus::EraseError);
+        }
+
+        virtual OperationResult Reset() override
+        {
+            _bus.Transfer(1);
+            _bus.Transfer(1);
+            return OperationResult::Success;
+        }
+
+        virtual OperationResult WaitForOperation(std::chrono::milliseconds /*timeout*/, FlagStatus /*status*/) override
+        {
+            // status register is polled until write finishes, then flag status is read once
+            _bus.Now = std::max(_bus.Now, _busyUntil);
+            _bus.Transfer(2);
+            _bus.Transfer(2);
+
+            return OperationResult::Success;
+        }
+
+        virtual bool IsBusy() override
+        {
+            _bus.Transfer(2);
+            return _bus.Now < _busyUntil;
+        }
+
+      private:
+        void Start(Microseconds minimum, Microseconds maximum)
+        {
+            std::uniform_int_distribution<std::uint64_t> duration(minimum.count(), maximum.count());
+            _busyUntil = _bus.Now + Microseconds(duration(_random));
+        }
+
+        SimulatedBus& _bus;
+        std::minstd_rand _random;
+        Microseconds _busyUntil;
+    };
+
+    class RedundantN25QThroughputTest : public testing::Test
+    {
+      public:
+        RedundantN25QThroughputTest()
+            : _errors{_errorsConfig},                     //
+              _errorCounter{_errors},                     //
+              _flash{{{_bus, 1}, {_bus, 2}, {_bus, 3}}}, //
+              _driver{_errors, {&_flash[0], &_flash[1], &_flash[2]}}
+        {
+        }
+
+      protected:
+        /**
+         * @brief Writes buffer page by page waiting for all chips after each page, as done before writes were pipelined
+         * @param[in] buffer Data to write
+         */
+        void WriteLockStep(span<const uint8_t> buffer);
+
+        /** @brief Size of data written in single benchmark run (one 64KB sector) */
+        static constexpr std::ptrdiff_t SectorSize = 64 * 1024;
+        /** @brief Size of single write request (YAFFS chunk) */
+        static constexpr std::ptrdiff_t ChunkSize = 2048;
+
+        NiceMock<ErrorCountingConfigrationMock> _errorsConfig;
+        error_counter::ErrorCounting _errors;
+        error_counter::ErrorCounter<RedundantN25QDriver::ErrorCounter::DeviceId> _errorCounter;
+
+        SimulatedBus _bus;
+        array<SimulatedN25Q, 3> _flash;
+        RedundantN25QDriver _driver;
+    };
+
+    constexpr std::ptrdiff_t RedundantN25QThroughputTest::SectorSize;
+    constexpr std::ptrdiff_t RedundantN25QThroughputTest::ChunkSize;
+
+    void RedundantN25QThroughputTest::WriteLockStep(span<const uint8_t> buffer)
+    {
+        for (std::ptrdiff_t offset = 0; offset < buffer.size(); offset += N25QDriver::PageSize)
+        {
+            auto page = buffer.subspan(offset, std::min(N25QDriver::PageSize, buffer.size() - offset));
+
+            auto w1 = _flash[0].BeginWritePage(0, offset, page);
+            auto w2 = _flash[1].BeginWritePage(0, offset, page);
+            auto w3 = _flash[2].BeginWritePage(0, offset, page);
+
+            w1.Wait();
+            w2.Wait();
+            w3.Wait();
+        }
+    }
+
+    /** @brief Converts amount of data written in given time to bytes per second */
+    std::uint64_t Throughput(std::ptrdiff_t bytes, Microseconds time)
+    {
+        return static_cast<std::uint64_t>(bytes) * 1000000 / time.count();
+    }
+
+    TEST_F(RedundantN25QThroughputTest, PipelinedWriteShouldOutperformLockStepWrite)
+    {
+        array<uint8_t, ChunkSize> chunk;
+        chunk.fill(0xA5);
+
+        ASSERT_THAT(_driver.EraseSector(0), Eq(OperationResult::Success));
+
+        auto start = _bus.Now;
+        for (std::ptrdiff_t offset = 0; offset < SectorSize; offset += ChunkSize)
+        {
+            WriteLockStep(chunk);
+        }
+        const auto lockStepTime = _bus.Now - start;
+
+        ASSERT_THAT(_driver.EraseSector(0), Eq(OperationResult::Success));
+
+        start = _bus.Now;
+        for (std::ptrdiff_t offset = 0; offset < SectorSize; offset += ChunkSize)
+        {
+            ASSERT_THAT(_driver.WriteMemory(offset, chunk), Eq(OperationResult::Success));
+        }
+        // last chunk is not complete until lagging chip is verified
+        _driver.Reset();
+        const auto pipelinedTime = _bus.Now - start;
+
+        const auto lockStepThroughput = Throughput(SectorSize, lockStepTime);
+        const auto pipelinedThroughput = Throughput(SectorSize, pipelinedTime);
+
+        RecordProperty("LockStepBytesPerSecond", static_cast<int>(lockStepThroughput));
+        RecordProperty("PipelinedBytesPerSecond", static_cast<int>(pipelinedThroughput));
+
+        ASSERT_THAT(pipelinedThroughput * 100, Gt(lockStepThroughput * 115));
+        ASSERT_THAT(_errorCounter, Eq(0));
+    }
+}
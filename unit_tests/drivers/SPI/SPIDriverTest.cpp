@@ -1,4 +1,5 @@
 #include <array>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -19,8 +20,12 @@ using testing::SetArgPointee;
 using testing::Return;
 using testing::InSequence;
 using testing::ReturnArg;
+using testing::Invoke;
+using testing::Ne;
 
 using drivers::spi::EFMSPIInterface;
+using drivers::spi::SPIPriority;
+using drivers::spi::SPITransfer;
 namespace
 {
     class SPIDriverTest : public Test
@@ -263,4 +268,167 @@ namespace
 
         ASSERT_THAT(r, Eq(OSResult::Timeout));
     }
+
+    TEST_F(SPIDriverTest, ShouldChainTransactionTransfers)
+    {
+        std::array<uint8_t, 4> command{1, 2, 3, 4};
+        std::array<uint8_t, 10> data;
+
+        std::vector<DMA_CfgDescrSGAlt_TypeDef> descriptors;
+
+        {
+            InSequence s;
+
+            EXPECT_CALL(this->_dma, AllocateChannel(_, nullptr)).WillOnce(DoAll(SetArgPointee<0>(1), Return(ECODE_EMDRV_DMADRV_OK)));
+            EXPECT_CALL(this->_dma, AllocateChannel(_, nullptr)).WillOnce(DoAll(SetArgPointee<0>(2), Return(ECODE_EMDRV_DMADRV_OK)));
+
+            EXPECT_CALL(this->_dma, CfgDescrScatterGather(_, 0, _))
+                .Times(2)
+                .WillRepeatedly(Invoke([&descriptors](DMA_DESCRIPTOR_TypeDef*, unsigned int, DMA_CfgDescrSGAlt_TypeDef* cfg) {
+                    descriptors.push_back(*cfg);
+                }));
+            EXPECT_CALL(this->_dma, CfgDescrScatterGather(_, 1, _))
+                .Times(2)
+                .WillRepeatedly(Invoke([&descriptors](DMA_DESCRIPTOR_TypeDef*, unsigned int, DMA_CfgDescrSGAlt_TypeDef* cfg) {
+                    descriptors.push_back(*cfg);
+                }));
+
+            EXPECT_CALL(this->_usart, Command(io_map::SPI::Peripheral, USART_CMD_CLEARRX));
+            EXPECT_CALL(this->_usart, Command(io_map::SPI::Peripheral, USART_CMD_CLEARTX));
+            EXPECT_CALL(this->_usart, IntClear(io_map::SPI::Peripheral, _));
+
+            EXPECT_CALL(this->_dma, CfgChannel(1, _));
+            EXPECT_CALL(this->_dma, CfgChannel(2, _));
+            EXPECT_CALL(this->_dma, ActivateScatterGather(1, false, _, 2));
+            EXPECT_CALL(this->_dma, ActivateScatterGather(2, false, _, 2));
+        }
+
+        EFMSPIInterface spi;
+
+        spi.Initialize();
+
+        const SPITransfer transfers[] = {SPITransfer::Write(command), SPITransfer::Read(data)};
+
+        ASSERT_THAT(spi.Transaction(transfers), Eq(OSResult::Success));
+
+        ASSERT_THAT(descriptors.size(), Eq(4U));
+
+        ASSERT_THAT(descriptors[0].src, Eq(command.data()));
+        ASSERT_THAT(descriptors[0].srcInc, Eq(dmaDataInc1));
+        ASSERT_THAT(descriptors[0].nMinus1, Eq(3));
+        ASSERT_THAT(descriptors[1].dstInc, Eq(dmaDataIncNone));
+        ASSERT_THAT(descriptors[1].nMinus1, Eq(3));
+
+        ASSERT_THAT(descriptors[2].srcInc, Eq(dmaDataIncNone));
+        ASSERT_THAT(descriptors[2].nMinus1, Eq(9));
+        ASSERT_THAT(descriptors[3].dst, Eq(data.data()));
+        ASSERT_THAT(descriptors[3].dstInc, Eq(dmaDataInc1));
+        ASSERT_THAT(descriptors[3].nMinus1, Eq(9));
+    }
+
+    TEST_F(SPIDriverTest, ShouldStreamLongTransactionThroughAlternateChains)
+    {
+        std::array<uint8_t, 4> command;
+        std::vector<uint8_t> data(9000);
+
+        std::vector<DMA_DESCRIPTOR_TypeDef*> chains;
+
+        ON_CALL(this->_dma, AllocateChannel(_, nullptr)).WillByDefault(DoAll(SetArgPointee<0>(1), Return(ECODE_EMDRV_DMADRV_OK)));
+        EXPECT_CALL(this->_dma, CfgDescrScatterGather(_, _, _)).Times(2 * 10);
+
+        {
+            InSequence s;
+
+            EXPECT_CALL(this->_dma, ActivateScatterGather(_, false, _, 8))
+                .Times(2)
+                .WillRepeatedly(
+                    Invoke([&chains](unsigned int, bool, DMA_DESCRIPTOR_TypeDef* descriptors, unsigned int) { chains.push_back(descriptors); }));
+            EXPECT_CALL(this->_dma, ActivateScatterGather(_, false, _, 2))
+                .Times(2)
+                .WillRepeatedly(
+                    Invoke([&chains](unsigned int, bool, DMA_DESCRIPTOR_TypeDef* descriptors, unsigned int) { chains.push_back(descriptors); }));
+        }
+
+        EFMSPIInterface spi;
+
+        spi.Initialize();
+
+        const SPITransfer transfers[] = {SPITransfer::Write(command), SPITransfer::Read(data)};
+
+        ASSERT_THAT(spi.Transaction(transfers), Eq(OSResult::Success));
+
+        ASSERT_THAT(chains.size(), Eq(4U));
+        ASSERT_THAT(chains[0], Ne(chains[2]));
+        ASSERT_THAT(chains[1], Ne(chains[3]));
+    }
+
+    TEST_F(SPIDriverTest, ShouldReturnTimeoutOnDMATimeoutInTransaction)
+    {
+        std::array<uint8_t, 4> command;
+        std::vector<uint8_t> data(9000);
+
+        ON_CALL(this->_dma, AllocateChannel(_, nullptr)).WillByDefault(DoAll(SetArgPointee<0>(1), Return(ECODE_EMDRV_DMADRV_OK)));
+
+        EXPECT_CALL(this->_dma, ActivateScatterGather(_, _, _, _)).Times(2);
+        EXPECT_CALL(this->_os, EventGroupWaitForBits(_, _, _, _, _)).WillOnce(Return(0));
+
+        EFMSPIInterface spi;
+
+        spi.Initialize();
+
+        const SPITransfer transfers[] = {SPITransfer::Write(command), SPITransfer::Read(data)};
+
+        ASSERT_THAT(spi.Transaction(transfers), Eq(OSResult::Timeout));
+    }
+
+    TEST_F(SPIDriverTest, CriticalLockShouldHoldOffBulkTransactionsWhileWaiting)
+    {
+        auto lock = reinterpret_cast<OSSemaphoreHandle>(1);
+        auto arbitrationLock = reinterpret_cast<OSSemaphoreHandle>(2);
+
+        EXPECT_CALL(this->_os, CreateBinarySemaphore(_)).WillOnce(Return(lock)).WillOnce(Return(arbitrationLock));
+
+        EFMSPIInterface spi;
+
+        spi.Initialize();
+
+        {
+            InSequence s;
+
+            EXPECT_CALL(this->_os, TakeSemaphore(arbitrationLock, _));
+            EXPECT_CALL(this->_os, EventGroupClearBits(_, 1 << 2));
+            EXPECT_CALL(this->_os, GiveSemaphore(arbitrationLock));
+
+            EXPECT_CALL(this->_os, TakeSemaphore(lock, _));
+
+            EXPECT_CALL(this->_os, TakeSemaphore(arbitrationLock, _));
+            EXPECT_CALL(this->_os, EventGroupSetBits(_, 1 << 2));
+            EXPECT_CALL(this->_os, GiveSemaphore(arbitrationLock));
+        }
+
+        spi.Lock(SPIPriority::Critical);
+    }
+
+    TEST_F(SPIDriverTest, BulkLockShouldWaitUntilNoCriticalTransactionIsPending)
+    {
+        auto lock = reinterpret_cast<OSSemaphoreHandle>(1);
+        auto arbitrationLock = reinterpret_cast<OSSemaphoreHandle>(2);
+
+        EXPECT_CALL(this->_os, CreateBinarySemaphore(_)).WillOnce(Return(lock)).WillOnce(Return(arbitrationLock));
+
+        EFMSPIInterface spi;
+
+        spi.Initialize();
+
+        {
+            InSequence s;
+
+            EXPECT_CALL(this->_os, EventGroupWaitForBits(_, 1 << 2, true, false, _)).WillOnce(Return(1 << 2));
+            EXPECT_CALL(this->_os, TakeSemaphore(lock, _));
+        }
+
+        EXPECT_CALL(this->_os, TakeSemaphore(arbitrationLock, _)).Times(0);
+
+        spi.Lock(SPIPriority::Bulk);
+    }
 }
@@ -26,6 +26,7 @@ using testing::Ge;
 using testing::StrEq;
 using testing::Return;
 using testing::Invoke;
+using testing::ReturnPointee;
 using testing::Pointee;
 using testing::ElementsAre;
 using testing::Matches;
@@ -217,4 +218,89 @@ namespace
             EXPECT_EQ(value[i], 0);
         }
     }
+
+    TEST_F(ImtqUseTest, SplitPhaseMagnetometerMeasurementWaitsOnlyRemainingIntegrationTime)
+    {
+        std::chrono::milliseconds uptime = 100ms;
+        ON_CALL(os, GetUptime()).WillByDefault(ReturnPointee(&uptime));
+
+        EXPECT_CALL(i2c, Write(ImtqAddress, ElementsAre(0x03))).WillOnce(Return(I2CResult::OK));
+        EXPECT_CALL(i2c, Write(ImtqAddress, ElementsAre(0x04))).WillOnce(Return(I2CResult::OK));
+        EXPECT_CALL(i2c, Write(ImtqAddress, ElementsAre(0x43))).WillOnce(Return(I2CResult::OK));
+
+        EXPECT_CALL(i2c, Read(ImtqAddress, _))
+            .WillOnce(Invoke([=](uint8_t /*address*/, auto outData) {
+                outData[0] = 0x03;
+                outData[1] = 0x00;
+                return I2CResult::OK;
+            }))
+            .WillOnce(Invoke([=](uint8_t /*address*/, auto outData) {
+                outData[0] = 0x04;
+                outData[1] = 0x00;
+                return I2CResult::OK;
+            }))
+            .WillOnce(Invoke([=](uint8_t /*address*/, auto outData) {
+                EXPECT_EQ(outData.size(), 15);
+
+                outData[0] = 0x43;
+                for (int i = 1; i < 15; ++i)
+                {
+                    outData[i] = 0x00;
+                }
+                outData[6] = 0x05;
+                return I2CResult::OK;
+            }));
+
+        EXPECT_CALL(os, Sleep(10ms)).WillRepeatedly(Return());
+        EXPECT_CALL(os, Sleep(30ms)).Times(0);
+        EXPECT_CALL(os, Sleep(8ms)).WillOnce(Return());
+
+        MagnetometerMeasurementToken token;
+        ASSERT_TRUE(imtq.BeginMagnetometerMeasurement(token));
+        ASSERT_TRUE(token.Pending);
+        ASSERT_EQ(token.ReadyAt, 130ms);
+
+        uptime = 122ms;
+
+        Vector3<MagnetometerMeasurement> value = {1, 2, 3};
+        ASSERT_TRUE(imtq.EndMagnetometerMeasurement(token, value));
+        ASSERT_FALSE(token.Pending);
+        EXPECT_THAT(value, ElementsAre(0, 5, 0));
+    }
+
+    TEST_F(ImtqUseTest, SplitPhaseMagnetometerMeasurementDoesNotWaitAfterIntegrationFinished)
+    {
+        std::chrono::milliseconds uptime = 100ms;
+        ON_CALL(os, GetUptime()).WillByDefault(ReturnPointee(&uptime));
+
+        EXPECT_CALL(i2c, Write(ImtqAddress, ElementsAre(0x43))).WillOnce(Return(I2CResult::OK));
+        EXPECT_CALL(i2c, Read(ImtqAddress, _)).WillOnce(Invoke([=](uint8_t /*address*/, auto outData) {
+            outData[0] = 0x43;
+            for (int i = 1; i < 15; ++i)
+            {
+                outData[i] = 0x00;
+            }
+            return I2CResult::OK;
+        }));
+
+        EXPECT_CALL(os, Sleep(10ms)).WillRepeatedly(Return());
+        EXPECT_CALL(os, Sleep(Ne(10ms))).Times(0);
+
+        MagnetometerMeasurementToken token;
+        token.ReadyAt = 90ms;
+        token.Pending = true;
+
+        Vector3<MagnetometerMeasurement> value;
+        ASSERT_TRUE(imtq.EndMagnetometerMeasurement(token, value));
+    }
+
+    TEST_F(ImtqUseTest, EndMagnetometerMeasurementFailsWithoutPendingMeasurement)
+    {
+        EXPECT_CALL(i2c, Write(_, _)).Times(0);
+        EXPECT_CALL(i2c, Read(_, _)).Times(0);
+
+        MagnetometerMeasurementToken token;
+        Vector3<MagnetometerMeasurement> value;
+        ASSERT_FALSE(imtq.EndMagnetometerMeasurement(token, value));
+    }
 }
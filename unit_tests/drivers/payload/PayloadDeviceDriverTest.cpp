@@ -386,6 +386,49 @@ namespace
         ASSERT_THAT(result.voltages[4], Eq(0x0202u));
     }
 
+    TEST_F(PayloadDeviceDriverTest, SplitSunSRefMeasurementSuccessful)
+    {
+        EXPECT_CALL(driver, IsBusy()).WillOnce(Return(false));
+        EXPECT_CALL(driver, PayloadWrite(ElementsAre(0x80))).WillOnce(Return(OSResult::Success));
+        EXPECT_CALL(driver, WaitForData()).Times(0);
+
+        ASSERT_THAT(payload.BeginSunSRefMeasurement(), Eq(OSResult::Success));
+
+        testing::Mock::VerifyAndClearExpectations(&driver);
+
+        EXPECT_CALL(driver, WaitForData()).WillOnce(Return(OSResult::Success));
+        EXPECT_CALL(driver, PayloadRead(ElementsAre(1), _)).WillOnce(Invoke([=](span<const uint8_t> /*inData*/, span<uint8_t> outData) {
+            std::fill(outData.begin(), outData.end(), 0x02);
+            return OSResult::Success;
+        }));
+
+        PayloadTelemetry::SunsRef result;
+        ASSERT_THAT(payload.EndSunSRefMeasurement(result), Eq(OSResult::Success));
+
+        ASSERT_THAT(result.voltages[0], Eq(0x0202u));
+        ASSERT_THAT(result.voltages[4], Eq(0x0202u));
+    }
+
+    TEST_F(PayloadDeviceDriverTest, EndSunSRefMeasurementWithoutBegin)
+    {
+        EXPECT_CALL(driver, WaitForData()).Times(0);
+        EXPECT_CALL(driver, PayloadRead(_, _)).Times(0);
+
+        PayloadTelemetry::SunsRef result;
+        ASSERT_THAT(payload.EndSunSRefMeasurement(result), Eq(OSResult::InvalidOperation));
+    }
+
+    TEST_F(PayloadDeviceDriverTest, EndSunSRefMeasurementAfterBusyBegin)
+    {
+        EXPECT_CALL(driver, IsBusy()).WillOnce(Return(true));
+        EXPECT_CALL(driver, PayloadWrite(_)).Times(0);
+        EXPECT_CALL(driver, WaitForData()).Times(0);
+
+        PayloadTelemetry::SunsRef result;
+        ASSERT_THAT(payload.BeginSunSRefMeasurement(), Eq(OSResult::Busy));
+        ASSERT_THAT(payload.EndSunSRefMeasurement(result), Eq(OSResult::InvalidOperation));
+    }
+
     TEST_F(PayloadDeviceDriverTest, MeasureTemperaturesSuccessful)
     {
         EXPECT_CALL(driver, IsBusy()).WillOnce(Invoke([]() { return false; }));
@@ -6,6 +6,8 @@
 #include "mock/comm.hpp"
 #include "telemetry/state.hpp"
 
+using testing::ElementsAre;
+using testing::Invoke;
 using testing::Return;
 using testing::_;
 using namespace std::chrono_literals;
@@ -41,23 +43,20 @@ namespace
         _sender.RunOnce();
     }
 
-    TEST_F(BeaconSenderTest, ShouldSendPreviousBeaconAndWaitShortDelayOnFailureToGetTelemetry)
+    TEST_F(BeaconSenderTest, ShouldSendLatestPublishedTelemetry)
     {
-        EXPECT_CALL(_os, Sleep(60000ms));
-        EXPECT_CALL(_transmitter, SendFrame(_)).WillOnce(Return(true));
-        _sender.RunOnce();
+        std::array<std::uint8_t, 4> first{0x11, 0x22, 0x33, 0x44};
+        std::array<std::uint8_t, 4> second{0x55, 0x66, 0x77, 0x88};
 
-        EXPECT_CALL(_os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Timeout));
-        EXPECT_CALL(_os, Sleep(5000ms));
-        EXPECT_CALL(_transmitter, SendFrame(_)).WillOnce(Return(true));
-        _sender.RunOnce();
-    }
+        _telemetry.lastSerializedTelemetry.Publish(first);
+        _telemetry.lastSerializedTelemetry.Publish(second);
+
+        EXPECT_CALL(_os, Sleep(60000ms));
+        EXPECT_CALL(_transmitter, SendFrame(_)).WillOnce(Invoke([](gsl::span<const std::uint8_t> frame) {
+            EXPECT_THAT(frame.subspan(0, 5), ElementsAre(telecommunication::downlink::BeaconMarker, 0x55, 0x66, 0x77, 0x88));
+            return true;
+        }));
 
-    TEST_F(BeaconSenderTest, ShouldNotSendEmptyFrameAndShouldWaitShortDelayOnFailureToGetTelemetry)
-    {
-        EXPECT_CALL(_os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Timeout));
-        EXPECT_CALL(_os, Sleep(5000ms));
-        EXPECT_CALL(_transmitter, SendFrame(_)).Times(0);
         _sender.RunOnce();
     }
 
@@ -1,6 +1,7 @@
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 #include "OsMock.hpp"
+#include "base/reader.h"
 #include "experiment/adcs/adcs.hpp"
 #include "experiment/adcs/data_point.hpp"
 #include "mock/AdcsMocks.hpp"
@@ -27,6 +28,8 @@ using experiments::StartResult;
 using namespace std::chrono_literals;
 using devices::gyro::GyroscopeTelemetry;
 using devices::payload::PayloadTelemetry;
+using experiments::fs::ExperimentFile;
+using PID = experiments::fs::ExperimentFile::PID;
 using namespace std::chrono_literals;
 
 struct ImtqDataProviderMock : telemetry::IImtqDataProvider
@@ -55,8 +58,30 @@ namespace
         DetumblingExperiment _exp;
 
         std::array<std::uint8_t, 1024> _dataBuffer;
+
+        /**
+         * @brief Writes single data point to experiment file backed by @ref _dataBuffer
+         * @param deltaRecords Delta records format selector
+         */
+        void WriteDataPoint(bool deltaRecords);
     };
 
+    void DetumblingExperimentTest::WriteDataPoint(bool deltaRecords)
+    {
+        DetumblingDataPoint point;
+        point.Timestamp = 10ms;
+        point.Gyro = GyroscopeTelemetry(1, 2, 3, 4);
+        point.Magnetometer = telemetry::ImtqMagnetometerMeasurements(std::array<devices::imtq::MagnetometerMeasurement, 3>{-5, 6, 7});
+        point.Dipoles = telemetry::ImtqDipoles(std::array<devices::imtq::Dipole, 3>{8, -9, 10});
+
+        ExperimentFile file;
+        file.Open(this->_fs, "/detum", services::fs::FileOpen::CreateAlways, services::fs::FileAccess::WriteOnly);
+
+        point.WriteTo(file, deltaRecords);
+
+        file.Close();
+    }
+
     DetumblingExperimentTest::DetumblingExperimentTest()
         : _exp(this->_adcs, this->_time, this->_power, this->_gyro, this->_payload, this->_imtq, this->_fs)
     {
@@ -135,6 +160,32 @@ namespace
         ASSERT_THAT(r, Eq(StartResult::Failure));
     }
 
+    TEST_F(DetumblingExperimentTest, GatherSingleDataPointShouldReadSensorsWhilePayloadMeasures)
+    {
+        {
+            InSequence s;
+            EXPECT_CALL(_payload, BeginSunSRefMeasurement()).WillOnce(Return(OSResult::Success));
+            EXPECT_CALL(this->_gyro, read()).WillOnce(Return(Some(GyroscopeTelemetry(1, 2, 3, 4))));
+            EXPECT_CALL(_imtq, GetLastAdcsState(_, _)).WillOnce(Return(true));
+            EXPECT_CALL(_payload, EndSunSRefMeasurement(_)).WillOnce(Return(OSResult::Success));
+            EXPECT_CALL(_payload, MeasurePhotodiodes(_)).WillOnce(Return(OSResult::Success));
+            EXPECT_CALL(_payload, MeasureTemperatures(_)).WillOnce(Return(OSResult::Success));
+        }
+
+        this->_exp.GatherSingleMeasurement();
+    }
+
+    TEST_F(DetumblingExperimentTest, GatherSingleDataPointShouldNotCollectPayloadMeasurementThatFailedToStart)
+    {
+        EXPECT_CALL(_payload, BeginSunSRefMeasurement()).WillOnce(Return(OSResult::Busy));
+        EXPECT_CALL(_payload, EndSunSRefMeasurement(_)).Times(0);
+        EXPECT_CALL(this->_gyro, read()).WillOnce(Return(Some(GyroscopeTelemetry(1, 2, 3, 4))));
+
+        auto point = this->_exp.GatherSingleMeasurement();
+
+        ASSERT_THAT(point.Gyro.X(), Eq(1));
+    }
+
     TEST_F(DetumblingExperimentTest, ShouldDisableSENSPowerOnStop)
     {
         EXPECT_CALL(_power, SensPower(false)).WillOnce(Return(true));
@@ -169,7 +220,8 @@ namespace
         std::array<devices::imtq::MagnetometerMeasurement, 3> mtm{1, 2, 3};
         std::array<devices::imtq::Dipole, 3> dipoles{1, 2, 3};
 
-        EXPECT_CALL(_payload, MeasureSunSRef(_)).WillOnce(DoAll(SetArgReferee<0>(refSunsData), Return(OSResult::Success)));
+        EXPECT_CALL(_payload, BeginSunSRefMeasurement()).WillOnce(Return(OSResult::Success));
+        EXPECT_CALL(_payload, EndSunSRefMeasurement(_)).WillOnce(DoAll(SetArgReferee<0>(refSunsData), Return(OSResult::Success)));
         EXPECT_CALL(_payload, MeasurePhotodiodes(_)).WillOnce(DoAll(SetArgReferee<0>(photodiodes), Return(OSResult::Success)));
         EXPECT_CALL(_payload, MeasureTemperatures(_)).WillOnce(DoAll(SetArgReferee<0>(temperatures), Return(OSResult::Success)));
 
@@ -206,16 +258,112 @@ namespace
 
     TEST_F(DetumblingExperimentTest, IterationTiming)
     {
+        std::chrono::milliseconds uptime = 0ms;
+        ON_CALL(_os, GetUptime()).WillByDefault(Invoke([&uptime]() { return uptime; }));
+        ON_CALL(_os, SleepUntil(_)).WillByDefault(Invoke([&uptime](std::chrono::milliseconds time) { uptime = time; }));
+        ON_CALL(_gyro, read()).WillByDefault(Invoke([&uptime]() {
+            uptime += 3s;
+            return Some(GyroscopeTelemetry());
+        }));
+
         this->_exp.Duration(3600s);
         this->_exp.SampleRate(11s);
 
         this->_exp.Start();
 
-        EXPECT_CALL(_os, Sleep(Eq(11s)));
+        {
+            InSequence s;
+            EXPECT_CALL(_gyro, read());
+            EXPECT_CALL(_os, SleepUntil(Eq(11s)));
+            EXPECT_CALL(_gyro, read());
+            EXPECT_CALL(_os, SleepUntil(Eq(22s)));
+            EXPECT_CALL(_gyro, read());
+        }
 
-        auto r = this->_exp.Iteration();
+        for (auto i = 0; i < 3; i++)
+        {
+            auto r = this->_exp.Iteration();
+            ASSERT_THAT(r, Eq(IterationResult::LoopImmediately));
+        }
+
+        const auto sampling = this->_exp.Sampling();
+        ASSERT_THAT(sampling.Samples, Eq(3u));
+        ASSERT_THAT(sampling.AchievedPeriod, Eq(11s));
+        ASSERT_THAT(sampling.MaxJitter, Eq(0ms));
+        ASSERT_THAT(sampling.MissedDeadlines, Eq(0u));
+    }
+
+    TEST_F(DetumblingExperimentTest, DataPointIsWrittenInTelemetryFormatByDefault)
+    {
+        WriteDataPoint(false);
+
+        Reader r(this->_dataBuffer);
+
+        ASSERT_THAT(r.ReadByte(), Eq(num(PID::Synchronization)));
+
+        ASSERT_THAT(r.ReadByte(), Eq(num(PID::Timestamp)));
+        ASSERT_THAT(r.ReadQuadWordLE(), Eq(10u));
+
+        ASSERT_THAT(r.ReadByte(), Eq(num(PID::Gyro)));
+        ASSERT_THAT(r.ReadSignedWordLE(), Eq(1));
+        ASSERT_THAT(r.ReadSignedWordLE(), Eq(2));
+        ASSERT_THAT(r.ReadSignedWordLE(), Eq(3));
+        ASSERT_THAT(r.ReadSignedWordLE(), Eq(4));
+
+        ASSERT_THAT(r.ReadByte(), Eq(num(PID::PayloadSunS)));
+        r.Skip(PayloadTelemetry::SunsRef::DeviceDataLength);
+        ASSERT_THAT(r.ReadByte(), Eq(num(PID::PayloadTemperatures)));
+        r.Skip(PayloadTelemetry::Temperatures::DeviceDataLength);
+        ASSERT_THAT(r.ReadByte(), Eq(num(PID::PayloadPhotodiodes)));
+        r.Skip(PayloadTelemetry::Photodiodes::DeviceDataLength);
+
+        ASSERT_THAT(r.ReadByte(), Eq(num(PID::Magnetometer)));
+        ASSERT_THAT(r.ReadSignedDoubleWordLE(), Eq(-5));
+        ASSERT_THAT(r.ReadSignedDoubleWordLE(), Eq(6));
+        ASSERT_THAT(r.ReadSignedDoubleWordLE(), Eq(7));
+
+        ASSERT_THAT(r.ReadByte(), Eq(num(PID::Dipoles)));
+        ASSERT_THAT(r.ReadSignedWordLE(), Eq(8));
+        ASSERT_THAT(r.ReadSignedWordLE(), Eq(-9));
+        ASSERT_THAT(r.ReadSignedWordLE(), Eq(10));
+
+        ASSERT_THAT(r.ReadByte(), Eq(num(PID::Padding)));
+        ASSERT_THAT(r.Status(), Eq(true));
+    }
+
+    TEST_F(DetumblingExperimentTest, DataPointSensorSamplesAreWrittenAsDeltaRecordsWhenEnabled)
+    {
+        WriteDataPoint(true);
+
+        Reader r(this->_dataBuffer);
+
+        ASSERT_THAT(r.ReadByte(), Eq(num(PID::Synchronization)));
+
+        ASSERT_THAT(r.ReadByte(), Eq(num(PID::Timestamp)));
+        ASSERT_THAT(r.ReadQuadWordLE(), Eq(10u));
+
+        // first sample in packet is stored against zero reference, zig-zag encoded
+        ASSERT_THAT(r.ReadByte(), Eq(num(PID::Gyro) | ExperimentFile::DeltaFlag));
+        ASSERT_THAT(r.ReadByte(), Eq(4));
+        ASSERT_THAT(r.ReadArray(4), ElementsAre(2, 4, 6, 8));
+
+        ASSERT_THAT(r.ReadByte(), Eq(num(PID::PayloadSunS)));
+        r.Skip(PayloadTelemetry::SunsRef::DeviceDataLength);
+        ASSERT_THAT(r.ReadByte(), Eq(num(PID::PayloadTemperatures)));
+        r.Skip(PayloadTelemetry::Temperatures::DeviceDataLength);
+        ASSERT_THAT(r.ReadByte(), Eq(num(PID::PayloadPhotodiodes)));
+        r.Skip(PayloadTelemetry::Photodiodes::DeviceDataLength);
+
+        ASSERT_THAT(r.ReadByte(), Eq(num(PID::Magnetometer) | ExperimentFile::DeltaFlag));
+        ASSERT_THAT(r.ReadByte(), Eq(3));
+        ASSERT_THAT(r.ReadArray(3), ElementsAre(9, 12, 14));
+
+        ASSERT_THAT(r.ReadByte(), Eq(num(PID::Dipoles) | ExperimentFile::DeltaFlag));
+        ASSERT_THAT(r.ReadByte(), Eq(3));
+        ASSERT_THAT(r.ReadArray(3), ElementsAre(16, 17, 20));
 
-        ASSERT_THAT(r, Eq(IterationResult::LoopImmediately));
+        ASSERT_THAT(r.ReadByte(), Eq(num(PID::Padding)));
+        ASSERT_THAT(r.Status(), Eq(true));
     }
 
     TEST_F(DetumblingExperimentTest, FallbackToMissionLoopOnGetTimeFail)
@@ -0,0 +1,91 @@
+#include <string>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "experiments/MeasurementFanOut.hpp"
+
+using testing::Eq;
+using experiments::FanOut;
+using experiments::Immediate;
+using experiments::Split;
+
+namespace
+{
+    TEST(MeasurementFanOutTest, ShouldStartAllMeasurementsBeforeCollectingAnyOfThem)
+    {
+        std::string trace;
+
+        auto result = FanOut(Split(
+                                 [&trace]() {
+                                     trace += "A";
+                                     return true;
+                                 },
+                                 [&trace]() {
+                                     trace += "a";
+                                     return true;
+                                 }),
+            Split(
+                [&trace]() {
+                    trace += "B";
+                    return true;
+                },
+                [&trace]() {
+                    trace += "b";
+                    return true;
+                }),
+            Immediate([&trace]() {
+                trace += "C";
+                return true;
+            }));
+
+        ASSERT_THAT(result, Eq(true));
+        ASSERT_THAT(trace, Eq("ABCab"));
+    }
+
+    TEST(MeasurementFanOutTest, ShouldNotCollectMeasurementThatFailedToStart)
+    {
+        std::string trace;
+
+        auto result = FanOut(Split(
+                                 [&trace]() {
+                                     trace += "A";
+                                     return false;
+                                 },
+                                 [&trace]() {
+                                     trace += "a";
+                                     return true;
+                                 }),
+            Immediate([&trace]() {
+                trace += "B";
+                return true;
+            }));
+
+        ASSERT_THAT(result, Eq(false));
+        ASSERT_THAT(trace, Eq("AB"));
+    }
+
+    TEST(MeasurementFanOutTest, ShouldCollectRemainingMeasurementsWhenOneFails)
+    {
+        std::string trace;
+
+        auto result = FanOut(Split([]() { return true; },
+                                 [&trace]() {
+                                     trace += "a";
+                                     return false;
+                                 }),
+            Split([]() { return true; },
+                [&trace]() {
+                    trace += "b";
+                    return true;
+                }));
+
+        ASSERT_THAT(result, Eq(false));
+        ASSERT_THAT(trace, Eq("ab"));
+    }
+
+    TEST(MeasurementFanOutTest, ShouldReportFailedImmediateMeasurement)
+    {
+        auto result = FanOut(Immediate([]() { return false; }));
+
+        ASSERT_THAT(result, Eq(false));
+    }
+}
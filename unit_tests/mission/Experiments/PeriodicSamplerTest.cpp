@@ -0,0 +1,139 @@
+#include <chrono>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "OsMock.hpp"
+#include "experiments/PeriodicSampler.hpp"
+
+using testing::Eq;
+using testing::Invoke;
+using testing::_;
+using experiments::PeriodicSampler;
+using namespace std::chrono_literals;
+
+namespace
+{
+    class PeriodicSamplerTest : public testing::Test
+    {
+      protected:
+        PeriodicSamplerTest();
+
+        testing::NiceMock<OSMock> _os;
+        OSReset _osReset;
+        std::chrono::milliseconds _uptime;
+        PeriodicSampler _sampler;
+    };
+
+    PeriodicSamplerTest::PeriodicSamplerTest() : _uptime(100s)
+    {
+        _osReset = InstallProxy(&_os);
+
+        ON_CALL(_os, GetUptime()).WillByDefault(Invoke([this]() { return this->_uptime; }));
+        ON_CALL(_os, SleepUntil(_)).WillByDefault(Invoke([this](std::chrono::milliseconds time) { this->_uptime = time; }));
+    }
+
+    TEST_F(PeriodicSamplerTest, FirstSampleIsTakenImmediately)
+    {
+        EXPECT_CALL(_os, SleepUntil(_)).Times(0);
+
+        _sampler.Start(1s);
+        _sampler.WaitForNextSample();
+
+        ASSERT_THAT(_sampler.Statistics().Samples, Eq(1u));
+        ASSERT_THAT(_sampler.Statistics().Period, Eq(1s));
+    }
+
+    TEST_F(PeriodicSamplerTest, DeadlinesDoNotDependOnSamplingTime)
+    {
+        _sampler.Start(1s);
+        _sampler.WaitForNextSample();
+
+        _uptime += 300ms;
+        EXPECT_CALL(_os, SleepUntil(Eq(101s)));
+        _sampler.WaitForNextSample();
+
+        _uptime += 700ms;
+        EXPECT_CALL(_os, SleepUntil(Eq(102s)));
+        _sampler.WaitForNextSample();
+
+        _uptime += 50ms;
+        EXPECT_CALL(_os, SleepUntil(Eq(103s)));
+        _sampler.WaitForNextSample();
+
+        const auto& statistics = _sampler.Statistics();
+        ASSERT_THAT(statistics.Samples, Eq(4u));
+        ASSERT_THAT(statistics.AchievedPeriod, Eq(1s));
+        ASSERT_THAT(statistics.MaxJitter, Eq(0ms));
+        ASSERT_THAT(statistics.MissedDeadlines, Eq(0u));
+    }
+
+    TEST_F(PeriodicSamplerTest, LateSampleIsTakenImmediatelyAndKeepsSchedule)
+    {
+        _sampler.Start(1s);
+        _sampler.WaitForNextSample();
+
+        _uptime += 1500ms;
+        EXPECT_CALL(_os, SleepUntil(_)).Times(0);
+        _sampler.WaitForNextSample();
+        testing::Mock::VerifyAndClearExpectations(&_os);
+
+        EXPECT_CALL(_os, SleepUntil(Eq(102s))).WillOnce(Invoke([this](std::chrono::milliseconds time) { this->_uptime = time; }));
+        _sampler.WaitForNextSample();
+
+        const auto& statistics = _sampler.Statistics();
+        ASSERT_THAT(statistics.Samples, Eq(3u));
+        ASSERT_THAT(statistics.MaxJitter, Eq(500ms));
+        ASSERT_THAT(statistics.MissedDeadlines, Eq(0u));
+    }
+
+    TEST_F(PeriodicSamplerTest, PassedDeadlinesAreSkipped)
+    {
+        _sampler.Start(1s);
+        _sampler.WaitForNextSample();
+
+        _uptime += 3500ms;
+        _sampler.WaitForNextSample();
+
+        EXPECT_CALL(_os, SleepUntil(Eq(104s)));
+        _sampler.WaitForNextSample();
+
+        const auto& statistics = _sampler.Statistics();
+        ASSERT_THAT(statistics.Samples, Eq(3u));
+        ASSERT_THAT(statistics.MissedDeadlines, Eq(2u));
+        ASSERT_THAT(statistics.MaxJitter, Eq(500ms));
+        ASSERT_THAT(statistics.AchievedPeriod, Eq(2s));
+    }
+
+    TEST_F(PeriodicSamplerTest, ZeroPeriodNeverWaits)
+    {
+        EXPECT_CALL(_os, SleepUntil(_)).Times(0);
+
+        _sampler.Start(0ms);
+        for (auto i = 0; i < 3; i++)
+        {
+            _uptime += 10ms;
+            _sampler.WaitForNextSample();
+        }
+
+        ASSERT_THAT(_sampler.Statistics().Samples, Eq(3u));
+        ASSERT_THAT(_sampler.Statistics().MissedDeadlines, Eq(0u));
+    }
+
+    TEST_F(PeriodicSamplerTest, StartResetsStatistics)
+    {
+        _sampler.Start(1s);
+        _sampler.WaitForNextSample();
+        _uptime += 5s;
+        _sampler.WaitForNextSample();
+
+        _sampler.Start(2s);
+
+        const auto& statistics = _sampler.Statistics();
+        ASSERT_THAT(statistics.Period, Eq(2s));
+        ASSERT_THAT(statistics.Samples, Eq(0u));
+        ASSERT_THAT(statistics.MissedDeadlines, Eq(0u));
+        ASSERT_THAT(statistics.MaxJitter, Eq(0ms));
+
+        EXPECT_CALL(_os, SleepUntil(_)).Times(0);
+        _sampler.WaitForNextSample();
+    }
+}
@@ -113,6 +113,8 @@ namespace
 
     TEST_F(SunSExperimentTest, IterationFlow)
     {
+        ON_CALL(_os, GetUptime()).WillByDefault(Return(10s));
+
         _exp.SetParameters(SunSExperimentParams(1, 2, 3, 2s, 1, 1min));
         _exp.SetOutputFiles("/exp");
 
@@ -126,10 +128,10 @@ namespace
             EXPECT_CALL(_os, Sleep(duration_cast<milliseconds>(3s)));
 
             EXPECT_CALL(_sunsExp, StartMeasurement(1, 2));
-            EXPECT_CALL(_os, Sleep(duration_cast<milliseconds>(2s)));
+            EXPECT_CALL(_os, SleepUntil(Eq(12s)));
 
             EXPECT_CALL(_sunsExp, StartMeasurement(1, 2));
-            EXPECT_CALL(_os, Sleep(duration_cast<milliseconds>(2s)));
+            EXPECT_CALL(_os, SleepUntil(Eq(14s)));
 
             EXPECT_CALL(_sunsExp, StartMeasurement(1, 2));
 
@@ -148,15 +150,21 @@ namespace
         PayloadTelemetry::SunsRef refSunsData;
         GyroscopeTelemetry gyroData;
 
-        EXPECT_CALL(_sunsExp, StartMeasurement(_, _)).WillOnce(Return(OperationStatus::OK));
+        {
+            InSequence s;
+
+            EXPECT_CALL(_sunsExp, StartMeasurement(_, _)).WillOnce(Return(OperationStatus::OK));
+
+            EXPECT_CALL(_payload, BeginSunSRefMeasurement()).WillOnce(Return(OSResult::Success));
 
-        EXPECT_CALL(_payload, MeasureSunSRef(_)).WillOnce(DoAll(SetArgReferee<0>(refSunsData), Return(OSResult::Success)));
+            EXPECT_CALL(_gyro, read()).WillOnce(Return(Some(gyroData)));
 
-        EXPECT_CALL(_sunsExp, WaitForData()).WillOnce(Return(OSResult::Success));
+            EXPECT_CALL(_sunsExp, WaitForData()).WillOnce(Return(OSResult::Success));
 
-        EXPECT_CALL(_sunsExp, GetMeasuredData(_)).WillOnce(DoAll(SetArgReferee<0>(expSunsData), Return(OperationStatus::OK)));
+            EXPECT_CALL(_sunsExp, GetMeasuredData(_)).WillOnce(DoAll(SetArgReferee<0>(expSunsData), Return(OperationStatus::OK)));
 
-        EXPECT_CALL(_gyro, read()).WillOnce(Return(Some(gyroData)));
+            EXPECT_CALL(_payload, EndSunSRefMeasurement(_)).WillOnce(DoAll(SetArgReferee<0>(refSunsData), Return(OSResult::Success)));
+        }
 
         auto dataPoint = _exp.GatherSingleMeasurement();
 
@@ -201,4 +201,89 @@ namespace
 
         ASSERT_THAT(_buffer, Eq(expected));
     }
+
+    TEST_F(ExperimentFileTest, DeltaRecordsAreEncodedAgainstPreviousSampleWithTheSamePID)
+    {
+        ExperimentFile file;
+        file.Open(_fs, TestFileName, FileOpen::CreateAlways, FileAccess::WriteOnly);
+
+        std::array<std::int32_t, 4> first{1, -1, 300, 0};
+        std::array<std::int32_t, 4> second{2, -1, 200, 5};
+        std::array<std::int32_t, 3> other{-2, 0, 64};
+
+        file.WriteDelta(ExperimentFile::PID::Gyro, first);
+        file.WriteDelta(ExperimentFile::PID::Dipoles, other);
+        file.WriteDelta(ExperimentFile::PID::Gyro, second);
+        file.Close();
+
+        std::array<uint8_t, 2 * ExperimentFile::PacketLength> expected;
+        expected.fill(0xFF);
+        Writer w(expected);
+
+        w.WriteByte(num(ExperimentFile::PID::Synchronization));
+
+        w.WriteByte(num(ExperimentFile::PID::Gyro) | ExperimentFile::DeltaFlag);
+        w.WriteByte(4);
+        w.WriteArray(std::array<uint8_t, 5>{0x02, 0x01, 0xD8, 0x04, 0x00});
+
+        w.WriteByte(num(ExperimentFile::PID::Dipoles) | ExperimentFile::DeltaFlag);
+        w.WriteByte(3);
+        w.WriteArray(std::array<uint8_t, 4>{0x03, 0x00, 0x80, 0x01});
+
+        w.WriteByte(num(ExperimentFile::PID::Gyro) | ExperimentFile::DeltaFlag);
+        w.WriteByte(4);
+        w.WriteArray(std::array<uint8_t, 5>{0x02, 0x00, 0xC7, 0x01, 0x0A});
+
+        ASSERT_THAT(_buffer, Eq(expected));
+    }
+
+    TEST_F(ExperimentFileTest, DeltaReferenceIsResetInEveryPacket)
+    {
+        ExperimentFile file;
+        file.Open(_fs, TestFileName, FileOpen::CreateAlways, FileAccess::WriteOnly);
+
+        std::array<std::int32_t, 1> first{10};
+        std::array<std::int32_t, 1> second{11};
+
+        file.WriteDelta(ExperimentFile::PID::Gyro, first);
+
+        std::array<uint8_t, ExperimentFile::PacketLength - 6> filler;
+        filler.fill(0xBC);
+        file.Write(ExperimentFile::PID::Reserved, filler);
+
+        file.WriteDelta(ExperimentFile::PID::Gyro, second);
+        file.Close();
+
+        std::array<uint8_t, 2 * ExperimentFile::PacketLength> expected;
+        expected.fill(0xFF);
+        Writer w(expected);
+
+        w.WriteByte(num(ExperimentFile::PID::Synchronization));
+        w.WriteByte(num(ExperimentFile::PID::Gyro) | ExperimentFile::DeltaFlag);
+        w.WriteByte(1);
+        w.WriteByte(20);
+        w.WriteByte(num(ExperimentFile::PID::Reserved));
+        w.WriteArray(filler);
+        w.WriteByte(0xFF);
+
+        // second packet
+        w.WriteByte(num(ExperimentFile::PID::Synchronization));
+        w.WriteByte(num(ExperimentFile::PID::Gyro) | ExperimentFile::DeltaFlag);
+        w.WriteByte(1);
+        w.WriteByte(22);
+
+        ASSERT_THAT(_buffer, Eq(expected));
+    }
+
+    TEST_F(ExperimentFileTest, DeltaEncodingRejectsControlPIDs)
+    {
+        ExperimentFile file;
+        file.Open(_fs, TestFileName, FileOpen::CreateAlways, FileAccess::WriteOnly);
+
+        std::array<std::int32_t, 1> sample{10};
+
+        ASSERT_THAT(file.WriteDelta(ExperimentFile::PID::Timestamp, sample), Eq(OSResult::InvalidArgument));
+        ASSERT_THAT(file.WriteDelta(ExperimentFile::PID::Padding, sample), Eq(OSResult::InvalidArgument));
+        ASSERT_THAT(file.WriteDelta(ExperimentFile::PID::Synchronization, sample), Eq(OSResult::InvalidArgument));
+    }
 }
@@ -0,0 +1,222 @@
+#include <gsl/span>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "OsMock.hpp"
+#include "fs/ExperimentFile.hpp"
+#include "fs/ExperimentFileWriter.hpp"
+#include "mock/FsMock.hpp"
+
+using testing::NiceMock;
+using testing::Return;
+using testing::Invoke;
+using testing::Eq;
+using testing::Each;
+using testing::ElementsAre;
+using testing::_;
+
+using namespace experiments::fs;
+using namespace services::fs;
+using namespace std::chrono_literals;
+
+namespace
+{
+    class ExperimentFileWriterTest : public testing::Test
+    {
+      public:
+        ExperimentFileWriterTest();
+
+        const char* TestFileName = "/test";
+
+        void OnFlush(const gsl::span<uint8_t>& packet);
+
+      protected:
+        NiceMock<OSMock> _os;
+        OSReset _osReset{InstallProxy(&_os)};
+
+        NiceMock<FsMock> _fs;
+        std::array<uint8_t, 4 * ExperimentFile::PacketLength> _buffer;
+
+        ExperimentFileWriter _writer;
+
+        std::vector<std::uint8_t> _flushed;
+    };
+
+    ExperimentFileWriterTest::ExperimentFileWriterTest()
+    {
+        _buffer.fill(0xCC);
+        this->_fs.AddFile(TestFileName, _buffer);
+    }
+
+    void ExperimentFileWriterTest::OnFlush(const gsl::span<uint8_t>& packet)
+    {
+        this->_flushed.push_back(packet[1]);
+    }
+
+    TEST_F(ExperimentFileWriterTest, PacketIsWrittenByBackgroundTaskNotOnFlush)
+    {
+        ExperimentFile file;
+        file.SetWriter(&_writer);
+        file.Open(_fs, TestFileName, FileOpen::CreateAlways, FileAccess::WriteOnly);
+
+        uint8_t data = 7;
+        file.Write(ExperimentFile::PID::Reserved, gsl::make_span(&data, 1));
+        file.Flush();
+
+        ASSERT_THAT(_writer.Pending(), Eq(1));
+        ASSERT_THAT(gsl::make_span(_buffer).subspan(0, ExperimentFile::PacketLength), Each(Eq(0xCC)));
+
+        ASSERT_THAT(_writer.WriteNext(), Eq(true));
+        ASSERT_THAT(_writer.WriteNext(), Eq(false));
+
+        ASSERT_THAT(_writer.Pending(), Eq(0));
+        ASSERT_THAT(_writer.PacketsWritten(), Eq(1U));
+        ASSERT_THAT(_buffer[0], Eq(num(ExperimentFile::PID::Synchronization)));
+        ASSERT_THAT(_buffer[1], Eq(num(ExperimentFile::PID::Reserved)));
+        ASSERT_THAT(_buffer[2], Eq(7));
+        ASSERT_THAT(_buffer[3], Eq(num(ExperimentFile::PID::Padding)));
+    }
+
+    TEST_F(ExperimentFileWriterTest, PacketsAreWrittenInOrderAndFlushHandlerIsInvokedAfterWrite)
+    {
+        ExperimentFile file;
+        file.SetWriter(&_writer);
+        file.Open(_fs, TestFileName, FileOpen::CreateAlways, FileAccess::WriteOnly);
+        file.SetOnFlush(ExperimentFile::OnFlushDelegate::make_delegate<ExperimentFileWriterTest, &ExperimentFileWriterTest::OnFlush>(this));
+
+        for (uint8_t i = 0; i < 3; i++)
+        {
+            file.Write(static_cast<ExperimentFile::PID>(0x10 + i), gsl::make_span(&i, 1));
+            file.Flush();
+        }
+
+        ASSERT_THAT(_flushed.size(), Eq(0U));
+
+        while (_writer.WriteNext())
+        {
+        }
+
+        ASSERT_THAT(_flushed, ElementsAre(0x10, 0x11, 0x12));
+        ASSERT_THAT(_buffer[0 * ExperimentFile::PacketLength + 1], Eq(0x10));
+        ASSERT_THAT(_buffer[1 * ExperimentFile::PacketLength + 1], Eq(0x11));
+        ASSERT_THAT(_buffer[2 * ExperimentFile::PacketLength + 1], Eq(0x12));
+    }
+
+    TEST_F(ExperimentFileWriterTest, SubmitWaitsForFreeBufferAndCountsOverrun)
+    {
+        ExperimentFile file;
+        file.SetWriter(&_writer);
+        file.Open(_fs, TestFileName, FileOpen::CreateAlways, FileAccess::WriteOnly);
+
+        for (uint8_t i = 0; i < ExperimentFileWriter::BuffersCount; i++)
+        {
+            file.Write(ExperimentFile::PID::Reserved, gsl::make_span(&i, 1));
+            ASSERT_THAT(file.Flush(), Eq(OSResult::Success));
+        }
+
+        ASSERT_THAT(_writer.Overruns(), Eq(0U));
+
+        EXPECT_CALL(_os, EventGroupWaitForBits(_, _, _, _, _)).WillOnce(Invoke([this](OSEventGroupHandle, OSEventBits bits, bool, bool, auto) {
+            this->_writer.WriteNext();
+            return bits;
+        }));
+
+        uint8_t data = 0xAB;
+        file.Write(ExperimentFile::PID::Reserved, gsl::make_span(&data, 1));
+        ASSERT_THAT(file.Flush(), Eq(OSResult::Success));
+
+        ASSERT_THAT(_writer.Overruns(), Eq(1U));
+        ASSERT_THAT(_writer.Pending(), Eq(ExperimentFileWriter::BuffersCount));
+
+        // file waits for pending packets before it is destroyed
+        while (_writer.WriteNext())
+        {
+        }
+    }
+
+    TEST_F(ExperimentFileWriterTest, DestroyedFileWaitsForFlushedPackets)
+    {
+        {
+            ExperimentFile file;
+            file.SetWriter(&_writer);
+            file.Open(_fs, TestFileName, FileOpen::CreateAlways, FileAccess::WriteOnly);
+
+            uint8_t data = 0xAB;
+            file.Write(ExperimentFile::PID::Reserved, gsl::make_span(&data, 1));
+            ASSERT_THAT(file.Flush(), Eq(OSResult::Success));
+
+            EXPECT_CALL(_os, EventGroupWaitForBits(_, _, _, _, _)).WillOnce(Invoke([this](OSEventGroupHandle, OSEventBits bits, bool, bool, auto) {
+                this->_writer.WriteNext();
+                return bits;
+            }));
+        }
+
+        ASSERT_THAT(_writer.Pending(), Eq(0));
+        ASSERT_THAT(_writer.PacketsWritten(), Eq(1U));
+    }
+
+    TEST_F(ExperimentFileWriterTest, SubmitFailsWhenNoBufferIsReleasedInTime)
+    {
+        ExperimentFile file;
+        file.SetWriter(&_writer);
+        file.Open(_fs, TestFileName, FileOpen::CreateAlways, FileAccess::WriteOnly);
+
+        for (uint8_t i = 0; i < ExperimentFileWriter::BuffersCount; i++)
+        {
+            file.Write(ExperimentFile::PID::Reserved, gsl::make_span(&i, 1));
+            file.Flush();
+        }
+
+        ON_CALL(_os, EventGroupWaitForBits(_, _, _, _, _)).WillByDefault(Return(0));
+
+        uint8_t data = 0xAB;
+        file.Write(ExperimentFile::PID::Reserved, gsl::make_span(&data, 1));
+        ASSERT_THAT(file.Flush(), Eq(OSResult::Timeout));
+        ASSERT_THAT(_writer.Overruns(), Eq(1U));
+    }
+
+    TEST_F(ExperimentFileWriterTest, CloseWaitsUntilAllPacketsAreWritten)
+    {
+        ExperimentFile file;
+        file.SetWriter(&_writer);
+        file.Open(_fs, TestFileName, FileOpen::CreateAlways, FileAccess::WriteOnly);
+
+        uint8_t data = 7;
+        file.Write(ExperimentFile::PID::Reserved, gsl::make_span(&data, 1));
+        file.Flush();
+        file.Write(ExperimentFile::PID::Reserved, gsl::make_span(&data, 1));
+
+        EXPECT_CALL(_os, EventGroupWaitForBits(_, _, _, _, _)).WillOnce(Invoke([this](OSEventGroupHandle, OSEventBits bits, bool, bool, auto) {
+            while (this->_writer.WriteNext())
+            {
+            }
+            return bits;
+        }));
+
+        ASSERT_THAT(file.Close(), Eq(OSResult::Success));
+        ASSERT_THAT(_writer.Pending(), Eq(0));
+        ASSERT_THAT(_writer.PacketsWritten(), Eq(2U));
+    }
+
+    TEST_F(ExperimentFileWriterTest, CloseReportsFailedBackgroundWrite)
+    {
+        ExperimentFile file;
+        file.SetWriter(&_writer);
+        file.Open(_fs, TestFileName, FileOpen::CreateAlways, FileAccess::WriteOnly);
+
+        uint8_t data = 7;
+        file.Write(ExperimentFile::PID::Reserved, gsl::make_span(&data, 1));
+
+        ON_CALL(_fs, Write(_, _)).WillByDefault(Return(MakeFSIOResult(OSResult::IOError)));
+        EXPECT_CALL(_os, EventGroupWaitForBits(_, _, _, _, _)).WillOnce(Invoke([this](OSEventGroupHandle, OSEventBits bits, bool, bool, auto) {
+            this->_writer.WriteNext();
+            return bits;
+        }));
+
+        EXPECT_CALL(_fs, Close(_)).Times(1);
+
+        ASSERT_THAT(file.Close(), Eq(OSResult::IOError));
+        ASSERT_THAT(_writer.PacketsWritten(), Eq(0U));
+        testing::Mock::VerifyAndClearExpectations(&_fs);
+    }
+}
@@ -21,6 +21,7 @@ namespace
         MOCK_METHOD1(AddDeviceAndMount, OSResult(yaffs_dev* device));
         MOCK_METHOD1(ClearDevice, OSResult(yaffs_dev* device));
         MOCK_METHOD0(Sync, void());
+        MOCK_METHOD3(StartMaintenance, OSResult(yaffs_dev* device, services::fs::IEraseAheadDevice& eraseAhead, std::uint16_t erasedReserve));
     };
 
     struct FileSystemTaskTest : public testing::Test
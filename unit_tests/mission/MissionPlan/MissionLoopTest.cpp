@@ -10,6 +10,7 @@
 using testing::Return;
 using testing::Eq;
 using testing::_;
+using testing::InSequence;
 using namespace mission;
 
 namespace
@@ -27,6 +28,14 @@ namespace
         VerifyDescriptorMock<State, float>>
         Mission;
 
+    typedef MissionLoop<State,
+        UpdateDescriptorMock<State, void>,
+        Concurrent<UpdateDescriptorMock<State, int>>,
+        UpdateDescriptorMock<State, float>,
+        Concurrent<UpdateDescriptorMock<State, double>>,
+        UpdateDescriptorMock<State, char>>
+        ConcurrentMission;
+
     struct MissionLoopTest : public testing::Test
     {
         Mission mission;
@@ -87,4 +96,66 @@ namespace
         EXPECT_CALL(action2, ActionProc(_)).Times(1);
         mission.RunOnce();
     }
+
+    struct ConcurrentMissionLoopTest : public testing::Test
+    {
+        ConcurrentMission mission;
+        testing::StrictMock<OSMock> mock;
+    };
+
+    TEST_F(ConcurrentMissionLoopTest, TestInitializationCreatesConcurrentUpdateTask)
+    {
+        auto proxy = InstallProxy(&mock);
+        EXPECT_CALL(mock, CreateEventGroup()).WillOnce(Return(this));
+        EXPECT_CALL(mock, CreateTask(_, _, _, _, _, _)).Times(2).WillRepeatedly(Return(OSResult::Success));
+        EXPECT_CALL(mock, SuspendTask(_));
+        const auto status = mission.Initialize(10s);
+        ASSERT_THAT(status, Eq(true));
+    }
+
+    TEST_F(ConcurrentMissionLoopTest, TestConcurrentUpdateTaskCreationFailure)
+    {
+        auto proxy = InstallProxy(&mock);
+        EXPECT_CALL(mock, CreateEventGroup()).WillOnce(Return(this));
+        EXPECT_CALL(mock, CreateTask(_, _, _, _, _, _)).WillOnce(Return(OSResult::IOError));
+        const auto status = mission.Initialize(10s);
+        ASSERT_THAT(status, Eq(false));
+    }
+
+    TEST_F(ConcurrentMissionLoopTest, TestUpdatesDeclaredAfterConcurrentUpdatesRunAfterThem)
+    {
+        auto& update1 = static_cast<UpdateDescriptorMock<State, void>&>(mission);
+        auto& concurrent1 = static_cast<UpdateDescriptorMock<State, int>&>(mission);
+        auto& update2 = static_cast<UpdateDescriptorMock<State, float>&>(mission);
+        auto& concurrent2 = static_cast<UpdateDescriptorMock<State, double>&>(mission);
+        auto& update3 = static_cast<UpdateDescriptorMock<State, char>&>(mission);
+
+        {
+            InSequence s;
+            EXPECT_CALL(update1, UpdateProc(_)).WillOnce(Return(UpdateResult::Ok));
+            EXPECT_CALL(update2, UpdateProc(_)).WillOnce(Return(UpdateResult::Ok));
+            EXPECT_CALL(concurrent1, UpdateProc(_)).WillOnce(Return(UpdateResult::Ok));
+            EXPECT_CALL(concurrent2, UpdateProc(_)).WillOnce(Return(UpdateResult::Ok));
+            EXPECT_CALL(update3, UpdateProc(_)).WillOnce(Return(UpdateResult::Ok));
+        }
+
+        mission.RunOnce();
+    }
+
+    TEST_F(ConcurrentMissionLoopTest, TestConcurrentUpdateFailureStopsRemainingUpdates)
+    {
+        auto& update1 = static_cast<UpdateDescriptorMock<State, void>&>(mission);
+        auto& concurrent1 = static_cast<UpdateDescriptorMock<State, int>&>(mission);
+        auto& update2 = static_cast<UpdateDescriptorMock<State, float>&>(mission);
+        auto& concurrent2 = static_cast<UpdateDescriptorMock<State, double>&>(mission);
+        auto& update3 = static_cast<UpdateDescriptorMock<State, char>&>(mission);
+
+        EXPECT_CALL(update1, UpdateProc(_)).WillOnce(Return(UpdateResult::Ok));
+        EXPECT_CALL(update2, UpdateProc(_)).WillOnce(Return(UpdateResult::Warning));
+        EXPECT_CALL(concurrent1, UpdateProc(_)).WillOnce(Return(UpdateResult::Failure));
+        EXPECT_CALL(concurrent2, UpdateProc(_)).Times(0);
+        EXPECT_CALL(update3, UpdateProc(_)).Times(0);
+
+        mission.RunOnce();
+    }
 }
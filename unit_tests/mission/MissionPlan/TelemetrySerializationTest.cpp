@@ -0,0 +1,134 @@
+#include <array>
+#include <chrono>
+#include <iostream>
+#include "gtest/gtest.h"
+#include "gmock/gmock-matchers.h"
+#include "CycleCounter.hpp"
+#include "base/BitWriter.hpp"
+#include "mission/TelemetrySerialization.hpp"
+#include "telemetry/TimeTelemetry.hpp"
+
+namespace
+{
+    using testing::Eq;
+    using testing::Ne;
+    using namespace std::chrono_literals;
+
+    using Snapshot = std::array<std::uint8_t, telemetry::ManagedTelemetry::TotalSerializedSize>;
+
+    class TelemetrySerializationTest : public testing::Test
+    {
+      protected:
+        TelemetrySerializationTest();
+
+        Snapshot Published();
+
+        Snapshot Expected();
+
+        telemetry::TelemetryState state;
+        telemetry::TelemetrySerialization serialization;
+        mission::UpdateDescriptor<telemetry::TelemetryState> descriptor;
+    };
+
+    TelemetrySerializationTest::TelemetrySerializationTest() : serialization(0)
+    {
+        this->descriptor = serialization.BuildUpdate();
+    }
+
+    Snapshot TelemetrySerializationTest::Published()
+    {
+        Snapshot snapshot;
+        EXPECT_THAT(this->state.lastSerializedTelemetry.CopyTo(snapshot), Eq(true));
+        return snapshot;
+    }
+
+    Snapshot TelemetrySerializationTest::Expected()
+    {
+        Snapshot snapshot{};
+        BitWriter writer(snapshot);
+        this->state.telemetry.Write(writer);
+        EXPECT_THAT(writer.Status(), Eq(true));
+        return snapshot;
+    }
+
+    TEST_F(TelemetrySerializationTest, FirstRunPublishesCompleteTelemetry)
+    {
+        state.telemetry.Set(telemetry::InternalTimeTelemetry(10min));
+        ASSERT_THAT(descriptor.Execute(state), Eq(mission::UpdateResult::Ok));
+        ASSERT_THAT(state.lastSerializedTelemetry.Sequence(), Eq(2u));
+        ASSERT_THAT(Published(), Eq(Expected()));
+    }
+
+    TEST_F(TelemetrySerializationTest, UnchangedTelemetryIsNotPublishedAgain)
+    {
+        descriptor.Execute(state);
+        const auto sequence = state.lastSerializedTelemetry.Sequence();
+
+        ASSERT_THAT(descriptor.Execute(state), Eq(mission::UpdateResult::Ok));
+        ASSERT_THAT(state.lastSerializedTelemetry.Sequence(), Eq(sequence));
+    }
+
+    TEST_F(TelemetrySerializationTest, SettingSameValueDoesNotPublishTelemetry)
+    {
+        state.telemetry.Set(telemetry::InternalTimeTelemetry(10min));
+        descriptor.Execute(state);
+        const auto sequence = state.lastSerializedTelemetry.Sequence();
+
+        state.telemetry.Set(telemetry::InternalTimeTelemetry(10min));
+        descriptor.Execute(state);
+        ASSERT_THAT(state.lastSerializedTelemetry.Sequence(), Eq(sequence));
+    }
+
+    TEST_F(TelemetrySerializationTest, UpdatedElementIsPatchedInPublishedTelemetry)
+    {
+        state.telemetry.Set(telemetry::InternalTimeTelemetry(10min));
+        descriptor.Execute(state);
+        const auto previous = Published();
+
+        state.telemetry.Set(telemetry::InternalTimeTelemetry(20min));
+        ASSERT_THAT(descriptor.Execute(state), Eq(mission::UpdateResult::Ok));
+
+        const auto current = Published();
+        ASSERT_THAT(current, Ne(previous));
+        ASSERT_THAT(current, Eq(Expected()));
+    }
+
+    /**
+     * Compares cost of preparing beacon contents when single telemetry element changes between beacons:
+     * complete serialization of telemetry versus re-encoding of changed element only.
+     */
+    TEST_F(TelemetrySerializationTest, EncodeCostPerBeacon)
+    {
+        descriptor.Execute(state);
+
+        CycleCounter::Enable();
+        CycleStatistics full{};
+        CycleStatistics incremental{};
+
+        for (auto i = 1; i <= 100; i++)
+        {
+            state.telemetry.Set(telemetry::InternalTimeTelemetry(std::chrono::seconds(i)));
+
+            auto start = CycleCounter::Now();
+            Snapshot buffer;
+            BitWriter writer(buffer);
+            state.telemetry.Write(writer);
+            full.Add(CycleCounter::Elapsed(start));
+
+            start = CycleCounter::Now();
+            descriptor.Execute(state);
+            incremental.Add(CycleCounter::Elapsed(start));
+
+            ASSERT_THAT(Published(), Eq(buffer));
+        }
+
+        std::cout << "[ BENCH    ] Telemetry encode cycles per beacon:" //
+                  << " full avg=" << full.Average()                  //
+                  << " max=" << full.Max                             //
+                  << " incremental avg=" << incremental.Average()    //
+                  << " max=" << incremental.Max << std::endl;
+
+        RecordProperty("FullEncodeCyclesAverage", static_cast<int>(full.Average()));
+        RecordProperty("IncrementalEncodeCyclesAverage", static_cast<int>(incremental.Average()));
+    }
+}
@@ -8,7 +8,9 @@
 
 namespace
 {
+    using testing::ElementsAre;
     using testing::Eq;
+    using testing::Invoke;
     using testing::_;
     using testing::Return;
     using testing::SizeIs;
@@ -103,8 +105,6 @@ namespace
         EXPECT_CALL(fs, Write(10, _)).WillOnce(Return(WriteSuccessful()));
         EXPECT_CALL(fs, GetFileSize(10)).WillOnce(Return(0));
         EXPECT_CALL(fs, Close(10));
-        EXPECT_CALL(os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Success));
-        EXPECT_CALL(os, GiveSemaphore(_)).WillOnce(Return(OSResult::Success));
         state.telemetry.Set(telemetry::InternalTimeTelemetry(10min));
         this->descriptor.Execute(this->state);
     }
@@ -119,21 +119,27 @@ namespace
         ASSERT_THAT(this->descriptor.EvaluateCondition(this->state), Eq(true));
     }
 
-    TEST_F(TelemetryTest, TestConditionAfterFailedTelemetryAccessAcquisition)
+    TEST_F(TelemetryTest, TestSavePublishedSnapshot)
     {
-        state.telemetry.Set(telemetry::InternalTimeTelemetry(10min));
+        std::array<std::uint8_t, 3> snapshot{0x01, 0x02, 0x03};
+        state.lastSerializedTelemetry.Publish(snapshot);
 
-        ASSERT_THAT(this->descriptor.EvaluateCondition(this->state), Eq(true));
-        EXPECT_CALL(os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Deadlock));
-        this->descriptor.Execute(this->state);
+        EXPECT_CALL(fs, Open(_, _, _)).WillOnce(Return(OpenSuccessful(10)));
+        EXPECT_CALL(fs, GetFileSize(10)).WillOnce(Return(0));
+        EXPECT_CALL(fs, Write(10, _)).WillOnce(Invoke([this](auto, gsl::span<const std::uint8_t> buffer) {
+            EXPECT_THAT(buffer, SizeIs(telemetry::TelemetryState::SerializedTelemetry::Length));
+            EXPECT_THAT(buffer.subspan(0, 4), ElementsAre(0x01, 0x02, 0x03, 0x00));
+            return this->WriteSuccessful();
+        }));
+        EXPECT_CALL(os, TakeSemaphore(_, _)).Times(0);
 
-        ASSERT_THAT(this->descriptor.EvaluateCondition(this->state), Eq(true));
+        state.telemetry.Set(telemetry::InternalTimeTelemetry(10min));
+        this->descriptor.Execute(this->state);
     }
 
     TEST_F(TelemetryTest, TestSaveChangeSlightlyBelowLimit)
     {
         EXPECT_CALL(fs, Open(_, _, _)).WillOnce(Return(OpenSuccessful(10)));
-        EXPECT_CALL(os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Success));
         EXPECT_CALL(fs, Write(10, _)).WillOnce(Return(WriteSuccessful()));
         EXPECT_CALL(fs, GetFileSize(10)).WillOnce(Return(1023));
         state.telemetry.Set(telemetry::InternalTimeTelemetry(10min));
@@ -143,7 +149,6 @@ namespace
     TEST_F(TelemetryTest, TestSaveChangeFileOpenFailure)
     {
         EXPECT_CALL(fs, Open(_, _, _)).WillOnce(Return(FileOpenResult(OSResult::IOError, 0)));
-        EXPECT_CALL(os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Success));
         state.telemetry.Set(telemetry::InternalTimeTelemetry(10min));
         this->descriptor.Execute(this->state);
         ASSERT_THAT(state.telemetry.IsModified(), Eq(true));
@@ -151,7 +156,6 @@ namespace
 
     TEST_F(TelemetryTest, TestSaveWriteFailure)
     {
-        EXPECT_CALL(os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Success));
         EXPECT_CALL(fs, Open(_, _, _)).WillOnce(Return(OpenSuccessful(10)));
         EXPECT_CALL(fs, Write(10, _)).WillOnce(Return(IOResult(OSResult::IOError, gsl::span<const std::uint8_t>())));
         state.telemetry.Set(telemetry::InternalTimeTelemetry(10min));
@@ -160,7 +164,6 @@ namespace
 
     TEST_F(TelemetryTest, TestSaveChangeOverLimitSuccess)
     {
-        EXPECT_CALL(os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Success));
         EXPECT_CALL(fs, Open(_, _, _)).WillRepeatedly(Return(OpenSuccessful(10)));
         EXPECT_CALL(fs, Write(10, _)).WillOnce(Return(WriteSuccessful()));
         EXPECT_CALL(fs, GetFileSize(10)).Times(2).WillOnce(Return(1024));
@@ -172,7 +175,6 @@ namespace
 
     TEST_F(TelemetryTest, TestSaveChangeOverLimitArchivizerFailure)
     {
-        EXPECT_CALL(os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Success));
         EXPECT_CALL(fs, Open(_, _, _)).WillRepeatedly(Return(OpenSuccessful(10)));
         EXPECT_CALL(fs, Write(10, _)).Times(0);
         EXPECT_CALL(fs, GetFileSize(10)).WillOnce(Return(1024));
@@ -183,7 +185,6 @@ namespace
 
     TEST_F(TelemetryTest, TestSaveChangeOverLimitFileReopenFailure)
     {
-        EXPECT_CALL(os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Success));
         EXPECT_CALL(fs, Open(_, _, _)).WillOnce(Return(OpenSuccessful(10))).WillOnce(Return(FileOpenResult(OSResult::IOError, 0)));
         EXPECT_CALL(fs, Write(10, _)).Times(0);
         EXPECT_CALL(fs, GetFileSize(10)).WillOnce(Return(1024));
@@ -0,0 +1,101 @@
+#include <cstdio>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "fs/directory_cache.hpp"
+
+using testing::Eq;
+using testing::StrEq;
+using services::fs::DirectoryCache;
+
+namespace
+{
+    class DirectoryCacheTest : public testing::Test
+    {
+      protected:
+        void Fill(const char* prefix, const char* cursor, std::uint32_t count);
+
+        DirectoryCache _cache;
+        int _directory;
+        char _names[20][8];
+    };
+
+    void DirectoryCacheTest::Fill(const char* prefix, const char* cursor, std::uint32_t count)
+    {
+        _cache.Refill(&_directory, prefix, cursor);
+
+        // offered in reverse order as directory walk is not sorted
+        for (auto i = count; i > 0; i--)
+        {
+            sprintf(_names[i - 1], "f%02u", static_cast<unsigned int>(i - 1));
+            _cache.Offer(_names[i - 1], i - 1);
+        }
+    }
+
+    TEST_F(DirectoryCacheTest, ShouldNotCoverAnythingWhenEmpty)
+    {
+        ASSERT_THAT(_cache.Covers(&_directory, "", ""), Eq(false));
+    }
+
+    TEST_F(DirectoryCacheTest, ShouldKeepWholeSmallDirectorySorted)
+    {
+        Fill("", "", 5);
+
+        ASSERT_THAT(_cache.Complete(), Eq(true));
+        ASSERT_THAT(_cache.Covers(&_directory, "", ""), Eq(true));
+        ASSERT_THAT(_cache.Covers(&_directory, "", "f03"), Eq(true));
+
+        auto entries = _cache.After("f01");
+        ASSERT_THAT(entries.size(), Eq(3));
+        ASSERT_THAT(entries[0].Name, StrEq("f02"));
+        ASSERT_THAT(entries[0].ObjectId, Eq(2U));
+        ASSERT_THAT(entries[2].Name, StrEq("f04"));
+    }
+
+    TEST_F(DirectoryCacheTest, ShouldKeepSmallestNamesAfterCursorWhenDirectoryIsLarge)
+    {
+        Fill("", "f03", 20);
+
+        ASSERT_THAT(_cache.Complete(), Eq(false));
+
+        auto entries = _cache.After("f03");
+        ASSERT_THAT(entries.size(), Eq(static_cast<std::ptrdiff_t>(DirectoryCache::Capacity)));
+        ASSERT_THAT(entries[0].Name, StrEq("f04"));
+        ASSERT_THAT(entries[DirectoryCache::Capacity - 1].Name, StrEq("f11"));
+
+        ASSERT_THAT(_cache.Covers(&_directory, "", "f10"), Eq(true));
+        ASSERT_THAT(_cache.Covers(&_directory, "", "f11"), Eq(false));
+        ASSERT_THAT(_cache.Covers(&_directory, "", "f02"), Eq(false));
+    }
+
+    TEST_F(DirectoryCacheTest, ShouldFilterByPrefix)
+    {
+        Fill("f1", "", 20);
+
+        ASSERT_THAT(_cache.Complete(), Eq(false));
+
+        auto entries = _cache.After("");
+        ASSERT_THAT(entries[0].Name, StrEq("f10"));
+
+        ASSERT_THAT(_cache.Covers(&_directory, "f1", ""), Eq(true));
+        ASSERT_THAT(_cache.Covers(&_directory, "f0", ""), Eq(false));
+    }
+
+    TEST_F(DirectoryCacheTest, ShouldNotCoverAfterInvalidation)
+    {
+        Fill("", "", 3);
+
+        _cache.Invalidate();
+
+        ASSERT_THAT(_cache.Covers(&_directory, "", ""), Eq(false));
+        ASSERT_THAT(_cache.After("").size(), Eq(0));
+    }
+
+    TEST_F(DirectoryCacheTest, ShouldNotCoverOtherDirectory)
+    {
+        int otherDirectory;
+
+        Fill("", "", 3);
+
+        ASSERT_THAT(_cache.Covers(&otherDirectory, "", ""), Eq(false));
+    }
+}
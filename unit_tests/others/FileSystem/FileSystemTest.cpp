@@ -1,8 +1,12 @@
 #include <stdio.h>
+#include <vector>
 #include "gtest/gtest.h"
-#include "gmock/gmock-matchers.h"
+#include "gmock/gmock.h"
+#include "OsMock.hpp"
 #include "fs/yaffs.h"
+#include "os/os.hpp"
 #include "yaffs.hpp"
+#include "yaffs_getblockinfo.h"
 
 #include "FileSystem/MemoryDriver.hpp"
 
@@ -13,12 +17,70 @@ using testing::StrEq;
 using testing::Eq;
 using testing::Ne;
 using testing::Ge;
+using testing::Gt;
+using testing::Lt;
+using testing::Contains;
+using testing::Not;
 using testing::Test;
+using testing::Return;
+using testing::NiceMock;
+using testing::_;
 using namespace services::fs;
+using namespace std::chrono_literals;
 
 extern "C" void yaffs_remove_device(struct yaffs_dev* dev);
 namespace
 {
+    /** @brief Erase-ahead device with fixed number of blocks waiting for erasure */
+    struct EraseAheadDeviceFake : public IEraseAheadDevice
+    {
+        virtual bool EraseNext() override
+        {
+            if (Pending == 0)
+            {
+                return false;
+            }
+
+            Pending--;
+            Erased++;
+            return true;
+        }
+
+        std::uint16_t Pending = 0;
+        std::uint16_t Erased = 0;
+    };
+
+    /** @brief Blocks with deferred erasure */
+    std::vector<int> DeferredBlocks;
+
+    /** @brief Number of erased blocks requested by each flush */
+    std::vector<int> FlushRequests;
+
+    int DeferErase(struct yaffs_dev* /*dev*/, int block_no)
+    {
+        DeferredBlocks.push_back(block_no);
+        return YAFFS_OK;
+    }
+
+    int FlushErases(struct yaffs_dev* dev, int min_erased)
+    {
+        FlushRequests.push_back(min_erased);
+
+        while (!DeferredBlocks.empty() && (min_erased < 0 || dev->n_erased_blocks < min_erased))
+        {
+            const auto block = DeferredBlocks.front();
+            if (dev->drv.drv_erase_fn(dev, block - dev->block_offset) != YAFFS_OK)
+            {
+                return YAFFS_FAIL;
+            }
+
+            yaffs_block_erased(dev, block);
+            DeferredBlocks.erase(DeferredBlocks.begin());
+        }
+
+        return YAFFS_OK;
+    }
+
     class FileSystemTest : public Test
     {
       protected:
@@ -437,4 +499,247 @@ namespace
 
         yaffs_unmount("/");
     }
+
+    TEST_F(FileSystemTest, ShouldReportNoReserveWithoutMaintenance)
+    {
+        yaffs_mount("/");
+
+        ASSERT_THAT(api.ErasedReserve(), Eq(0));
+        ASSERT_THAT(api.RunMaintenance(), Eq(false));
+
+        yaffs_unmount("/");
+    }
+
+    TEST_F(FileSystemTest, ShouldEraseAheadBeforeCollectingGarbage)
+    {
+        NiceMock<OSMock> os;
+        auto osReset = InstallProxy(&os);
+        ON_CALL(os, CreateTask(_, _, _, _, _, _)).WillByDefault(Return(OSResult::Success));
+
+        EraseAheadDeviceFake eraseAhead;
+        eraseAhead.Pending = 2;
+
+        yaffs_mount("/");
+
+        ASSERT_THAT(api.StartMaintenance(&device, eraseAhead, 4), Eq(OSResult::Success));
+        ASSERT_THAT(api.ErasedReserve(), Eq(device.n_erased_blocks));
+
+        ASSERT_THAT(api.RunMaintenance(), Eq(true));
+        ASSERT_THAT(api.RunMaintenance(), Eq(true));
+        ASSERT_THAT(eraseAhead.Erased, Eq(2));
+
+        // fresh file system has plenty of erased blocks and nothing to collect
+        ASSERT_THAT(api.RunMaintenance(), Eq(false));
+
+        ASSERT_THAT(api.StartMaintenance(&device, eraseAhead, 4), Ne(OSResult::Success));
+
+        yaffs_unmount("/");
+    }
+
+    TEST_F(FileSystemTest, ShouldKeepReleasedBlocksDirtyUntilErased)
+    {
+        DeferredBlocks.clear();
+        device.drv.drv_defer_erase_fn = DeferErase;
+        device.drv.drv_flush_erases_fn = FlushErases;
+        // summary chunks would keep released blocks in use
+        device.param.disable_summary = 1;
+
+        yaffs_mount("/");
+
+        auto file = yaffs_open("/file", O_CREAT | O_WRONLY, S_IRWXU);
+        std::uint8_t buffer[1024] = {0};
+        for (auto i = 0; i < 40; i++)
+        {
+            yaffs_write(file, buffer, sizeof(buffer));
+        }
+        yaffs_close(file);
+
+        const auto erasedBefore = device.n_erased_blocks;
+        yaffs_unlink("/file");
+
+        ASSERT_THAT(DeferredBlocks.size(), Ge(1U));
+        ASSERT_THAT(device.n_erased_blocks, Eq(erasedBefore));
+        for (auto block : DeferredBlocks)
+        {
+            ASSERT_THAT(yaffs_get_block_info(&device, block)->block_state, Eq(YAFFS_BLOCK_STATE_DIRTY));
+        }
+
+        const auto deferred = DeferredBlocks;
+        yaffs_sync("/");
+
+        ASSERT_THAT(DeferredBlocks.size(), Eq(0U));
+        // checkpoint written by sync takes erased blocks
+        ASSERT_THAT(device.n_erased_blocks + device.blocks_in_checkpt, Eq(erasedBefore + static_cast<int>(deferred.size())));
+        for (auto block : deferred)
+        {
+            ASSERT_THAT(yaffs_get_block_info(&device, block)->block_state, Ne(YAFFS_BLOCK_STATE_DIRTY));
+        }
+
+        yaffs_unmount("/");
+    }
+
+    TEST_F(FileSystemTest, ShouldFlushOnlyErasesNeededByGarbageCollection)
+    {
+        DeferredBlocks.clear();
+        FlushRequests.clear();
+        device.drv.drv_defer_erase_fn = DeferErase;
+        device.drv.drv_flush_erases_fn = FlushErases;
+        device.param.disable_summary = 1;
+
+        yaffs_mount("/");
+
+        std::uint8_t buffer[1024] = {0};
+        auto file = yaffs_open("/released", O_CREAT | O_WRONLY, S_IRWXU);
+        for (auto i = 0; i < 256; i++)
+        {
+            yaffs_write(file, buffer, sizeof(buffer));
+        }
+        yaffs_close(file);
+
+        file = yaffs_open("/full", O_CREAT | O_WRONLY, S_IRWXU);
+        FillDevice(file);
+        yaffs_close(file);
+
+        // device is left with many released blocks and no erased ones to spare
+        yaffs_unlink("/released");
+        const auto released = DeferredBlocks.size();
+
+        file = yaffs_open("/file", O_CREAT | O_WRONLY, S_IRWXU);
+        yaffs_write(file, buffer, sizeof(buffer));
+
+        ASSERT_THAT(FlushRequests, Contains(Gt(0)));
+        ASSERT_THAT(FlushRequests, Not(Contains(YAFFS_FLUSH_ALL_ERASES)));
+        // garbage collection got its blocks while others still wait for background erase
+        ASSERT_THAT(DeferredBlocks.size(), Gt(0U));
+        ASSERT_THAT(DeferredBlocks.size(), Lt(released));
+
+        yaffs_close(file);
+        yaffs_unmount("/");
+
+        ASSERT_THAT(FlushRequests.back(), Eq(YAFFS_FLUSH_ALL_ERASES));
+        ASSERT_THAT(DeferredBlocks.size(), Eq(0U));
+    }
+
+    TEST_F(FileSystemTest, ShouldTrackWorstWriteLatency)
+    {
+        NiceMock<OSMock> os;
+        auto osReset = InstallProxy(&os);
+        EXPECT_CALL(os, GetUptime()).WillOnce(Return(10ms)).WillOnce(Return(35ms)).WillOnce(Return(40ms)).WillOnce(Return(45ms));
+
+        yaffs_mount("/");
+
+        auto file = api.Open("/file", FileOpen::CreateAlways, FileAccess::WriteOnly);
+        std::uint8_t buffer[16] = {0};
+
+        api.Write(file.Result, buffer);
+        api.Write(file.Result, buffer);
+        api.Close(file.Result);
+
+        ASSERT_THAT(api.TakeWorstWriteLatency(), Eq(25ms));
+        ASSERT_THAT(api.TakeWorstWriteLatency(), Eq(0ms));
+
+        yaffs_unmount("/");
+    }
+
+    TEST_F(FileSystemTest, ShouldListDirectoryPageByPage)
+    {
+        yaffs_mount("/");
+        api.MakeDirectory("/dir");
+
+        char path[20];
+        std::uint8_t buffer[16] = {0};
+
+        for (auto i = 11; i >= 0; i--)
+        {
+            sprintf(path, "/dir/file%02d", i);
+            auto file = api.Open(path, FileOpen::CreateAlways, FileAccess::WriteOnly);
+            api.Write(file.Result, gsl::make_span(buffer).first(i));
+            api.Close(file.Result);
+        }
+
+        std::array<DirectoryEntry, 5> entries;
+        char cursor[MaxListedNameLength + 1] = "";
+        int listed = 0;
+
+        for (auto expectedCount : {5U, 5U, 2U})
+        {
+            auto result = api.ListDirectory("/dir", cursor, nullptr, entries);
+
+            ASSERT_THAT(result.Status, Eq(OSResult::Success));
+            ASSERT_THAT(result.Result, Eq(expectedCount));
+
+            for (std::size_t i = 0; i < result.Result; i++, listed++)
+            {
+                sprintf(path, "file%02d", listed);
+                ASSERT_THAT(entries[i].Name, StrEq(path));
+                ASSERT_THAT(entries[i].Size, Eq(listed));
+            }
+
+            strcpy(cursor, entries[result.Result - 1].Name);
+        }
+
+        yaffs_unmount("/");
+    }
+
+    TEST_F(FileSystemTest, ShouldListOnlyEntriesMatchingPrefix)
+    {
+        yaffs_mount("/");
+
+        for (auto path : {"/log2", "/photo1", "/log1", "/photo2", "/log3"})
+        {
+            api.Close(api.Open(path, FileOpen::CreateAlways, FileAccess::WriteOnly).Result);
+        }
+
+        std::array<DirectoryEntry, 10> entries;
+        auto result = api.ListDirectory("/", "log1", "log", entries);
+
+        ASSERT_THAT(result.Status, Eq(OSResult::Success));
+        ASSERT_THAT(result.Result, Eq(2U));
+        ASSERT_THAT(entries[0].Name, StrEq("log2"));
+        ASSERT_THAT(entries[1].Name, StrEq("log3"));
+
+        yaffs_unmount("/");
+    }
+
+    TEST_F(FileSystemTest, ShouldSeeDirectoryChangesBetweenPages)
+    {
+        yaffs_mount("/");
+        api.MakeDirectory("/dir");
+
+        for (auto path : {"/dir/a", "/dir/c", "/dir/e"})
+        {
+            api.Close(api.Open(path, FileOpen::CreateAlways, FileAccess::WriteOnly).Result);
+        }
+
+        std::array<DirectoryEntry, 1> entries;
+        ASSERT_THAT(api.ListDirectory("/dir", nullptr, nullptr, entries).Result, Eq(1U));
+        ASSERT_THAT(entries[0].Name, StrEq("a"));
+
+        api.Close(api.Open("/dir/b", FileOpen::CreateAlways, FileAccess::WriteOnly).Result);
+        api.Unlink("/dir/c");
+        api.Copy("/dir/a", "/dir/d");
+
+        std::array<DirectoryEntry, 5> rest;
+        auto result = api.ListDirectory("/dir", "a", nullptr, rest);
+
+        ASSERT_THAT(result.Result, Eq(3U));
+        ASSERT_THAT(rest[0].Name, StrEq("b"));
+        ASSERT_THAT(rest[1].Name, StrEq("d"));
+        ASSERT_THAT(rest[2].Name, StrEq("e"));
+
+        yaffs_unmount("/");
+    }
+
+    TEST_F(FileSystemTest, ShouldRejectListingOfMissingDirectoryOrFile)
+    {
+        yaffs_mount("/");
+        api.Close(api.Open("/file", FileOpen::CreateAlways, FileAccess::WriteOnly).Result);
+
+        std::array<DirectoryEntry, 1> entries;
+
+        ASSERT_THAT(api.ListDirectory("/missing", nullptr, nullptr, entries).Status, Eq(OSResult::NotFound));
+        ASSERT_THAT(api.ListDirectory("/file", nullptr, nullptr, entries).Status, Eq(OSResult::NotADirectory));
+
+        yaffs_unmount("/");
+    }
 }
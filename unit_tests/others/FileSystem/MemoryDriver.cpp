@@ -131,10 +131,10 @@ static FlashStatus EraseBlock(FlashNANDInterface* interface, uint32_t offset)
         return FlashStatusWriteError;
     }
 
-    uint32_t spareAddress = blockNo * 32 * 16;
+    uint8_t* spareBase = context->spare + blockNo * 32 * 16;
 
     memset((void*)(context->memory + offset), 0xFF, 32 * 512);
-    memset((void*)spareAddress, 0xFF, 32 * 16);
+    memset(spareBase, 0xFF, 32 * 16);
 
     return FlashStatusOK;
 }
@@ -0,0 +1,132 @@
+#include <array>
+#include <cstdint>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "OsMock.hpp"
+#include "fs/yaffs_pools.hpp"
+#include "os/os.hpp"
+
+using testing::_;
+using testing::Eq;
+using testing::Ne;
+using testing::IsNull;
+using testing::Return;
+using testing::NiceMock;
+using services::fs::PoolFallback;
+using services::fs::YaffsMemoryPools;
+
+namespace
+{
+    using Pools = YaffsMemoryPools<512, 32, 60, 8>;
+
+    class YaffsMemoryPoolsTest : public testing::Test
+    {
+      protected:
+        YaffsMemoryPoolsTest();
+
+        NiceMock<OSMock> _os;
+        OSReset _osReset;
+
+        std::array<std::uint8_t, 4096> _heap;
+    };
+
+    YaffsMemoryPoolsTest::YaffsMemoryPoolsTest()
+    {
+        this->_osReset = InstallProxy(&this->_os);
+        ON_CALL(this->_os, Alloc(_)).WillByDefault(Return(this->_heap.data()));
+    }
+
+    TEST_F(YaffsMemoryPoolsTest, ShouldMirrorYaffsTnodeGeometry)
+    {
+        const std::size_t width = Pools::TnodeWidth;
+        ASSERT_THAT(width, Eq(16U));
+        ASSERT_THAT(services::fs::details::CalculateTnodeWidth(70000), Eq(18U));
+        ASSERT_THAT(services::fs::details::CalculateTnodeWidth(1 << 17), Eq(18U));
+        ASSERT_THAT(services::fs::details::CalculateTnodeWidth((1 << 17) + 1), Eq(18U));
+        ASSERT_THAT(services::fs::details::CalculateTnodeWidth((1 << 18) + 1), Eq(20U));
+    }
+
+    TEST_F(YaffsMemoryPoolsTest, ShouldServeYaffsAllocationsFromPools)
+    {
+        Pools pools;
+        EXPECT_CALL(this->_os, Alloc(_)).Times(0);
+
+        auto list = pools.Allocate(8);
+        auto tnodes = pools.Allocate(Pools::TnodeBatchSize);
+        auto objects = pools.Allocate(Pools::ObjectBatchSize);
+        auto chunk = pools.Allocate(512);
+        auto data = pools.Allocate(496);
+
+        ASSERT_THAT(list, Ne(nullptr));
+        ASSERT_THAT(tnodes, Ne(nullptr));
+        ASSERT_THAT(objects, Ne(nullptr));
+        ASSERT_THAT(chunk, Ne(nullptr));
+        ASSERT_THAT(data, Ne(nullptr));
+
+        auto statistics = pools.Statistics();
+        ASSERT_THAT(statistics.Small.InUse, Eq(1));
+        ASSERT_THAT(statistics.Tnodes.InUse, Eq(1));
+        ASSERT_THAT(statistics.Objects.InUse, Eq(1));
+        ASSERT_THAT(statistics.ChunkBuffers.InUse, Eq(2));
+        ASSERT_THAT(statistics.HeapAllocations, Eq(0U));
+        ASSERT_THAT(statistics.Exhausted(), Eq(false));
+    }
+
+    TEST_F(YaffsMemoryPoolsTest, ShouldReturnBlocksToPools)
+    {
+        Pools pools;
+
+        auto tnodes = pools.Allocate(Pools::TnodeBatchSize);
+        pools.Free(tnodes);
+
+        ASSERT_THAT(pools.Statistics().Tnodes.InUse, Eq(0));
+        ASSERT_THAT(pools.Allocate(Pools::TnodeBatchSize), Eq(tnodes));
+        ASSERT_THAT(pools.Statistics().Tnodes.HighWaterMark, Eq(1));
+    }
+
+    TEST_F(YaffsMemoryPoolsTest, ShouldTakeOtherSizesFromHeap)
+    {
+        Pools pools;
+        EXPECT_CALL(this->_os, Alloc(1000)).WillOnce(Return(this->_heap.data()));
+        EXPECT_CALL(this->_os, Free(this->_heap.data()));
+
+        auto table = pools.Allocate(1000);
+        ASSERT_THAT(table, Eq(this->_heap.data()));
+        ASSERT_THAT(pools.Statistics().HeapAllocations, Eq(1U));
+
+        pools.Free(table);
+    }
+
+    TEST_F(YaffsMemoryPoolsTest, ShouldFallBackToHeapWhenPoolIsExhausted)
+    {
+        Pools pools;
+
+        for (std::size_t i = 0; i < Pools::ChunkBuffers; i++)
+        {
+            pools.Allocate(512);
+        }
+
+        EXPECT_CALL(this->_os, Alloc(512)).WillOnce(Return(this->_heap.data()));
+
+        ASSERT_THAT(pools.Allocate(512), Eq(this->_heap.data()));
+
+        auto statistics = pools.Statistics();
+        ASSERT_THAT(statistics.ChunkBuffers.Exhaustions, Eq(1U));
+        ASSERT_THAT(statistics.HeapAllocations, Eq(1U));
+        ASSERT_THAT(statistics.Exhausted(), Eq(true));
+    }
+
+    TEST_F(YaffsMemoryPoolsTest, ShouldFailWhenPoolIsExhaustedAndFallbackIsDisabled)
+    {
+        Pools pools(PoolFallback::Fail);
+        EXPECT_CALL(this->_os, Alloc(_)).Times(0);
+
+        for (std::size_t i = 0; i < Pools::ObjectBatches; i++)
+        {
+            ASSERT_THAT(pools.Allocate(Pools::ObjectBatchSize), Ne(nullptr));
+        }
+
+        ASSERT_THAT(pools.Allocate(Pools::ObjectBatchSize), IsNull());
+        ASSERT_THAT(pools.Statistics().Objects.Exhaustions, Eq(1U));
+    }
+}
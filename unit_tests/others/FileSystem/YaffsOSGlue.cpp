@@ -3,6 +3,7 @@
 #include <stdio.h>
 #include <yaffs_trace.h>
 #include <yaffsfs.h>
+#include "fs/yaffs_pools.hpp"
 #include "heap.h"
 #include "system.h"
 
@@ -85,6 +86,6 @@ void yaffs_log(const char* fmt, ...)
     va_end(args);
 }
 }
-void YaffsGlueInit(void)
+void YaffsGlueInit(services::fs::IYaffsMemoryPools* /*pools*/)
 {
 }
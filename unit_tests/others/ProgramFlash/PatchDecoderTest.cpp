@@ -0,0 +1,117 @@
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "program_flash/patch.hpp"
+
+using testing::Eq;
+using testing::ElementsAreArray;
+using program_flash::PatchDecoder;
+using program_flash::PatchStatus;
+
+namespace
+{
+    class PatchDecoderTest : public testing::Test
+    {
+      protected:
+        PatchDecoderTest();
+
+        PatchStatus DecodeAll(gsl::span<const std::uint8_t> patch, std::size_t inputStep, std::size_t outputStep);
+
+        const std::string _source;
+
+        PatchDecoder _decoder;
+
+        std::vector<std::uint8_t> _output;
+    };
+
+    PatchDecoderTest::PatchDecoderTest() : _source("Hello World!")
+    {
+        this->_decoder.Reset(gsl::make_span(reinterpret_cast<const std::uint8_t*>(_source.data()), _source.size()));
+    }
+
+    PatchStatus PatchDecoderTest::DecodeAll(gsl::span<const std::uint8_t> patch, std::size_t inputStep, std::size_t outputStep)
+    {
+        std::array<std::uint8_t, 32> buffer;
+        std::size_t position = 0;
+
+        while (true)
+        {
+            auto part = patch.subspan(position, std::min<std::size_t>(inputStep, patch.size() - position));
+
+            std::size_t consumed = 0;
+            std::size_t produced = 0;
+
+            auto status = this->_decoder.Decode(part, gsl::make_span(buffer).subspan(0, outputStep), consumed, produced);
+            if (status != PatchStatus::Ok)
+            {
+                return status;
+            }
+
+            this->_output.insert(this->_output.end(), buffer.begin(), buffer.begin() + produced);
+            position += consumed;
+
+            if (position == static_cast<std::size_t>(patch.size()) && produced == 0)
+            {
+                return PatchStatus::Ok;
+            }
+        }
+    }
+
+    TEST_F(PatchDecoderTest, ShouldApplyAllOperations)
+    {
+        std::uint8_t patch[] = {
+            0, 0, 0, 0, 0, 6, 0, 0, 0,         // copy "Hello "
+            2, 5, 0, 0, 0, 'P', 'a', 't', 'c', 'h', // insert "Patch"
+            0, 11, 0, 0, 0, 1, 0, 0, 0,        // copy "!"
+            1, 6, 0, 0, 0, 2, 0, 0, 0, 1, 0xFF // add to "Wo"
+        };
+
+        const std::string expected("Hello Patch!Xn");
+
+        for (std::size_t inputStep = 1; inputStep <= sizeof(patch); inputStep += 3)
+        {
+            for (std::size_t outputStep = 1; outputStep <= 16; outputStep += 5)
+            {
+                this->_decoder.Reset(gsl::make_span(reinterpret_cast<const std::uint8_t*>(_source.data()), _source.size()));
+                this->_output.clear();
+
+                ASSERT_THAT(DecodeAll(patch, inputStep, outputStep), Eq(PatchStatus::Ok));
+                ASSERT_THAT(this->_output, ElementsAreArray(expected.begin(), expected.end())) << inputStep << "/" << outputStep;
+                ASSERT_THAT(this->_decoder.TotalProduced(), Eq(expected.size()));
+                ASSERT_THAT(this->_decoder.IsIdle(), Eq(true));
+            }
+        }
+    }
+
+    TEST_F(PatchDecoderTest, ShouldRejectUnknownOperation)
+    {
+        std::uint8_t patch[] = {3, 0, 0, 0, 0};
+
+        ASSERT_THAT(DecodeAll(patch, sizeof(patch), 16), Eq(PatchStatus::InvalidOperation));
+    }
+
+    TEST_F(PatchDecoderTest, ShouldRejectCopyBeyondSource)
+    {
+        std::uint8_t patch[] = {0, 10, 0, 0, 0, 3, 0, 0, 0};
+
+        ASSERT_THAT(DecodeAll(patch, sizeof(patch), 16), Eq(PatchStatus::SourceOutOfRange));
+    }
+
+    TEST_F(PatchDecoderTest, ShouldRejectAddBeyondSource)
+    {
+        std::uint8_t patch[] = {1, 0xFF, 0xFF, 0xFF, 0xFF, 2, 0, 0, 0};
+
+        ASSERT_THAT(DecodeAll(patch, sizeof(patch), 16), Eq(PatchStatus::SourceOutOfRange));
+    }
+
+    TEST_F(PatchDecoderTest, ShouldReportPartialOperationAsNotIdle)
+    {
+        std::uint8_t patch[] = {2, 4, 0, 0, 0, 'a', 'b'};
+
+        ASSERT_THAT(DecodeAll(patch, sizeof(patch), 16), Eq(PatchStatus::Ok));
+        ASSERT_THAT(this->_decoder.IsIdle(), Eq(false));
+    }
+}
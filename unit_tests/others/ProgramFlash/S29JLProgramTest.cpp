@@ -0,0 +1,138 @@
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "OsMock.hpp"
+#include "mock/flash_driver_fake.hpp"
+
+using testing::Eq;
+using testing::Each;
+using testing::ElementsAreArray;
+using testing::Invoke;
+using testing::NiceMock;
+using program_flash::FlashStatus;
+
+namespace
+{
+    class S29JLProgramTest : public testing::Test
+    {
+      protected:
+        S29JLProgramTest();
+
+        std::array<std::uint8_t, 256> _storage;
+
+        FlashDriverFake _flash;
+    };
+
+    S29JLProgramTest::S29JLProgramTest() : _flash(_storage, 10)
+    {
+    }
+
+    TEST_F(S29JLProgramTest, ShouldProgramBytesInUnlockBypassMode)
+    {
+        std::uint8_t data[] = {1, 2, 3, 4};
+
+        ASSERT_THAT(this->_flash.Program(16, data), Eq(FlashStatus::NotBusy));
+
+        ASSERT_THAT(gsl::make_span(this->_storage).subspan(16, 4), ElementsAreArray(data));
+        ASSERT_THAT(this->_flash.ProgramCycles(), Eq(4U));
+        ASSERT_THAT(this->_flash.InUnlockBypass(), Eq(false));
+        ASSERT_THAT(this->_flash.Resets(), Eq(0U));
+        // single poll checking that device is idle before programming
+        ASSERT_THAT(this->_flash.Ticks(), Eq(this->_flash.BusyTicks() + 1));
+    }
+
+    TEST_F(S29JLProgramTest, ShouldReportVerifyErrorWhenAreaIsNotErased)
+    {
+        std::uint8_t data[] = {0xF0, 0xF0, 0xF0, 0xF0};
+        this->_storage[17] = 0x0F;
+
+        ASSERT_THAT(this->_flash.Program(16, data), Eq(FlashStatus::VerifyError));
+
+        ASSERT_THAT(this->_flash.ProgramCycles(), Eq(2U));
+        ASSERT_THAT(this->_storage[18], Eq(0xFF));
+        ASSERT_THAT(this->_flash.InUnlockBypass(), Eq(false));
+        ASSERT_THAT(this->_flash.Resets(), Eq(0U));
+    }
+
+    TEST_F(S29JLProgramTest, ShouldResetDeviceOutOfStatusModeWhenByteFails)
+    {
+        std::uint8_t data[] = {1, 2, 3, 4};
+        this->_flash.FailProgramAt(18, FlashStatus::ExceededTimeLimits);
+
+        ASSERT_THAT(this->_flash.Program(16, data), Eq(FlashStatus::ExceededTimeLimits));
+
+        ASSERT_THAT(this->_flash.ProgramCycles(), Eq(2U));
+        ASSERT_THAT(this->_flash.Resets(), Eq(1U));
+        ASSERT_THAT(this->_flash.InStatusMode(), Eq(false));
+        ASSERT_THAT(this->_flash.InUnlockBypass(), Eq(false));
+
+        ASSERT_THAT(this->_flash.Program(32, data), Eq(FlashStatus::NotBusy));
+        ASSERT_THAT(gsl::make_span(this->_storage).subspan(32, 4), ElementsAreArray(data));
+    }
+
+    TEST_F(S29JLProgramTest, ShouldReportBusyWhenDeviceDoesNotBecomeIdle)
+    {
+        NiceMock<OSMock> os;
+        auto osReset = InstallProxy(&os);
+        ON_CALL(os, GetUptime()).WillByDefault(Invoke([this]() { return std::chrono::milliseconds(this->_flash.Ticks()); }));
+
+        std::uint8_t data[] = {1, 2, 3, 4};
+        this->_flash.HoldBusy(20000);
+
+        ASSERT_THAT(this->_flash.Program(16, data), Eq(FlashStatus::Busy));
+
+        ASSERT_THAT(this->_flash.ProgramCycles(), Eq(0U));
+        ASSERT_THAT(gsl::make_span(this->_storage).subspan(16, 4), Each(Eq(0xFF)));
+        ASSERT_THAT(this->_flash.InUnlockBypass(), Eq(false));
+    }
+
+    TEST_F(S29JLProgramTest, ShouldProgramSameBytesAtMultipleOffsets)
+    {
+        std::uint8_t data[] = {1, 2, 3, 4};
+        std::size_t offsets[] = {0, 64, 128};
+        std::size_t failedOffset = 0xFF;
+
+        ASSERT_THAT(this->_flash.ProgramMultiple(offsets, data, failedOffset), Eq(FlashStatus::NotBusy));
+
+        for (auto offset : offsets)
+        {
+            ASSERT_THAT(gsl::make_span(this->_storage).subspan(offset, 4), ElementsAreArray(data));
+        }
+
+        ASSERT_THAT(failedOffset, Eq(0xFFU));
+        ASSERT_THAT(this->_flash.ProgramCycles(), Eq(12U));
+        ASSERT_THAT(this->_flash.Ticks(), Eq(this->_flash.BusyTicks()));
+        ASSERT_THAT(this->_flash.InUnlockBypass(), Eq(false));
+    }
+
+    TEST_F(S29JLProgramTest, ShouldReportOffsetAtWhichProgrammingMultipleOffsetsFailed)
+    {
+        std::uint8_t data[] = {1, 2, 3, 4};
+        std::size_t offsets[] = {0, 64, 128};
+        std::size_t failedOffset = 0xFF;
+        this->_flash.FailProgramAt(64 + 2, FlashStatus::ExceededTimeLimits);
+
+        ASSERT_THAT(this->_flash.ProgramMultiple(offsets, data, failedOffset), Eq(FlashStatus::ExceededTimeLimits));
+
+        ASSERT_THAT(failedOffset, Eq(1U));
+        ASSERT_THAT(this->_flash.Resets(), Eq(1U));
+        ASSERT_THAT(this->_flash.InStatusMode(), Eq(false));
+        ASSERT_THAT(this->_flash.InUnlockBypass(), Eq(false));
+    }
+
+    TEST_F(S29JLProgramTest, ShouldReportOffsetThatFailedVerificationAfterProgrammingMultipleOffsets)
+    {
+        std::uint8_t data[] = {1, 2, 3, 4};
+        std::size_t offsets[] = {0, 64, 128};
+        std::size_t failedOffset = 0xFF;
+        this->_storage[130] = 0x00;
+
+        ASSERT_THAT(this->_flash.ProgramMultiple(offsets, data, failedOffset), Eq(FlashStatus::VerifyError));
+
+        ASSERT_THAT(failedOffset, Eq(2U));
+        ASSERT_THAT(this->_flash.Resets(), Eq(0U));
+        ASSERT_THAT(this->_flash.InUnlockBypass(), Eq(false));
+    }
+}
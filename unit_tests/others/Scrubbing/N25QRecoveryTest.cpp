@@ -0,0 +1,326 @@
+#include <algorithm>
+#include <map>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "n25q/n25q.h"
+#include "scrubber/n25q.hpp"
+#include "shared.hpp"
+
+using testing::Eq;
+using devices::n25q::FlagStatus;
+using devices::n25q::OperationResult;
+using devices::n25q::OperationWaiter;
+using scrubber::N25QRecovery;
+
+namespace
+{
+    /** @brief N25Q fake keeping only bytes that differ from erased state */
+    class FakeN25Q : public devices::n25q::IN25QDriver
+    {
+      public:
+        virtual OSResult ReadMemory(std::size_t address, gsl::span<uint8_t> buffer) override
+        {
+            Reads++;
+
+            if (FailReads)
+            {
+                return OSResult::IOError;
+            }
+
+            for (std::ptrdiff_t i = 0; i < buffer.size(); i++)
+            {
+                buffer[i] = Get(address + i);
+            }
+
+            return OSResult::Success;
+        }
+
+        virtual OperationWaiter BeginWritePage(size_t address, ptrdiff_t offset, gsl::span<const uint8_t> page) override
+        {
+            for (std::ptrdiff_t i = 0; i < page.size(); i++)
+            {
+                Set(address + offset + i, Get(address + offset + i) & page[i]);
+            }
+
+            return OperationWaiter(this, std::chrono::milliseconds(0), FlagStatus::Clear);
+        }
+
+        virtual OperationWaiter BeginEraseSubSector(size_t address) override
+        {
+            SubSectorErases++;
+            Erase(address, 4_KB);
+            return OperationWaiter(this, std::chrono::milliseconds(0), FlagStatus::Clear);
+        }
+
+        virtual OperationWaiter BeginEraseSector(size_t address) override
+        {
+            SectorErases++;
+            Erase(address, 64_KB);
+            return OperationWaiter(this, std::chrono::milliseconds(0), FlagStatus::Clear);
+        }
+
+        virtual OperationWaiter BeginEraseChip() override
+        {
+            Memory.clear();
+            return OperationWaiter(this, std::chrono::milliseconds(0), FlagStatus::Clear);
+        }
+
+        virtual OperationResult Reset() override
+        {
+            return OperationResult::Success;
+        }
+
+        virtual OperationResult WaitForOperation(std::chrono::milliseconds /*timeout*/, FlagStatus /*status*/) override
+        {
+            return OperationResult::Success;
+        }
+
+        virtual bool IsBusy() override
+        {
+            return false;
+        }
+
+        std::uint8_t Get(std::size_t address) const
+        {
+            auto it = Memory.find(address);
+            return it == Memory.end() ? 0xFF : it->second;
+        }
+
+        void Set(std::size_t address, std::uint8_t value)
+        {
+            if (value == 0xFF)
+            {
+                Memory.erase(address);
+            }
+            else
+            {
+                Memory[address] = value;
+            }
+        }
+
+        std::map<std::size_t, std::uint8_t> Memory;
+        bool FailReads = false;
+        std::uint32_t Reads = 0;
+        std::uint32_t SubSectorErases = 0;
+        std::uint32_t SectorErases = 0;
+
+      private:
+        void Erase(std::size_t address, std::size_t size)
+        {
+            Memory.erase(Memory.lower_bound(address), Memory.lower_bound(address + size));
+        }
+    };
+
+    /** @brief FRAM fake */
+    class FakeFram : public devices::fm25w::IFM25WDriver
+    {
+      public:
+        FakeFram()
+        {
+            Memory.fill(0);
+        }
+
+        virtual Option<devices::fm25w::Status> ReadStatus() override
+        {
+            return None<devices::fm25w::Status>();
+        }
+
+        virtual void Read(devices::fm25w::Address address, gsl::span<std::uint8_t> buffer) override
+        {
+            std::copy_n(Memory.begin() + address, buffer.size(), buffer.begin());
+        }
+
+        virtual void Write(devices::fm25w::Address address, gsl::span<const std::uint8_t> buffer) override
+        {
+            std::copy(buffer.begin(), buffer.end(), Memory.begin() + address);
+        }
+
+        std::array<std::uint8_t, 32> Memory;
+    };
+
+    class N25QRecoveryTest : public testing::Test
+    {
+      protected:
+        N25QRecovery MakeRecovery();
+
+        void SetOnAll(std::size_t address, std::uint8_t value);
+
+        FakeN25Q _flash1;
+        FakeN25Q _flash2;
+        FakeN25Q _flash3;
+        FakeFram _fram;
+
+        static constexpr std::uint16_t BlocksCount = 4;
+        static constexpr devices::fm25w::Address ProgressAddress = 8;
+    };
+
+    constexpr std::uint16_t N25QRecoveryTest::BlocksCount;
+    constexpr devices::fm25w::Address N25QRecoveryTest::ProgressAddress;
+
+    N25QRecovery N25QRecoveryTest::MakeRecovery()
+    {
+        return N25QRecovery(ScrubbingBuffer, {&_flash1, &_flash2, &_flash3}, _fram, ProgressAddress, BlocksCount);
+    }
+
+    void N25QRecoveryTest::SetOnAll(std::size_t address, std::uint8_t value)
+    {
+        _flash1.Set(address, value);
+        _flash2.Set(address, value);
+        _flash3.Set(address, value);
+    }
+
+    TEST_F(N25QRecoveryTest, ShouldLeaveConsistentBlocksUntouched)
+    {
+        SetOnAll(100, 0x12);
+        SetOnAll(64_KB + 5, 0x34);
+
+        auto recovery = MakeRecovery();
+
+        while (recovery.RecoverNextBlock())
+        {
+        }
+
+        ASSERT_THAT(recovery.Status().NextBlock, Eq(BlocksCount));
+        ASSERT_THAT(recovery.Status().Recovered, Eq(0));
+        ASSERT_THAT(recovery.Status().Erased, Eq(0));
+
+        ASSERT_THAT(_flash1.SubSectorErases + _flash2.SubSectorErases + _flash3.SubSectorErases, Eq(0U));
+        ASSERT_THAT(_flash1.SectorErases + _flash2.SectorErases + _flash3.SectorErases, Eq(0U));
+        ASSERT_THAT(_flash1.Get(100), Eq(0x12));
+        ASSERT_THAT(_flash1.Get(64_KB + 5), Eq(0x34));
+    }
+
+    TEST_F(N25QRecoveryTest, ShouldRewriteOnlyDisagreeingSubSector)
+    {
+        SetOnAll(64_KB + 4_KB + 10, 0x55);
+        SetOnAll(64_KB + 8_KB + 20, 0x66);
+        _flash2.Set(64_KB + 4_KB + 10, 0x00);
+
+        auto recovery = MakeRecovery();
+
+        while (recovery.RecoverNextBlock())
+        {
+        }
+
+        ASSERT_THAT(recovery.Status().Recovered, Eq(1));
+        ASSERT_THAT(recovery.Status().Erased, Eq(0));
+
+        ASSERT_THAT(_flash1.SubSectorErases, Eq(0U));
+        ASSERT_THAT(_flash2.SubSectorErases, Eq(1U));
+        ASSERT_THAT(_flash3.SubSectorErases, Eq(0U));
+
+        ASSERT_THAT(_flash2.Get(64_KB + 4_KB + 10), Eq(0x55));
+        ASSERT_THAT(_flash2.Get(64_KB + 8_KB + 20), Eq(0x66));
+    }
+
+    TEST_F(N25QRecoveryTest, ShouldVoteBytesFromDifferentChipsIndependently)
+    {
+        SetOnAll(10, 0x01);
+        SetOnAll(20, 0x02);
+        _flash1.Set(10, 0xAA);
+        _flash3.Set(20, 0xBB);
+
+        auto recovery = MakeRecovery();
+        recovery.RecoverNextBlock();
+
+        ASSERT_THAT(recovery.Status().Recovered, Eq(1));
+
+        for (auto flash : {&_flash1, &_flash2, &_flash3})
+        {
+            ASSERT_THAT(flash->Get(10), Eq(0x01));
+            ASSERT_THAT(flash->Get(20), Eq(0x02));
+        }
+    }
+
+    TEST_F(N25QRecoveryTest, ShouldEraseBlockThatCannotBeVoted)
+    {
+        SetOnAll(2 * 64_KB + 100, 0x11);
+        _flash1.Set(2 * 64_KB + 7_KB, 0x01);
+        _flash2.Set(2 * 64_KB + 7_KB, 0x02);
+        _flash3.Set(2 * 64_KB + 7_KB, 0x03);
+        SetOnAll(3 * 64_KB, 0x22);
+
+        auto recovery = MakeRecovery();
+
+        while (recovery.RecoverNextBlock())
+        {
+        }
+
+        ASSERT_THAT(recovery.Status().Recovered, Eq(0));
+        ASSERT_THAT(recovery.Status().Erased, Eq(1));
+
+        for (auto flash : {&_flash1, &_flash2, &_flash3})
+        {
+            ASSERT_THAT(flash->SectorErases, Eq(1U));
+            ASSERT_THAT(flash->Get(2 * 64_KB + 100), Eq(0xFF));
+            ASSERT_THAT(flash->Get(2 * 64_KB + 7_KB), Eq(0xFF));
+            ASSERT_THAT(flash->Get(3 * 64_KB), Eq(0x22));
+        }
+    }
+
+    TEST_F(N25QRecoveryTest, ShouldRewriteCopyThatCannotBeRead)
+    {
+        SetOnAll(300, 0x77);
+        _flash3.FailReads = true;
+
+        auto recovery = MakeRecovery();
+        recovery.RecoverNextBlock();
+
+        ASSERT_THAT(recovery.Status().Recovered, Eq(1));
+        ASSERT_THAT(_flash3.SubSectorErases, Eq(16U));
+        ASSERT_THAT(_flash3.Get(300), Eq(0x77));
+    }
+
+    TEST_F(N25QRecoveryTest, ShouldEraseBlockWhenTwoCopiesCannotBeRead)
+    {
+        _flash2.FailReads = true;
+        _flash3.FailReads = true;
+
+        auto recovery = MakeRecovery();
+        recovery.RecoverNextBlock();
+
+        ASSERT_THAT(recovery.Status().Erased, Eq(1));
+    }
+
+    TEST_F(N25QRecoveryTest, ShouldResumeFromStoredProgress)
+    {
+        _flash2.Set(10, 0x00);
+
+        {
+            auto recovery = MakeRecovery();
+            ASSERT_FALSE(recovery.Resume());
+
+            recovery.RecoverNextBlock();
+            recovery.RecoverNextBlock();
+        }
+
+        _flash1.Reads = 0;
+
+        auto recovery = MakeRecovery();
+        ASSERT_TRUE(recovery.Resume());
+
+        ASSERT_THAT(recovery.Status().NextBlock, Eq(2));
+        ASSERT_THAT(recovery.Status().Recovered, Eq(1));
+
+        while (recovery.RecoverNextBlock())
+        {
+        }
+
+        ASSERT_THAT(_flash1.Reads, Eq(2U * 16));
+        ASSERT_THAT(recovery.Status().NextBlock, Eq(BlocksCount));
+        ASSERT_THAT(recovery.Status().Recovered, Eq(1));
+    }
+
+    TEST_F(N25QRecoveryTest, ShouldClearProgressAfterLastBlock)
+    {
+        auto recovery = MakeRecovery();
+
+        while (recovery.RecoverNextBlock())
+        {
+        }
+
+        auto next = MakeRecovery();
+        ASSERT_FALSE(next.Resume());
+        ASSERT_THAT(next.Status().NextBlock, Eq(0));
+    }
+}
@@ -0,0 +1,338 @@
+#include "Include/adcs/DetumblingSimulation.hpp"
+#include <algorithm>
+#include <cmath>
+#include "base/os.h"
+#include "imtq/imtq.h"
+
+using namespace std::chrono_literals;
+
+using devices::imtq::ImtqDriver;
+using devices::imtq::MagnetometerMeasurement;
+using devices::imtq::MagnetometerMeasurementToken;
+using devices::imtq::Vector3;
+
+namespace adcs
+{
+    namespace simulation
+    {
+        /** @brief Earth radius [m] */
+        static constexpr float EarthRadius = 6371.2e3f;
+
+        /** @brief Earth gravitational parameter [m^3/s^2] */
+        static constexpr float EarthGravitationalParameter = 3.986004e14f;
+
+        /** @brief Magnetic field at equator on Earth surface [T] */
+        static constexpr float EquatorialField = 3.12e-5f;
+
+        static float ToSeconds(std::chrono::milliseconds value)
+        {
+            return value.count() / 1000.0f;
+        }
+
+        Spacecraft::Spacecraft(const Environment& environment, const Eigen::Vector3f& angularRate)
+            : _environment(environment),                                                           //
+              _radius(EarthRadius + environment.Altitude),                                         //
+              _meanMotion(std::sqrt(EarthGravitationalParameter / (_radius * _radius * _radius))), //
+              _attitude(Eigen::Quaternionf::Identity()),                                           //
+              _angularRate(angularRate),                                                           //
+              _time(0)
+        {
+        }
+
+        void Spacecraft::Advance(std::chrono::milliseconds duration, const Eigen::Vector3f& dipole)
+        {
+            while (duration > 0ms)
+            {
+                const auto step = std::min(duration, this->_environment.Step);
+                Integrate(ToSeconds(step), dipole);
+                this->_time += step;
+                duration -= step;
+            }
+        }
+
+        Eigen::Vector3f Spacecraft::MagneticField() const
+        {
+            return this->_attitude.conjugate() * InertialMagneticField(ToSeconds(this->_time));
+        }
+
+        const Eigen::Vector3f& Spacecraft::AngularRate() const
+        {
+            return this->_angularRate;
+        }
+
+        std::chrono::milliseconds Spacecraft::Time() const
+        {
+            return this->_time;
+        }
+
+        const Environment& Spacecraft::Parameters() const
+        {
+            return this->_environment;
+        }
+
+        Eigen::Vector3f Spacecraft::InertialMagneticField(float time) const
+        {
+            const float argumentOfLatitude = this->_meanMotion * time;
+            const float inclination = this->_environment.Inclination;
+
+            const Eigen::Vector3f position(std::cos(argumentOfLatitude),
+                std::sin(argumentOfLatitude) * std::cos(inclination),
+                std::sin(argumentOfLatitude) * std::sin(inclination));
+
+            // Earth magnetic moment points to geographic south
+            const Eigen::Vector3f axis = Eigen::Vector3f::UnitZ();
+            const float scale = EquatorialField * std::pow(EarthRadius / this->_radius, 3.0f);
+
+            return scale * (axis - 3.0f * axis.dot(position) * position);
+        }
+
+        void Spacecraft::Integrate(float step, const Eigen::Vector3f& dipole)
+        {
+            const Eigen::Vector3f& inertia = this->_environment.Inertia;
+            const Eigen::Vector3f torque = dipole.cross(MagneticField());
+
+            auto derivative = [&](const Eigen::Vector3f& rate) -> Eigen::Vector3f {
+                return (torque - rate.cross(inertia.cwiseProduct(rate))).cwiseQuotient(inertia);
+            };
+
+            const Eigen::Vector3f k1 = derivative(this->_angularRate);
+            const Eigen::Vector3f k2 = derivative(this->_angularRate + 0.5f * step * k1);
+            const Eigen::Vector3f k3 = derivative(this->_angularRate + 0.5f * step * k2);
+            const Eigen::Vector3f k4 = derivative(this->_angularRate + step * k3);
+
+            const Eigen::Vector3f nextRate = this->_angularRate + step / 6.0f * (k1 + 2.0f * k2 + 2.0f * k3 + k4);
+            const Eigen::Vector3f averageRate = 0.5f * (this->_angularRate + nextRate);
+
+            const float angle = averageRate.norm() * step;
+            if (angle > 0.0f)
+            {
+                this->_attitude = this->_attitude * Eigen::Quaternionf(Eigen::AngleAxisf(angle, averageRate.normalized()));
+                this->_attitude.normalize();
+            }
+
+            this->_angularRate = nextRate;
+        }
+
+        SimulatedImtqDriver::SimulatedImtqDriver(Spacecraft& spacecraft)
+            : _spacecraft(spacecraft), _dipole(Eigen::Vector3f::Zero()), _actuationEnd(0), _actuationTime(0)
+        {
+        }
+
+        void SimulatedImtqDriver::Advance(std::chrono::milliseconds duration)
+        {
+            const auto now = this->_spacecraft.Time();
+            const auto actuation = std::max(0ms, std::min(duration, this->_actuationEnd - now));
+
+            if (actuation > 0ms)
+            {
+                this->_spacecraft.Advance(actuation, this->_dipole);
+                this->_actuationTime += actuation;
+            }
+
+            this->_spacecraft.Advance(duration - actuation, Eigen::Vector3f::Zero());
+        }
+
+        bool SimulatedImtqDriver::PerformSelfTest(devices::imtq::SelfTestResult& result, bool /*tryToFixIsisErrors*/)
+        {
+            result = devices::imtq::SelfTestResult{};
+            return true;
+        }
+
+        bool SimulatedImtqDriver::MeasureMagnetometer(Vector3<MagnetometerMeasurement>& result)
+        {
+            MagnetometerMeasurementToken token;
+            if (!BeginMagnetometerMeasurement(token))
+            {
+                return false;
+            }
+
+            return EndMagnetometerMeasurement(token, result);
+        }
+
+        bool SimulatedImtqDriver::BeginMagnetometerMeasurement(MagnetometerMeasurementToken& token)
+        {
+            CancelOperation();
+
+            System::SleepTask(ImtqDriver::MagneticFieldDecayTime);
+
+            token.ReadyAt = System::GetUptime() + ImtqDriver::IntegrationTime;
+            token.Pending = true;
+            return true;
+        }
+
+        bool SimulatedImtqDriver::EndMagnetometerMeasurement(MagnetometerMeasurementToken& token, Vector3<MagnetometerMeasurement>& result)
+        {
+            if (!token.Pending)
+            {
+                return false;
+            }
+
+            token.Pending = false;
+
+            const auto now = System::GetUptime();
+            if (now < token.ReadyAt)
+            {
+                System::SleepTask(token.ReadyAt - now);
+            }
+
+            const Eigen::Vector3f field = this->_spacecraft.MagneticField() * 1e9f;
+            for (auto i = 0; i < 3; i++)
+            {
+                result[i] = static_cast<MagnetometerMeasurement>(std::lround(field[i]));
+            }
+
+            return true;
+        }
+
+        bool SimulatedImtqDriver::SoftwareReset()
+        {
+            return CancelOperation();
+        }
+
+        bool SimulatedImtqDriver::SendNoOperation()
+        {
+            return true;
+        }
+
+        bool SimulatedImtqDriver::CancelOperation()
+        {
+            this->_actuationEnd = std::min(this->_actuationEnd, this->_spacecraft.Time());
+            return true;
+        }
+
+        bool SimulatedImtqDriver::StartMTMMeasurement()
+        {
+            return true;
+        }
+
+        bool SimulatedImtqDriver::StartActuationCurrent(const Vector3<devices::imtq::Current>& /*current*/,
+            std::chrono::milliseconds /*duration*/)
+        {
+            return false;
+        }
+
+        bool SimulatedImtqDriver::StartActuationDipole(Vector3<devices::imtq::Dipole> dipole, std::chrono::milliseconds duration)
+        {
+            const auto limit = this->_spacecraft.Parameters().MaxDipole;
+
+            for (auto i = 0; i < 3; i++)
+            {
+                this->_dipole[i] = std::max(-limit, std::min(dipole[i] * 1e-4f, limit));
+            }
+
+            this->_actuationEnd = this->_spacecraft.Time() + duration;
+            return true;
+        }
+
+        bool SimulatedImtqDriver::StartAllAxisSelfTest()
+        {
+            return true;
+        }
+
+        bool SimulatedImtqDriver::StartBDotDetumbling(std::chrono::seconds /*duration*/)
+        {
+            return false;
+        }
+
+        bool SimulatedImtqDriver::GetSystemState(devices::imtq::State& /*state*/)
+        {
+            return false;
+        }
+
+        bool SimulatedImtqDriver::GetCalibratedMagnetometerData(devices::imtq::MagnetometerMeasurementResult& /*result*/)
+        {
+            return false;
+        }
+
+        bool SimulatedImtqDriver::GetCoilCurrent(Vector3<devices::imtq::Current>& /*result*/)
+        {
+            return false;
+        }
+
+        bool SimulatedImtqDriver::GetCoilTemperature(Vector3<devices::imtq::TemperatureMeasurement>& /*result*/)
+        {
+            return false;
+        }
+
+        bool SimulatedImtqDriver::GetSelfTestResult(devices::imtq::SelfTestResult& /*result*/)
+        {
+            return false;
+        }
+
+        bool SimulatedImtqDriver::GetDetumbleData(devices::imtq::DetumbleData& /*result*/)
+        {
+            return false;
+        }
+
+        bool SimulatedImtqDriver::GetHouseKeepingRAW(devices::imtq::HouseKeepingRAW& /*result*/)
+        {
+            return false;
+        }
+
+        bool SimulatedImtqDriver::GetHouseKeepingEngineering(devices::imtq::HouseKeepingEngineering& /*result*/)
+        {
+            return false;
+        }
+
+        bool SimulatedImtqDriver::GetParameter(Parameter /*id*/, gsl::span<std::uint8_t> /*result*/)
+        {
+            return false;
+        }
+
+        bool SimulatedImtqDriver::SetParameter(Parameter /*id*/, gsl::span<const std::uint8_t> /*value*/)
+        {
+            return false;
+        }
+
+        bool SimulatedImtqDriver::ResetParameterAndGetDefault(Parameter /*id*/, gsl::span<std::uint8_t> /*result*/)
+        {
+            return false;
+        }
+
+        std::chrono::milliseconds SimulatedImtqDriver::ActuationTime() const
+        {
+            return this->_actuationTime;
+        }
+
+        DetumblingReport RunClosedLoop(IAdcsProcessor& processor,
+            Spacecraft& spacecraft,
+            SimulatedImtqDriver& imtq,
+            std::chrono::milliseconds period,
+            float threshold,
+            std::chrono::seconds limit)
+        {
+            DetumblingReport report{};
+
+            const auto start = spacecraft.Time();
+            const auto actuationAtStart = imtq.ActuationTime();
+
+            while (spacecraft.Time() - start < limit)
+            {
+                const auto iterationStart = System::GetUptime();
+
+                processor.Process();
+                report.Iterations++;
+
+                if (spacecraft.AngularRate().norm() < threshold)
+                {
+                    report.Detumbled = true;
+                    report.TimeToDetumble = std::chrono::duration_cast<std::chrono::seconds>(spacecraft.Time() - start);
+                    break;
+                }
+
+                const auto elapsed = System::GetUptime() - iterationStart;
+                System::SleepTask(std::max(0ms, period - elapsed));
+            }
+
+            const auto simulated = spacecraft.Time() - start;
+
+            report.FinalRate = spacecraft.AngularRate().norm();
+            if (simulated > 0ms)
+            {
+                report.DutyCycle = static_cast<std::uint16_t>((imtq.ActuationTime() - actuationAtStart).count() * 1000 / simulated.count());
+            }
+
+            return report;
+        }
+    }
+}
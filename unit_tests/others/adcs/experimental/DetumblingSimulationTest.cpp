@@ -0,0 +1,222 @@
+#include <malloc.h>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "CycleCounter.hpp"
+#include "Include/adcs/DetumblingSimulation.hpp"
+#include "OsMock.hpp"
+#include "adcs/DetumblingComputations.hpp"
+#include "adcs/ExperimentalDetumbling.hpp"
+#include "adcs/FixedPointDetumblingComputations.hpp"
+#include "mock/power.hpp"
+
+using namespace std::chrono_literals;
+
+using testing::_;
+using testing::Eq;
+using testing::Invoke;
+using testing::Le;
+using testing::Lt;
+using testing::Return;
+
+using adcs::DetumblingComputations;
+using adcs::FixedPointDetumblingComputations;
+using adcs::simulation::DetumblingReport;
+using adcs::simulation::Environment;
+using adcs::simulation::RunClosedLoop;
+using adcs::simulation::SimulatedImtqDriver;
+using adcs::simulation::Spacecraft;
+
+namespace
+{
+    /** @brief Angular rate below which spacecraft is considered detumbled (1 deg/s) */
+    constexpr float DetumbledRate = 0.01745f;
+
+    /** @brief Initial tumbling rate (about 3 deg/s per axis) */
+    const Eigen::Vector3f InitialRate{0.05f, -0.05f, 0.05f};
+
+    /** @brief Simulated time after which detumbling is considered failed (nominal loop needs about 27 minutes) */
+    constexpr std::chrono::seconds SimulationLimit = 45min;
+
+    class DetumblingSimulationTest : public testing::Test
+    {
+      protected:
+        DetumblingSimulationTest();
+
+        DetumblingReport Run(const Eigen::Vector3f& initialRate, std::chrono::milliseconds period, std::chrono::seconds limit);
+
+        void Report(const char* name, const DetumblingReport& report);
+
+        Environment _environment;
+        testing::NiceMock<OSMock> _os;
+        OSReset _osReset;
+        testing::NiceMock<PowerControlMock> _power;
+    };
+
+    DetumblingSimulationTest::DetumblingSimulationTest()
+    {
+        _osReset = InstallProxy(&_os);
+
+        ON_CALL(_power, ImtqPower(_)).WillByDefault(Return(true));
+    }
+
+    DetumblingReport DetumblingSimulationTest::Run(
+        const Eigen::Vector3f& initialRate, std::chrono::milliseconds period, std::chrono::seconds limit)
+    {
+        Spacecraft spacecraft(_environment, initialRate);
+        SimulatedImtqDriver imtq(spacecraft);
+        adcs::ExperimentalDetumbling detumbling(imtq, _power);
+
+        ON_CALL(_os, GetUptime()).WillByDefault(Invoke([&spacecraft]() { return spacecraft.Time(); }));
+        ON_CALL(_os, Sleep(_)).WillByDefault(Invoke([&imtq](std::chrono::milliseconds time) { imtq.Advance(time); }));
+
+        detumbling.Initialize();
+        EXPECT_THAT(detumbling.Enable(), Eq(OSResult::Success));
+
+        const auto report = RunClosedLoop(detumbling, spacecraft, imtq, period, DetumbledRate, limit);
+
+        testing::Mock::VerifyAndClearExpectations(&_os);
+
+        return report;
+    }
+
+    void DetumblingSimulationTest::Report(const char* name, const DetumblingReport& report)
+    {
+        std::cout << "[ SIM      ] " << name                                //
+                  << ": detumbled=" << report.Detumbled                     //
+                  << " time=" << report.TimeToDetumble.count() << "s"       //
+                  << " iterations=" << report.Iterations                    //
+                  << " final_rate=" << report.FinalRate << "rad/s"          //
+                  << " duty_cycle=" << report.DutyCycle << "/1000" << std::endl;
+    }
+
+    TEST_F(DetumblingSimulationTest, ExperimentalDetumblingShouldDetumbleSpacecraft)
+    {
+        const auto period = chrono_extensions::period_cast<std::chrono::milliseconds>(adcs::ExperimentalDetumbling::Frequency);
+        const auto report = Run(InitialRate, period, SimulationLimit);
+
+        Report("period 200ms (nominal)", report);
+
+        ASSERT_TRUE(report.Detumbled);
+        ASSERT_THAT(report.FinalRate, Lt(DetumbledRate));
+    }
+
+    TEST_F(DetumblingSimulationTest, ExperimentalDetumblingShouldStopImmediatelyWhenNotTumbling)
+    {
+        const auto report = Run(Eigen::Vector3f::Zero(), 200ms, 10min);
+
+        ASSERT_TRUE(report.Detumbled);
+        ASSERT_THAT(report.Iterations, Eq(1U));
+    }
+
+    /**
+     * Compares loop periods longer than nominal one (see ExperimentalDetumblingShouldDetumbleSpacecraft).
+     * Actuation is limited by ExperimentalDetumbling::ActuationTimeout, so loop period above it lowers duty cycle
+     * and shorter period should detumble no slower (with 10% tolerance for filter mismatch).
+     */
+    TEST_F(DetumblingSimulationTest, ShorterLoopPeriodShouldNotDetumbleSlower)
+    {
+        const auto shorter = Run(InitialRate, 500ms, SimulationLimit);
+        Report("period 500ms", shorter);
+
+        const auto longer = Run(InitialRate, 1000ms, SimulationLimit);
+        Report("period 1000ms", longer);
+
+        ASSERT_TRUE(shorter.Detumbled);
+        ASSERT_TRUE(longer.Detumbled);
+        ASSERT_THAT(shorter.TimeToDetumble.count(), Le(longer.TimeToDetumble.count() * 11 / 10));
+    }
+
+    /**
+     * @brief Measures step of detumbling computations fed with magnetic field of tumbling spacecraft and checks heap usage
+     * @param[in] name Benchmark name used in report
+     * @return Cycle statistics of single step
+     *
+     * Under QEMU SysTick follows virtual clock, so reported cycles are only relative, cycle-accurate numbers come from hardware runs.
+     */
+    template <typename Algorithm> CycleStatistics BenchmarkStep(const char* name)
+    {
+        testing::NiceMock<OSMock> os;
+        auto osReset = InstallProxy(&os);
+
+        Environment environment;
+        Spacecraft spacecraft(environment, InitialRate);
+
+        Algorithm computations;
+        typename Algorithm::Parameters parameters;
+
+        auto measure = [&spacecraft]() {
+            const Eigen::Vector3f field = spacecraft.MagneticField() * 1e9f;
+            return adcs::MagVec{static_cast<adcs::MagnetometerMeasurement>(field[0]),
+                static_cast<adcs::MagnetometerMeasurement>(field[1]),
+                static_cast<adcs::MagnetometerMeasurement>(field[2])};
+        };
+
+        auto state = computations.initialize(parameters, measure());
+
+        CycleCounter::Enable();
+        CycleStatistics cycles{};
+
+        const auto heapBefore = mallinfo().uordblks;
+
+        for (auto i = 0; i < 1000; i++)
+        {
+            spacecraft.Advance(200ms, Eigen::Vector3f::Zero());
+            const auto measurement = measure();
+
+            const auto start = CycleCounter::Now();
+            computations.step(measurement, state);
+            cycles.Add(CycleCounter::Elapsed(start));
+        }
+
+        const auto heapAfter = mallinfo().uordblks;
+
+        std::cout << "[ BENCH    ] " << name << "::step cycles (relative under QEMU):" //
+                  << " min=" << cycles.Min                                         //
+                  << " avg=" << cycles.Average()                                   //
+                  << " max=" << cycles.Max << std::endl;
+
+        EXPECT_THAT(cycles.Samples, Eq(1000U));
+        EXPECT_THAT(heapAfter, Eq(heapBefore));
+
+        return cycles;
+    }
+
+    TEST(DetumblingComputationsBenchmark, StepShouldNotAllocateMemory)
+    {
+        const auto cycles = BenchmarkStep<DetumblingComputations>("DetumblingComputations");
+
+        RecordProperty("StepCyclesAverage", static_cast<int>(cycles.Average()));
+        RecordProperty("StepCyclesMax", static_cast<int>(cycles.Max));
+    }
+
+    TEST(DetumblingComputationsBenchmark, FixedPointStepShouldNotAllocateMemory)
+    {
+        const auto cycles = BenchmarkStep<FixedPointDetumblingComputations>("FixedPointDetumblingComputations");
+
+        RecordProperty("StepCyclesAverage", static_cast<int>(cycles.Average()));
+        RecordProperty("StepCyclesMax", static_cast<int>(cycles.Max));
+    }
+
+    /**
+     * Compares cost of single detumbling step of floating point and fixed-point computations fed with the same measurements.
+     * MCU has no FPU, so floating point step runs on software emulation.
+     */
+    TEST(DetumblingComputationsBenchmark, StepCostFloatVersusFixedPoint)
+    {
+        const auto floating = BenchmarkStep<DetumblingComputations>("DetumblingComputations");
+        const auto fixed = BenchmarkStep<FixedPointDetumblingComputations>("FixedPointDetumblingComputations");
+
+        std::cout << "[ BENCH    ] Detumbling step cycles (relative under QEMU):"                                 //
+                  << " float avg=" << floating.Average()                                                        //
+                  << " max=" << floating.Max                                                                    //
+                  << " fixed avg=" << fixed.Average()                                                           //
+                  << " max=" << fixed.Max                                                                       //
+                  << " float/fixed=" << static_cast<float>(floating.Average()) / std::max(fixed.Average(), 1U) << std::endl;
+
+        RecordProperty("FloatStepCyclesAverage", static_cast<int>(floating.Average()));
+        RecordProperty("FixedPointStepCyclesAverage", static_cast<int>(fixed.Average()));
+    }
+}
@@ -11,6 +11,8 @@ using testing::Eq;
 using testing::_;
 using testing::Return;
 using testing::DoAll;
+using testing::Invoke;
+using testing::ReturnPointee;
 using testing::SetArgReferee;
 
 using devices::imtq::Current;
@@ -18,6 +20,7 @@ using devices::imtq::DetumbleData;
 using devices::imtq::Dipole;
 using devices::imtq::Error;
 using devices::imtq::MagnetometerMeasurement;
+using devices::imtq::MagnetometerMeasurementToken;
 using devices::imtq::SelfTestResult;
 using devices::imtq::TemperatureMeasurement;
 using devices::imtq::Vector3;
@@ -59,6 +62,9 @@ namespace
 
         ON_CALL(_imtqDriver, MeasureMagnetometer(_))
             .WillByDefault(DoAll(SetArgReferee<0>(calibratedMagnetometerMeasurement), Return(true)));
+        ON_CALL(_imtqDriver, BeginMagnetometerMeasurement(_)).WillByDefault(Return(true));
+        ON_CALL(_imtqDriver, EndMagnetometerMeasurement(_, _))
+            .WillByDefault(DoAll(SetArgReferee<1>(calibratedMagnetometerMeasurement), Return(true)));
         EXPECT_CALL(_imtqDriver, StartActuationDipole(Eq(expectedDipole), Eq(500ms)));
 
         _detumbling.Initialize();
@@ -66,6 +72,75 @@ namespace
         _detumbling.Process();
     }
 
+    TEST_F(ExperimentalDetumblingTest, ShouldNotActuateWhenMagnetometerMeasurementCannotBeStarted)
+    {
+        ON_CALL(_imtqDriver, BeginMagnetometerMeasurement(_)).WillByDefault(Return(false));
+        EXPECT_CALL(_imtqDriver, EndMagnetometerMeasurement(_, _)).Times(0);
+        EXPECT_CALL(_imtqDriver, StartActuationDipole(_, _)).Times(0);
+
+        _detumbling.Process();
+
+        ASSERT_THAT(_detumbling.GetTimingStatistics().Iterations, Eq(0U));
+    }
+
+    TEST_F(ExperimentalDetumblingTest, ShouldTrackActuationDutyCycle)
+    {
+        std::chrono::milliseconds uptime = 1000ms;
+        ON_CALL(_os, GetUptime()).WillByDefault(ReturnPointee(&uptime));
+
+        ON_CALL(_imtqDriver, BeginMagnetometerMeasurement(_)).WillByDefault(Invoke([&](MagnetometerMeasurementToken& token) {
+            uptime += 10ms;
+            token.ReadyAt = uptime + 30ms;
+            token.Pending = true;
+            return true;
+        }));
+
+        ON_CALL(_imtqDriver, EndMagnetometerMeasurement(_, _))
+            .WillByDefault(Invoke([&](MagnetometerMeasurementToken& token, Vector3<MagnetometerMeasurement>& result) {
+                uptime = token.ReadyAt + 2ms;
+                token.Pending = false;
+                result = Vector3<MagnetometerMeasurement>{1, -2, 3};
+                return true;
+            }));
+
+        ON_CALL(_imtqDriver, StartActuationDipole(_, _)).WillByDefault(Return(true));
+
+        _detumbling.Process();
+        ASSERT_THAT(_detumbling.GetTimingStatistics().Iterations, Eq(0U));
+
+        uptime = 1200ms;
+        _detumbling.Process();
+
+        const auto statistics = _detumbling.GetTimingStatistics();
+        ASSERT_THAT(statistics.Iterations, Eq(1U));
+        ASSERT_THAT(statistics.ActuationTime, Eq(158ms));
+        ASSERT_THAT(statistics.IdleTime, Eq(42ms));
+        ASSERT_THAT(statistics.DutyCycle, Eq(790));
+    }
+
+    TEST_F(ExperimentalDetumblingTest, ShouldCapActuationTimeAtActuationTimeout)
+    {
+        std::chrono::milliseconds uptime = 0ms;
+        ON_CALL(_os, GetUptime()).WillByDefault(ReturnPointee(&uptime));
+
+        ON_CALL(_imtqDriver, BeginMagnetometerMeasurement(_)).WillByDefault(Return(true));
+        ON_CALL(_imtqDriver, EndMagnetometerMeasurement(_, _)).WillByDefault(Invoke([&](auto& /*token*/, auto& /*result*/) {
+            uptime += 50ms;
+            return true;
+        }));
+        ON_CALL(_imtqDriver, StartActuationDipole(_, _)).WillByDefault(Return(true));
+
+        _detumbling.Process();
+
+        uptime = 2000ms;
+        _detumbling.Process();
+
+        const auto statistics = _detumbling.GetTimingStatistics();
+        ASSERT_THAT(statistics.ActuationTime, Eq(500ms));
+        ASSERT_THAT(statistics.IdleTime, Eq(50ms));
+        ASSERT_THAT(statistics.DutyCycle, Eq(909));
+    }
+
     TEST_F(ExperimentalDetumblingTest, ShouldOperateWithOneMagnetometerFail)
     {
         EXPECT_CALL(_os, TakeSemaphore(_, _)).WillRepeatedly(Return(OSResult::Success));
@@ -0,0 +1,246 @@
+#ifndef UNIT_TESTS_OTHERS_ADCS_EXPERIMENTAL_DETUMBLING_SIMULATION_HPP
+#define UNIT_TESTS_OTHERS_ADCS_EXPERIMENTAL_DETUMBLING_SIMULATION_HPP
+
+#pragma once
+
+#include <Eigen/Dense>
+#include <chrono>
+#include <cstdint>
+#include "adcs/adcs.hpp"
+#include "imtq/IImtqDriver.hpp"
+
+namespace adcs
+{
+    namespace simulation
+    {
+        /**
+         * @brief Parameters of simulated spacecraft and its environment.
+         *
+         * Defaults describe 2U CubeSat on 600 km sun-synchronous orbit with iMTQ magnetorquers.
+         */
+        struct Environment
+        {
+            /** @brief Principal moments of inertia [kg m^2] */
+            Eigen::Vector3f Inertia{0.0112f, 0.0112f, 0.0041f};
+
+            /** @brief Orbit altitude [m] */
+            float Altitude = 600e3f;
+
+            /** @brief Orbit inclination [rad] */
+            float Inclination = 1.7052f;
+
+            /** @brief Maximum dipole produced by single coil [Am^2] */
+            float MaxDipole = 0.2f;
+
+            /** @brief Integration step of rigid body dynamics */
+            std::chrono::milliseconds Step = std::chrono::milliseconds(100);
+        };
+
+        /**
+         * @brief Rigid body tumbling on circular orbit in Earth dipole magnetic field.
+         *
+         * Earth field is modelled as dipole aligned with Earth rotation axis, Earth rotation is neglected.
+         */
+        class Spacecraft final
+        {
+          public:
+            /**
+             * @brief Ctor
+             * @param[in] environment Spacecraft and environment parameters
+             * @param[in] angularRate Initial angular rate in body frame [rad/s]
+             */
+            Spacecraft(const Environment& environment, const Eigen::Vector3f& angularRate);
+
+            /**
+             * @brief Propagates spacecraft state
+             * @param[in] duration Propagation time
+             * @param[in] dipole Dipole generated by coils in body frame [Am^2]
+             */
+            void Advance(std::chrono::milliseconds duration, const Eigen::Vector3f& dipole);
+
+            /**
+             * @brief Returns magnetic field in body frame
+             * @return Magnetic field [T]
+             */
+            Eigen::Vector3f MagneticField() const;
+
+            /**
+             * @brief Returns angular rate in body frame
+             * @return Angular rate [rad/s]
+             */
+            const Eigen::Vector3f& AngularRate() const;
+
+            /**
+             * @brief Returns simulation time
+             * @return Time elapsed since start of simulation
+             */
+            std::chrono::milliseconds Time() const;
+
+            /**
+             * @brief Returns spacecraft and environment parameters
+             * @return Simulation parameters
+             */
+            const Environment& Parameters() const;
+
+          private:
+            /**
+             * @brief Calculates magnetic field in inertial frame
+             * @param[in] time Time since start of simulation [s]
+             * @return Magnetic field [T]
+             */
+            Eigen::Vector3f InertialMagneticField(float time) const;
+
+            /**
+             * @brief Performs single integration step
+             * @param[in] step Step length [s]
+             * @param[in] dipole Dipole generated by coils in body frame [Am^2]
+             */
+            void Integrate(float step, const Eigen::Vector3f& dipole);
+
+            /** @brief Environment parameters */
+            const Environment _environment;
+
+            /** @brief Orbit radius [m] */
+            const float _radius;
+
+            /** @brief Orbital mean motion [rad/s] */
+            const float _meanMotion;
+
+            /** @brief Attitude (body to inertial) */
+            Eigen::Quaternionf _attitude;
+
+            /** @brief Angular rate in body frame [rad/s] */
+            Eigen::Vector3f _angularRate;
+
+            /** @brief Simulation time */
+            std::chrono::milliseconds _time;
+        };
+
+        /**
+         * @brief iMTQ fake driving simulated spacecraft.
+         *
+         * Fake follows timing of real driver (field decay, integration time, actuation timeout) using OS sleeps,
+         * so simulated time must be tied to OS proxy with @ref Advance.
+         * Magnetometer measurements are returned in 1e-9 T, as expected by @ref DetumblingComputations.
+         */
+        class SimulatedImtqDriver final : public devices::imtq::IImtqDriver
+        {
+          public:
+            /**
+             * @brief Ctor
+             * @param[in] spacecraft Simulated spacecraft
+             */
+            SimulatedImtqDriver(Spacecraft& spacecraft);
+
+            /**
+             * @brief Propagates spacecraft with current coils actuation
+             * @param[in] duration Propagation time
+             */
+            void Advance(std::chrono::milliseconds duration);
+
+            virtual bool PerformSelfTest(devices::imtq::SelfTestResult& result, bool tryToFixIsisErrors) override;
+
+            virtual bool MeasureMagnetometer(devices::imtq::Vector3<devices::imtq::MagnetometerMeasurement>& result) override;
+
+            virtual bool BeginMagnetometerMeasurement(devices::imtq::MagnetometerMeasurementToken& token) override;
+
+            virtual bool EndMagnetometerMeasurement(devices::imtq::MagnetometerMeasurementToken& token,
+                devices::imtq::Vector3<devices::imtq::MagnetometerMeasurement>& result) override;
+
+            virtual bool SoftwareReset() override;
+
+            virtual bool SendNoOperation() override;
+
+            virtual bool CancelOperation() override;
+
+            virtual bool StartMTMMeasurement() override;
+
+            virtual bool StartActuationCurrent(const devices::imtq::Vector3<devices::imtq::Current>& current,
+                std::chrono::milliseconds duration) override;
+
+            virtual bool StartActuationDipole(devices::imtq::Vector3<devices::imtq::Dipole> dipole, std::chrono::milliseconds duration) override;
+
+            virtual bool StartAllAxisSelfTest() override;
+
+            virtual bool StartBDotDetumbling(std::chrono::seconds duration) override;
+
+            virtual bool GetSystemState(devices::imtq::State& state) override;
+
+            virtual bool GetCalibratedMagnetometerData(devices::imtq::MagnetometerMeasurementResult& result) override;
+
+            virtual bool GetCoilCurrent(devices::imtq::Vector3<devices::imtq::Current>& result) override;
+
+            virtual bool GetCoilTemperature(devices::imtq::Vector3<devices::imtq::TemperatureMeasurement>& result) override;
+
+            virtual bool GetSelfTestResult(devices::imtq::SelfTestResult& result) override;
+
+            virtual bool GetDetumbleData(devices::imtq::DetumbleData& result) override;
+
+            virtual bool GetHouseKeepingRAW(devices::imtq::HouseKeepingRAW& result) override;
+
+            virtual bool GetHouseKeepingEngineering(devices::imtq::HouseKeepingEngineering& result) override;
+
+            virtual bool GetParameter(Parameter id, gsl::span<std::uint8_t> result) override;
+
+            virtual bool SetParameter(Parameter id, gsl::span<const std::uint8_t> value) override;
+
+            virtual bool ResetParameterAndGetDefault(Parameter id, gsl::span<std::uint8_t> result) override;
+
+            /**
+             * @brief Returns total time coils were actuated
+             * @return Actuation time
+             */
+            std::chrono::milliseconds ActuationTime() const;
+
+          private:
+            /** @brief Simulated spacecraft */
+            Spacecraft& _spacecraft;
+
+            /** @brief Commanded dipole [Am^2] */
+            Eigen::Vector3f _dipole;
+
+            /** @brief Time at which actuation ends */
+            std::chrono::milliseconds _actuationEnd;
+
+            /** @brief Total actuation time */
+            std::chrono::milliseconds _actuationTime;
+        };
+
+        /**
+         * @brief Result of closed loop detumbling run
+         */
+        struct DetumblingReport
+        {
+            /** @brief true if angular rate dropped below threshold */
+            bool Detumbled;
+            /** @brief Time at which angular rate dropped below threshold */
+            std::chrono::seconds TimeToDetumble;
+            /** @brief Number of control iterations */
+            std::uint32_t Iterations;
+            /** @brief Angular rate at the end of run [rad/s] */
+            float FinalRate;
+            /** @brief Share of simulated time coils were actuated in permille */
+            std::uint16_t DutyCycle;
+        };
+
+        /**
+         * @brief Runs ADCS processor against simulated spacecraft, scheduling iterations the same way @ref AdcsCoordinator does.
+         * @param[in] processor ADCS processor
+         * @param[in] spacecraft Simulated spacecraft
+         * @param[in] imtq Simulated iMTQ used by processor
+         * @param[in] period Control loop period
+         * @param[in] threshold Angular rate below which spacecraft is considered detumbled [rad/s]
+         * @param[in] limit Maximum simulation time
+         * @return Run report
+         * @remark OS proxy has to route uptime and sleeps to simulation (see @ref SimulatedImtqDriver).
+         */
+        DetumblingReport RunClosedLoop(IAdcsProcessor& processor,
+            Spacecraft& spacecraft,
+            SimulatedImtqDriver& imtq,
+            std::chrono::milliseconds period,
+            float threshold,
+            std::chrono::seconds limit);
+    }
+}
+
+#endif /* UNIT_TESTS_OTHERS_ADCS_EXPERIMENTAL_DETUMBLING_SIMULATION_HPP */
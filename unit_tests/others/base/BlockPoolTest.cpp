@@ -0,0 +1,97 @@
+#include <array>
+#include <cstdint>
+#include <set>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "base/block_pool.hpp"
+
+using testing::Eq;
+using testing::Ne;
+using testing::IsNull;
+
+namespace
+{
+    using Pool = BlockPool<12, 4>;
+
+    TEST(BlockPoolTest, ShouldAllocateDistinctBlocksUntilExhausted)
+    {
+        Pool pool;
+        std::set<void*> blocks;
+
+        for (std::size_t i = 0; i < Pool::Count; i++)
+        {
+            auto block = pool.Allocate();
+            ASSERT_THAT(block, Ne(nullptr));
+            ASSERT_THAT(pool.Contains(block), Eq(true));
+            blocks.insert(block);
+        }
+
+        ASSERT_THAT(blocks.size(), Eq(4U));
+        ASSERT_THAT(pool.Allocate(), IsNull());
+
+        auto statistics = pool.Statistics();
+        ASSERT_THAT(statistics.Capacity, Eq(4));
+        ASSERT_THAT(statistics.InUse, Eq(4));
+        ASSERT_THAT(statistics.HighWaterMark, Eq(4));
+        ASSERT_THAT(statistics.Exhaustions, Eq(1U));
+    }
+
+    TEST(BlockPoolTest, ShouldReuseFreedBlock)
+    {
+        Pool pool;
+
+        auto first = pool.Allocate();
+        auto second = pool.Allocate();
+
+        pool.Free(first);
+
+        ASSERT_THAT(pool.Allocate(), Eq(first));
+        ASSERT_THAT(pool.Allocate(), Ne(second));
+    }
+
+    TEST(BlockPoolTest, ShouldTrackHighWaterMark)
+    {
+        Pool pool;
+
+        auto a = pool.Allocate();
+        auto b = pool.Allocate();
+        auto c = pool.Allocate();
+        pool.Free(b);
+        pool.Free(a);
+        pool.Free(c);
+        pool.Allocate();
+
+        auto statistics = pool.Statistics();
+        ASSERT_THAT(statistics.InUse, Eq(1));
+        ASSERT_THAT(statistics.HighWaterMark, Eq(3));
+        ASSERT_THAT(statistics.Exhaustions, Eq(0U));
+    }
+
+    TEST(BlockPoolTest, ShouldRecognizeForeignPointers)
+    {
+        Pool pool;
+        std::array<std::uint8_t, 12> other;
+
+        ASSERT_THAT(pool.Contains(other.data()), Eq(false));
+        ASSERT_THAT(pool.Contains(nullptr), Eq(false));
+    }
+
+    TEST(BlockPoolTest, ShouldIgnoreNullRelease)
+    {
+        Pool pool;
+
+        pool.Free(nullptr);
+
+        ASSERT_THAT(pool.Statistics().InUse, Eq(0));
+    }
+
+    TEST(BlockPoolTest, ShouldAlignBlocks)
+    {
+        Pool pool;
+
+        for (std::size_t i = 0; i < Pool::Count; i++)
+        {
+            ASSERT_THAT(reinterpret_cast<std::uintptr_t>(pool.Allocate()) % 8, Eq(0U));
+        }
+    }
+}
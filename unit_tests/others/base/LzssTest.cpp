@@ -0,0 +1,169 @@
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "base/lzss.hpp"
+
+using testing::Eq;
+using testing::ElementsAre;
+using testing::ElementsAreArray;
+
+namespace
+{
+    class LzssDecoderTest : public testing::Test
+    {
+      protected:
+        std::vector<std::uint8_t> DecodeAll(gsl::span<const std::uint8_t> input, std::size_t inputStep, std::size_t outputStep);
+
+        lzss::Decoder _decoder;
+    };
+
+    std::vector<std::uint8_t> LzssDecoderTest::DecodeAll(gsl::span<const std::uint8_t> input, std::size_t inputStep, std::size_t outputStep)
+    {
+        std::vector<std::uint8_t> result;
+        std::array<std::uint8_t, 64> buffer;
+
+        std::size_t position = 0;
+
+        while (true)
+        {
+            auto part = input.subspan(position, std::min<std::size_t>(inputStep, input.size() - position));
+
+            std::size_t consumed = 0;
+            std::size_t produced = 0;
+
+            auto status = this->_decoder.Decode(part, gsl::make_span(buffer).subspan(0, outputStep), consumed, produced);
+            EXPECT_THAT(status, Eq(lzss::DecoderStatus::Ok));
+
+            result.insert(result.end(), buffer.begin(), buffer.begin() + produced);
+            position += consumed;
+
+            if (position == static_cast<std::size_t>(input.size()) && produced == 0)
+            {
+                break;
+            }
+        }
+
+        return result;
+    }
+
+    TEST_F(LzssDecoderTest, ShouldDecodeLiterals)
+    {
+        std::uint8_t input[] = {0xFF, 'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 0x01, 'I'};
+
+        auto result = DecodeAll(input, sizeof(input), 64);
+
+        ASSERT_THAT(result, ElementsAre('A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I'));
+        ASSERT_THAT(this->_decoder.TotalProduced(), Eq(9U));
+        ASSERT_THAT(this->_decoder.IsIdle(), Eq(true));
+    }
+
+    TEST_F(LzssDecoderTest, ShouldDecodeOverlappingReference)
+    {
+        std::uint8_t input[] = {0x01, 'A', 0x00, (5 - lzss::MinMatchLength) << 2};
+
+        auto result = DecodeAll(input, sizeof(input), 64);
+
+        ASSERT_THAT(result, ElementsAre('A', 'A', 'A', 'A', 'A', 'A'));
+    }
+
+    TEST_F(LzssDecoderTest, ShouldDecodeStreamFedInSmallParts)
+    {
+        std::uint8_t input[] = {0x2F, 'P', 'r', 'o', 'g', 0x03, (8 - lzss::MinMatchLength) << 2, 0x00};
+        const std::string expected("ProgProgProg\0", 13);
+
+        for (std::size_t inputStep = 1; inputStep <= sizeof(input); inputStep++)
+        {
+            for (std::size_t outputStep = 1; outputStep <= 16; outputStep++)
+            {
+                this->_decoder.Reset();
+
+                auto result = DecodeAll(input, inputStep, outputStep);
+
+                ASSERT_THAT(result, ElementsAreArray(expected.begin(), expected.end())) << inputStep << "/" << outputStep;
+            }
+        }
+    }
+
+    TEST_F(LzssDecoderTest, ShouldDecodeLongestMatch)
+    {
+        std::uint8_t input[] = {0x03, 'x', 'y', 0x01, 0xFC};
+
+        auto result = DecodeAll(input, sizeof(input), 64);
+
+        ASSERT_THAT(result.size(), Eq(2U + lzss::MaxMatchLength));
+        for (std::size_t i = 0; i < result.size(); i++)
+        {
+            ASSERT_THAT(result[i], Eq(i % 2 == 0 ? 'x' : 'y'));
+        }
+    }
+
+    TEST_F(LzssDecoderTest, ShouldRejectReferenceBeforeStreamBeginning)
+    {
+        std::uint8_t input[] = {0x01, 'A', 0x01, 0x00};
+        std::array<std::uint8_t, 16> buffer;
+
+        std::size_t consumed = 0;
+        std::size_t produced = 0;
+
+        auto status = this->_decoder.Decode(input, buffer, consumed, produced);
+
+        ASSERT_THAT(status, Eq(lzss::DecoderStatus::InvalidReference));
+    }
+
+    TEST_F(LzssDecoderTest, ShouldDecodeEncodedData)
+    {
+        std::vector<std::uint8_t> input(3000, 0xFF);
+        for (std::size_t i = 1000; i < 2000; i++)
+        {
+            input[i] = static_cast<std::uint8_t>((i * 7) ^ (i >> 3));
+        }
+
+        std::vector<std::uint8_t> compressed(4000);
+        std::size_t consumed = 0;
+
+        auto produced = lzss::Encode(input, compressed, consumed);
+        compressed.resize(produced);
+
+        ASSERT_THAT(consumed, Eq(input.size()));
+        ASSERT_THAT(produced, testing::Lt(input.size()));
+        ASSERT_THAT(DecodeAll(compressed, 17, 64), ElementsAreArray(input));
+    }
+
+    TEST_F(LzssDecoderTest, ShouldStopEncodingWhenOutputIsFull)
+    {
+        std::vector<std::uint8_t> input(256);
+        for (std::size_t i = 0; i < input.size(); i++)
+        {
+            input[i] = static_cast<std::uint8_t>(i);
+        }
+
+        std::array<std::uint8_t, 19> compressed;
+        std::size_t consumed = 0;
+
+        auto produced = lzss::Encode(input, compressed, consumed);
+
+        // two groups of literals take 18 bytes, third group needs flags byte and literal
+        ASSERT_THAT(produced, Eq(18U));
+        ASSERT_THAT(consumed, Eq(16U));
+        ASSERT_THAT(DecodeAll(gsl::make_span(compressed).subspan(0, produced), produced, 64),
+            ElementsAreArray(input.begin(), input.begin() + consumed));
+    }
+
+    TEST_F(LzssDecoderTest, ShouldReportPartialTokenAsNotIdle)
+    {
+        std::uint8_t input[] = {0x01, 'A', 0x00};
+        std::array<std::uint8_t, 16> buffer;
+
+        std::size_t consumed = 0;
+        std::size_t produced = 0;
+
+        this->_decoder.Decode(input, buffer, consumed, produced);
+
+        ASSERT_THAT(consumed, Eq(3U));
+        ASSERT_THAT(produced, Eq(1U));
+        ASSERT_THAT(this->_decoder.IsIdle(), Eq(false));
+    }
+}
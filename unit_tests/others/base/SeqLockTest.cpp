@@ -0,0 +1,136 @@
+#include <array>
+#include <cstdint>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "base/seqlock.hpp"
+
+using testing::ElementsAre;
+using testing::Eq;
+
+namespace
+{
+    using Buffer = SeqLockBuffer<4>;
+
+    TEST(SeqLockTest, ShouldReadZerosBeforeFirstPublication)
+    {
+        Buffer buffer;
+        std::array<std::uint8_t, 4> result{1, 1, 1, 1};
+
+        ASSERT_THAT(buffer.CopyTo(result), Eq(true));
+        ASSERT_THAT(result, ElementsAre(0, 0, 0, 0));
+        ASSERT_THAT(buffer.Sequence(), Eq(0U));
+    }
+
+    TEST(SeqLockTest, ShouldReadLatestPublication)
+    {
+        Buffer buffer;
+        std::array<std::uint8_t, 4> first{1, 2, 3, 4};
+        std::array<std::uint8_t, 4> second{5, 6, 7, 8};
+        std::array<std::uint8_t, 4> result;
+
+        buffer.Publish(first);
+        ASSERT_THAT(buffer.CopyTo(result), Eq(true));
+        ASSERT_THAT(result, ElementsAre(1, 2, 3, 4));
+
+        buffer.Publish(second);
+        ASSERT_THAT(buffer.CopyTo(result), Eq(true));
+        ASSERT_THAT(result, ElementsAre(5, 6, 7, 8));
+
+        ASSERT_THAT(buffer.Sequence(), Eq(4U));
+    }
+
+    TEST(SeqLockTest, ShouldPadShortPublicationWithZeros)
+    {
+        Buffer buffer;
+        std::array<std::uint8_t, 4> full{1, 2, 3, 4};
+        std::array<std::uint8_t, 2> partial{9, 9};
+        std::array<std::uint8_t, 4> result;
+
+        buffer.Publish(full);
+        buffer.Publish(full);
+        buffer.Publish(partial);
+
+        ASSERT_THAT(buffer.CopyTo(result), Eq(true));
+        ASSERT_THAT(result, ElementsAre(9, 9, 0, 0));
+    }
+
+    TEST(SeqLockTest, ShouldPassViewWithoutCopying)
+    {
+        Buffer buffer;
+        std::array<std::uint8_t, 4> data{1, 2, 3, 4};
+        buffer.Publish(data);
+
+        const std::uint8_t* first = nullptr;
+        const std::uint8_t* second = nullptr;
+
+        buffer.Read([&first](gsl::span<const std::uint8_t> view) { first = view.data(); });
+        buffer.Read([&second](gsl::span<const std::uint8_t> view) { second = view.data(); });
+
+        ASSERT_THAT(first, Eq(second));
+    }
+
+    TEST(SeqLockTest, ShouldNotRetryWhenSinglePublicationHappensDuringRead)
+    {
+        Buffer buffer;
+        std::array<std::uint8_t, 4> first{1, 2, 3, 4};
+        std::array<std::uint8_t, 4> second{5, 6, 7, 8};
+        buffer.Publish(first);
+
+        auto calls = 0;
+        std::array<std::uint8_t, 4> seen;
+
+        auto result = buffer.Read([&](gsl::span<const std::uint8_t> view) {
+            calls++;
+            buffer.Publish(second);
+            std::copy(view.begin(), view.end(), seen.begin());
+        });
+
+        ASSERT_THAT(result, Eq(true));
+        ASSERT_THAT(calls, Eq(1));
+        ASSERT_THAT(seen, ElementsAre(1, 2, 3, 4));
+    }
+
+    TEST(SeqLockTest, ShouldRetryWhenBufferIsReusedDuringRead)
+    {
+        Buffer buffer;
+        std::array<std::uint8_t, 4> first{1, 2, 3, 4};
+        std::array<std::uint8_t, 4> second{5, 6, 7, 8};
+        std::array<std::uint8_t, 4> third{9, 10, 11, 12};
+        buffer.Publish(first);
+
+        auto calls = 0;
+        std::array<std::uint8_t, 4> seen;
+
+        auto result = buffer.Read([&](gsl::span<const std::uint8_t> view) {
+            calls++;
+            if (calls == 1)
+            {
+                buffer.Publish(second);
+                buffer.Publish(third);
+            }
+
+            std::copy(view.begin(), view.end(), seen.begin());
+        });
+
+        ASSERT_THAT(result, Eq(true));
+        ASSERT_THAT(calls, Eq(2));
+        ASSERT_THAT(seen, ElementsAre(9, 10, 11, 12));
+    }
+
+    TEST(SeqLockTest, ShouldGiveUpWhenWriterKeepsReplacingSnapshot)
+    {
+        Buffer buffer;
+        std::array<std::uint8_t, 4> data{1, 2, 3, 4};
+
+        auto calls = 0;
+
+        auto result = buffer.Read([&](gsl::span<const std::uint8_t> /*view*/) {
+            calls++;
+            buffer.Publish(data);
+            buffer.Publish(data);
+        });
+
+        ASSERT_THAT(result, Eq(false));
+        ASSERT_THAT(calls, Eq(static_cast<int>(Buffer::MaxReadAttempts)));
+    }
+}
@@ -0,0 +1,114 @@
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+#include "gtest/gtest.h"
+#include "adcs/DetumblingComputations.hpp"
+#include "adcs/FixedPointDetumblingComputations.hpp"
+#include "rapidcheck.hpp"
+#include "rapidcheck/gtest.h"
+
+using adcs::DetumblingComputations;
+using adcs::FixedPointDetumblingComputations;
+using adcs::MagVec;
+
+namespace
+{
+    /** @brief Largest field component expected on low Earth orbit [1e-9 T] */
+    constexpr std::int32_t MaxOrbitField = 60000;
+
+    /** @brief Largest change of field component between two iterations [1e-9 T] */
+    constexpr std::int32_t MaxFieldChange = 2000;
+
+    std::int64_t NormSquared(const MagVec& field)
+    {
+        std::int64_t result = 0;
+        for (auto component : field)
+        {
+            result += static_cast<std::int64_t>(component) * component;
+        }
+
+        return result;
+    }
+
+    bool WithinTolerance(std::int32_t reference, std::int32_t actual)
+    {
+        const auto allowed = std::max(FixedPointDetumblingComputations::ToleranceAbsolute,
+            std::abs(reference) * FixedPointDetumblingComputations::TolerancePermille / 1000);
+
+        return std::abs(reference - actual) <= allowed;
+    }
+
+    RC_GTEST_PROP(DetumblingComputationsTest, FixedPointMatchesFloatReference, (bool coilX, bool coilY, bool coilZ))
+    {
+        const auto wCutOff = *rc::gen::inRange(1, 90);
+        const auto start = *rc::gen::container<MagVec>(rc::gen::inRange(-MaxOrbitField, MaxOrbitField + 1));
+        const auto changes = *rc::gen::resize(200, rc::gen::container<std::vector<MagVec>>(
+            rc::gen::container<MagVec>(rc::gen::inRange(-MaxFieldChange, MaxFieldChange + 1))));
+
+        DetumblingComputations::Parameters parameters;
+        parameters.wCutOff = wCutOff / 100.0f;
+        parameters.coilsOn = {{coilX, coilY, coilZ}};
+
+        DetumblingComputations reference;
+        FixedPointDetumblingComputations fixedPoint;
+
+        auto referenceState = reference.initialize(parameters, start);
+        auto fixedPointState = fixedPoint.initialize(parameters, start);
+
+        const auto minNormSquared = static_cast<std::int64_t>(FixedPointDetumblingComputations::ToleranceMinField) *
+            FixedPointDetumblingComputations::ToleranceMinField;
+
+        auto field = start;
+        for (const auto& change : changes)
+        {
+            for (auto i = 0; i < 3; i++)
+            {
+                field[i] = std::max(-MaxOrbitField, std::min(field[i] + change[i], MaxOrbitField));
+            }
+
+            const auto expected = reference.step(field, referenceState);
+            const auto actual = fixedPoint.step(field, fixedPointState);
+
+            if (NormSquared(field) < minNormSquared)
+            {
+                continue;
+            }
+
+            for (auto i = 0; i < 3; i++)
+            {
+                RC_ASSERT(WithinTolerance(expected[i], actual[i]));
+            }
+        }
+    }
+
+    RC_GTEST_PROP(DetumblingComputationsTest, FixedPointDisabledCoilsAreNotActuated, (bool coilX, bool coilY, bool coilZ))
+    {
+        const auto field = *rc::gen::container<MagVec>(rc::gen::inRange(-MaxOrbitField, MaxOrbitField + 1));
+
+        DetumblingComputations::Parameters parameters;
+        parameters.coilsOn = {{coilX, coilY, coilZ}};
+
+        FixedPointDetumblingComputations fixedPoint;
+        auto state = fixedPoint.initialize(parameters, field);
+
+        const auto dipole = fixedPoint.step(field, state);
+
+        for (auto i = 0; i < 3; i++)
+        {
+            RC_ASSERT(parameters.coilsOn[i] || dipole[i] == 0);
+        }
+    }
+
+    TEST(DetumblingComputationsTest, FixedPointShouldNotActuateWithoutField)
+    {
+        DetumblingComputations::Parameters parameters;
+        FixedPointDetumblingComputations fixedPoint;
+
+        auto state = fixedPoint.initialize(parameters, MagVec{{0, 0, 0}});
+        fixedPoint.step(MagVec{{30000, -20000, 10000}}, state);
+
+        const auto dipole = fixedPoint.step(MagVec{{0, 0, 0}}, state);
+
+        ASSERT_EQ(dipole, (adcs::DipoleVec{{0, 0, 0}}));
+    }
+}
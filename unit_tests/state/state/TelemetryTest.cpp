@@ -99,8 +99,45 @@ namespace
         return this->byte;
     }
 
+    class FlagsObject
+    {
+      public:
+        static constexpr std::uint32_t Id = 9;
+
+        FlagsObject();
+
+        explicit FlagsObject(std::uint8_t newFlags);
+
+        void Write(BitWriter& writer) const;
+
+        static constexpr std::uint32_t BitSize();
+
+      private:
+        std::uint8_t flags;
+    };
+
+    FlagsObject::FlagsObject() : flags(0)
+    {
+    }
+
+    FlagsObject::FlagsObject(std::uint8_t newFlags) : flags(newFlags)
+    {
+    }
+
+    void FlagsObject::Write(BitWriter& writer) const
+    {
+        writer.WriteWord(this->flags, 5);
+    }
+
+    constexpr std::uint32_t FlagsObject::BitSize()
+    {
+        return 5;
+    }
+
     typedef telemetry::Telemetry<SimpleObject, ComplexObject> Telemetry;
 
+    typedef telemetry::Telemetry<FlagsObject, SimpleObject, ComplexObject> UnalignedTelemetry;
+
     class TelemetryTest : public testing::Test
     {
       protected:
@@ -269,4 +306,87 @@ namespace
         auto span = writer.Capture();
         ASSERT_THAT(span, Eq(gsl::make_span(expected)));
     }
+
+    TEST_F(TelemetryTest, TestBitOffset)
+    {
+        ASSERT_THAT(Telemetry::BitOffset<SimpleObject>(), Eq(0));
+        ASSERT_THAT(Telemetry::BitOffset<ComplexObject>(), Eq(32));
+        ASSERT_THAT(UnalignedTelemetry::BitOffset<SimpleObject>(), Eq(5));
+        ASSERT_THAT(UnalignedTelemetry::BitOffset<ComplexObject>(), Eq(37));
+    }
+
+    TEST_F(TelemetryTest, TestFullEncodeMatchesWrite)
+    {
+        UnalignedTelemetry unaligned;
+        unaligned.Set(FlagsObject(0x15));
+        unaligned.Set(SimpleObject(0x55aa77ee));
+        unaligned.Set(ComplexObject(0x1234, 0xa5));
+
+        std::array<std::uint8_t, UnalignedTelemetry::TotalSerializedSize> written{};
+        BitWriter writer(written);
+        unaligned.Write(writer);
+        ASSERT_THAT(writer.Status(), Eq(true));
+
+        std::array<std::uint8_t, UnalignedTelemetry::TotalSerializedSize> encoded{};
+        ASSERT_THAT(unaligned.Encode(encoded, true), Eq(true));
+        ASSERT_THAT(encoded, Eq(written));
+    }
+
+    TEST_F(TelemetryTest, TestEncodeWithoutChangesLeavesBufferUntouched)
+    {
+        std::array<std::uint8_t, Telemetry::TotalSerializedSize> buffer{};
+        telemetry.Set(SimpleObject(0x55aa77ee));
+        ASSERT_THAT(telemetry.Encode(buffer, true), Eq(true));
+        ASSERT_THAT(telemetry.Encode(buffer, false), Eq(false));
+        ASSERT_THAT(telemetry.Encode(buffer, true), Eq(false));
+    }
+
+    TEST_F(TelemetryTest, TestEncodeSameValueReportsNoChange)
+    {
+        std::array<std::uint8_t, Telemetry::TotalSerializedSize> buffer{};
+        telemetry.Set(SimpleObject(1));
+        telemetry.Encode(buffer, true);
+
+        telemetry.Set(SimpleObject(1));
+        ASSERT_THAT(telemetry.Encode(buffer, false), Eq(false));
+    }
+
+    TEST_F(TelemetryTest, TestEncodePatchesOnlyUpdatedElement)
+    {
+        UnalignedTelemetry unaligned;
+        unaligned.Set(FlagsObject(0x1f));
+        unaligned.Set(SimpleObject(0xffffffff));
+        unaligned.Set(ComplexObject(0xffff, 0xff));
+
+        std::array<std::uint8_t, UnalignedTelemetry::TotalSerializedSize> encoded{};
+        unaligned.Encode(encoded, true);
+
+        unaligned.Set(SimpleObject(0x12345678));
+        ASSERT_THAT(unaligned.Encode(encoded, false), Eq(true));
+
+        std::array<std::uint8_t, UnalignedTelemetry::TotalSerializedSize> written{};
+        BitWriter writer(written);
+        unaligned.Write(writer);
+        ASSERT_THAT(encoded, Eq(written));
+    }
+
+    TEST_F(TelemetryTest, TestEncodeIncludesVolatileChanges)
+    {
+        std::array<std::uint8_t, Telemetry::TotalSerializedSize> buffer{};
+        std::uint8_t expected[] = {0xee, 0x77, 0xaa, 0x55, 0x00, 0x00, 0x00};
+        telemetry.Encode(buffer, true);
+
+        telemetry.SetVolatile(SimpleObject(0x55aa77ee));
+        ASSERT_THAT(telemetry.Encode(buffer, false), Eq(true));
+        ASSERT_THAT(gsl::make_span(buffer), Eq(gsl::make_span(expected)));
+        ASSERT_THAT(telemetry.IsModified(), Eq(false));
+    }
+
+    TEST_F(TelemetryTest, TestEncodeDoesNotAffectModificationFlag)
+    {
+        std::array<std::uint8_t, Telemetry::TotalSerializedSize> buffer{};
+        telemetry.Set(SimpleObject(1));
+        telemetry.Encode(buffer, false);
+        ASSERT_THAT(telemetry.IsModified(), Eq(true));
+    }
 }
@@ -0,0 +1,151 @@
+#include <array>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "OsMock.hpp"
+#include "os/os.hpp"
+#include "telemetry/cpu_usage.hpp"
+
+namespace
+{
+    using testing::_;
+    using testing::Eq;
+    using testing::Invoke;
+    using testing::Return;
+    using testing::StrEq;
+    using telemetry::CpuUsageMonitor;
+    using telemetry::TaskCpuUsage;
+
+    class CpuUsageMonitorTest : public testing::Test
+    {
+      protected:
+        CpuUsageMonitorTest();
+
+        void ExpectRunTimes(std::uint32_t total, std::uint32_t idle, std::uint32_t comm, std::uint32_t telemetry);
+
+        testing::NiceMock<OSMock> os;
+        OSReset osReset;
+        CpuUsageMonitor monitor;
+    };
+
+    CpuUsageMonitorTest::CpuUsageMonitorTest()
+    {
+        this->osReset = InstallProxy(&os);
+        this->monitor.Initialize();
+    }
+
+    void CpuUsageMonitorTest::ExpectRunTimes(std::uint32_t total, std::uint32_t idle, std::uint32_t comm, std::uint32_t telemetry)
+    {
+        EXPECT_CALL(os, GetTaskRunTimes(_, _))
+            .WillOnce(Invoke([=](gsl::span<TaskRunTime> tasks, std::uint32_t& totalRunTime) -> std::size_t {
+                tasks[0] = TaskRunTime{"IDLE", 1, idle, 200, true};
+                tasks[1] = TaskRunTime{"Comm", 2, comm, 300, false};
+                tasks[2] = TaskRunTime{"Telemetry", 3, telemetry, 400, false};
+                totalRunTime = total;
+                return 3;
+            }));
+    }
+
+    TEST_F(CpuUsageMonitorTest, ShouldCalculateUsageSinceStartUntilWindowIsFilled)
+    {
+        ExpectRunTimes(1000, 600, 100, 300);
+
+        ASSERT_THAT(monitor.Sample(), Eq(true));
+        ASSERT_THAT(monitor.IdleLoad(), Eq(600));
+
+        std::array<TaskCpuUsage, CpuUsageMonitor::MaxTasks> usage;
+        ASSERT_THAT(monitor.Report(usage), Eq(3U));
+
+        ASSERT_THAT(usage[0].Name, StrEq("IDLE"));
+        ASSERT_THAT(usage[0].Load, Eq(600));
+        ASSERT_THAT(usage[1].Name, StrEq("Telemetry"));
+        ASSERT_THAT(usage[1].Load, Eq(300));
+        ASSERT_THAT(usage[1].StackHighWaterMark, Eq(400));
+        ASSERT_THAT(usage[2].Name, StrEq("Comm"));
+        ASSERT_THAT(usage[2].Load, Eq(100));
+        ASSERT_THAT(usage[2].Number, Eq(2U));
+    }
+
+    TEST_F(CpuUsageMonitorTest, ShouldCalculateUsageOverSlidingWindow)
+    {
+        std::uint32_t comm = 0;
+        for (std::uint32_t k = 1; k <= CpuUsageMonitor::WindowSamples; k++)
+        {
+            comm += 100;
+            ExpectRunTimes(1000 * k, 1000 * k - comm, comm, 0);
+            ASSERT_THAT(monitor.Sample(), Eq(true));
+        }
+
+        ASSERT_THAT(monitor.IdleLoad(), Eq(900));
+
+        comm += 900;
+        const std::uint32_t total = 1000 * (CpuUsageMonitor::WindowSamples + 1);
+        ExpectRunTimes(total, total - comm, comm, 0);
+        ASSERT_THAT(monitor.Sample(), Eq(true));
+
+        std::array<TaskCpuUsage, CpuUsageMonitor::MaxTasks> usage;
+        ASSERT_THAT(monitor.Report(usage), Eq(3U));
+
+        ASSERT_THAT(monitor.IdleLoad(), Eq(700));
+        ASSERT_THAT(usage[1].Name, StrEq("Comm"));
+        ASSERT_THAT(usage[1].Load, Eq(300));
+    }
+
+    TEST_F(CpuUsageMonitorTest, ShouldHandleRunTimeCounterOverflow)
+    {
+        const std::uint32_t start = 0xFFFFFFFF - 2500;
+
+        for (std::uint32_t k = 0; k <= CpuUsageMonitor::WindowSamples; k++)
+        {
+            ExpectRunTimes(start + 1000 * k, start - 100 + 750 * k, 0xFFFFFF00 + 250 * k, 7);
+            ASSERT_THAT(monitor.Sample(), Eq(true));
+        }
+
+        std::array<TaskCpuUsage, CpuUsageMonitor::MaxTasks> usage;
+        ASSERT_THAT(monitor.Report(usage), Eq(3U));
+
+        ASSERT_THAT(monitor.IdleLoad(), Eq(750));
+        ASSERT_THAT(usage[1].Load, Eq(250));
+        ASSERT_THAT(usage[2].Load, Eq(0));
+    }
+
+    TEST_F(CpuUsageMonitorTest, ShouldIgnoreSampleWhenStatisticsAreUnavailable)
+    {
+        EXPECT_CALL(os, GetTaskRunTimes(_, _)).WillOnce(Return(0));
+
+        ASSERT_THAT(monitor.Sample(), Eq(false));
+
+        std::array<TaskCpuUsage, CpuUsageMonitor::MaxTasks> usage;
+        ASSERT_THAT(monitor.Report(usage), Eq(0U));
+    }
+
+    TEST_F(CpuUsageMonitorTest, ShouldLimitReportToBufferSize)
+    {
+        ExpectRunTimes(1000, 600, 100, 300);
+        monitor.Sample();
+
+        std::array<TaskCpuUsage, 2> usage;
+        ASSERT_THAT(monitor.Report(usage), Eq(2U));
+        ASSERT_THAT(usage[1].Name, StrEq("Telemetry"));
+    }
+
+    TEST_F(CpuUsageMonitorTest, ShouldNotReportWhenLockIsNotAcquired)
+    {
+        ExpectRunTimes(1000, 600, 100, 300);
+        monitor.Sample();
+
+        EXPECT_CALL(os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Timeout));
+
+        std::array<TaskCpuUsage, CpuUsageMonitor::MaxTasks> usage;
+        ASSERT_THAT(monitor.Report(usage), Eq(0U));
+    }
+
+    TEST_F(CpuUsageMonitorTest, ShouldNotReportIdleLoadWhenLockIsNotAcquired)
+    {
+        ExpectRunTimes(1000, 600, 100, 300);
+        monitor.Sample();
+
+        EXPECT_CALL(os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Timeout));
+
+        ASSERT_THAT(monitor.IdleLoad(), Eq(0));
+    }
+}
@@ -15,18 +15,26 @@ namespace
 
     using namespace services::fs;
 
+    struct YaffsMemoryPoolsMock : public IYaffsMemoryPools
+    {
+        MOCK_METHOD1(Allocate, void*(std::size_t size));
+        MOCK_METHOD1(Free, void(void* pointer));
+        MOCK_METHOD0(Statistics, YaffsMemoryStatistics());
+    };
+
     class FileSystemTelemetryAcquisitionTest : public testing::Test
     {
       protected:
         FileSystemTelemetryAcquisitionTest();
         mission::UpdateResult Run();
         FsMock mock;
+        testing::NiceMock<YaffsMemoryPoolsMock> pools;
         telemetry::TelemetryState state;
         telemetry::FileSystemTelemetryAcquisition task;
         mission::UpdateDescriptor<telemetry::TelemetryState> descriptor;
     };
 
-    FileSystemTelemetryAcquisitionTest::FileSystemTelemetryAcquisitionTest() : task(mock), descriptor(task.BuildUpdate())
+    FileSystemTelemetryAcquisitionTest::FileSystemTelemetryAcquisitionTest() : task(std::tie(mock, pools)), descriptor(task.BuildUpdate())
     {
     }
 
@@ -57,4 +65,15 @@ namespace
         ASSERT_THAT(state.telemetry.Get<telemetry::FileSystemTelemetry>().GetValue(), Eq(0x12345678u));
         ASSERT_THAT(state.telemetry.IsModified(), Eq(true));
     }
+
+    TEST_F(FileSystemTelemetryAcquisitionTest, TestPoolsExhaustionAcquisition)
+    {
+        YaffsMemoryStatistics statistics{};
+        statistics.Tnodes.Exhaustions = 2;
+
+        EXPECT_CALL(mock, GetFreeSpace(_)).WillOnce(Return(0x12345678u));
+        EXPECT_CALL(pools, Statistics()).WillOnce(Return(statistics));
+        Run();
+        ASSERT_THAT(state.telemetry.Get<telemetry::FileSystemPoolsExhausted>().GetValue(), Eq(true));
+    }
 }
@@ -269,6 +269,25 @@ namespace
         }
     }
 
+    TEST_F(ImtqTelemetryCollectorTest, TestEndMagnetometerMeasurementTelemetry)
+    {
+        MockTelemetryLock();
+        MagnetometerMeasurementToken token;
+        Vector3<MagnetometerMeasurement> result;
+        EXPECT_CALL(driver, BeginMagnetometerMeasurement(_)).WillOnce(Return(true));
+        EXPECT_CALL(driver, EndMagnetometerMeasurement(_, _)).WillOnce(Invoke([](auto& /*token*/, auto& result) {
+            result = Vector3<MagnetometerMeasurement>{4, 5, 6};
+            return true;
+        }));
+
+        ASSERT_THAT(collector.BeginMagnetometerMeasurement(token), Eq(true));
+        ASSERT_THAT(collector.EndMagnetometerMeasurement(token, result), Eq(true));
+
+        ImtqMagnetometerMeasurements telemetry;
+        Capture(telemetry, ElementId::Magnetometer);
+        EXPECT_THAT(telemetry.GetValue(), Eq(Vector3<MagnetometerMeasurement>{4, 5, 6}));
+    }
+
     TEST_F(ImtqTelemetryCollectorTest, TestSoftwareReset)
     {
         MockNoLocking();
@@ -7,8 +7,10 @@
 
 namespace
 {
+    using testing::_;
     using testing::Return;
     using testing::Eq;
+    using testing::Invoke;
 
     using namespace std::chrono_literals;
 
@@ -19,11 +21,12 @@ namespace
         mission::UpdateResult Run();
         OSMock os;
         telemetry::TelemetryState state;
+        telemetry::CpuUsageMonitor cpuUsage;
         telemetry::SystemTelemetryAcquisition task;
         mission::UpdateDescriptor<telemetry::TelemetryState> descriptor;
     };
 
-    SystemTelemetryAcquisitionTest::SystemTelemetryAcquisitionTest() : task(0), descriptor(task.BuildUpdate())
+    SystemTelemetryAcquisitionTest::SystemTelemetryAcquisitionTest() : task(cpuUsage), descriptor(task.BuildUpdate())
     {
     }
 
@@ -36,9 +39,30 @@ namespace
     {
         auto guard = InstallProxy(&os);
         EXPECT_CALL(os, GetUptime()).WillOnce(Return(0x1234567ms));
+        EXPECT_CALL(os, GetTaskRunTimes(_, _)).WillOnce(Return(0));
         const auto result = Run();
         ASSERT_THAT(result, Eq(mission::UpdateResult::Ok));
         ASSERT_THAT(state.telemetry.IsModified(), Eq(true));
         ASSERT_THAT(state.telemetry.Get<telemetry::OSState>().GetValue().Value(), Eq(0x1234567u / 1000));
+        ASSERT_THAT(state.telemetry.Get<telemetry::OSIdleTime>().GetValue().Value(), Eq(0));
+    }
+
+    TEST_F(SystemTelemetryAcquisitionTest, TestIdleTimeAcquisition)
+    {
+        auto guard = InstallProxy(&os);
+        EXPECT_CALL(os, GetUptime()).WillOnce(Return(0ms));
+        // sample publishes and idle load reads under the same lock
+        EXPECT_CALL(os, TakeSemaphore(_, _)).Times(2).WillRepeatedly(Return(OSResult::Success));
+        EXPECT_CALL(os, GiveSemaphore(_)).Times(2).WillRepeatedly(Return(OSResult::Success));
+        EXPECT_CALL(os, GetTaskRunTimes(_, _)).WillOnce(Invoke([](gsl::span<TaskRunTime> tasks, std::uint32_t& totalRunTime) {
+            tasks[0] = TaskRunTime{"IDLE", 1, 8765, 100, true};
+            tasks[1] = TaskRunTime{"Comm", 2, 1235, 100, false};
+            totalRunTime = 10000;
+            return std::size_t(2);
+        }));
+
+        const auto result = Run();
+        ASSERT_THAT(result, Eq(mission::UpdateResult::Ok));
+        ASSERT_THAT(state.telemetry.Get<telemetry::OSIdleTime>().GetValue().Value(), Eq(88));
     }
 }